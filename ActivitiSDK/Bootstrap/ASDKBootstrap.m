@@ -56,6 +56,9 @@
 #import "ASDKCSRFTokenStorage.h"
 #import "ASDKFilterParserOperationWorker.h"
 #import "ASDKPersistenceStack.h"
+#import "ASDKPersistenceStoreManager.h"
+#import "ASDKCacheMaintenanceService.h"
+#import "ASDKModelCache.h"
 #import "ASDKNetworkDelayedOperationSaveFormService.h"
 
 // Configurations imports
@@ -74,6 +77,12 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
 
 @property (strong, nonatomic) ASDKRequestOperationManager   *requestOperationManager;
 
+/**
+ *  Property meant to hold a reference to the manager keeping recently used persistence
+ *  stores open between account switches
+ */
+@property (strong, nonatomic) ASDKPersistenceStoreManager   *persistenceStoreManager;
+
 @end
 
 @implementation ASDKBootstrap
@@ -98,6 +107,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     if (self) {
         _serviceLocator = [ASDKServiceLocator new];
         ASDKLogVerbose(@"Service locator component...%@", _serviceLocator ? @"OK" : @"NOT_OK");
+        
+        _persistenceStoreManager = [ASDKPersistenceStoreManager new];
+        [_serviceLocator addService:_persistenceStoreManager];
     }
     
     return self;
@@ -108,11 +120,51 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
 #pragma mark Public interface
 
 - (void)setupServicesWithServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration {
+    BOOL isSameServer = self.requestOperationManager && [self isServerConfiguration:serverConfiguration
+                                                                 onSameServerAs:_serverConfiguration];
     _serverConfiguration = serverConfiguration;
     
     // Register available services with the service locator repository
     ASDKLogVerbose(@"Registering services...");
     
+    // Switching between accounts of the same server only swaps the credentials
+    // of the existing network services
+    if (isSameServer) {
+        ASDKLogVerbose(@"Reusing network services for server:%@", serverConfiguration.hostAddressString);
+        
+        ASDKBasicAuthentificationProvider *authenticationProvider =
+        [[ASDKBasicAuthentificationProvider alloc] initWithUserName:serverConfiguration.username
+                                                           password:serverConfiguration.password];
+        [self.requestOperationManager replaceAuthenticationProvider:authenticationProvider];
+    } else {
+        [self setupNetworkServices];
+    }
+    
+    // Set up form services
+    [self setupFormColorSchemeManager];
+    
+    // Set up persistence services
+    [self setupPersistenceStack];
+    [self setupCacheMaintenanceService];
+    [self setupModelCache];
+}
+
+- (void)updateServerConfigurationCredentialsForUsername:(NSString *)username
+                                               password:(NSString *)password {
+    _serverConfiguration.username = username;
+    _serverConfiguration.password = password;
+    
+    ASDKBasicAuthentificationProvider *authenticationProvider =
+    [[ASDKBasicAuthentificationProvider alloc] initWithUserName:username
+                                                       password:password];
+    [self.requestOperationManager replaceAuthenticationProvider:authenticationProvider];
+}
+
+
+#pragma mark -
+#pragma mark Private interface
+
+- (void)setupNetworkServices {
     // Create a service path factory with the passed server configuration
     ASDKServicePathFactory *servicePathFactory = [[ASDKServicePathFactory alloc] initWithHostAddress:self.serverConfiguration.hostAddressString
                                                                                  serviceDocumentPath:self.serverConfiguration.serviceDocument
@@ -177,29 +229,16 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
                                                       parserManager:parserOperationManager
                                                  servicePathFactory:servicePathFactory
                                                        diskServices:diskService];
-    
-    // Set up form services
-    [self setupFormColorSchemeManager];
-    
-    // Set up persistence services
-    [self setupPersistenceStack];
 }
 
-- (void)updateServerConfigurationCredentialsForUsername:(NSString *)username
-                                               password:(NSString *)password {
-    _serverConfiguration.username = username;
-    _serverConfiguration.password = password;
-    
-    ASDKBasicAuthentificationProvider *authenticationProvider =
-    [[ASDKBasicAuthentificationProvider alloc] initWithUserName:username
-                                                       password:password];
-    [self.requestOperationManager replaceAuthenticationProvider:authenticationProvider];
+- (BOOL)isServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration
+               onSameServerAs:(ASDKModelServerConfiguration *)otherServerConfiguration {
+    return ([serverConfiguration.hostAddressString isEqualToString:otherServerConfiguration.hostAddressString] &&
+            [serverConfiguration.serviceDocument isEqualToString:otherServerConfiguration.serviceDocument] &&
+            ((!serverConfiguration.port && !otherServerConfiguration.port) || [serverConfiguration.port isEqualToString:otherServerConfiguration.port]) &&
+            serverConfiguration.isCommunicationOverSecureLayer == otherServerConfiguration.isCommunicationOverSecureLayer) ? YES : NO;
 }
 
-
-#pragma mark -
-#pragma mark Private interface
-
 - (ASDKParserOperationManager *)parserOperationManager {
     ASDKParserOperationManager *parserOperationManager = [ASDKParserOperationManager new];
     
@@ -440,17 +479,54 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
 }
 
 - (void)setupPersistenceStack {
-    ASDKPersistenceStack *persistenceStack = [[ASDKPersistenceStack alloc] initWithServerConfiguration:self.serverConfiguration
-                                                                                          errorHandler:^(NSError *error) {
+    // Stores of recently used accounts are still open and are reused warm
+    id<ASDKPersistenceStackProtocol> persistenceStack =
+    [self.persistenceStoreManager activatePersistenceStackForServerConfiguration:self.serverConfiguration
+                                                                    errorHandler:^(NSError *error) {
         ASDKLogVerbose(@"Persistence stack...%@", error ? @"NOT_OK" : @"OK");
         if (error) {
             ASDKLogError(@"Reason:%@", error.localizedDescription);
         }
     }];
+    if (!persistenceStack) {
+        [_serviceLocator removeServiceConformingToProtocol:@protocol(ASDKPersistenceStackProtocol)];
+        return;
+    }
+    
     if ([_serviceLocator isServiceRegisteredForProtocol:@protocol(ASDKPersistenceStackProtocol)]) {
         [_serviceLocator removeService:persistenceStack];
     }
     [_serviceLocator addService:persistenceStack];
 }
 
+- (void)setupCacheMaintenanceService {
+    id<ASDKCacheMaintenanceServiceProtocol> cacheMaintenanceService = self.persistenceStoreManager.activeCacheMaintenanceService;
+    if (!cacheMaintenanceService) {
+        [_serviceLocator removeServiceConformingToProtocol:@protocol(ASDKCacheMaintenanceServiceProtocol)];
+        return;
+    }
+    
+    if ([_serviceLocator isServiceRegisteredForProtocol:@protocol(ASDKCacheMaintenanceServiceProtocol)]) {
+        [_serviceLocator removeService:cacheMaintenanceService];
+    }
+    [_serviceLocator addService:cacheMaintenanceService];
+    
+    ASDKLogVerbose(@"Cache maintenance service...%@", cacheMaintenanceService ? @"OK" : @"NOT_OK");
+}
+
+- (void)setupModelCache {
+    id<ASDKModelCacheProtocol> modelCache = self.persistenceStoreManager.activeModelCache;
+    if (!modelCache) {
+        [_serviceLocator removeServiceConformingToProtocol:@protocol(ASDKModelCacheProtocol)];
+        return;
+    }
+    
+    if ([_serviceLocator isServiceRegisteredForProtocol:@protocol(ASDKModelCacheProtocol)]) {
+        [_serviceLocator removeService:modelCache];
+    }
+    [_serviceLocator addService:modelCache];
+    
+    ASDKLogVerbose(@"Model cache...%@", modelCache ? @"OK" : @"NOT_OK");
+}
+
 @end
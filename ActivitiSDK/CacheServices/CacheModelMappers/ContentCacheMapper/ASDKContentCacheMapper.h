@@ -17,6 +17,8 @@
  ******************************************************************************/
 
 #import <Foundation/Foundation.h>
+#import "ASDKPersistenceStackConstants.h"
+@import CoreData;
 
 @class ASDKMOContent, ASDKModelContent;
 
@@ -25,5 +27,17 @@
 + (ASDKMOContent *)mapContent:(ASDKModelContent *)content
                     toCacheMO:(ASDKMOContent *)moContent;
 + (ASDKModelContent *)mapCacheMOToContent:(ASDKMOContent *)moContent;
++ (ASDKModelContent *)mapCacheMOToContent:(ASDKMOContent *)moContent
+                           mappingProfile:(ASDKCacheMappingProfile)mappingProfile;
+
+/**
+ *  Configures the passed content fetch request so that the properties and
+ *  relationships read when mapping with the given profile are fetched upfront.
+ *
+ *  @param fetchRequest   Fetch request targeting content managed objects
+ *  @param mappingProfile Mapping profile the fetched content will be mapped with
+ */
++ (void)configureFetchRequest:(NSFetchRequest *)fetchRequest
+            forMappingProfile:(ASDKCacheMappingProfile)mappingProfile;
 
 @end
@@ -47,6 +47,12 @@
 }
 
 + (ASDKModelContent *)mapCacheMOToContent:(ASDKMOContent *)moContent {
+    return [self mapCacheMOToContent:moContent
+                      mappingProfile:ASDKCacheMappingProfileDetails];
+}
+
++ (ASDKModelContent *)mapCacheMOToContent:(ASDKMOContent *)moContent
+                           mappingProfile:(ASDKCacheMappingProfile)mappingProfile {
     ASDKModelContent *content = [ASDKModelContent new];
     content.modelID = moContent.modelID;
     content.contentName = moContent.contentName;
@@ -61,11 +67,24 @@
     content.creationDate = moContent.creationDate;
     
     if (moContent.owner) {
-        ASDKModelProfile *profile = [ASDKProfileCacheMapper mapCacheMOToProfile:moContent.owner];
+        ASDKModelProfile *profile = [ASDKProfileCacheMapper mapCacheMOToProfile:moContent.owner
+                                                                 mappingProfile:mappingProfile];
         content.owner = profile;
     }
     
     return content;
 }
 
++ (void)configureFetchRequest:(NSFetchRequest *)fetchRequest
+            forMappingProfile:(ASDKCacheMappingProfile)mappingProfile {
+    if (ASDKCacheMappingProfileListSummary == mappingProfile) {
+        fetchRequest.propertiesToFetch = @[@"modelID", @"contentName", @"isModelContentAvailable", @"isLink",
+                                           @"mimeType", @"displayType", @"previewStatus", @"thumbnailStatus",
+                                           @"source", @"sourceID", @"creationDate", @"owner"];
+        fetchRequest.relationshipKeyPathsForPrefetching = @[@"owner"];
+    } else {
+        fetchRequest.relationshipKeyPathsForPrefetching = @[@"owner", @"owner.groups"];
+    }
+}
+
 @end
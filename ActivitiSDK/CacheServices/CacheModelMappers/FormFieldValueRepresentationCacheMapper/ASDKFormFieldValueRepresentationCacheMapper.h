@@ -19,7 +19,9 @@
 #import <Foundation/Foundation.h>
 
 @class ASDKMOFormFieldValueRepresentation,
-ASDKFormFieldValueRequestRepresentation;
+ASDKMOFormFieldValue,
+ASDKFormFieldValueRequestRepresentation,
+ASDKFormSaveJournalEntry;
 
 @interface ASDKFormFieldValueRepresentationCacheMapper : NSObject
 
@@ -29,4 +31,15 @@ ASDKFormFieldValueRequestRepresentation;
 
 + (ASDKFormFieldValueRequestRepresentation *)mapCacheMOToFormFieldValueRepresentation:(ASDKMOFormFieldValueRepresentation *)moFormFieldValueRepresentation;
 
++ (ASDKFormSaveJournalEntry *)mapCacheMOToFormSaveJournalEntry:(ASDKMOFormFieldValueRepresentation *)moFormFieldValueRepresentation;
+
++ (ASDKMOFormFieldValue *)mapFormFieldValue:(id)formFieldValue
+                             forFormFieldID:(NSString *)formFieldID
+                              forTaskWithID:(NSString *)taskID
+                                  toCacheMO:(ASDKMOFormFieldValue *)moFormFieldValue;
+
++ (id)mapCacheMOToFormFieldValue:(ASDKMOFormFieldValue *)moFormFieldValue;
+
++ (NSString *)encodedFormFieldValue:(id)formFieldValue;
+
 @end
@@ -20,7 +20,9 @@
 
 // Models
 #import "ASDKMOFormFieldValueRepresentation.h"
+#import "ASDKMOFormFieldValue.h"
 #import "ASDKFormFieldValueRequestRepresentation.h"
+#import "ASDKFormSaveJournalEntry.h"
 
 @implementation ASDKFormFieldValueRepresentationCacheMapper
 
@@ -29,7 +31,9 @@
                                                               toCacheMO:(ASDKMOFormFieldValueRepresentation *)moFormFieldValueRepresentation {
     moFormFieldValueRepresentation.taskID = taskID;
     moFormFieldValueRepresentation.outcome = formFieldValueRepresentation.outcome;
-    moFormFieldValueRepresentation.formFields = formFieldValueRepresentation.formFields;
+    
+    // Form field values are persisted as individual ASDKMOFormFieldValue rows
+    moFormFieldValueRepresentation.formFields = nil;
     
     return moFormFieldValueRepresentation;
 }
@@ -37,10 +41,77 @@
 + (ASDKFormFieldValueRequestRepresentation *)mapCacheMOToFormFieldValueRepresentation:(ASDKMOFormFieldValueRepresentation *)moFormFieldValueRepresentation {
     ASDKFormFieldValueRequestRepresentation *formFieldValueRepresentation = [ASDKFormFieldValueRequestRepresentation new];
     formFieldValueRepresentation.outcome = moFormFieldValueRepresentation.outcome;
-    formFieldValueRepresentation.formFields = (NSArray *)moFormFieldValueRepresentation.formFields;
+    
+    // Representations journaled before form field values were split into rows
+    // still carry the archived form field models
+    if (moFormFieldValueRepresentation.formFields) {
+        formFieldValueRepresentation.formFields = (NSArray *)moFormFieldValueRepresentation.formFields;
+    } else {
+        NSMutableDictionary *formFieldValues = [NSMutableDictionary dictionary];
+        for (ASDKMOFormFieldValue *moFormFieldValue in moFormFieldValueRepresentation.formFieldValues) {
+            id formFieldValue = [self mapCacheMOToFormFieldValue:moFormFieldValue];
+            if (formFieldValue && moFormFieldValue.formFieldID) {
+                formFieldValues[moFormFieldValue.formFieldID] = formFieldValue;
+            }
+        }
+        formFieldValueRepresentation.formFieldValues = formFieldValues;
+    }
     formFieldValueRepresentation.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
     
     return formFieldValueRepresentation;
 }
 
++ (ASDKFormSaveJournalEntry *)mapCacheMOToFormSaveJournalEntry:(ASDKMOFormFieldValueRepresentation *)moFormFieldValueRepresentation {
+    ASDKFormSaveJournalEntry *journalEntry = [ASDKFormSaveJournalEntry new];
+    journalEntry.taskID = moFormFieldValueRepresentation.taskID;
+    journalEntry.formFieldValueRequestRepresentation = [self mapCacheMOToFormFieldValueRepresentation:moFormFieldValueRepresentation];
+    journalEntry.revision = moFormFieldValueRepresentation.revision;
+    journalEntry.attemptCount = moFormFieldValueRepresentation.attemptCount;
+    journalEntry.journalDate = moFormFieldValueRepresentation.journalDate;
+    journalEntry.nextAttemptDate = moFormFieldValueRepresentation.nextAttemptDate;
+    
+    return journalEntry;
+}
+
++ (ASDKMOFormFieldValue *)mapFormFieldValue:(id)formFieldValue
+                             forFormFieldID:(NSString *)formFieldID
+                              forTaskWithID:(NSString *)taskID
+                                  toCacheMO:(ASDKMOFormFieldValue *)moFormFieldValue {
+    moFormFieldValue.formFieldID = formFieldID;
+    moFormFieldValue.taskID = taskID;
+    moFormFieldValue.value = [self encodedFormFieldValue:formFieldValue];
+    
+    return moFormFieldValue;
+}
+
++ (id)mapCacheMOToFormFieldValue:(ASDKMOFormFieldValue *)moFormFieldValue {
+    NSData *encodedValueData = [moFormFieldValue.value dataUsingEncoding:NSUTF8StringEncoding];
+    if (!encodedValueData) {
+        return nil;
+    }
+    
+    NSArray *valueContainer = [NSJSONSerialization JSONObjectWithData:encodedValueData
+                                                              options:0
+                                                                error:nil];
+    return [valueContainer isKindOfClass:NSArray.class] ? valueContainer.firstObject : nil;
+}
+
++ (NSString *)encodedFormFieldValue:(id)formFieldValue {
+    // Values can be strings, numbers or JSON containers like people or dynamic table
+    // rows, so they're wrapped in an array to always form a valid JSON document.
+    // Keys are sorted to get a stable encoding that can be compared for changes.
+    // Values that couldn't be submitted as JSON are not persisted either.
+    NSArray *valueContainer = formFieldValue ? @[formFieldValue] : nil;
+    if (!valueContainer ||
+        ![NSJSONSerialization isValidJSONObject:valueContainer]) {
+        return nil;
+    }
+    
+    NSData *encodedValueData = [NSJSONSerialization dataWithJSONObject:valueContainer
+                                                               options:NSJSONWritingSortedKeys
+                                                                 error:nil];
+    return [[NSString alloc] initWithData:encodedValueData
+                                 encoding:NSUTF8StringEncoding];
+}
+
 @end
@@ -17,6 +17,7 @@
  ******************************************************************************/
 
 #import <Foundation/Foundation.h>
+#import "ASDKPersistenceStackConstants.h"
 @import CoreData;
 
 @class ASDKModelProcessInstance, ASDKMOProcessInstance;
@@ -25,6 +26,19 @@
 
 + (ASDKMOProcessInstance *)mapProcessInstance:(ASDKModelProcessInstance *)processInstance
               toCacheMO:(ASDKMOProcessInstance *)moProcessInstance;
++ (NSDictionary *)mapProcessInstanceToBatchInsertAttributes:(ASDKModelProcessInstance *)processInstance;
 + (ASDKModelProcessInstance *)mapCacheMOToProcessInstance:(ASDKMOProcessInstance *)moProcessInstance;
++ (ASDKModelProcessInstance *)mapCacheMOToProcessInstance:(ASDKMOProcessInstance *)moProcessInstance
+                                           mappingProfile:(ASDKCacheMappingProfile)mappingProfile;
+
+/**
+ *  Configures the passed process instance fetch request so that the properties and
+ *  relationships read when mapping with the given profile are fetched upfront.
+ *
+ *  @param fetchRequest   Fetch request targeting process instance managed objects
+ *  @param mappingProfile Mapping profile the fetched process instances will be mapped with
+ */
++ (void)configureFetchRequest:(NSFetchRequest *)fetchRequest
+            forMappingProfile:(ASDKCacheMappingProfile)mappingProfile;
 
 @end
@@ -56,7 +56,32 @@
     return moProcessInstance;
 }
 
++ (NSDictionary *)mapProcessInstanceToBatchInsertAttributes:(ASDKModelProcessInstance *)processInstance {
+    NSMutableDictionary *attributes = [NSMutableDictionary dictionary];
+    [attributes setValue:processInstance.modelID forKey:@"modelID"];
+    [attributes setValue:processInstance.name forKey:@"name"];
+    [attributes setValue:processInstance.endDate forKey:@"endDate"];
+    [attributes setValue:processInstance.startDate forKey:@"startDate"];
+    [attributes setValue:processInstance.tenantID forKey:@"tenantID"];
+    [attributes setValue:@(processInstance.processDefinitionVersion) forKey:@"processDefinitionVersion"];
+    [attributes setValue:processInstance.processDefinitionCategory forKey:@"processDefinitionCategory"];
+    [attributes setValue:processInstance.processDefinitionDeploymentID forKey:@"processDefinitionDeploymentID"];
+    [attributes setValue:processInstance.processDefinitionDescription forKey:@"processDefinitionDescription"];
+    [attributes setValue:processInstance.processDefinitionID forKey:@"processDefinitionID"];
+    [attributes setValue:processInstance.processDefinitionKey forKey:@"processDefinitionKey"];
+    [attributes setValue:processInstance.processDefinitionName forKey:@"processDefinitionName"];
+    [attributes setValue:@(processInstance.isStartFormDefined) forKey:@"isStartFormDefined"];
+    
+    return attributes;
+}
+
 + (ASDKModelProcessInstance *)mapCacheMOToProcessInstance:(ASDKMOProcessInstance *)moProcessInstance {
+    return [self mapCacheMOToProcessInstance:moProcessInstance
+                              mappingProfile:ASDKCacheMappingProfileDetails];
+}
+
++ (ASDKModelProcessInstance *)mapCacheMOToProcessInstance:(ASDKMOProcessInstance *)moProcessInstance
+                                           mappingProfile:(ASDKCacheMappingProfile)mappingProfile {
     ASDKModelProcessInstance *processInstance = [ASDKModelProcessInstance new];
     processInstance.modelID = moProcessInstance.modelID;
     processInstance.name = moProcessInstance.name;
@@ -73,11 +98,26 @@
     processInstance.isStartFormDefined = moProcessInstance.isStartFormDefined;
     
     if (moProcessInstance.initiator) {
-        ASDKModelProfile *profile = [ASDKProfileCacheMapper mapCacheMOToProfile:moProcessInstance.initiator];
+        ASDKModelProfile *profile = [ASDKProfileCacheMapper mapCacheMOToProfile:moProcessInstance.initiator
+                                                                 mappingProfile:mappingProfile];
         processInstance.initiatorModel = profile;
     }
     
     return processInstance;
 }
 
++ (void)configureFetchRequest:(NSFetchRequest *)fetchRequest
+            forMappingProfile:(ASDKCacheMappingProfile)mappingProfile {
+    if (ASDKCacheMappingProfileListSummary == mappingProfile) {
+        fetchRequest.propertiesToFetch = @[@"modelID", @"name", @"endDate", @"startDate", @"tenantID",
+                                           @"processDefinitionVersion", @"processDefinitionCategory",
+                                           @"processDefinitionDeploymentID", @"processDefinitionDescription",
+                                           @"processDefinitionID", @"processDefinitionKey",
+                                           @"processDefinitionName", @"isStartFormDefined", @"initiator"];
+        fetchRequest.relationshipKeyPathsForPrefetching = @[@"initiator"];
+    } else {
+        fetchRequest.relationshipKeyPathsForPrefetching = @[@"initiator", @"initiator.groups"];
+    }
+}
+
 @end
@@ -17,6 +17,7 @@
  ******************************************************************************/
 
 #import <Foundation/Foundation.h>
+#import "ASDKPersistenceStackConstants.h"
 
 @class ASDKMOProfile,
 ASDKModelProfile,
@@ -26,9 +27,12 @@ ASDKMOCurrentProfile;
 
 + (ASDKMOProfile *)mapProfile:(ASDKModelProfile *)profile
                     toCacheMO:(ASDKMOProfile *)moProfile;
++ (NSDictionary *)mapProfileToBatchInsertAttributes:(ASDKModelProfile *)profile;
 + (ASDKMOCurrentProfile *)mapCacheMOProfile:(ASDKMOProfile *)moProfile
              toCurrentProfileCacheMO:(ASDKMOCurrentProfile *)moCurrentProfile;
 + (ASDKModelProfile *)mapCacheMOToProfile:(ASDKMOProfile *)moProfile;
++ (ASDKModelProfile *)mapCacheMOToProfile:(ASDKMOProfile *)moProfile
+                           mappingProfile:(ASDKCacheMappingProfile)mappingProfile;
 + (ASDKModelProfile *)mapCacheMOToProfileProxy:(ASDKMOProfile *)moProfile;
 
 @end
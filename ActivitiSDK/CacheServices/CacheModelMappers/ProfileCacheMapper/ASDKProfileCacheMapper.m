@@ -53,6 +53,25 @@
     return moProfile;
 }
 
++ (NSDictionary *)mapProfileToBatchInsertAttributes:(ASDKModelProfile *)profile {
+    NSMutableDictionary *attributes = [NSMutableDictionary dictionary];
+    [attributes setValue:profile.modelID forKey:@"modelID"];
+    [attributes setValue:profile.tenantID forKey:@"tenantID"];
+    [attributes setValue:profile.tenantName forKey:@"tenantName"];
+    [attributes setValue:profile.tenantPictureID forKey:@"tenantPictureID"];
+    [attributes setValue:profile.userFirstName forKey:@"userFirstName"];
+    [attributes setValue:profile.userLastName forKey:@"userLastName"];
+    [attributes setValue:profile.email forKey:@"email"];
+    [attributes setValue:profile.companyName forKey:@"companyName"];
+    [attributes setValue:profile.externalID forKey:@"externalID"];
+    [attributes setValue:profile.pictureID forKey:@"pictureID"];
+    [attributes setValue:@(profile.profileState) forKey:@"profileState"];
+    [attributes setValue:profile.creationDate forKey:@"creationDate"];
+    [attributes setValue:profile.lastUpdate forKey:@"lastUpdate"];
+    
+    return attributes;
+}
+
 + (ASDKMOCurrentProfile *)mapCacheMOProfile:(ASDKMOProfile *)moProfile
                     toCurrentProfileCacheMO:(ASDKMOCurrentProfile *)moCurrentProfile {
     moCurrentProfile.profile = moProfile;
@@ -61,6 +80,12 @@
 
 
 + (ASDKModelProfile *)mapCacheMOToProfile:(ASDKMOProfile *)moProfile {
+    return [self mapCacheMOToProfile:moProfile
+                      mappingProfile:ASDKCacheMappingProfileDetails];
+}
+
++ (ASDKModelProfile *)mapCacheMOToProfile:(ASDKMOProfile *)moProfile
+                           mappingProfile:(ASDKCacheMappingProfile)mappingProfile {
     ASDKModelProfile *profile = [ASDKModelProfile new];
     profile.modelID = moProfile.modelID;
     profile.tenantID = moProfile.tenantID;
@@ -76,7 +101,9 @@
     profile.creationDate = moProfile.creationDate;
     profile.lastUpdate = moProfile.lastUpdate;
     
-    if (moProfile.groups.count) {
+    // Group membership is not displayed in lists and would fire a fault per profile
+    if (ASDKCacheMappingProfileDetails == mappingProfile &&
+        moProfile.groups.count) {
         ASDKGroupCacheMapper *groupMapper = [ASDKGroupCacheMapper new];
         NSMutableArray *groups = [NSMutableArray array];
         for (ASDKMOGroup *moGroup in moProfile.groups) {
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+@interface ASDKSearchTokensCacheMapper : NSObject
+
+/**
+ *  Returns the normalized search tokens of the passed string as stored in the
+ *  searchTokens column of cached entities. The string is lowercased, diacritic and
+ *  width folded and split on anything that is not a letter or a digit. Tokens are
+ *  joined by a single space.
+ *
+ *  @param string String to be tokenized, usually the name of the entity
+ *
+ *  @return       Space separated normalized tokens or nil if none were found
+ */
++ (NSString *)searchTokensForString:(NSString *)string;
+
+/**
+ *  Returns a predicate matching entities whose searchTokens column has, for every
+ *  token in the passed query, a token starting with it. Entities cached before the
+ *  column was introduced have no search tokens and fall back to matching the passed
+ *  name key path against the raw query.
+ *
+ *  @param query       Search text as typed by the user
+ *  @param nameKeyPath Key path of the attribute the search tokens were built from
+ *
+ *  @return            Predicate to be evaluated by the store or nil for an empty query
+ */
++ (NSPredicate *)searchTokensPredicateForQuery:(NSString *)query
+                                   nameKeyPath:(NSString *)nameKeyPath;
+
+@end
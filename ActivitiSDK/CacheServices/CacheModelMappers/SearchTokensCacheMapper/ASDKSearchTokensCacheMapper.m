@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKSearchTokensCacheMapper.h"
+
+static NSString * const kASDKSearchTokensSeparator = @" ";
+
+@implementation ASDKSearchTokensCacheMapper
+
+
+#pragma mark -
+#pragma mark Public interface
+
++ (NSString *)searchTokensForString:(NSString *)string {
+    NSArray *tokens = [self normalizedTokensForString:string];
+    return tokens.count ? [tokens componentsJoinedByString:kASDKSearchTokensSeparator] : nil;
+}
+
++ (NSPredicate *)searchTokensPredicateForQuery:(NSString *)query
+                                   nameKeyPath:(NSString *)nameKeyPath {
+    NSArray *queryTokens = [self normalizedTokensForString:query];
+    if (!queryTokens.count) {
+        return nil;
+    }
+    
+    /* The first token of a row is matched with BEGINSWITH and any other token of the
+     * row by its leading separator. The store still scans the rows, but both sides
+     * are already folded so the per-row [cd] comparison of the name is avoided.
+     */
+    NSMutableArray *tokenPredicates = [NSMutableArray array];
+    for (NSString *queryToken in queryTokens) {
+        NSString *innerQueryToken = [kASDKSearchTokensSeparator stringByAppendingString:queryToken];
+        [tokenPredicates addObject:[NSPredicate predicateWithFormat:@"searchTokens BEGINSWITH %@ OR searchTokens CONTAINS %@", queryToken, innerQueryToken]];
+    }
+    NSPredicate *searchTokensPredicate = [[NSCompoundPredicate alloc] initWithType:NSAndPredicateType
+                                                                     subpredicates:tokenPredicates];
+    
+    NSPredicate *legacyPredicate = [NSPredicate predicateWithFormat:@"searchTokens == nil AND %K CONTAINS[cd] %@", nameKeyPath, query];
+    
+    return [[NSCompoundPredicate alloc] initWithType:NSOrPredicateType
+                                       subpredicates:@[searchTokensPredicate, legacyPredicate]];
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
++ (NSArray *)normalizedTokensForString:(NSString *)string {
+    if (!string.length) {
+        return nil;
+    }
+    
+    NSString *foldedString = [string stringByFoldingWithOptions:NSCaseInsensitiveSearch | NSDiacriticInsensitiveSearch | NSWidthInsensitiveSearch
+                                                         locale:nil];
+    NSCharacterSet *separatorCharacterSet = [[NSCharacterSet alphanumericCharacterSet] invertedSet];
+    NSArray *components = [foldedString.lowercaseString componentsSeparatedByCharactersInSet:separatorCharacterSet];
+    
+    return [components filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"length > 0"]];
+}
+
+@end
@@ -17,6 +17,7 @@
  ******************************************************************************/
 
 #import <Foundation/Foundation.h>
+#import "ASDKPersistenceStackConstants.h"
 @import CoreData;
 
 @class ASDKMOTask, ASDKModelTask;
@@ -25,7 +26,31 @@
 
 + (ASDKMOTask *)mapTask:(ASDKModelTask *)task
               toCacheMO:(ASDKMOTask *)moTask;
+
+/**
+ *  Maps the flat properties of the passed task to an attribute dictionary suitable
+ *  for a batch insert request. Relationships are not part of the dictionary and
+ *  nil properties are omitted.
+ *
+ *  @param task Task to be mapped
+ *
+ *  @return     Dictionary keyed by the task entity's attribute names
+ */
++ (NSDictionary *)mapTaskToBatchInsertAttributes:(ASDKModelTask *)task;
 + (ASDKModelTask *)mapCacheMOToTask:(ASDKMOTask *)moTask;
++ (ASDKModelTask *)mapCacheMOToTask:(ASDKMOTask *)moTask
+                     mappingProfile:(ASDKCacheMappingProfile)mappingProfile;
+
+/**
+ *  Configures the passed task fetch request so that the properties and relationships
+ *  read when mapping with the given profile are fetched upfront instead of firing a
+ *  fault for every row.
+ *
+ *  @param fetchRequest   Fetch request targeting task managed objects
+ *  @param mappingProfile Mapping profile the fetched tasks will be mapped with
+ */
++ (void)configureFetchRequest:(NSFetchRequest *)fetchRequest
+            forMappingProfile:(ASDKCacheMappingProfile)mappingProfile;
 
 
 @end
@@ -52,7 +52,37 @@
     return moTask;
 }
 
++ (NSDictionary *)mapTaskToBatchInsertAttributes:(ASDKModelTask *)task {
+    NSMutableDictionary *attributes = [NSMutableDictionary dictionary];
+    [attributes setValue:task.modelID forKey:@"modelID"];
+    [attributes setValue:task.name forKey:@"name"];
+    [attributes setValue:task.taskDescription forKey:@"taskDescription"];
+    [attributes setValue:task.dueDate forKey:@"dueDate"];
+    [attributes setValue:task.endDate forKey:@"endDate"];
+    [attributes setValue:task.creationDate forKey:@"creationDate"];
+    [attributes setValue:@(task.duration) forKey:@"duration"];
+    [attributes setValue:@(task.priority) forKey:@"priority"];
+    [attributes setValue:task.processInstanceID forKey:@"processInstanceID"];
+    [attributes setValue:task.processDefinitionID forKey:@"processDefinitionID"];
+    [attributes setValue:task.processDefinitionName forKey:@"processDefinitionName"];
+    [attributes setValue:task.formKey forKey:@"formKey"];
+    [attributes setValue:@(task.isMemberOfCandidateGroup) forKey:@"isMemberOfCandidateGroup"];
+    [attributes setValue:@(task.isMemberOfCandidateUsers) forKey:@"isMemberOfCandidateUsers"];
+    [attributes setValue:@(task.isManagerOfCandidateGroup) forKey:@"isManagerOfCandidateGroup"];
+    [attributes setValue:task.parentTaskID forKey:@"parentTaskID"];
+    [attributes setValue:task.processDefinitionDeploymentID forKey:@"processDefinitionDeploymentID"];
+    [attributes setValue:task.category forKey:@"category"];
+    
+    return attributes;
+}
+
 + (ASDKModelTask *)mapCacheMOToTask:(ASDKMOTask *)moTask {
+    return [self mapCacheMOToTask:moTask
+                   mappingProfile:ASDKCacheMappingProfileDetails];
+}
+
++ (ASDKModelTask *)mapCacheMOToTask:(ASDKMOTask *)moTask
+                     mappingProfile:(ASDKCacheMappingProfile)mappingProfile {
     ASDKModelTask *task = [ASDKModelTask new];
     task.modelID = moTask.modelID;
     task.name = moTask.name;
@@ -74,11 +104,13 @@
     task.category = moTask.category;
     
     if (moTask.assignee) {
-        ASDKModelProfile *profile = [ASDKProfileCacheMapper mapCacheMOToProfile:moTask.assignee];
+        ASDKModelProfile *profile = [ASDKProfileCacheMapper mapCacheMOToProfile:moTask.assignee
+                                                                 mappingProfile:mappingProfile];
         task.assigneeModel = profile;
     }
     
-    if (moTask.involvedPeople.count) {
+    if (ASDKCacheMappingProfileDetails == mappingProfile &&
+        moTask.involvedPeople.count) {
         NSMutableArray *involvedPeople = [NSMutableArray array];
         for (ASDKMOProfile *moProfile in moTask.involvedPeople) {
             ASDKModelProfile *profile = [ASDKProfileCacheMapper mapCacheMOToProfile:moProfile];
@@ -90,4 +122,20 @@
     return task;
 }
 
++ (void)configureFetchRequest:(NSFetchRequest *)fetchRequest
+            forMappingProfile:(ASDKCacheMappingProfile)mappingProfile {
+    if (ASDKCacheMappingProfileListSummary == mappingProfile) {
+        fetchRequest.propertiesToFetch = @[@"modelID", @"name", @"taskDescription", @"dueDate", @"endDate",
+                                           @"creationDate", @"duration", @"priority", @"processInstanceID",
+                                           @"processDefinitionID", @"processDefinitionName", @"formKey",
+                                           @"isMemberOfCandidateGroup", @"isMemberOfCandidateUsers",
+                                           @"isManagerOfCandidateGroup", @"parentTaskID",
+                                           @"processDefinitionDeploymentID", @"category", @"assignee"];
+        fetchRequest.relationshipKeyPathsForPrefetching = @[@"assignee"];
+    } else {
+        fetchRequest.relationshipKeyPathsForPrefetching = @[@"assignee", @"assignee.groups",
+                                                            @"involvedPeople", @"involvedPeople.groups"];
+    }
+}
+
 @end
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+@import CoreData;
+
+typedef NSError * (^ASDKCacheModelBulkInsertChunkBlock)(NSArray *chunk, NSManagedObjectContext *moContext);
+
+/**
+ *  Helper used by the model upsert classes to ingest large lists of freshly seen
+ *  entities. Flat rows are written directly to the store with batch insert requests
+ *  in bounded chunks and relationships are wired afterwards in a separate pass that
+ *  is saved and reset chunk by chunk so that the number of managed objects kept in
+ *  memory stays bounded.
+ */
+@interface ASDKCacheModelBulkInsert : NSObject
+
+/**
+ *  Returns whether batch insert requests are supported by the running OS version.
+ *  When they are not, callers are expected to fall back to the regular upsert path.
+ */
++ (BOOL)isBulkInsertAvailable;
+
+/**
+ *  Persists pending changes of the passed context. Batch requests operate directly
+ *  on the store, so existence checks and relationship wiring only see a consistent
+ *  picture once previously upserted objects reached it.
+ *
+ *  @param moContext Context whose pending changes are to be saved
+ *  @param error     Error reported by Core Data if the save fails
+ *
+ *  @return          YES if there was nothing to save or the save succeeded
+ */
++ (BOOL)commitPendingChangesInMOContext:(NSManagedObjectContext *)moContext
+                                  error:(NSError **)error;
+
+/**
+ *  Returns the subset of the passed model IDs for which a row of the given entity
+ *  already exists in the store.
+ */
++ (NSArray *)existingModelIDs:(NSArray *)modelIDs
+                forEntityName:(NSString *)entityName
+                        error:(NSError **)error
+                  inMOContext:(NSManagedObjectContext *)moContext;
+
+/**
+ *  Inserts the passed attribute dictionaries as rows of the given entity using
+ *  batch insert requests of at most kASDKCacheBulkInsertChunkSize rows each.
+ *
+ *  @return Managed object IDs of the inserted rows
+ */
++ (NSArray *)batchInsertAttributesList:(NSArray *)attributesList
+                         forEntityName:(NSString *)entityName
+                                 error:(NSError **)error
+                           inMOContext:(NSManagedObjectContext *)moContext;
+
+/**
+ *  Splits the passed list in chunks and executes the chunk block for each of them on
+ *  a private context sharing the coordinator of the passed context. The private context
+ *  is saved and reset after every chunk and iteration stops at the first error.
+ *
+ *  @return Error returned by a chunk block or reported while saving, nil otherwise
+ */
++ (NSError *)performRelationshipPassForList:(NSArray *)list
+                                 usingBlock:(ASDKCacheModelBulkInsertChunkBlock)chunkBlock
+                                inMOContext:(NSManagedObjectContext *)moContext;
+
+@end
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKCacheModelBulkInsert.h"
+
+// Constants
+#import "ASDKPersistenceStackConstants.h"
+
+// Managers
+#import "ASDKWriterManagedObjectContext.h"
+
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
+
+@implementation ASDKCacheModelBulkInsert
+
+
+#pragma mark -
+#pragma mark Public interface
+
++ (BOOL)isBulkInsertAvailable {
+    if (@available(iOS 13.0, *)) {
+        return YES;
+    }
+    
+    return NO;
+}
+
++ (BOOL)commitPendingChangesInMOContext:(NSManagedObjectContext *)moContext
+                                  error:(NSError **)error {
+    if (!moContext.hasChanges) {
+        return YES;
+    }
+    
+    // The writer context would otherwise just record a deferred save
+    if ([moContext isKindOfClass:[ASDKWriterManagedObjectContext class]]) {
+        return [(ASDKWriterManagedObjectContext *)moContext commitChanges:error];
+    }
+    
+    return [moContext save:error];
+}
+
++ (NSArray *)existingModelIDs:(NSArray *)modelIDs
+                forEntityName:(NSString *)entityName
+                        error:(NSError **)error
+                  inMOContext:(NSManagedObjectContext *)moContext {
+    NSError *internalError = nil;
+    
+    NSFetchRequest *existingModelIDsRequest = [NSFetchRequest fetchRequestWithEntityName:entityName];
+    existingModelIDsRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", modelIDs];
+    existingModelIDsRequest.resultType = NSDictionaryResultType;
+    existingModelIDsRequest.propertiesToFetch = @[@"modelID"];
+    NSArray *existingModelIDsResults = [moContext executeFetchRequest:existingModelIDsRequest
+                                                                error:&internalError];
+    
+    *error = internalError;
+    return [existingModelIDsResults valueForKey:@"modelID"];
+}
+
++ (NSArray *)batchInsertAttributesList:(NSArray *)attributesList
+                         forEntityName:(NSString *)entityName
+                                 error:(NSError **)error
+                           inMOContext:(NSManagedObjectContext *)moContext {
+    NSError *internalError = nil;
+    NSMutableArray *insertedObjectIDs = [NSMutableArray array];
+    
+    if (@available(iOS 13.0, *)) {
+        for (NSUInteger location = 0; location < attributesList.count; location += kASDKCacheBulkInsertChunkSize) {
+            @autoreleasepool {
+                NSRange chunkRange = NSMakeRange(location, MIN(kASDKCacheBulkInsertChunkSize, attributesList.count - location));
+                NSBatchInsertRequest *batchInsertRequest = [[NSBatchInsertRequest alloc] initWithEntityName:entityName
+                                                                                                    objects:[attributesList subarrayWithRange:chunkRange]];
+                batchInsertRequest.resultType = NSBatchInsertRequestResultTypeObjectIDs;
+                NSBatchInsertResult *batchInsertResult = [moContext executeRequest:batchInsertRequest
+                                                                             error:&internalError];
+                if (internalError) {
+                    break;
+                }
+                
+                [insertedObjectIDs addObjectsFromArray:batchInsertResult.result];
+            }
+        }
+    }
+    
+    *error = internalError;
+    return insertedObjectIDs;
+}
+
++ (NSError *)performRelationshipPassForList:(NSArray *)list
+                                 usingBlock:(ASDKCacheModelBulkInsertChunkBlock)chunkBlock
+                                inMOContext:(NSManagedObjectContext *)moContext {
+    if (!list.count) {
+        return nil;
+    }
+    
+    NSManagedObjectContext *bulkContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    bulkContext.persistentStoreCoordinator = moContext.persistentStoreCoordinator;
+    bulkContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+    bulkContext.undoManager = nil;
+    
+    __block NSError *internalError = nil;
+    [bulkContext performBlockAndWait:^{
+        for (NSUInteger location = 0; location < list.count; location += kASDKCacheBulkInsertChunkSize) {
+            @autoreleasepool {
+                NSRange chunkRange = NSMakeRange(location, MIN(kASDKCacheBulkInsertChunkSize, list.count - location));
+                internalError = chunkBlock([list subarrayWithRange:chunkRange], bulkContext);
+                
+                NSError *saveError = nil;
+                if (!internalError &&
+                    bulkContext.hasChanges &&
+                    ![bulkContext save:&saveError]) {
+                    internalError = saveError;
+                }
+                
+                // Drop the registered objects so that memory usage is bound to a single chunk
+                [bulkContext reset];
+            }
+            
+            if (internalError) {
+                break;
+            }
+        }
+    }];
+    
+    return internalError;
+}
+
+@end
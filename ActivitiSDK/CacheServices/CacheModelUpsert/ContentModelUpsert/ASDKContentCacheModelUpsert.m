@@ -144,6 +144,7 @@
     
     [ASDKContentCacheMapper mapContent:content
                              toCacheMO:moContent];
+    moContent.lastAccessDate = [NSDate date];
     
     // Map owner to managed object
     if (content.owner) {
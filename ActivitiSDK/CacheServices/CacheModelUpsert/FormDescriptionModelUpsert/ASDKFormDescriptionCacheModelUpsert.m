@@ -136,6 +136,7 @@ typedef NS_ENUM(NSInteger, ASDKFormDescriptionType) {
                 
             default: break;
         }
+        moFormDescription.lastAccessDate = [NSDate date];
     }
     
     *error = internalError;
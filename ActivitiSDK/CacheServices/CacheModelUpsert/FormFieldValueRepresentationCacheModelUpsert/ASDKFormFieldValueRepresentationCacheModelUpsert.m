@@ -20,6 +20,7 @@
 
 // Models
 #import "ASDKMOFormFieldValueRepresentation.h"
+#import "ASDKMOFormFieldValue.h"
 #import "ASDKFormFieldValueRequestRepresentation.h"
 
 // Mappers
@@ -47,15 +48,77 @@
         if (!moFormFieldValueRepresentation) {
             moFormFieldValueRepresentation = [NSEntityDescription insertNewObjectForEntityForName:[ASDKMOFormFieldValueRepresentation entityName]
                                                                            inManagedObjectContext:moContext];
+            moFormFieldValueRepresentation.journalDate = [NSDate date];
         }
         
         [ASDKFormFieldValueRepresentationCacheMapper mapFormFieldValueRepresentation:formFieldValueRequestRepresentation
                                                                        forTaskWithID:taskID
                                                                            toCacheMO:moFormFieldValueRepresentation];
+        
+        NSDictionary *formFieldValues = formFieldValueRequestRepresentation.formFieldValues;
+        if (!formFieldValues) {
+            formFieldValues = [ASDKFormFieldValueRequestRepresentation formFieldValuesForFormFields:formFieldValueRequestRepresentation.formFields];
+        }
+        [self upsertFormFieldValues:formFieldValues
+                          forTaskID:taskID
+     toFormFieldValueRepresentation:moFormFieldValueRepresentation
+                        inMOContext:moContext];
+        
+        // New content invalidates any upload in flight for the previous revision and
+        // is eligible for an immediate upload attempt
+        moFormFieldValueRepresentation.revision++;
+        moFormFieldValueRepresentation.attemptCount = 0;
+        moFormFieldValueRepresentation.nextAttemptDate = nil;
     }
     
     *error = internalError;
     return moFormFieldValueRepresentation;
 }
 
+
+#pragma mark -
+#pragma mark Private interface
+
++ (void)upsertFormFieldValues:(NSDictionary *)formFieldValues
+                    forTaskID:(NSString *)taskID
+toFormFieldValueRepresentation:(ASDKMOFormFieldValueRepresentation *)moFormFieldValueRepresentation
+                  inMOContext:(NSManagedObjectContext *)moContext {
+    // Only rows whose value changed are touched so saving a form again writes
+    // the edited fields instead of the whole form
+    NSMutableDictionary *moFormFieldValuesByID = [NSMutableDictionary dictionary];
+    for (ASDKMOFormFieldValue *moFormFieldValue in moFormFieldValueRepresentation.formFieldValues) {
+        if (!moFormFieldValue.formFieldID ||
+            !formFieldValues[moFormFieldValue.formFieldID]) {
+            [moContext deleteObject:moFormFieldValue];
+        } else {
+            moFormFieldValuesByID[moFormFieldValue.formFieldID] = moFormFieldValue;
+        }
+    }
+    
+    for (NSString *formFieldID in formFieldValues) {
+        ASDKMOFormFieldValue *moFormFieldValue = moFormFieldValuesByID[formFieldID];
+        NSString *encodedFormFieldValue = [ASDKFormFieldValueRepresentationCacheMapper encodedFormFieldValue:formFieldValues[formFieldID]];
+        
+        if (!encodedFormFieldValue) {
+            if (moFormFieldValue) {
+                [moContext deleteObject:moFormFieldValue];
+            }
+            continue;
+        }
+        
+        if (!moFormFieldValue) {
+            moFormFieldValue = [NSEntityDescription insertNewObjectForEntityForName:[ASDKMOFormFieldValue entityName]
+                                                             inManagedObjectContext:moContext];
+            moFormFieldValue.formFieldValueRepresentation = moFormFieldValueRepresentation;
+        } else if ([moFormFieldValue.value isEqualToString:encodedFormFieldValue]) {
+            continue;
+        }
+        
+        [ASDKFormFieldValueRepresentationCacheMapper mapFormFieldValue:formFieldValues[formFieldID]
+                                                        forFormFieldID:formFieldID
+                                                         forTaskWithID:taskID
+                                                             toCacheMO:moFormFieldValue];
+    }
+}
+
 @end
@@ -27,6 +27,19 @@
                                         error:(NSError **)error
                                   inMOContext:(NSManagedObjectContext *)moContext;
 
+/**
+ *  Bulk ingest variant of the process instance list upsert meant for large first
+ *  synchronizations. Process instances and initiators that are not yet cached are
+ *  written with batch insert requests, the initiator relationship is wired in a
+ *  second pass and already cached process instances go through the regular upsert
+ *  in the passed context.
+ *
+ *  @return Managed object IDs of the rows written by batch insert requests
+ */
++ (NSArray *)bulkInsertProcessInstanceListToCache:(NSArray *)processInstanceList
+                                            error:(NSError **)error
+                                      inMOContext:(NSManagedObjectContext *)moContext;
+
 + (ASDKMOProcessInstance *)upsertProcessInstanceToCache:(ASDKModelProcessInstance *)processInstance
                                                   error:(NSError **)error
                                             inMOContext:(NSManagedObjectContext *)moContext;
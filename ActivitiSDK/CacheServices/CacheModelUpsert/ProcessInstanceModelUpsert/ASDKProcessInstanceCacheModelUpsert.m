@@ -26,9 +26,11 @@
 
 // Model mappers
 #import "ASDKProcessInstanceCacheMapper.h"
+#import "ASDKSearchTokensCacheMapper.h"
 
 // Model upsert
 #import "ASDKProfileCacheModelUpsert.h"
+#import "ASDKCacheModelBulkInsert.h"
 
 
 @implementation ASDKProcessInstanceCacheModelUpsert
@@ -142,6 +144,122 @@
     return moProcessInstances;
 }
 
++ (NSArray *)bulkInsertProcessInstanceListToCache:(NSArray *)processInstanceList
+                                            error:(NSError **)error
+                                      inMOContext:(NSManagedObjectContext *)moContext {
+    NSError *internalError = nil;
+    NSMutableArray *insertedObjectIDs = [NSMutableArray array];
+    
+    NSMutableDictionary *processInstancesByModelID = [NSMutableDictionary dictionary];
+    for (ASDKModelProcessInstance *processInstance in processInstanceList) {
+        if (processInstance.modelID) {
+            processInstancesByModelID[processInstance.modelID] = processInstance;
+        }
+    }
+    
+    NSArray *existingIDs = nil;
+    if ([ASDKCacheModelBulkInsert commitPendingChangesInMOContext:moContext
+                                                            error:&internalError]) {
+        existingIDs = [ASDKCacheModelBulkInsert existingModelIDs:processInstancesByModelID.allKeys
+                                                   forEntityName:[ASDKMOProcessInstance entityName]
+                                                           error:&internalError
+                                                     inMOContext:moContext];
+    }
+    
+    NSMutableArray *insertedIDs = [NSMutableArray arrayWithArray:processInstancesByModelID.allKeys];
+    [insertedIDs removeObjectsInArray:existingIDs];
+    NSMutableArray *relatedProcessInstanceIDs = [NSMutableArray array];
+    
+    // Ingest the initiators of the new process instances first so that the relationship pass finds them
+    if (!internalError) {
+        NSMutableArray *profileList = [NSMutableArray array];
+        for (NSString *idString in insertedIDs) {
+            ASDKModelProcessInstance *processInstance = processInstancesByModelID[idString];
+            if (processInstance.initiatorModel) {
+                [profileList addObject:processInstance.initiatorModel];
+                [relatedProcessInstanceIDs addObject:idString];
+            }
+        }
+        
+        NSArray *insertedProfileObjectIDs = [ASDKProfileCacheModelUpsert bulkInsertProfileListToCache:profileList
+                                                                                                error:&internalError
+                                                                                          inMOContext:moContext];
+        [insertedObjectIDs addObjectsFromArray:insertedProfileObjectIDs];
+    }
+    
+    // Perform insert operations
+    if (!internalError) {
+        NSDate *lastAccessDate = [NSDate date];
+        NSMutableArray *attributesList = [NSMutableArray array];
+        for (NSString *idString in insertedIDs) {
+            ASDKModelProcessInstance *processInstance = processInstancesByModelID[idString];
+            NSMutableDictionary *attributes = [[ASDKProcessInstanceCacheMapper mapProcessInstanceToBatchInsertAttributes:processInstance] mutableCopy];
+            attributes[@"lastAccessDate"] = lastAccessDate;
+            [attributes setValue:[ASDKSearchTokensCacheMapper searchTokensForString:processInstance.name]
+                          forKey:@"searchTokens"];
+            [attributesList addObject:attributes];
+        }
+        
+        NSArray *insertedProcessInstanceObjectIDs = [ASDKCacheModelBulkInsert batchInsertAttributesList:attributesList
+                                                                                          forEntityName:[ASDKMOProcessInstance entityName]
+                                                                                                  error:&internalError
+                                                                                            inMOContext:moContext];
+        [insertedObjectIDs addObjectsFromArray:insertedProcessInstanceObjectIDs];
+    }
+    
+    // Map initiators to the inserted managed objects
+    ASDKCacheModelBulkInsertChunkBlock initiatorRelationshipBlock = ^NSError *(NSArray *chunk, NSManagedObjectContext *bulkContext) {
+        NSError *chunkError = nil;
+        NSMutableArray *initiatorIDs = [NSMutableArray array];
+        for (NSString *idString in chunk) {
+            ASDKModelProcessInstance *processInstance = processInstancesByModelID[idString];
+            if (processInstance.initiatorModel.modelID) {
+                [initiatorIDs addObject:processInstance.initiatorModel.modelID];
+            }
+        }
+        
+        NSFetchRequest *fetchProfileListRequest = [ASDKMOProfile fetchRequest];
+        fetchProfileListRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", initiatorIDs];
+        NSArray *profileResults = [bulkContext executeFetchRequest:fetchProfileListRequest
+                                                             error:&chunkError];
+        if (chunkError) {
+            return chunkError;
+        }
+        NSDictionary *moProfilesByModelID = [NSDictionary dictionaryWithObjects:profileResults
+                                                                        forKeys:[profileResults valueForKey:@"modelID"]];
+        
+        NSFetchRequest *fetchProcessInstanceListRequest = [ASDKMOProcessInstance fetchRequest];
+        fetchProcessInstanceListRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", chunk];
+        NSArray *processInstanceResults = [bulkContext executeFetchRequest:fetchProcessInstanceListRequest
+                                                                     error:&chunkError];
+        for (ASDKMOProcessInstance *moProcessInstance in processInstanceResults) {
+            ASDKModelProcessInstance *processInstance = processInstancesByModelID[moProcessInstance.modelID];
+            moProcessInstance.initiator = moProfilesByModelID[processInstance.initiatorModel.modelID];
+        }
+        
+        return chunkError;
+    };
+    
+    if (!internalError) {
+        internalError = [ASDKCacheModelBulkInsert performRelationshipPassForList:relatedProcessInstanceIDs
+                                                                      usingBlock:initiatorRelationshipBlock
+                                                                     inMOContext:moContext];
+    }
+    
+    // Perform update operations
+    if (!internalError &&
+        existingIDs.count) {
+        NSArray *existingProcessInstanceList = [processInstancesByModelID objectsForKeys:existingIDs
+                                                                          notFoundMarker:[NSNull null]];
+        [self upsertProcessInstanceListToCache:existingProcessInstanceList
+                                         error:&internalError
+                                   inMOContext:moContext];
+    }
+    
+    *error = internalError;
+    return insertedObjectIDs;
+}
+
 + (ASDKMOProcessInstance *)populateMOProcessInstance:(ASDKMOProcessInstance *)moProcessInstance
                    withPropertiesFromProcessInstance:(ASDKModelProcessInstance *)processInstance
                                          inMOContext:(NSManagedObjectContext *)moContext
@@ -150,6 +268,8 @@
     
     [ASDKProcessInstanceCacheMapper mapProcessInstance:processInstance
                                              toCacheMO:moProcessInstance];
+    moProcessInstance.lastAccessDate = [NSDate date];
+    moProcessInstance.searchTokens = [ASDKSearchTokensCacheMapper searchTokensForString:processInstance.name];
     
     // Map initiator to managed object
     if (processInstance.initiatorModel) {
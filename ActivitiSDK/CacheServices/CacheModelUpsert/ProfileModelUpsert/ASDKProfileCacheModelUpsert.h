@@ -27,4 +27,16 @@
                                   error:(NSError **)error
                             inMOContext:(NSManagedObjectContext *)moContext;
 
+/**
+ *  Bulk ingest variant of the profile upsert. Profiles that are not yet cached are
+ *  written with batch insert requests and have their groups wired in a second pass,
+ *  while already cached ones go through the regular upsert in the passed context.
+ *  Duplicate model IDs in the list are ingested once.
+ *
+ *  @return Managed object IDs of the rows written by batch insert requests
+ */
++ (NSArray *)bulkInsertProfileListToCache:(NSArray *)profileList
+                                    error:(NSError **)error
+                              inMOContext:(NSManagedObjectContext *)moContext;
+
 @end
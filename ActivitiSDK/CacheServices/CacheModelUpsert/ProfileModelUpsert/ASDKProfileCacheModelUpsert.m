@@ -29,6 +29,7 @@
 
 // Model upsert
 #import "ASDKGroupCacheModelUpsert.h"
+#import "ASDKCacheModelBulkInsert.h"
 
 @implementation ASDKProfileCacheModelUpsert
 
@@ -52,6 +53,7 @@
         // Map profile properties to managed object
         [ASDKProfileCacheMapper mapProfile:profile
                                  toCacheMO:moProfile];
+        moProfile.lastAccessDate = [NSDate date];
         
         // Map group to managed object
         if (profile.groups.count) {
@@ -68,4 +70,92 @@
     return moProfile;
 }
 
++ (NSArray *)bulkInsertProfileListToCache:(NSArray *)profileList
+                                    error:(NSError **)error
+                              inMOContext:(NSManagedObjectContext *)moContext {
+    NSError *internalError = nil;
+    NSArray *insertedObjectIDs = nil;
+    
+    NSMutableDictionary *profilesByModelID = [NSMutableDictionary dictionary];
+    for (ASDKModelProfile *profile in profileList) {
+        if (profile.modelID) {
+            profilesByModelID[profile.modelID] = profile;
+        }
+    }
+    
+    NSArray *existingIDs = [ASDKCacheModelBulkInsert existingModelIDs:profilesByModelID.allKeys
+                                                        forEntityName:[ASDKMOProfile entityName]
+                                                                error:&internalError
+                                                          inMOContext:moContext];
+    if (!internalError) {
+        // Perform insert operations
+        NSMutableArray *insertedIDs = [NSMutableArray arrayWithArray:profilesByModelID.allKeys];
+        [insertedIDs removeObjectsInArray:existingIDs];
+        
+        NSDate *lastAccessDate = [NSDate date];
+        NSMutableArray *attributesList = [NSMutableArray array];
+        NSMutableArray *groupedProfileIDs = [NSMutableArray array];
+        for (NSString *idString in insertedIDs) {
+            ASDKModelProfile *profile = profilesByModelID[idString];
+            NSMutableDictionary *attributes = [[ASDKProfileCacheMapper mapProfileToBatchInsertAttributes:profile] mutableCopy];
+            attributes[@"lastAccessDate"] = lastAccessDate;
+            [attributesList addObject:attributes];
+            
+            if (profile.groups.count) {
+                [groupedProfileIDs addObject:idString];
+            }
+        }
+        
+        insertedObjectIDs = [ASDKCacheModelBulkInsert batchInsertAttributesList:attributesList
+                                                                  forEntityName:[ASDKMOProfile entityName]
+                                                                          error:&internalError
+                                                                    inMOContext:moContext];
+        
+        // Map groups to the inserted managed objects
+        ASDKCacheModelBulkInsertChunkBlock groupsRelationshipBlock = ^NSError *(NSArray *chunk, NSManagedObjectContext *bulkContext) {
+            NSError *chunkError = nil;
+            NSFetchRequest *fetchProfileListRequest = [ASDKMOProfile fetchRequest];
+            fetchProfileListRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", chunk];
+            NSArray *profileResults = [bulkContext executeFetchRequest:fetchProfileListRequest
+                                                                 error:&chunkError];
+            for (ASDKMOProfile *moProfile in profileResults) {
+                ASDKModelProfile *profile = profilesByModelID[moProfile.modelID];
+                for (ASDKModelGroup *group in profile.groups) {
+                    ASDKMOGroup *moGroup = [ASDKGroupCacheModelUpsert upsertGroupToCache:group
+                                                                                   error:&chunkError
+                                                                             inMOContext:bulkContext];
+                    if (chunkError) {
+                        return chunkError;
+                    }
+                    
+                    [moProfile addGroupsObject:moGroup];
+                }
+            }
+            
+            return chunkError;
+        };
+        
+        if (!internalError) {
+            internalError = [ASDKCacheModelBulkInsert performRelationshipPassForList:groupedProfileIDs
+                                                                          usingBlock:groupsRelationshipBlock
+                                                                         inMOContext:moContext];
+        }
+        
+        // Perform update operations
+        if (!internalError) {
+            for (NSString *idString in existingIDs) {
+                [self upsertProfileToCache:profilesByModelID[idString]
+                                     error:&internalError
+                               inMOContext:moContext];
+                if (internalError) {
+                    break;
+                }
+            }
+        }
+    }
+    
+    *error = internalError;
+    return insertedObjectIDs;
+}
+
 @end
@@ -30,4 +30,18 @@
                              error:(NSError **)error
                        inMOContext:(NSManagedObjectContext *)moContext;
 
+/**
+ *  Bulk ingest variant of the task list upsert meant for large first synchronizations.
+ *  Tasks and profiles that are not yet cached are written with batch insert requests,
+ *  assignee and involved people relationships are wired in a second pass and already
+ *  cached tasks go through the regular upsert in the passed context. The inserted rows
+ *  are not registered with any context, callers are expected to merge the returned
+ *  object IDs into the contexts they care about.
+ *
+ *  @return Managed object IDs of the rows written by batch insert requests
+ */
++ (NSArray *)bulkInsertTaskListToCache:(NSArray *)taskList
+                                 error:(NSError **)error
+                           inMOContext:(NSManagedObjectContext *)moContext;
+
 @end
@@ -27,9 +27,11 @@
 // Model mappers
 #import "ASDKTaskCacheMapper.h"
 #import "ASDKProfileCacheMapper.h"
+#import "ASDKSearchTokensCacheMapper.h"
 
 // Model upsert
 #import "ASDKProfileCacheModelUpsert.h"
+#import "ASDKCacheModelBulkInsert.h"
 
 
 @implementation ASDKTaskCacheModelUpsert
@@ -142,6 +144,136 @@
     return moTasks;
 }
 
++ (NSArray *)bulkInsertTaskListToCache:(NSArray *)taskList
+                                 error:(NSError **)error
+                           inMOContext:(NSManagedObjectContext *)moContext {
+    NSError *internalError = nil;
+    NSMutableArray *insertedObjectIDs = [NSMutableArray array];
+    
+    NSMutableDictionary *tasksByModelID = [NSMutableDictionary dictionary];
+    for (ASDKModelTask *task in taskList) {
+        if (task.modelID) {
+            tasksByModelID[task.modelID] = task;
+        }
+    }
+    
+    NSArray *existingIDs = nil;
+    if ([ASDKCacheModelBulkInsert commitPendingChangesInMOContext:moContext
+                                                            error:&internalError]) {
+        existingIDs = [ASDKCacheModelBulkInsert existingModelIDs:tasksByModelID.allKeys
+                                                   forEntityName:[ASDKMOTask entityName]
+                                                           error:&internalError
+                                                     inMOContext:moContext];
+    }
+    
+    NSMutableArray *insertedIDs = [NSMutableArray arrayWithArray:tasksByModelID.allKeys];
+    [insertedIDs removeObjectsInArray:existingIDs];
+    NSMutableArray *relatedTaskIDs = [NSMutableArray array];
+    
+    // Ingest the profiles referenced by the new tasks first so that the relationship pass finds them
+    if (!internalError) {
+        NSMutableArray *profileList = [NSMutableArray array];
+        for (NSString *idString in insertedIDs) {
+            ASDKModelTask *task = tasksByModelID[idString];
+            if (task.assigneeModel) {
+                [profileList addObject:task.assigneeModel];
+            }
+            [profileList addObjectsFromArray:task.involvedPeople];
+            
+            if (task.assigneeModel ||
+                task.involvedPeople.count) {
+                [relatedTaskIDs addObject:idString];
+            }
+        }
+        
+        NSArray *insertedProfileObjectIDs = [ASDKProfileCacheModelUpsert bulkInsertProfileListToCache:profileList
+                                                                                                error:&internalError
+                                                                                          inMOContext:moContext];
+        [insertedObjectIDs addObjectsFromArray:insertedProfileObjectIDs];
+    }
+    
+    // Perform insert operations
+    if (!internalError) {
+        NSDate *lastAccessDate = [NSDate date];
+        NSMutableArray *attributesList = [NSMutableArray array];
+        for (NSString *idString in insertedIDs) {
+            ASDKModelTask *task = tasksByModelID[idString];
+            NSMutableDictionary *attributes = [[ASDKTaskCacheMapper mapTaskToBatchInsertAttributes:task] mutableCopy];
+            attributes[@"lastAccessDate"] = lastAccessDate;
+            [attributes setValue:[ASDKSearchTokensCacheMapper searchTokensForString:task.name]
+                          forKey:@"searchTokens"];
+            [attributesList addObject:attributes];
+        }
+        
+        NSArray *insertedTaskObjectIDs = [ASDKCacheModelBulkInsert batchInsertAttributesList:attributesList
+                                                                               forEntityName:[ASDKMOTask entityName]
+                                                                                       error:&internalError
+                                                                                 inMOContext:moContext];
+        [insertedObjectIDs addObjectsFromArray:insertedTaskObjectIDs];
+    }
+    
+    // Map assignee and involved people to the inserted managed objects
+    ASDKCacheModelBulkInsertChunkBlock profilesRelationshipBlock = ^NSError *(NSArray *chunk, NSManagedObjectContext *bulkContext) {
+        NSError *chunkError = nil;
+        NSMutableSet *profileIDs = [NSMutableSet set];
+        for (NSString *idString in chunk) {
+            ASDKModelTask *task = tasksByModelID[idString];
+            if (task.assigneeModel.modelID) {
+                [profileIDs addObject:task.assigneeModel.modelID];
+            }
+            [profileIDs addObjectsFromArray:[task.involvedPeople valueForKey:@"modelID"]];
+        }
+        
+        NSFetchRequest *fetchProfileListRequest = [ASDKMOProfile fetchRequest];
+        fetchProfileListRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", profileIDs];
+        NSArray *profileResults = [bulkContext executeFetchRequest:fetchProfileListRequest
+                                                             error:&chunkError];
+        if (chunkError) {
+            return chunkError;
+        }
+        NSDictionary *moProfilesByModelID = [NSDictionary dictionaryWithObjects:profileResults
+                                                                        forKeys:[profileResults valueForKey:@"modelID"]];
+        
+        NSFetchRequest *fetchTaskListRequest = [ASDKMOTask fetchRequest];
+        fetchTaskListRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", chunk];
+        NSArray *taskResults = [bulkContext executeFetchRequest:fetchTaskListRequest
+                                                          error:&chunkError];
+        for (ASDKMOTask *moTask in taskResults) {
+            ASDKModelTask *task = tasksByModelID[moTask.modelID];
+            if (task.assigneeModel.modelID) {
+                moTask.assignee = moProfilesByModelID[task.assigneeModel.modelID];
+            }
+            for (ASDKModelProfile *profile in task.involvedPeople) {
+                ASDKMOProfile *moProfile = profile.modelID ? moProfilesByModelID[profile.modelID] : nil;
+                if (moProfile) {
+                    [moTask addInvolvedPeopleObject:moProfile];
+                }
+            }
+        }
+        
+        return chunkError;
+    };
+    
+    if (!internalError) {
+        internalError = [ASDKCacheModelBulkInsert performRelationshipPassForList:relatedTaskIDs
+                                                                      usingBlock:profilesRelationshipBlock
+                                                                     inMOContext:moContext];
+    }
+    
+    // Perform update operations
+    if (!internalError &&
+        existingIDs.count) {
+        NSArray *existingTaskList = [tasksByModelID objectsForKeys:existingIDs
+                                                    notFoundMarker:[NSNull null]];
+        [self upsertTaskListToCache:existingTaskList
+                              error:&internalError
+                        inMOContext:moContext];
+    }
+    
+    *error = internalError;
+    return insertedObjectIDs;
+}
+
 + (ASDKMOTask *)populateMOTask:(ASDKMOTask *)moTask
         withPropertiesFromTask:(ASDKModelTask *)task
                    inMOContext:(NSManagedObjectContext *)moContext
@@ -150,6 +282,8 @@
     
     [ASDKTaskCacheMapper mapTask:task
                        toCacheMO:moTask];
+    moTask.lastAccessDate = [NSDate date];
+    moTask.searchTokens = [ASDKSearchTokensCacheMapper searchTokensForString:task.name];
     
     // Map assignee to managed object
     if (task.assigneeModel) {
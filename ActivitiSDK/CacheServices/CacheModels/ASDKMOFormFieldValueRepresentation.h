@@ -19,7 +19,7 @@
 #import <Foundation/Foundation.h>
 #import <CoreData/CoreData.h>
 
-@class NSObject;
+@class NSObject, ASDKMOFormFieldValue;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -30,4 +30,10 @@
  */
 - (void)saveChanges;
 
+/**
+ * Returns whether the persistence medium is ready to serve cached data. Data accessors
+ * fall back to network only requests while the cache is not ready.
+ */
+- (BOOL)isReady;
+
 @end
@@ -24,4 +24,8 @@
     // Implement in subclasses
 }
 
+- (BOOL)isReady {
+    return YES;
+}
+
 @end
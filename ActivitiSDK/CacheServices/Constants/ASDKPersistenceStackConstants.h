@@ -23,3 +23,14 @@ extern NSString * const ASDKPersistenceStackErrorDomain;
 extern NSInteger const  kASDKPersistenceStackInitializationErrorCode;
 extern NSInteger const  kASDKPersistenceStackSaveViewContextErrorCode;
 extern NSInteger const  kASDKPersistenceStackCleanCacheStalledDataErrorCode;
+extern NSInteger const  kASDKPersistenceStackCacheMaintenanceErrorCode;
+extern NSInteger const  kASDKPersistenceStackSaveWriterContextErrorCode;
+
+// Cache mapping profiles
+typedef NS_ENUM(NSInteger, ASDKCacheMappingProfile) {
+    ASDKCacheMappingProfileDetails = 0,     // Hydrates every cached relationship
+    ASDKCacheMappingProfileListSummary      // Hydrates just what list rows display
+};
+
+// Bulk insert
+extern NSUInteger const kASDKCacheBulkInsertChunkSize;
@@ -26,3 +26,11 @@ NSString * const ASDKPersistenceStackErrorDomain                        = @"ASDK
 NSInteger const  kASDKPersistenceStackInitializationErrorCode           = 1;
 NSInteger const  kASDKPersistenceStackSaveViewContextErrorCode          = 2;
 NSInteger const  kASDKPersistenceStackCleanCacheStalledDataErrorCode    = 3;
+NSInteger const  kASDKPersistenceStackCacheMaintenanceErrorCode         = 4;
+NSInteger const  kASDKPersistenceStackSaveWriterContextErrorCode        = 5;
+
+
+#pragma mark -
+#pragma mark Bulk insert
+
+NSUInteger const kASDKCacheBulkInsertChunkSize                          = 500;
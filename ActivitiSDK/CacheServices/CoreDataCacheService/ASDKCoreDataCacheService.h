@@ -19,6 +19,7 @@
 #import <Foundation/Foundation.h>
 #import "ASDKPersistenceStack.h"
 #import "ASDKCacheService.h"
+#import "ASDKModelCacheProtocol.h"
 
 typedef void (^ASDKCacheServiceCompletionBlock) (NSError *error);
 
@@ -34,4 +35,42 @@ typedef void (^ASDKCacheServiceCompletionBlock) (NSError *error);
 
 @property (strong, nonatomic, readonly) ASDKPersistenceStack *persistenceStack;
 
+/**
+ * In-memory model cache consulted before reaching the persistent store for
+ * detail fetches.
+ */
+@property (strong, nonatomic, readonly) id<ASDKModelCacheProtocol> modelCache;
+
+/**
+ * When set, the saves issued by the cache writes of this service are deferred until
+ * saveChanges is called so that all the writes of a data accessor operation chain
+ * are persisted with a single save. Defaults to NO.
+ */
+@property (assign, nonatomic) BOOL defersSavesUntilSaveChanges;
+
+/**
+ * Executes the passed block on a private context owned by this cache service. The
+ * context is reused across reads so that consecutive operations hit a warm row cache.
+ *
+ * @param taskBlock Block to be executed
+ */
+- (void)performReadTask:(ASDKPersistenceTaskBlock)taskBlock;
+
+/**
+ * Executes the passed block on the persistence stack's writer context, deferring its
+ * saves if defersSavesUntilSaveChanges is set.
+ *
+ * @param taskBlock Block to be executed
+ */
+- (void)performWriteTask:(ASDKPersistenceTaskBlock)taskBlock;
+
+/**
+ * Records a read access to the passed managed objects so that they are considered
+ * recently used when the cache is trimmed. Must be called on the queue of the
+ * context the objects belong to.
+ *
+ * @param managedObjects Collection of managed objects that have been read
+ */
+- (void)recordAccessForManagedObjects:(NSArray<NSManagedObject *> *)managedObjects;
+
 @end
@@ -20,11 +20,23 @@
 
 // Protocols
 #import "ASDKPersistenceStackProtocol.h"
+#import "ASDKCacheMaintenanceServiceProtocol.h"
 
 // Managers
 #import "ASDKBootstrap.h"
 #import "ASDKServiceLocator.h"
 
+@interface ASDKCoreDataCacheService ()
+
+@property (strong, nonatomic) id<ASDKCacheMaintenanceServiceProtocol> cacheMaintenanceService;
+
+/**
+ *  Property meant to hold a reference to the reusable context reads are performed on
+ */
+@property (strong, nonatomic) NSManagedObjectContext *readContext;
+
+@end
+
 @implementation ASDKCoreDataCacheService
 
 - (instancetype)init {
@@ -32,17 +44,47 @@
     if (self) {
         ASDKBootstrap *bootStrap = [ASDKBootstrap sharedInstance];
         _persistenceStack = [bootStrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKPersistenceStackProtocol)];
+        _cacheMaintenanceService = [bootStrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKCacheMaintenanceServiceProtocol)];
+        _modelCache = [bootStrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKModelCacheProtocol)];
     }
     
     return self;
 }
 
 - (void)saveChanges {
-    __weak typeof(self) weakSelf = self;
-    dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
-        [strongSelf.persistenceStack saveContext];
-    });
+    // Saving happens on the persistence stack's writer context so it is safe to
+    // call from any queue
+    [self.persistenceStack saveContext];
+}
+
+- (void)performReadTask:(ASDKPersistenceTaskBlock)taskBlock {
+    NSManagedObjectContext *readContext = nil;
+    @synchronized (self) {
+        if (!self.readContext) {
+            self.readContext = [self.persistenceStack backgroundContext];
+        }
+        readContext = self.readContext;
+    }
+    
+    [self.persistenceStack performBackgroundTask:taskBlock
+                                       inContext:readContext];
+}
+
+- (void)performWriteTask:(ASDKPersistenceTaskBlock)taskBlock {
+    [self.persistenceStack performWriteTask:taskBlock
+                              deferringSave:self.defersSavesUntilSaveChanges];
+}
+
+- (void)recordAccessForManagedObjects:(NSArray<NSManagedObject *> *)managedObjects {
+    if (!managedObjects.count) {
+        return;
+    }
+    
+    [self.cacheMaintenanceService recordAccessForObjectIDs:[managedObjects valueForKey:NSStringFromSelector(@selector(objectID))]];
+}
+
+- (BOOL)isReady {
+    return self.persistenceStack.isStoreLoaded;
 }
 
 @end
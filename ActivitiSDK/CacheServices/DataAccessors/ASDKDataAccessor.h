@@ -50,6 +50,15 @@ typedef NS_ENUM(NSInteger, ASDKNetworkReachabilityStatus) {
  */
 - (ASDKNetworkReachabilityStatus)networkReachabilityStatus;
 
+/**
+ * Returns the caching policy to be used when listing data filtered by the passed
+ * search text. Searches issued while the network is unreachable are answered by
+ * the local search index instead of failing on a remote request.
+ @param searchText Search text the listed data is filtered by.
+ @return Enum integer corresponding to a caching policy.
+ */
+- (ASDKServiceDataAccessorCachingPolicy)cachePolicyForSearchText:(NSString *)searchText;
+
 /**
  * Requests cancelation for all domain specific operations.
  */
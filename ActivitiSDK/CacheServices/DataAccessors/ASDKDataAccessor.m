@@ -42,6 +42,22 @@
 }
 
 
+#pragma mark -
+#pragma mark Getters
+
+- (ASDKServiceDataAccessorCachingPolicy)cachePolicy {
+    // While the cache is warming up cached data cannot be served in time, so
+    // hybrid requests go to the network only instead of waiting for the cache
+    if (ASDKServiceDataAccessorCachingPolicyHybrid == _cachePolicy &&
+        _cacheService &&
+        ![_cacheService isReady]) {
+        return ASDKServiceDataAccessorCachingPolicyAPIOnly;
+    }
+    
+    return _cachePolicy;
+}
+
+
 #pragma mark - 
 #pragma mark Public interface
 
@@ -70,6 +86,18 @@
     return ASDKNetworkReachabilityStatusUnknown;
 }
 
+- (ASDKServiceDataAccessorCachingPolicy)cachePolicyForSearchText:(NSString *)searchText {
+    ASDKServiceDataAccessorCachingPolicy cachePolicy = self.cachePolicy;
+    
+    if (searchText.length &&
+        ASDKServiceDataAccessorCachingPolicyHybrid == cachePolicy &&
+        ASDKNetworkReachabilityStatusNotReachable == [self networkReachabilityStatus]) {
+        return ASDKServiceDataAccessorCachingPolicyCacheOnly;
+    }
+    
+    return cachePolicy;
+}
+
 - (void)cancelOperations {
     // Implement in sublcasses.
 }
@@ -59,6 +59,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         _networkService = (ASDKAppNetworkServices *)[sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKAppNetworkServiceProtocol)];
         _networkService.resultsQueue = applicationsProcessingQueue;
         _cacheService = [ASDKApplicationCacheService new];
+        
+        // Group the cache writes of an operation chain into the save issued at its end
+        self.appCacheService.defersSavesUntilSaveChanges = YES;
     }
     
     return self;
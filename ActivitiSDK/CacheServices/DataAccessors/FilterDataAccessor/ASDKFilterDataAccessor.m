@@ -21,6 +21,7 @@
 // Constants
 #import "ASDKLogConfiguration.h"
 #import "ASDKLocalizationConstants.h"
+#import "ASDKNetworkServiceConstants.h"
 
 // Managers
 #import "ASDKBootstrap.h"
@@ -34,9 +35,12 @@
 // Models
 #import "ASDKDataAccessorResponseCollection.h"
 #import "ASDKFilterListRequestRepresentation.h"
+#import "ASDKModelPaging.h"
 
 static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLAG_TRACE;
 
+static NSUInteger const kASDKDefaultFilterCreationAttemptCount = 2;
+
 @interface ASDKFilterDataAccessor ()
 
 @property (strong, nonatomic) NSOperationQueue *processingQueue;
@@ -61,6 +65,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         _networkService = (ASDKFilterNetworkServices *)[sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKFilterNetworkServiceProtocol)];
         _networkService.resultsQueue = profileUpdatesProcessingQueue;
         _cacheService = [ASDKFilterCacheService new];
+        
+        // Group the cache writes of an operation chain into the save issued at its end
+        self.filterCacheService.defersSavesUntilSaveChanges = YES;
     }
     
     return self;
@@ -261,27 +268,6 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     }
 }
 
-- (void)createDefaultTaskFilterListForApplicationID:(NSString *)appID {
-    // Define operations
-    ASDKAsyncBlockOperation *createInvolvedTasksFilterOperation = [self createInvolvedTasksFilterForApplicationID:appID];
-    ASDKAsyncBlockOperation *createMyTasksFilterOperation = [self createMyTasksFilterForApplicationID:appID];
-    ASDKAsyncBlockOperation *createQueuedTasksFilterOperation = [self createQueuedTasksFilterForApplicationID:appID];
-    ASDKAsyncBlockOperation *createCompletedTasksFilterOperation = [self createCompletedTasksFilterForApplicationID:appID];
-    ASDKAsyncBlockOperation *refetchTaskFilterListOperation = [self refetchTaskFilterListForApplicationID:appID];
-    
-    [createMyTasksFilterOperation addDependency:createInvolvedTasksFilterOperation];
-    [createQueuedTasksFilterOperation addDependency:createMyTasksFilterOperation];
-    [createCompletedTasksFilterOperation addDependency:createQueuedTasksFilterOperation];
-    [refetchTaskFilterListOperation addDependency:createCompletedTasksFilterOperation];
-    [self.processingQueue addOperations:@[createInvolvedTasksFilterOperation,
-                                          createMyTasksFilterOperation,
-                                          createQueuedTasksFilterOperation,
-                                          createCompletedTasksFilterOperation,
-                                          refetchTaskFilterListOperation]
-                      waitUntilFinished:NO];
-    
-}
-
 - (ASDKAsyncBlockOperation *)remoteTaskFilterListForFilter:(ASDKFilterListRequestRepresentation *)filter {
     if ([self.delegate respondsToSelector:@selector(dataAccessorDidStartFetchingRemoteData:)]) {
         [self.delegate dataAccessorDidStartFetchingRemoteData:self];
@@ -298,33 +284,57 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
                                                            return;
                                                        }
                                                        
-                                                       if (!error && !filterList.count) {
-                                                           ASDKLogVerbose(@"There are no filters defined. Will populate with default ones...");
+                                                       NSArray *missingFilterRepresentations = error ? nil : [weakSelf missingDefaultTaskFilterRepresentationsForFilterList:filterList
+                                                                                                                                                                  applicationID:filter.appID];
+                                                       if (missingFilterRepresentations.count) {
+                                                           ASDKLogVerbose(@"There are %lu default filters missing. Will populate them...", (unsigned long)missingFilterRepresentations.count);
                                                            
-                                                           // Generate default filter operations and define additional dependency rules
-                                                           [weakSelf createDefaultTaskFilterListForApplicationID:filter.appID];
+                                                           // The filter list completed with the created default filters is reported
+                                                           // as the remote response and cached by the store operation depending on this one
+                                                           [weakSelf createDefaultTaskFilters:missingFilterRepresentations
+                                                                                forFilterList:filterList
+                                                                              completionBlock:^(NSArray *completedFilterList, NSError *creationError, ASDKModelPaging *creationPaging) {
+                                                                                  if (operation.isCancelled) {
+                                                                                      [operation complete];
+                                                                                      return;
+                                                                                  }
+                                                                                  
+                                                                                  [weakSelf handleRemoteTaskFilterList:completedFilterList
+                                                                                                                paging:creationPaging
+                                                                                                                 error:creationError
+                                                                                                          forOperation:operation];
+                                                                              }];
                                                        } else {
-                                                           ASDKDataAccessorResponseCollection *responseCollection =
-                                                           [[ASDKDataAccessorResponseCollection alloc] initWithCollection:filterList
-                                                                                                                   paging:paging
-                                                                                                             isCachedData:NO
-                                                                                                                    error:error];
-                                                           
-                                                           if (weakSelf.delegate) {
-                                                               [weakSelf.delegate dataAccessor:weakSelf
-                                                                           didLoadDataResponse:responseCollection];
-                                                           }
-                                                           
-                                                           operation.result = responseCollection;
+                                                           [weakSelf handleRemoteTaskFilterList:filterList
+                                                                                         paging:paging
+                                                                                          error:error
+                                                                                   forOperation:operation];
                                                        }
-                                                       
-                                                       [operation complete];
                                                    }];
     }];
     
     return remoteFilterListOperation;
 }
 
+- (void)handleRemoteTaskFilterList:(NSArray *)filterList
+                            paging:(ASDKModelPaging *)paging
+                             error:(NSError *)error
+                      forOperation:(ASDKAsyncBlockOperation *)operation {
+    ASDKDataAccessorResponseCollection *responseCollection =
+    [[ASDKDataAccessorResponseCollection alloc] initWithCollection:filterList
+                                                            paging:paging
+                                                      isCachedData:NO
+                                                             error:error];
+    
+    if (self.delegate) {
+        [self.delegate dataAccessor:self
+                didLoadDataResponse:responseCollection];
+    }
+    
+    operation.result = responseCollection;
+    [operation complete];
+}
+
 - (ASDKAsyncBlockOperation *)cachedTaskFilterListForFilter:(ASDKFilterListRequestRepresentation *)filter {
     __weak typeof(self) weakSelf = self;
     ASDKAsyncBlockOperation *cachedTaskFilterListOperation = [ASDKAsyncBlockOperation blockOperationWithBlock:^(ASDKAsyncBlockOperation * operation) {
@@ -392,158 +402,205 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     return storeInCacheOperation;
 }
 
-- (ASDKAsyncBlockOperation *)createInvolvedTasksFilterForApplicationID:(NSString *)appID {
-    __weak typeof(self) weakSelf = self;
-    ASDKAsyncBlockOperation *createFilterOperation = [ASDKAsyncBlockOperation blockOperationWithBlock:^(ASDKAsyncBlockOperation *operation) {
-        __strong typeof(self) strongSelf = weakSelf;
-        
-        ASDKFilterCreationRequestRepresentation *involvedTasksFilter = [ASDKFilterCreationRequestRepresentation new];
-        involvedTasksFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-        involvedTasksFilter.appID = appID;
-        involvedTasksFilter.icon = kASDKAPIIconNameInvolved;
-        involvedTasksFilter.index = 0;
-        involvedTasksFilter.name = ASDKLocalizedStringFromTable(kLocalizationDefaultFilterInvolvedTasksText, ASDKLocalizationTable, @"Involved tasks text");
-        
-        ASDKModelFilter *involvedFilter = [ASDKModelFilter new];
-        involvedFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-        involvedFilter.assignmentType = ASDKTaskAssignmentTypeInvolved;
-        involvedFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
-        involvedFilter.state = ASDKModelFilterStateTypeActive;
-        
-        involvedTasksFilter.filter = involvedFilter;
-        
-        [strongSelf.filterNetworkService createUserTaskFilterWithRepresentation:involvedTasksFilter
-                                                            withCompletionBlock:^(ASDKModelFilter *filter, NSError *error) {
-                                                                if (!error && filter) {
-                                                                    ASDKLogVerbose(@"Created default filter:%@", filter.name);
-                                                                } else {
-                                                                    ASDKLogError(@"An error occured while trying to create the default filter:%@.\nReason:%@", involvedTasksFilter.name, error.localizedDescription);
-                                                                }
-                                                                
-                                                                [operation complete];
-                                                            }];
+- (NSArray *)missingDefaultTaskFilterRepresentationsForFilterList:(NSArray *)filterList
+                                                    applicationID:(NSString *)appID {
+    NSArray *filterRepresentations = @[[self involvedTasksFilterRepresentationForApplicationID:appID],
+                                       [self myTasksFilterRepresentationForApplicationID:appID],
+                                       [self queuedTasksFilterRepresentationForApplicationID:appID],
+                                       [self completedTasksFilterRepresentationForApplicationID:appID]];
+    
+    // Default filters are populated for an empty filter list and completed when only
+    // some of them are defined, as left behind by a partially successful creation.
+    // Filter lists without any of the defaults are user defined and left as they are.
+    NSSet *filterNames = [NSSet setWithArray:[filterList valueForKey:@"name"]];
+    NSPredicate *missingFilterPredicate = [NSPredicate predicateWithBlock:^BOOL(ASDKFilterCreationRequestRepresentation *filterRepresentation, NSDictionary *bindings) {
+        return ![filterNames containsObject:filterRepresentation.name];
     }];
+    NSArray *missingFilterRepresentations = [filterRepresentations filteredArrayUsingPredicate:missingFilterPredicate];
     
-    return createFilterOperation;
+    if (filterList.count &&
+        missingFilterRepresentations.count == filterRepresentations.count) {
+        return @[];
+    }
+    
+    return missingFilterRepresentations;
 }
 
-- (ASDKAsyncBlockOperation *)createMyTasksFilterForApplicationID:(NSString *)appID {
-    __weak typeof(self) weakSelf = self;
-    ASDKAsyncBlockOperation *createFilterOperation = [ASDKAsyncBlockOperation blockOperationWithBlock:^(ASDKAsyncBlockOperation *operation) {
-        __strong typeof(self) strongSelf = weakSelf;
-        
-        ASDKFilterCreationRequestRepresentation *myTasksFilter = [ASDKFilterCreationRequestRepresentation new];
-        myTasksFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-        myTasksFilter.appID = appID;
-        myTasksFilter.icon = kASDKAPIIconNameMy;
-        myTasksFilter.index = 1;
-        myTasksFilter.name = ASDKLocalizedStringFromTable(kLocalizationDefaultFilterMyTasksText, ASDKLocalizationTable, "My tasks text");
-        
-        ASDKModelFilter *myFilter = [ASDKModelFilter new];
-        myFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-        myFilter.assignmentType = ASDKTaskAssignmentTypeAssignee;
-        myFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
-        myFilter.state = ASDKModelFilterStateTypeActive;
-        
-        myTasksFilter.filter = myFilter;
-        
-        [strongSelf.filterNetworkService createUserTaskFilterWithRepresentation:myTasksFilter
-                                                            withCompletionBlock:^(ASDKModelFilter *filter, NSError *error) {
-                                                                if (!error && filter) {
-                                                                    ASDKLogVerbose(@"Created default filter:%@", filter.name);
-                                                                } else {
-                                                                    ASDKLogError(@"An error occured while trying to create the default filter: %@.\nReason:%@", myTasksFilter.name, error.localizedDescription);
-                                                                }
-                                                                
-                                                                [operation complete];
-                                                            }];
-    }];
+- (void)createDefaultTaskFilters:(NSArray *)filterRepresentations
+                   forFilterList:(NSArray *)filterList
+                 completionBlock:(ASDKFilterListCompletionBlock)completionBlock {
+    // Created filters are slotted by position to preserve the default filter order
+    NSMutableArray *createdFilters = [NSMutableArray array];
+    for (NSUInteger idx = 0; idx < filterRepresentations.count; idx++) {
+        [createdFilters addObject:[NSNull null]];
+    }
     
-    return createFilterOperation;
+    [self createDefaultTaskFilters:filterRepresentations
+                    createdFilters:createdFilters
+                 remainingAttempts:kASDKDefaultFilterCreationAttemptCount
+                   completionBlock:^(NSArray *defaultFilterList, NSError *error, ASDKModelPaging *paging) {
+                       // A partially completed filter list is still usable and is reported
+                       // without the error so that it gets cached and displayed
+                       if (error) {
+                           ASDKLogError(@"%lu default filters couldn't be created and will be retried on the next fetch.", (unsigned long)(filterRepresentations.count - defaultFilterList.count));
+                       }
+                       
+                       NSArray *completedFilterList = filterList.count ? [filterList arrayByAddingObjectsFromArray:defaultFilterList] : defaultFilterList;
+                       
+                       ASDKModelPaging *completedPaging = [ASDKModelPaging new];
+                       completedPaging.size = completedFilterList.count;
+                       completedPaging.start = 0;
+                       completedPaging.total = completedFilterList.count;
+                       
+                       completionBlock(completedFilterList, nil, completedPaging);
+                   }];
 }
 
-- (ASDKAsyncBlockOperation *)createQueuedTasksFilterForApplicationID:(NSString *)appID {
-    __weak typeof(self) weakSelf = self;
-    ASDKAsyncBlockOperation *createFilterOperation = [ASDKAsyncBlockOperation blockOperationWithBlock:^(ASDKAsyncBlockOperation *operation) {
-        __strong typeof(self) strongSelf = weakSelf;
-        
-        ASDKFilterCreationRequestRepresentation *queuedTasksFilter = [ASDKFilterCreationRequestRepresentation new];
-        queuedTasksFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-        queuedTasksFilter.appID = appID;
-        queuedTasksFilter.icon = kASDKAPIIconNameQueued;
-        queuedTasksFilter.index = 2;
-        queuedTasksFilter.name = ASDKLocalizedStringFromTable(kLocalizationDefaultFilterQueuedTasksText, ASDKLocalizationTable, @"Queued tasks text");
-        
-        ASDKModelFilter *queuedFilter = [ASDKModelFilter new];
-        queuedFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-        queuedFilter.assignmentType = ASDKTaskAssignmentTypeCandidate;
-        queuedFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
-        queuedFilter.state = ASDKModelFilterStateTypeActive;
+- (void)createDefaultTaskFilters:(NSArray *)filterRepresentations
+                  createdFilters:(NSMutableArray *)createdFilters
+               remainingAttempts:(NSUInteger)remainingAttempts
+                 completionBlock:(ASDKFilterListCompletionBlock)completionBlock {
+    // The creation requests are independent of each other so the ones for the filters
+    // that were not created yet are issued at once and joined
+    __block NSError *creationError = nil;
+    dispatch_group_t creationGroup = dispatch_group_create();
+    
+    for (NSUInteger idx = 0; idx < filterRepresentations.count; idx++) {
+        if (createdFilters[idx] != [NSNull null]) {
+            continue;
+        }
         
-        queuedTasksFilter.filter = queuedFilter;
+        ASDKFilterCreationRequestRepresentation *filterRepresentation = filterRepresentations[idx];
         
-        [strongSelf.filterNetworkService createUserTaskFilterWithRepresentation:queuedTasksFilter
-                                                            withCompletionBlock:^(ASDKModelFilter *filter, NSError *error) {
-                                                                if (!error && filter) {
-                                                                    ASDKLogVerbose(@"Created default filter:%@", filter.name);
-                                                                } else {
-                                                                    ASDKLogError(@"An error occured while trying to create the default filter: %@.\nReason:%@", queuedTasksFilter.name, error.localizedDescription);
-                                                                }
-                                                                
-                                                                [operation complete];
-                                                            }];
-    }];
+        dispatch_group_enter(creationGroup);
+        [self.filterNetworkService createUserTaskFilterWithRepresentation:filterRepresentation
+                                                      withCompletionBlock:^(ASDKModelFilter *filter, NSError *error) {
+                                                          @synchronized (createdFilters) {
+                                                              if (!error && filter) {
+                                                                  ASDKLogVerbose(@"Created default filter:%@", filter.name);
+                                                                  createdFilters[idx] = filter;
+                                                              } else {
+                                                                  ASDKLogError(@"An error occured while trying to create the default filter:%@.\nReason:%@", filterRepresentation.name, error.localizedDescription);
+                                                                  creationError = error ? error : [self defaultFilterCreationError];
+                                                              }
+                                                          }
+                                                          
+                                                          dispatch_group_leave(creationGroup);
+                                                      }];
+    }
     
-    return createFilterOperation;
-}
-
-- (ASDKAsyncBlockOperation *)createCompletedTasksFilterForApplicationID:(NSString *)appID {
     __weak typeof(self) weakSelf = self;
-    ASDKAsyncBlockOperation *createFilterOperation = [ASDKAsyncBlockOperation blockOperationWithBlock:^(ASDKAsyncBlockOperation *operation) {
+    dispatch_group_notify(creationGroup, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
         __strong typeof(self) strongSelf = weakSelf;
         
-        ASDKFilterCreationRequestRepresentation *completedTasksFilter = [ASDKFilterCreationRequestRepresentation new];
-        completedTasksFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-        completedTasksFilter.appID = appID;
-        completedTasksFilter.icon = kASDKAPIIconNameCompleted;
-        completedTasksFilter.index = 3;
-        completedTasksFilter.name = ASDKLocalizedStringFromTable(kLocalizationDefaultFilterCompletedTasksText, ASDKLocalizationTable, @"Completed tasks text");
+        if (creationError && remainingAttempts > 1 && strongSelf) {
+            ASDKLogVerbose(@"Retrying the creation of the default filters that failed...");
+            [strongSelf createDefaultTaskFilters:filterRepresentations
+                                  createdFilters:createdFilters
+                               remainingAttempts:remainingAttempts - 1
+                                 completionBlock:completionBlock];
+            return;
+        }
         
-        ASDKModelFilter *completedFilter = [ASDKModelFilter new];
-        completedFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-        completedFilter.assignmentType = ASDKTaskAssignmentTypeInvolved;
-        completedFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
-        completedFilter.state = ASDKModelFilterStateTypeCompleted;
+        // The filters that were created exist on the server regardless of the ones that
+        // failed, so they are reported along with the error. The missing ones are looked
+        // up by name and created on the next fetch of the filter list.
+        NSArray *defaultFilterList = nil;
+        @synchronized (createdFilters) {
+            [createdFilters removeObjectIdenticalTo:[NSNull null]];
+            defaultFilterList = [createdFilters copy];
+        }
         
-        completedTasksFilter.filter = completedFilter;
+        ASDKModelPaging *paging = [ASDKModelPaging new];
+        paging.size = defaultFilterList.count;
+        paging.start = 0;
+        paging.total = defaultFilterList.count;
         
-        [strongSelf.filterNetworkService createUserTaskFilterWithRepresentation:completedTasksFilter
-                                                            withCompletionBlock:^(ASDKModelFilter *filter, NSError *error) {
-                                                                if (!error && filter) {
-                                                                    ASDKLogVerbose(@"Created default filter:%@", filter.name);
-                                                                } else {
-                                                                    ASDKLogError(@"An error occured while trying to create the default filter: %@.\nReason:%@", completedTasksFilter.name, error.localizedDescription);
-                                                                }
-                                                                
-                                                                [operation complete];
-                                                            }];
-    }];
+        completionBlock(defaultFilterList, creationError, paging);
+    });
+}
+
+- (NSError *)defaultFilterCreationError {
+    return [NSError errorWithDomain:ASDKNetworkServiceErrorDomain
+                               code:ASDKNetworkServiceErrorInvalidResponseFormat
+                           userInfo:nil];
+}
+
+- (ASDKFilterCreationRequestRepresentation *)involvedTasksFilterRepresentationForApplicationID:(NSString *)appID {
+    ASDKFilterCreationRequestRepresentation *involvedTasksFilter = [ASDKFilterCreationRequestRepresentation new];
+    involvedTasksFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    involvedTasksFilter.appID = appID;
+    involvedTasksFilter.icon = kASDKAPIIconNameInvolved;
+    involvedTasksFilter.index = 0;
+    involvedTasksFilter.name = ASDKLocalizedStringFromTable(kLocalizationDefaultFilterInvolvedTasksText, ASDKLocalizationTable, @"Involved tasks text");
     
-    return createFilterOperation;
+    ASDKModelFilter *involvedFilter = [ASDKModelFilter new];
+    involvedFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    involvedFilter.assignmentType = ASDKTaskAssignmentTypeInvolved;
+    involvedFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
+    involvedFilter.state = ASDKModelFilterStateTypeActive;
+    
+    involvedTasksFilter.filter = involvedFilter;
+    
+    return involvedTasksFilter;
 }
 
-- (ASDKAsyncBlockOperation *)refetchTaskFilterListForApplicationID:(NSString *)appID {
-    __weak typeof(self) weakSelf = self;
-    ASDKAsyncBlockOperation *refetchTaskFilterListOperation = [ASDKAsyncBlockOperation blockOperationWithBlock:^(ASDKAsyncBlockOperation *operation) {
-        __strong typeof(self) strongSelf = weakSelf;
-        
-        [strongSelf fetchTaskFilterListForApplicationID:appID];
-        [operation complete];
-    }];
+- (ASDKFilterCreationRequestRepresentation *)myTasksFilterRepresentationForApplicationID:(NSString *)appID {
+    ASDKFilterCreationRequestRepresentation *myTasksFilter = [ASDKFilterCreationRequestRepresentation new];
+    myTasksFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    myTasksFilter.appID = appID;
+    myTasksFilter.icon = kASDKAPIIconNameMy;
+    myTasksFilter.index = 1;
+    myTasksFilter.name = ASDKLocalizedStringFromTable(kLocalizationDefaultFilterMyTasksText, ASDKLocalizationTable, "My tasks text");
     
-    return refetchTaskFilterListOperation;
+    ASDKModelFilter *myFilter = [ASDKModelFilter new];
+    myFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    myFilter.assignmentType = ASDKTaskAssignmentTypeAssignee;
+    myFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
+    myFilter.state = ASDKModelFilterStateTypeActive;
+    
+    myTasksFilter.filter = myFilter;
+    
+    return myTasksFilter;
+}
+
+- (ASDKFilterCreationRequestRepresentation *)queuedTasksFilterRepresentationForApplicationID:(NSString *)appID {
+    ASDKFilterCreationRequestRepresentation *queuedTasksFilter = [ASDKFilterCreationRequestRepresentation new];
+    queuedTasksFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    queuedTasksFilter.appID = appID;
+    queuedTasksFilter.icon = kASDKAPIIconNameQueued;
+    queuedTasksFilter.index = 2;
+    queuedTasksFilter.name = ASDKLocalizedStringFromTable(kLocalizationDefaultFilterQueuedTasksText, ASDKLocalizationTable, @"Queued tasks text");
+    
+    ASDKModelFilter *queuedFilter = [ASDKModelFilter new];
+    queuedFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    queuedFilter.assignmentType = ASDKTaskAssignmentTypeCandidate;
+    queuedFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
+    queuedFilter.state = ASDKModelFilterStateTypeActive;
+    
+    queuedTasksFilter.filter = queuedFilter;
+    
+    return queuedTasksFilter;
 }
 
+- (ASDKFilterCreationRequestRepresentation *)completedTasksFilterRepresentationForApplicationID:(NSString *)appID {
+    ASDKFilterCreationRequestRepresentation *completedTasksFilter = [ASDKFilterCreationRequestRepresentation new];
+    completedTasksFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    completedTasksFilter.appID = appID;
+    completedTasksFilter.icon = kASDKAPIIconNameCompleted;
+    completedTasksFilter.index = 3;
+    completedTasksFilter.name = ASDKLocalizedStringFromTable(kLocalizationDefaultFilterCompletedTasksText, ASDKLocalizationTable, @"Completed tasks text");
+    
+    ASDKModelFilter *completedFilter = [ASDKModelFilter new];
+    completedFilter.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    completedFilter.assignmentType = ASDKTaskAssignmentTypeInvolved;
+    completedFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
+    completedFilter.state = ASDKModelFilterStateTypeCompleted;
+    
+    completedTasksFilter.filter = completedFilter;
+    
+    return completedTasksFilter;
+}
 
 #pragma mark -
 #pragma mark Service - Default process instance filter list
@@ -60,6 +60,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         _networkService = (ASDKIntegrationNetworkServices *)[sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKIntegrationNetworkServiceProtocol)];
         _networkService.resultsQueue = integrationUpdatesProcessingQueue;
         _cacheService = [ASDKIntegrationCacheService new];
+        
+        // Group the cache writes of an operation chain into the save issued at its end
+        self.integrationCacheService.defersSavesUntilSaveChanges = YES;
     }
     
     return self;
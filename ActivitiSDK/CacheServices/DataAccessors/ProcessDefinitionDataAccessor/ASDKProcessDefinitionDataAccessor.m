@@ -58,6 +58,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         _networkService = (ASDKProcessDefinitionNetworkServices *)[sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKProcessDefinitionNetworkServiceProtocol)];
         _networkService.resultsQueue = processUpdatesProcessingQueue;
         _cacheService = [ASDKProcessDefinitionCacheService new];
+        
+        // Group the cache writes of an operation chain into the save issued at its end
+        self.processDefinitionCacheService.defersSavesUntilSaveChanges = YES;
     }
     
     return self;
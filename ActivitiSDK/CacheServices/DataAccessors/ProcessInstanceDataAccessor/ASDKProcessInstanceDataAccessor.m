@@ -31,6 +31,8 @@
 #import "ASDKProcessInstanceCacheService.h"
 
 // Model
+#import "ASDKFilterRequestRepresentation.h"
+#import "ASDKModelFilter.h"
 #import "ASDKDataAccessorResponseCollection.h"
 #import "ASDKDataAccessorResponseModel.h"
 #import "ASDKDataAccessorResponseConfirmation.h"
@@ -61,6 +63,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         _networkService = (ASDKProcessInstanceNetworkServices *)[sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKProcessInstanceNetworkServiceProtocol)];
         _networkService.resultsQueue = processUpdatesProcessingQueue;
         _cacheService = [ASDKProcessInstanceCacheService new];
+        
+        // Group the cache writes of an operation chain into the save issued at its end
+        self.processInstanceCacheService.defersSavesUntilSaveChanges = YES;
     }
     
     return self;
@@ -80,7 +85,7 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     ASDKAsyncBlockOperation *completionOperation = [self defaultCompletionOperation];
     
     // Handle cache policies
-    switch (self.cachePolicy) {
+    switch ([self cachePolicyForSearchText:filter.filterModel.name]) {
         case ASDKServiceDataAccessorCachingPolicyCacheOnly: {
             [completionOperation addDependency:cachedProcessInstanceListOperation];
             [self.processingQueue addOperations:@[cachedProcessInstanceListOperation,
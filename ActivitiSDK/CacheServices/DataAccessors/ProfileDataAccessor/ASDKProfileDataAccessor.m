@@ -61,6 +61,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         _networkService = (ASDKProfileNetworkServices *)[sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKProfileNetworkServiceProtocol)];
         _networkService.resultsQueue = profileUpdatesProcessingQueue;
         _cacheService = [ASDKProfileCacheServices new];
+        
+        // Group the cache writes of an operation chain into the save issued at its end
+        self.profileCacheService.defersSavesUntilSaveChanges = YES;
     }
     
     return self;
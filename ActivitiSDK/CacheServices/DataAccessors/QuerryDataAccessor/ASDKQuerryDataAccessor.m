@@ -58,6 +58,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         _networkService = (ASDKQuerryNetworkServices *)[sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKQuerryNetworkServiceProtocol)];
         _networkService.resultsQueue = taskUpdatesprocessingQueue;
         _cacheService = [ASDKTaskCacheService new];
+        
+        // Group the cache writes of an operation chain into the save issued at its end
+        self.taskCacheService.defersSavesUntilSaveChanges = YES;
     }
     
     return self;
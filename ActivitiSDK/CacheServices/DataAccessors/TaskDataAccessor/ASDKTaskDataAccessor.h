@@ -37,6 +37,19 @@ ASDKTaskChecklistOrderRequestRepresentation;
  */
 - (void)fetchTasksWithFilter:(ASDKFilterRequestRepresentation *)filter;
 
+/**
+ * Requests a list of tasks for the current logged in user conforming to the properties
+ * of a provided filter, but instead of downloading and rebuilding the whole list only the
+ * tasks created since the last synchronization are fetched and applied to the cached list.
+ * The cached list is fully refreshed periodically to account for removed tasks. Requests
+ * that cannot be served incrementally are handled like fetchTasksWithFilter: does.
+ * Tasks older than the last synchronization that changed on the server are only picked up
+ * on such a refresh, so user initiated refreshes should use fetchTasksWithFilter: instead.
+ *
+ * @param filter Filter object describing which subset of the task list should be fetched
+ */
+- (void)synchronizeTasksWithFilter:(ASDKFilterRequestRepresentation *)filter;
+
 /**
  * Requests the details of a task and reports network or cached data through the designated
  * data accessor delegate.
@@ -26,12 +26,14 @@
 #import "ASDKTaskNetworkServices.h"
 #import "ASDKTaskCacheService.h"
 #import "ASDKServiceLocator.h"
+#import "ASDKTaskListDeltaSynchronizer.h"
 
 // Operations
 #import "ASDKAsyncBlockOperation.h"
 
 // Model
 #import "ASDKFilterRequestRepresentation.h"
+#import "ASDKModelFilter.h"
 #import "ASDKDataAccessorResponseCollection.h"
 #import "ASDKDataAccessorResponseProgress.h"
 #import "ASDKDataAccessorResponseModel.h"
@@ -48,7 +50,8 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
 
 @interface ASDKTaskDataAccessor ()
 
-@property (strong, nonatomic) NSOperationQueue *processingQueue;
+@property (strong, nonatomic) NSOperationQueue              *processingQueue;
+@property (strong, nonatomic) ASDKTaskListDeltaSynchronizer *taskListSynchronizer;
 
 @end
 
@@ -70,6 +73,11 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         _networkService = (ASDKTaskNetworkServices *)[sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKTaskNetworkServiceProtocol)];
         _networkService.resultsQueue = taskUpdatesProcessingQueue;
         _cacheService = [ASDKTaskCacheService new];
+        
+        // Group the cache writes of an operation chain into the save issued at its end
+        self.taskCacheService.defersSavesUntilSaveChanges = YES;
+        _taskListSynchronizer = [[ASDKTaskListDeltaSynchronizer alloc] initWithTaskNetworkService:(id<ASDKTaskNetworkServiceProtocol>)_networkService
+                                                                                 taskCacheService:(id<ASDKTaskCacheServiceProtocol>)_cacheService];
     }
     
     return self;
@@ -89,7 +97,7 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     ASDKAsyncBlockOperation *completionOperation = [self defaultCompletionOperation];
     
     // Handle cache policies
-    switch (self.cachePolicy) {
+    switch ([self cachePolicyForSearchText:filter.filterModel.name]) {
         case ASDKServiceDataAccessorCachingPolicyCacheOnly: {
             [completionOperation addDependency:cachedTaskListOperation];
             [self.processingQueue addOperations:@[cachedTaskListOperation,
@@ -122,6 +130,76 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     }
 }
 
+- (void)synchronizeTasksWithFilter:(ASDKFilterRequestRepresentation *)filter {
+    NSParameterAssert(filter);
+    
+    if (ASDKServiceDataAccessorCachingPolicyHybrid != self.cachePolicy ||
+        ![ASDKTaskListDeltaSynchronizer canSynchronizeTaskListWithFilter:filter]) {
+        [self fetchTasksWithFilter:filter];
+        return;
+    }
+    
+    // Define operations
+    ASDKAsyncBlockOperation *cachedTaskListOperation = [self cachedTaskListOperationForFilter:filter];
+    ASDKAsyncBlockOperation *synchronizeTaskListOperation = [self synchronizeTaskListOperationForFilter:filter];
+    ASDKAsyncBlockOperation *completionOperation = [self defaultCompletionOperation];
+    
+    [synchronizeTaskListOperation addDependency:cachedTaskListOperation];
+    [completionOperation addDependency:synchronizeTaskListOperation];
+    [self.processingQueue addOperations:@[cachedTaskListOperation,
+                                          synchronizeTaskListOperation,
+                                          completionOperation]
+                      waitUntilFinished:NO];
+}
+
+- (ASDKAsyncBlockOperation *)synchronizeTaskListOperationForFilter:(ASDKFilterRequestRepresentation *)filter {
+    if ([self.delegate respondsToSelector:@selector(dataAccessorDidStartFetchingRemoteData:)]) {
+        [self.delegate dataAccessorDidStartFetchingRemoteData:self];
+    }
+    
+    __weak typeof(self) weakSelf = self;
+    ASDKAsyncBlockOperation *synchronizeTaskListOperation = [ASDKAsyncBlockOperation blockOperationWithBlock:^(ASDKAsyncBlockOperation *operation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (operation.isCancelled) {
+            [operation complete];
+            return;
+        }
+        
+        [strongSelf.taskListSynchronizer synchronizeTaskListWithFilter:filter
+                                                       completionBlock:^(NSArray *taskList, ASDKModelPaging *paging, NSError *error) {
+                                                           if (operation.isCancelled) {
+                                                               [operation complete];
+                                                               return;
+                                                           }
+                                                           
+                                                           if (!error) {
+                                                               ASDKLogVerbose(@"Task list was successfully synchronized for filter.\nFilter: %@", filter);
+                                                               
+                                                               [weakSelf.taskCacheService saveChanges];
+                                                           } else {
+                                                               ASDKLogError(@"Encountered an error while synchronizing the task list for filter: %@. Reason:%@", filter, error.localizedDescription);
+                                                           }
+                                                           
+                                                           ASDKDataAccessorResponseCollection *responseCollection =
+                                                           [[ASDKDataAccessorResponseCollection alloc] initWithCollection:taskList
+                                                                                                                   paging:paging
+                                                                                                             isCachedData:NO
+                                                                                                                    error:error];
+                                                           
+                                                           if (weakSelf.delegate) {
+                                                               [weakSelf.delegate dataAccessor:weakSelf
+                                                                           didLoadDataResponse:responseCollection];
+                                                           }
+                                                           
+                                                           operation.result = responseCollection;
+                                                           [operation complete];
+                                                       }];
+    }];
+    
+    return synchronizeTaskListOperation;
+}
+
 - (ASDKAsyncBlockOperation *)remoteTaskListOperationForFilter:(ASDKFilterRequestRepresentation *)filter {
     if ([self.delegate respondsToSelector:@selector(dataAccessorDidStartFetchingRemoteData:)]) {
         [self.delegate dataAccessorDidStartFetchingRemoteData:self];
@@ -1363,6 +1441,8 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     if (self.delegate) {
         [self.delegate dataAccessor:self
                 didLoadDataResponse:response];
+        
+        [self.delegate dataAccessorDidFinishedLoadingDataResponse:self];
     }
 }
 
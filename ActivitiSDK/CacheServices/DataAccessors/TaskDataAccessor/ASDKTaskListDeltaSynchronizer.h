@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+@class ASDKFilterRequestRepresentation,
+ASDKModelPaging;
+@protocol ASDKTaskNetworkServiceProtocol,
+ASDKTaskCacheServiceProtocol;
+
+typedef void (^ASDKTaskListSynchronizationCompletionBlock) (NSArray *taskList, ASDKModelPaging *paging, NSError *error);
+
+@interface ASDKTaskListDeltaSynchronizer : NSObject
+
+/**
+ * Property meant to hold the interval after which a cached task list is fully refreshed
+ * instead of being updated incrementally. Tasks that left the list and were created
+ * before the window covered by the delta are only dropped on such a refresh.
+ */
+@property (assign, nonatomic) NSTimeInterval    reconciliationInterval;
+
+/**
+ * Property meant to hold the maximum number of pages requested while looking for the high
+ * water mark. When more tasks than that changed a full refresh is performed instead.
+ */
+@property (assign, nonatomic) NSUInteger        maxDeltaPageCount;
+
+/**
+ * Designated initializer allowing the services used to fetch and cache task lists to be provided.
+ *
+ * @param taskNetworkService    Network service used to fetch task list pages
+ * @param taskCacheService      Cache service holding the task lists and their synchronization state
+ */
+- (instancetype)initWithTaskNetworkService:(id<ASDKTaskNetworkServiceProtocol>)taskNetworkService
+                          taskCacheService:(id<ASDKTaskCacheServiceProtocol>)taskCacheService;
+
+/**
+ * Returns whether the task list described by the passed filter can be synchronized
+ * incrementally. Only the first page of a list sorted by creation date in descending order
+ * and not narrowed down by a name can be, because the high water mark is the creation date
+ * of the newest known task.
+ *
+ * @param filter Filter object describing the task list
+ *
+ * @return       YES if the list supports delta synchronization, NO otherwise
+ */
++ (BOOL)canSynchronizeTaskListWithFilter:(ASDKFilterRequestRepresentation *)filter;
+
+/**
+ * Brings the cached task list described by the passed filter up to date with the server and
+ * reports the requested page as read from the cache. Only the tasks created after the high
+ * water mark of the list are downloaded and applied to the existing list. Lists that were
+ * never synchronized or whose reconciliation interval elapsed are fully refreshed.
+ *
+ * @param filter            Filter object describing the task list
+ * @param completionBlock   Completion block providing the task list page, paging information
+ *                          and an optional error reason
+ */
+- (void)synchronizeTaskListWithFilter:(ASDKFilterRequestRepresentation *)filter
+                      completionBlock:(ASDKTaskListSynchronizationCompletionBlock)completionBlock;
+
+@end
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKTaskListDeltaSynchronizer.h"
+
+// Constants
+#import "ASDKLogConfiguration.h"
+
+// Services
+#import "ASDKTaskNetworkServiceProtocol.h"
+#import "ASDKTaskCacheService.h"
+
+// Models
+#import "ASDKFilterRequestRepresentation.h"
+#import "ASDKModelFilter.h"
+#import "ASDKModelPaging.h"
+#import "ASDKModelTask.h"
+
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
+
+static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLAG_TRACE;
+
+static NSTimeInterval const kASDKTaskListReconciliationInterval = 30 * 60.0f;
+static NSUInteger const kASDKTaskListMaxDeltaPageCount          = 4;
+
+@interface ASDKTaskListDeltaSynchronizer ()
+
+// Service aggregation
+@property (strong, nonatomic) id<ASDKTaskNetworkServiceProtocol>    taskNetworkService;
+@property (strong, nonatomic) id<ASDKTaskCacheServiceProtocol>      taskCacheService;
+
+@end
+
+@implementation ASDKTaskListDeltaSynchronizer
+
+
+#pragma mark -
+#pragma mark Life cycle
+
+- (instancetype)initWithTaskNetworkService:(id<ASDKTaskNetworkServiceProtocol>)taskNetworkService
+                          taskCacheService:(id<ASDKTaskCacheServiceProtocol>)taskCacheService {
+    self = [super init];
+    
+    if (self) {
+        _taskNetworkService = taskNetworkService;
+        _taskCacheService = taskCacheService;
+        _reconciliationInterval = kASDKTaskListReconciliationInterval;
+        _maxDeltaPageCount = kASDKTaskListMaxDeltaPageCount;
+    }
+    
+    return self;
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
++ (BOOL)canSynchronizeTaskListWithFilter:(ASDKFilterRequestRepresentation *)filter {
+    return (!filter.page &&
+            filter.size > 0 &&
+            !filter.filterModel.name.length &&
+            ASDKModelFilterSortTypeCreatedDesc == filter.filterModel.sortType);
+}
+
+- (void)synchronizeTaskListWithFilter:(ASDKFilterRequestRepresentation *)filter
+                      completionBlock:(ASDKTaskListSynchronizationCompletionBlock)completionBlock {
+    NSParameterAssert(filter);
+    NSParameterAssert(completionBlock);
+    
+    if (![ASDKTaskListDeltaSynchronizer canSynchronizeTaskListWithFilter:filter]) {
+        [self refreshTaskListWithFilter:filter
+                        completionBlock:completionBlock];
+        return;
+    }
+    
+    __weak typeof(self) weakSelf = self;
+    [self.taskCacheService fetchTaskListSyncStateUsingFilter:filter
+                                         withCompletionBlock:^(NSDate *highWaterMarkDate, NSDate *reconciliationDate, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        BOOL isReconciliationDue = (error ||
+                                    !reconciliationDate ||
+                                    fabs(reconciliationDate.timeIntervalSinceNow) >= strongSelf.reconciliationInterval);
+        if (isReconciliationDue) {
+            ASDKLogVerbose(@"Task list needs to be reconciled with the server. Performing a full refresh for filter:%@", filter);
+            [strongSelf refreshTaskListWithFilter:filter
+                                  completionBlock:completionBlock];
+        } else {
+            [strongSelf fetchTaskListDeltaWithFilter:filter
+                                   highWaterMarkDate:highWaterMarkDate
+                                           pageIndex:0
+                                    accumulatedTasks:[NSMutableArray array]
+                                        serverPaging:nil
+                                     completionBlock:completionBlock];
+        }
+    }];
+}
+
+
+#pragma mark -
+#pragma mark Private interface
+
+- (void)refreshTaskListWithFilter:(ASDKFilterRequestRepresentation *)filter
+                  completionBlock:(ASDKTaskListSynchronizationCompletionBlock)completionBlock {
+    __weak typeof(self) weakSelf = self;
+    [self.taskNetworkService fetchTaskListWithFilterRepresentation:filter
+                                                   completionBlock:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (error) {
+            completionBlock(nil, nil, error);
+            return;
+        }
+        
+        // Rebuilding the list also resets its high water mark and reconciliation date
+        [strongSelf.taskCacheService cacheTaskList:taskList
+                                       usingFilter:filter
+                               withCompletionBlock:^(NSError *cacheError) {
+                                   if (cacheError) {
+                                       ASDKLogError(@"Encountered an error while caching the task list for filter: %@. Reason:%@", filter, cacheError.localizedDescription);
+                                   }
+                                   
+                                   completionBlock(taskList, paging, nil);
+                               }];
+    }];
+}
+
+- (void)fetchTaskListDeltaWithFilter:(ASDKFilterRequestRepresentation *)filter
+                   highWaterMarkDate:(NSDate *)highWaterMarkDate
+                           pageIndex:(NSUInteger)pageIndex
+                    accumulatedTasks:(NSMutableArray *)accumulatedTasks
+                        serverPaging:(ASDKModelPaging *)serverPaging
+                     completionBlock:(ASDKTaskListSynchronizationCompletionBlock)completionBlock {
+    ASDKFilterRequestRepresentation *pageFilter = [filter copy];
+    pageFilter.page = pageIndex;
+    
+    __weak typeof(self) weakSelf = self;
+    [self.taskNetworkService fetchTaskListWithFilterRepresentation:pageFilter
+                                                   completionBlock:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (error) {
+            completionBlock(nil, nil, error);
+            return;
+        }
+        
+        [accumulatedTasks addObjectsFromArray:taskList];
+        
+        // Pages are sorted by creation date in descending order so the delta is
+        // complete once a task that is not newer than the high water mark shows up
+        ASDKModelTask *oldestTask = taskList.lastObject;
+        BOOL isListExhausted = (taskList.count < (NSUInteger)filter.size ||
+                                paging.start + (NSInteger)taskList.count >= paging.total);
+        BOOL isHighWaterMarkReached = (highWaterMarkDate &&
+                                       oldestTask.creationDate &&
+                                       NSOrderedDescending != [oldestTask.creationDate compare:highWaterMarkDate]);
+        
+        if (isListExhausted || isHighWaterMarkReached) {
+            // When the whole list was downloaded every cached member can be reconciled
+            NSDate *windowStartDate = isListExhausted ? nil : oldestTask.creationDate;
+            [strongSelf applyTaskListDelta:accumulatedTasks
+                                withFilter:filter
+                           windowStartDate:windowStartDate
+                              serverPaging:serverPaging ? serverPaging : paging
+                           completionBlock:completionBlock];
+        } else if (pageIndex + 1 >= strongSelf.maxDeltaPageCount) {
+            ASDKLogVerbose(@"Task list changed beyond %lu pages. Performing a full refresh for filter:%@", (unsigned long)strongSelf.maxDeltaPageCount, filter);
+            [strongSelf refreshTaskListWithFilter:filter
+                                  completionBlock:completionBlock];
+        } else {
+            [strongSelf fetchTaskListDeltaWithFilter:filter
+                                   highWaterMarkDate:highWaterMarkDate
+                                           pageIndex:pageIndex + 1
+                                    accumulatedTasks:accumulatedTasks
+                                        serverPaging:serverPaging ? serverPaging : paging
+                                     completionBlock:completionBlock];
+        }
+    }];
+}
+
+- (void)applyTaskListDelta:(NSArray *)taskList
+                withFilter:(ASDKFilterRequestRepresentation *)filter
+           windowStartDate:(NSDate *)windowStartDate
+              serverPaging:(ASDKModelPaging *)serverPaging
+           completionBlock:(ASDKTaskListSynchronizationCompletionBlock)completionBlock {
+    ASDKLogVerbose(@"Applying %lu changed tasks to the cached task list for filter:%@", (unsigned long)taskList.count, filter);
+    
+    __weak typeof(self) weakSelf = self;
+    [self.taskCacheService applyTaskListDelta:taskList
+                                  usingFilter:filter
+                              windowStartDate:windowStartDate
+                          withCompletionBlock:^(NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (error) {
+            ASDKLogError(@"Cannot apply the task list delta for filter: %@. Reason:%@. Performing a full refresh.", filter, error.localizedDescription);
+            [strongSelf refreshTaskListWithFilter:filter
+                                  completionBlock:completionBlock];
+            return;
+        }
+        
+        [strongSelf.taskCacheService fetchTaskList:^(NSArray *cachedTaskList, NSError *cacheError, ASDKModelPaging *paging) {
+            // The cached list might hold fewer tasks than the server when later pages
+            // were never loaded, so report the server total for further paging
+            ASDKModelPaging *responsePaging = [ASDKModelPaging new];
+            responsePaging.start = paging.start;
+            responsePaging.size = cachedTaskList.count;
+            responsePaging.total = MAX(paging.total, serverPaging.total);
+            
+            completionBlock(cachedTaskList ? cachedTaskList : @[], responsePaging, cacheError);
+        } usingFilter:filter];
+    }];
+}
+
+@end
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+@class ASDKFormFieldValueRequestRepresentation;
+
+@interface ASDKFormSaveJournalEntry : NSObject
+
+/**
+ *  Property meant to hold the ID of the task for which the form values were saved
+ */
+@property (strong, nonatomic) NSString                                  *taskID;
+
+/**
+ *  Property meant to hold the form field values that are pending upload
+ */
+@property (strong, nonatomic) ASDKFormFieldValueRequestRepresentation   *formFieldValueRequestRepresentation;
+
+/**
+ *  Property meant to hold the revision of the journal entry. The revision is bumped
+ *  every time the user saves the form again while offline so that a replayed save
+ *  can only remove the exact content it uploaded.
+ */
+@property (assign, nonatomic) int64_t                                   revision;
+
+/**
+ *  Property meant to hold the number of failed upload attempts for the current revision
+ */
+@property (assign, nonatomic) NSInteger                                 attemptCount;
+
+/**
+ *  Property meant to hold the date when the entry was first journaled. Entries are
+ *  replayed in this order.
+ */
+@property (strong, nonatomic) NSDate                                    *journalDate;
+
+/**
+ *  Property meant to hold the earliest date at which a new upload attempt can be made
+ */
+@property (strong, nonatomic) NSDate                                    *nextAttemptDate;
+
+@end
@@ -18,8 +18,48 @@
 
 #import <Foundation/Foundation.h>
 
+@class ASDKReachabilityManager;
+@protocol ASDKFormNetworkServiceProtocol,
+ASDKFormCacheServicesProtocol;
+
 @interface ASDKNetworkDelayedOperationSaveFormService : NSObject
 
+/**
+ * Property meant to hold the maximum number of saved forms that are uploaded in parallel
+ */
+@property (assign, nonatomic) NSUInteger        maxConcurrentSaveCount;
+
+/**
+ * Property meant to hold the delay after which a failed upload is retried for the first
+ * time. Subsequent failures double the delay up to maxRetryInterval and a random jitter
+ * is applied so that forms failing together are not retried together. Forms rejected with
+ * a client error other than 408 or 429 are not retried and are dropped from the journal.
+ */
+@property (assign, nonatomic) NSTimeInterval    baseRetryInterval;
+
+/**
+ * Property meant to hold the upper bound of the delay between two upload attempts
+ */
+@property (assign, nonatomic) NSTimeInterval    maxRetryInterval;
+
+/**
+ * Property meant to hold the interval the network must stay reachable before saved forms
+ * are replayed. Connectivity changes within this interval are coalesced into a single replay.
+ */
+@property (assign, nonatomic) NSTimeInterval    reachabilitySettleInterval;
+
+/**
+ * Designated initializer allowing the services used to upload and journal saved forms to be
+ * provided. When no reachability manager is passed replays are only triggered explicitly.
+ *
+ * @param formNetworkService    Network service used to upload saved forms
+ * @param formCacheService      Cache service holding the journal of saved forms
+ * @param reachabilityManager   Reachability manager signaling connectivity changes
+ */
+- (instancetype)initWithFormNetworkService:(id<ASDKFormNetworkServiceProtocol>)formNetworkService
+                          formCacheService:(id<ASDKFormCacheServicesProtocol>)formCacheService
+                       reachabilityManager:(ASDKReachabilityManager *)reachabilityManager;
+
 /**
  * Method triggering all the connectivity restoration checks for a given service
  */
@@ -20,65 +20,112 @@
 
 // Constants
 #import "ASDKLogConfiguration.h"
+#import "ASDKHTTPCodes.h"
 
 // Operations
 #import "ASDKAsyncBlockOperation.h"
 
 // Services
-#import "ASDKFormDataAccessor.h"
+#import "ASDKBootstrap.h"
+#import "ASDKServiceLocator.h"
+#import "ASDKFormNetworkServiceProtocol.h"
+#import "ASDKFormCacheService.h"
 
 // Managers
 #import "ASDKReachabilityManager.h"
 #import "ASDKKVOManager.h"
-#import "ASDKDataAccessorOperation.h"
 
 // Models
-#import "ASDKDataAccessorResponseFormFieldValueRepresentations.h"
-#import "ASDKDataAccessorResponseConfirmation.h"
+#import "ASDKFormSaveJournalEntry.h"
 
-typedef NS_ENUM(NSInteger, ASDKNetworkReachabilityOperationType) {
-    ASDKNetworkReachabilityOperationTypeUndefined = -1,
-    ASDKNetworkReachabilityOperationTypeSubmitSavedForms = 1
-};
+@import AFNetworking;
 
-typedef NS_ENUM(NSInteger, ASDKNetworkReachabilityUserInfoParamType) {
-    ASDKNetworkReachabilityUserInfoParamTypeUndefined = -1,
-    ASDKNetworkReachabilityUserInfoParamTypeOperation,
-    ASDKNetworkReachabilityUserInfoParamTypeID,
-    ASDKNetworkReachabilityUserInfoParamTypeRetry,
-    ASDKNetworkReachabilityUserInfoParamTypeFormFieldValueRequestRepresentation
-};
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
 
-@interface ASDKNetworkDelayedOperationSaveFormService () <ASDKDataAccessorDelegate,
-                                                  ASDKDataAccessorOperationProtocol>
+static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLAG_TRACE;
+
+static NSUInteger const kASDKSaveFormMaxConcurrentSaveCount             = 3;
+static NSTimeInterval const kASDKSaveFormBaseRetryInterval              = 2.0f;
+static NSTimeInterval const kASDKSaveFormMaxRetryInterval               = 300.0f;
+static NSTimeInterval const kASDKSaveFormReachabilitySettleInterval     = 3.0f;
+
+@interface ASDKNetworkDelayedOperationSaveFormService ()
 
 // Service aggregation
-@property (strong, nonatomic) ASDKFormDataAccessor   *fetchFormFieldValueDataAccessor;
-@property (strong, nonatomic) ASDKFormDataAccessor   *deleteFormFieldValueDataAccessor;
+@property (strong, nonatomic) id<ASDKFormNetworkServiceProtocol>    formNetworkService;
+@property (strong, nonatomic) id<ASDKFormCacheServicesProtocol>     formCacheService;
 
 // Internal state
-@property (strong, nonatomic) ASDKReachabilityManager *reachabilityManager;
-@property (strong, nonatomic) ASDKKVOManager          *kvoManager;
-@property (strong, nonatomic) NSOperationQueue        *processingQueue;
-@property (strong, nonatomic) NSMutableArray          *taskIDs;
-@property (strong, nonatomic) NSMutableArray          *operationsToRetry;
+@property (strong, nonatomic) ASDKReachabilityManager               *reachabilityManager;
+@property (strong, nonatomic) ASDKKVOManager                        *kvoManager;
+@property (strong, nonatomic) NSOperationQueue                      *processingQueue;
+
+/**
+ *  Property meant to hold a reference to the serial queue on which the replay state
+ *  is mutated and journal responses are handled
+ */
+@property (strong, nonatomic) dispatch_queue_t                      journalQueue;
+
+/**
+ *  Property meant to hold the IDs of the tasks for which an upload is queued or running.
+ *  At most one upload per form is in flight at any given time.
+ */
+@property (strong, nonatomic) NSMutableSet                          *inFlightTaskIDs;
+
+/**
+ *  Property meant to hold the date of the next scheduled replay. A token is bumped on
+ *  every (re)scheduling so that superseded timers are ignored when they fire.
+ */
+@property (strong, nonatomic) NSDate                                *scheduledReplayDate;
+@property (assign, nonatomic) NSUInteger                            replayScheduleToken;
+
+/**
+ *  Property meant to hold a counter bumped every time an upload outcome is written to
+ *  the journal. Journal snapshots read before the last write are discarded.
+ */
+@property (assign, nonatomic) NSUInteger                            journalGeneration;
+
+@property (assign, nonatomic) BOOL                                  isFetchingJournal;
+@property (assign, nonatomic) BOOL                                  needsJournalRefetch;
 
 @end
 
 @implementation ASDKNetworkDelayedOperationSaveFormService
 
+
+#pragma mark -
+#pragma mark Life cycle
+
 - (instancetype)init {
+    return [self initWithFormNetworkService:nil
+                           formCacheService:[ASDKFormCacheService new]
+                        reachabilityManager:[ASDKReachabilityManager new]];
+}
+
+- (instancetype)initWithFormNetworkService:(id<ASDKFormNetworkServiceProtocol>)formNetworkService
+                          formCacheService:(id<ASDKFormCacheServicesProtocol>)formCacheService
+                       reachabilityManager:(ASDKReachabilityManager *)reachabilityManager {
     self = [super init];
     if (self) {
+        _formNetworkService = formNetworkService;
+        _formCacheService = formCacheService;
+        _reachabilityManager = reachabilityManager;
+        _maxConcurrentSaveCount = kASDKSaveFormMaxConcurrentSaveCount;
+        _baseRetryInterval = kASDKSaveFormBaseRetryInterval;
+        _maxRetryInterval = kASDKSaveFormMaxRetryInterval;
+        _reachabilitySettleInterval = kASDKSaveFormReachabilitySettleInterval;
         _processingQueue = [NSOperationQueue new];
-        _processingQueue.maxConcurrentOperationCount = 1;
-        _taskIDs = [NSMutableArray array];
-        _operationsToRetry = [NSMutableArray array];
-        _reachabilityManager = [ASDKReachabilityManager new];
-        _fetchFormFieldValueDataAccessor = [[ASDKFormDataAccessor alloc] initWithDelegate:self];
-        _deleteFormFieldValueDataAccessor = [[ASDKFormDataAccessor alloc] initWithDelegate:self];
+        _processingQueue.maxConcurrentOperationCount = _maxConcurrentSaveCount;
+        _journalQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.`%@JournalQueue",
+                                                [NSBundle bundleForClass:[self class]].bundleIdentifier,
+                                                NSStringFromClass([self class])] UTF8String], DISPATCH_QUEUE_SERIAL);
+        _inFlightTaskIDs = [NSMutableSet set];
         
-        [self handleBindingsForNetworkConnectivity];
+        if (_reachabilityManager) {
+            [self handleBindingsForNetworkConnectivity];
+        }
     }
     return self;
 }
@@ -86,127 +133,287 @@ typedef NS_ENUM(NSInteger, ASDKNetworkReachabilityUserInfoParamType) {
 - (void)dealloc {
     [self.kvoManager removeObserver:_reachabilityManager
                          forKeyPath:NSStringFromSelector(@selector(networkReachabilityStatus))];
-    [self.kvoManager removeObserver:_processingQueue
-                         forKeyPath:NSStringFromSelector(@selector(operationCount))];
 }
 
 
 #pragma mark -
-#pragma mark Private interface
+#pragma mark Public interface
 
-- (void)runNetworkConnectivityRestorationChecks {
-    // Check for saved forms submitted for upload and try to reupload them
-    [self.fetchFormFieldValueDataAccessor fetchAllFormFieldValueRequestRepresentations];
+- (void)setMaxConcurrentSaveCount:(NSUInteger)maxConcurrentSaveCount {
+    _maxConcurrentSaveCount = maxConcurrentSaveCount;
+    self.processingQueue.maxConcurrentOperationCount = maxConcurrentSaveCount;
 }
 
-- (void)removeSaveFormFieldValues {
-    [self.deleteFormFieldValueDataAccessor removeStalledFormFieldValueRepresentationsForTaskIDs:self.taskIDs];
+- (void)runNetworkConnectivityRestorationChecks {
+    // Check for saved forms submitted for upload and try to reupload them
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.journalQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        [strongSelf cancelScheduledReplay];
+        [strongSelf replayJournal];
+    });
 }
 
 
 #pragma mark -
-#pragma mark ASDKDataAccessorDelegate
+#pragma mark Replay
 
-- (void)dataAccessor:(id<ASDKServiceDataAccessorProtocol>)dataAccessor
- didLoadDataResponse:(ASDKDataAccessorResponseBase *)response {
-    if (self.fetchFormFieldValueDataAccessor == dataAccessor) {
-        [self handleFetchFormFieldValueDataAccessorResponse:response];
+- (void)replayJournal {
+    // Coalesce replay requests issued while the journal is being read
+    if (self.isFetchingJournal) {
+        self.needsJournalRefetch = YES;
+        return;
     }
+    self.isFetchingJournal = YES;
+    NSUInteger journalGeneration = self.journalGeneration;
+    
+    // Connectivity is restored far more often than forms are saved offline, so the
+    // pending entries are counted before the journal and its values are loaded
+    __weak typeof(self) weakSelf = self;
+    [self.formCacheService fetchFormSaveJournalEntryCountForTaskID:nil
+                                                   completionBlock:^(NSUInteger entryCount, NSError *error) {
+                                                       __strong typeof(self) strongSelf = weakSelf;
+                                                       
+                                                       if (!error && !entryCount) {
+                                                           [strongSelf handleFetchedJournalEntries:@[]
+                                                                                             error:nil
+                                                                             forJournalGeneration:journalGeneration];
+                                                           return;
+                                                       }
+                                                       
+                                                       [strongSelf.formCacheService fetchFormSaveJournalEntriesWithCompletionBlock:^(NSArray *journalEntries, NSError *fetchError) {
+                                                           [weakSelf handleFetchedJournalEntries:journalEntries
+                                                                                           error:fetchError
+                                                                           forJournalGeneration:journalGeneration];
+                                                       }];
+                                                   }];
 }
 
-- (void)dataAccessorDidFinishedLoadingDataResponse:(id<ASDKServiceDataAccessorProtocol>)dataAccessor {
-    if (self.deleteFormFieldValueDataAccessor == dataAccessor) {
-        [self.taskIDs removeAllObjects];
-        [self handleRetryForFailedOperations];
-    }
+- (void)handleFetchedJournalEntries:(NSArray *)journalEntries
+                              error:(NSError *)error
+               forJournalGeneration:(NSUInteger)journalGeneration {
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.journalQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        strongSelf.isFetchingJournal = NO;
+        
+        if (journalGeneration != strongSelf.journalGeneration) {
+            // An upload outcome was recorded while reading, the snapshot might
+            // still list removed entries or miss retry dates
+            strongSelf.needsJournalRefetch = YES;
+        } else if (!error) {
+            [strongSelf enqueueSaveOperationsForJournalEntries:journalEntries];
+        } else {
+            ASDKLogError(@"An error occured while fetching the saved forms journal. Reason:%@", error.localizedDescription);
+        }
+        
+        if (strongSelf.needsJournalRefetch) {
+            strongSelf.needsJournalRefetch = NO;
+            [strongSelf replayJournal];
+        }
+    });
 }
 
-
-#pragma mark -
-#pragma mark ASDKDataAccessorOperationProtocol
-
-- (void)dataAccessorOperation:(ASDKDataAccessorOperation *)operation
-             withDataAccessor:(id<ASDKServiceDataAccessorProtocol>)dataAccessor
-          didLoadDataResponse:(ASDKDataAccessorResponseBase *)response {
-    if ([operation.userInfo[@(ASDKNetworkReachabilityUserInfoParamTypeOperation)] isEqual:@(ASDKNetworkReachabilityOperationTypeSubmitSavedForms)]) {
-        [self handleSaveFormOperation:operation
-                     withDataAccessor:dataAccessor
-                         withResponse:response];
+- (void)enqueueSaveOperationsForJournalEntries:(NSArray *)journalEntries {
+    NSDate *currentDate = [NSDate date];
+    NSDate *earliestAttemptDate = nil;
+    
+    // Entries are delivered in the order they were journaled and the processing
+    // queue starts them in the same order
+    for (ASDKFormSaveJournalEntry *journalEntry in journalEntries) {
+        if ([self.inFlightTaskIDs containsObject:journalEntry.taskID]) {
+            continue;
+        }
+        
+        if (NSOrderedDescending == [journalEntry.nextAttemptDate compare:currentDate]) {
+            earliestAttemptDate = earliestAttemptDate ? [earliestAttemptDate earlierDate:journalEntry.nextAttemptDate] : journalEntry.nextAttemptDate;
+            continue;
+        }
+        
+        [self.inFlightTaskIDs addObject:journalEntry.taskID];
+        [self.processingQueue addOperation:[self saveOperationForJournalEntry:journalEntry]];
+    }
+    
+    if (earliestAttemptDate) {
+        [self scheduleReplayAfterInterval:[earliestAttemptDate timeIntervalSinceDate:currentDate]];
     }
 }
 
-- (void)dataAccessorOperation:(ASDKDataAccessorOperation *)operation
-didFinishedLoadingDataResponse:(id<ASDKServiceDataAccessorProtocol>)dataAccessor {
+- (ASDKAsyncBlockOperation *)saveOperationForJournalEntry:(ASDKFormSaveJournalEntry *)journalEntry {
+    __weak typeof(self) weakSelf = self;
+    ASDKAsyncBlockOperation *saveOperation = [ASDKAsyncBlockOperation blockOperationWithBlock:^(ASDKAsyncBlockOperation *operation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (operation.isCancelled) {
+            dispatch_async(strongSelf.journalQueue, ^{
+                [strongSelf.inFlightTaskIDs removeObject:journalEntry.taskID];
+                [operation complete];
+            });
+            return;
+        }
+        
+        [[strongSelf currentFormNetworkService] saveFormForTaskID:journalEntry.taskID
+                         withFormFieldValuesRequestRepresentation:journalEntry.formFieldValueRequestRepresentation
+                                                  completionBlock:^(BOOL isFormSaved, NSError *error) {
+                                                      dispatch_async(strongSelf.journalQueue, ^{
+                                                          if (isFormSaved) {
+                                                              [strongSelf handleSuccessfulSaveForJournalEntry:journalEntry
+                                                                                                    operation:operation];
+                                                          } else {
+                                                              [strongSelf handleFailedSaveForJournalEntry:journalEntry
+                                                                                                    error:error
+                                                                                                operation:operation];
+                                                          }
+                                                      });
+                                                  }];
+    }];
+    
+    return saveOperation;
 }
 
 
 #pragma mark -
 #pragma mark Operation handlers
 
-- (void)handleFetchFormFieldValueDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
-    ASDKDataAccessorResponseFormFieldValueRepresentations *formFieldValueRepresentationsResponse = (ASDKDataAccessorResponseFormFieldValueRepresentations *)response;
+- (void)handleSuccessfulSaveForJournalEntry:(ASDKFormSaveJournalEntry *)journalEntry
+                                  operation:(ASDKAsyncBlockOperation *)operation {
+    ASDKLogVerbose(@"Saved form for task: %@ was uploaded successfully.", journalEntry.taskID);
     
-    if (!formFieldValueRepresentationsResponse.error) {
-        NSArray *formFieldValueRepresentationArr = formFieldValueRepresentationsResponse.formFieldValueRepresentations;
-        NSArray *taskIDsArr = formFieldValueRepresentationsResponse.taskIDs;
-        
-        for (int idx = 0; idx < formFieldValueRepresentationArr.count; idx++) {
-            ASDKFormFieldValueRequestRepresentation *formFieldValueRequestRepresentation = formFieldValueRepresentationArr[idx];
-            NSString *taskID = taskIDsArr[idx];
-            
-            ASDKFormDataAccessor *saveFormDataAccessor = [[ASDKFormDataAccessor alloc] initWithDelegate:self];
-            ASDKDataAccessorOperation *dataAccessorOperation = [[ASDKDataAccessorOperation alloc] initWithDataAccessor:saveFormDataAccessor
-                                                                                                              delegate:self];
-            saveFormDataAccessor.delegate = dataAccessorOperation;
-            dataAccessorOperation.userInfo =
-            @{@(ASDKNetworkReachabilityUserInfoParamTypeOperation) : @(ASDKNetworkReachabilityOperationTypeSubmitSavedForms),
-              @(ASDKNetworkReachabilityUserInfoParamTypeID) : taskID,
-              @(ASDKNetworkReachabilityUserInfoParamTypeFormFieldValueRequestRepresentation) : formFieldValueRequestRepresentation};
-
-            [self.processingQueue addOperation:dataAccessorOperation];
-            [saveFormDataAccessor saveFormForTaskID:taskID
-            withFormFieldValueRequestRepresentation:formFieldValueRequestRepresentation];
-        }
-    }
+    // Only the uploaded revision is removed, a form saved again in the meantime stays journaled
+    __weak typeof(self) weakSelf = self;
+    [self.formCacheService removeFormSaveJournalEntryForTaskID:journalEntry.taskID
+                                                  withRevision:journalEntry.revision
+                                               completionBlock:^(BOOL isEntryRemoved, NSError *error) {
+                                                   __strong typeof(self) strongSelf = weakSelf;
+                                                   
+                                                   dispatch_async(strongSelf.journalQueue, ^{
+                                                       strongSelf.journalGeneration++;
+                                                       [strongSelf.inFlightTaskIDs removeObject:journalEntry.taskID];
+                                                       
+                                                       if (error) {
+                                                           ASDKLogError(@"Encountered an error while removing the saved form for task: %@ from the journal. Reason:%@", journalEntry.taskID, error.localizedDescription);
+                                                       } else if (!isEntryRemoved) {
+                                                           ASDKLogVerbose(@"Saved form for task: %@ changed while uploading. Replaying the new revision.", journalEntry.taskID);
+                                                           [strongSelf replayJournal];
+                                                       }
+                                                       
+                                                       [operation complete];
+                                                   });
+                                               }];
 }
 
-- (void)handleSaveFormOperation:(ASDKDataAccessorOperation *)operation
-               withDataAccessor:(id<ASDKServiceDataAccessorProtocol>)dataAccessor
-                   withResponse:(ASDKDataAccessorResponseBase *)response {
-    ASDKDataAccessorResponseConfirmation *confirmation = (ASDKDataAccessorResponseConfirmation *)response;
-    if (confirmation.isConfirmation) {
-        [self.taskIDs addObject:operation.userInfo[@(ASDKNetworkReachabilityUserInfoParamTypeID)]];
-    } else {
-        if ([operation.userInfo[@(ASDKNetworkReachabilityUserInfoParamTypeRetry)] boolValue]) {
-            [self.taskIDs addObject:operation.userInfo[@(ASDKNetworkReachabilityUserInfoParamTypeID)]];
-        } else {
-            NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithDictionary:operation.userInfo];
-            [dictionary setObject:@(YES)
-                           forKey:@(ASDKNetworkReachabilityUserInfoParamTypeRetry)];
-            operation.userInfo = dictionary;
-            [self.operationsToRetry addObject:operation];
-        }
+- (void)handleFailedSaveForJournalEntry:(ASDKFormSaveJournalEntry *)journalEntry
+                                  error:(NSError *)error
+                              operation:(ASDKAsyncBlockOperation *)operation {
+    if ([self isPermanentSaveError:error]) {
+        [self handlePermanentlyFailedSaveForJournalEntry:journalEntry
+                                                   error:error
+                                               operation:operation];
+        return;
     }
+    
+    NSInteger attemptCount = journalEntry.attemptCount + 1;
+    NSTimeInterval retryInterval = [self retryIntervalForAttemptCount:attemptCount];
+    NSDate *nextAttemptDate = [NSDate dateWithTimeIntervalSinceNow:retryInterval];
+    
+    ASDKLogError(@"Failed to upload saved form for task: %@ (attempt %ld). Retrying in %.1fs. Reason:%@", journalEntry.taskID, (long)attemptCount, retryInterval, error.localizedDescription);
+    
+    // Persist the retry state so that backoff survives an application restart
+    __weak typeof(self) weakSelf = self;
+    [self.formCacheService updateFormSaveJournalEntryForTaskID:journalEntry.taskID
+                                                  withRevision:journalEntry.revision
+                                                  attemptCount:attemptCount
+                                               nextAttemptDate:nextAttemptDate
+                                               completionBlock:^(NSError *error) {
+                                                   __strong typeof(self) strongSelf = weakSelf;
+                                                   
+                                                   dispatch_async(strongSelf.journalQueue, ^{
+                                                       strongSelf.journalGeneration++;
+                                                       [strongSelf.inFlightTaskIDs removeObject:journalEntry.taskID];
+                                                       
+                                                       if (error) {
+                                                           ASDKLogError(@"Encountered an error while recording the failed upload attempt for task: %@. Reason:%@", journalEntry.taskID, error.localizedDescription);
+                                                       }
+                                                       
+                                                       [strongSelf scheduleReplayAfterInterval:retryInterval];
+                                                       [operation complete];
+                                                   });
+                                               }];
 }
 
-- (void)handleRetryForFailedOperations {
-    for (ASDKDataAccessorOperation *failedOperation in self.operationsToRetry) {
-        NSString *taskID = failedOperation.userInfo[@(ASDKNetworkReachabilityUserInfoParamTypeID)];
-        ASDKFormFieldValueRequestRepresentation *formFieldValueRequestRepresentation =
-        failedOperation.userInfo[@(ASDKNetworkReachabilityUserInfoParamTypeFormFieldValueRequestRepresentation)];
-        ASDKFormDataAccessor *dataAccessor = (ASDKFormDataAccessor *)failedOperation.dataAccessor;
-        
-        ASDKDataAccessorOperation *retryOperation = [[ASDKDataAccessorOperation alloc] initWithDataAccessor:dataAccessor
-                                                                                                          delegate:self];
-        dataAccessor.delegate = retryOperation;
-        retryOperation.userInfo = failedOperation.userInfo;
-        
-        [self.processingQueue addOperation:retryOperation];
-        [dataAccessor saveFormForTaskID:taskID
-withFormFieldValueRequestRepresentation:formFieldValueRequestRepresentation];
+- (void)handlePermanentlyFailedSaveForJournalEntry:(ASDKFormSaveJournalEntry *)journalEntry
+                                             error:(NSError *)error
+                                         operation:(ASDKAsyncBlockOperation *)operation {
+    ASDKLogError(@"Server rejected the saved form for task: %@ (attempt %ld). Dropping it from the journal. Reason:%@", journalEntry.taskID, (long)journalEntry.attemptCount + 1, error.localizedDescription);
+    
+    // Retrying a rejected revision will not succeed, a form saved again in the
+    // meantime stays journaled and is uploaded on its own
+    __weak typeof(self) weakSelf = self;
+    [self.formCacheService removeFormSaveJournalEntryForTaskID:journalEntry.taskID
+                                                  withRevision:journalEntry.revision
+                                               completionBlock:^(BOOL isEntryRemoved, NSError *error) {
+                                                   __strong typeof(self) strongSelf = weakSelf;
+                                                   
+                                                   dispatch_async(strongSelf.journalQueue, ^{
+                                                       strongSelf.journalGeneration++;
+                                                       [strongSelf.inFlightTaskIDs removeObject:journalEntry.taskID];
+                                                       
+                                                       if (error) {
+                                                           ASDKLogError(@"Encountered an error while removing the rejected form for task: %@ from the journal. Reason:%@", journalEntry.taskID, error.localizedDescription);
+                                                       } else if (!isEntryRemoved) {
+                                                           [strongSelf replayJournal];
+                                                       }
+                                                       
+                                                       [operation complete];
+                                                   });
+                                               }];
+}
+
+
+#pragma mark -
+#pragma mark Scheduling
+
+- (NSTimeInterval)retryIntervalForAttemptCount:(NSInteger)attemptCount {
+    NSTimeInterval exponentialInterval = MIN(self.maxRetryInterval, self.baseRetryInterval * pow(2, MAX(attemptCount - 1, 0)));
+    
+    // Keep half of the interval and randomize the other half so that forms
+    // failing at the same time spread their retries
+    double jitter = (double)arc4random_uniform(UINT32_MAX) / UINT32_MAX;
+    return exponentialInterval / 2 + jitter * exponentialInterval / 2;
+}
+
+- (void)scheduleReplayAfterInterval:(NSTimeInterval)interval {
+    NSDate *replayDate = [NSDate dateWithTimeIntervalSinceNow:interval];
+    
+    // An earlier replay will pick up this entry as well
+    if (self.scheduledReplayDate &&
+        NSOrderedDescending != [self.scheduledReplayDate compare:replayDate]) {
+        return;
     }
     
-    [self.operationsToRetry removeAllObjects];
+    self.scheduledReplayDate = replayDate;
+    NSUInteger replayScheduleToken = ++self.replayScheduleToken;
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(MAX(interval, 0) * NSEC_PER_SEC)), self.journalQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (replayScheduleToken != strongSelf.replayScheduleToken) {
+            return;
+        }
+        strongSelf.scheduledReplayDate = nil;
+        
+        if (![strongSelf isNetworkUnreachable]) {
+            [strongSelf replayJournal];
+        }
+    });
+}
+
+- (void)cancelScheduledReplay {
+    self.scheduledReplayDate = nil;
+    self.replayScheduleToken++;
 }
 
 
@@ -222,24 +429,55 @@ withFormFieldValueRequestRepresentation:formFieldValueRequestRepresentation];
                            options:NSKeyValueObservingOptionNew
                              block:^(id observer, id object, NSDictionary *change) {
                                  __strong typeof(self) strongSelf = weakSelf;
-
-                                 ASDKNetworkReachabilityStatus networkReachabilityStatus = [change[NSKeyValueChangeNewKey] boolValue];
+                                 
+                                 ASDKNetworkReachabilityStatus networkReachabilityStatus = [change[NSKeyValueChangeNewKey] integerValue];
                                  if (ASDKNetworkReachabilityStatusReachableViaWWANOrWifi == networkReachabilityStatus) {
-                                     [strongSelf runNetworkConnectivityRestorationChecks];
+                                     // Wait for the connection to settle so that a flapping network
+                                     // results in a single replay
+                                     dispatch_async(strongSelf.journalQueue, ^{
+                                         [strongSelf cancelScheduledReplay];
+                                         [strongSelf scheduleReplayAfterInterval:strongSelf.reachabilitySettleInterval];
+                                     });
+                                 } else if (ASDKNetworkReachabilityStatusNotReachable == networkReachabilityStatus) {
+                                     dispatch_async(strongSelf.journalQueue, ^{
+                                         [strongSelf cancelScheduledReplay];
+                                     });
+                                     [strongSelf.processingQueue cancelAllOperations];
                                  }
                              }];
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
+- (BOOL)isPermanentSaveError:(NSError *)error {
+    // Client errors other than timeouts and throttling are answered the same way
+    // on every retry, e.g. for a completed or deleted task or a revoked access
+    NSHTTPURLResponse *response = error.userInfo[AFNetworkingOperationFailingURLResponseErrorKey];
+    if (![response isKindOfClass:[NSHTTPURLResponse class]]) {
+        return NO;
+    }
     
-    [self.kvoManager observeObject:self.processingQueue
-                        forKeyPath:NSStringFromSelector(@selector(operationCount))
-                           options:NSKeyValueObservingOptionNew
-                             block:^(id observer, id object, NSDictionary *change) {
-                                 __strong typeof(self) strongSelf = weakSelf;
-                                 
-                                 NSUInteger operationCount = [change[NSKeyValueChangeNewKey] unsignedIntegerValue];
-                                 if (!operationCount) {
-                                     [strongSelf removeSaveFormFieldValues];
-                                 }
-    }];
+    NSInteger statusCode = response.statusCode;
+    return (statusCode >= ASDKHTTPCode400BadRequest &&
+            statusCode < ASDKHTTPCode500InternalServerError &&
+            statusCode != ASDKHTTPCode408RequestTimeout &&
+            statusCode != ASDKHTTPCode429TooManyRequests);
+}
+
+- (id<ASDKFormNetworkServiceProtocol>)currentFormNetworkService {
+    if (self.formNetworkService) {
+        return self.formNetworkService;
+    }
+    
+    ASDKBootstrap *sdkBootstrap = [ASDKBootstrap sharedInstance];
+    return [sdkBootstrap.serviceLocator serviceConformingToProtocol:@protocol(ASDKFormNetworkServiceProtocol)];
+}
+
+- (BOOL)isNetworkUnreachable {
+    return (self.reachabilityManager &&
+            ASDKNetworkReachabilityStatusNotReachable == self.reachabilityManager.networkReachabilityStatus) ? YES : NO;
 }
 
 @end
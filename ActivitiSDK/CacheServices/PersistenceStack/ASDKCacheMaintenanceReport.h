@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+@interface ASDKCacheMaintenanceReport : NSObject
+
+/**
+ *  Property meant to hold the number of rows reclaimed for each root entity
+ *  keyed by entity name.
+ */
+@property (strong, nonatomic, readonly) NSDictionary            *reclaimedRowCounts;
+
+/**
+ *  Property meant to hold the total number of rows reclaimed during the maintenance pass.
+ */
+@property (assign, nonatomic, readonly) NSUInteger              reclaimedRowCount;
+
+/**
+ *  Property meant to hold the on-disk size of the store, write-ahead log included,
+ *  before and after the maintenance pass.
+ */
+@property (assign, nonatomic) unsigned long long                storeByteSizeBeforeMaintenance;
+@property (assign, nonatomic) unsigned long long                storeByteSizeAfterMaintenance;
+
+/**
+ *  Property meant to hold the wall clock duration of the maintenance pass.
+ */
+@property (assign, nonatomic) NSTimeInterval                    maintenanceDuration;
+
+/**
+ *  Adds the passed number of reclaimed rows to the running count of the given entity.
+ *
+ *  @param rowCount   Number of deleted rows
+ *  @param entityName Name of the entity the rows belong to
+ */
+- (void)addReclaimedRowCount:(NSUInteger)rowCount
+               forEntityName:(NSString *)entityName;
+
+@end
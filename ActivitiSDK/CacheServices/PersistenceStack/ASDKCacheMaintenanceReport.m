@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKCacheMaintenanceReport.h"
+
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
+
+@interface ASDKCacheMaintenanceReport ()
+
+@property (strong, nonatomic) NSMutableDictionary *mutableReclaimedRowCounts;
+
+@end
+
+@implementation ASDKCacheMaintenanceReport
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _mutableReclaimedRowCounts = [NSMutableDictionary dictionary];
+    }
+    
+    return self;
+}
+
+- (void)addReclaimedRowCount:(NSUInteger)rowCount
+               forEntityName:(NSString *)entityName {
+    if (!rowCount) {
+        return;
+    }
+    
+    NSUInteger currentRowCount = [self.mutableReclaimedRowCounts[entityName] unsignedIntegerValue];
+    self.mutableReclaimedRowCounts[entityName] = @(currentRowCount + rowCount);
+}
+
+- (NSDictionary *)reclaimedRowCounts {
+    return [self.mutableReclaimedRowCounts copy];
+}
+
+- (NSUInteger)reclaimedRowCount {
+    NSUInteger reclaimedRowCount = 0;
+    for (NSNumber *rowCount in self.mutableReclaimedRowCounts.allValues) {
+        reclaimedRowCount += rowCount.unsignedIntegerValue;
+    }
+    
+    return reclaimedRowCount;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"Reclaimed %lu rows %@ in %.2fs. Store size: %llu bytes -> %llu bytes.",
+            (unsigned long)self.reclaimedRowCount,
+            self.reclaimedRowCounts,
+            self.maintenanceDuration,
+            self.storeByteSizeBeforeMaintenance,
+            self.storeByteSizeAfterMaintenance];
+}
+
+@end
@@ -0,0 +1,535 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKCacheMaintenanceService.h"
+@import CoreData;
+@import UIKit;
+
+// Constants
+#import "ASDKPersistenceStackConstants.h"
+#import "ASDKLogConfiguration.h"
+
+// Protocols
+#import "ASDKPersistenceStackProtocol.h"
+
+// Models
+#import "ASDKCacheMaintenanceReport.h"
+#import "ASDKMOTask.h"
+#import "ASDKMOProcessInstance.h"
+#import "ASDKMOProfile.h"
+#import "ASDKMOContent.h"
+#import "ASDKMOFormDescription.h"
+#import "ASDKMOTaskFilterMap.h"
+#import "ASDKMOTaskFilterMapPlaceholder.h"
+#import "ASDKMOProcessInstanceFilterMapPlaceholder.h"
+
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
+
+static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLAG_TRACE;
+
+static NSUInteger const kASDKCacheMaintenanceDefaultMaxRowCountPerEntity    = 5000;
+static unsigned long long const kASDKCacheMaintenanceDefaultMaxStoreByteSize = 50 * 1024 * 1024;
+static NSTimeInterval const kASDKCacheMaintenanceDefaultRetentionInterval   = 7 * 24 * 60 * 60;
+static NSTimeInterval const kASDKCacheMaintenanceDefaultMinimumInterval     = 60 * 60;
+
+@interface ASDKCacheMaintenanceService ()
+
+@property (strong, atomic, readwrite) ASDKCacheMaintenanceReport    *lastMaintenanceReport;
+
+/**
+ *  Property meant to hold a reference to the persistence stack whose store is maintained
+ */
+@property (strong, nonatomic) id<ASDKPersistenceStackProtocol>      persistenceStack;
+
+/**
+ *  Property meant to hold a reference to the low priority serial queue on which
+ *  maintenance passes are executed
+ */
+@property (strong, nonatomic) dispatch_queue_t                      maintenanceQueue;
+
+/**
+ *  Property meant to hold a reference to the serial queue guarding the recorded accesses
+ */
+@property (strong, nonatomic) dispatch_queue_t                      accessRecordingQueue;
+
+/**
+ *  Property meant to hold object IDs that have been read since the last maintenance pass
+ */
+@property (strong, nonatomic) NSMutableSet                          *accessedObjectIDs;
+
+/**
+ *  Property meant to hold the date at which the last maintenance pass was scheduled
+ */
+@property (strong, atomic) NSDate                                   *lastMaintenanceDate;
+
+/**
+ *  Property meant to hold the store size measured after the last eviction caused by the
+ *  byte budget. SQLite reuses freed pages instead of shrinking the file, so the byte
+ *  budget is enforced again only once the store grew past that size.
+ */
+@property (assign, nonatomic) unsigned long long                    storeByteSizeAtLastEviction;
+
+@end
+
+@implementation ASDKCacheMaintenanceService
+
+
+#pragma mark -
+#pragma mark Life cycle
+
+- (instancetype)initWithPersistenceStack:(id<ASDKPersistenceStackProtocol>)persistenceStack {
+    self = [super init];
+    if (self) {
+        _persistenceStack = persistenceStack;
+        _maxRowCountPerEntity = kASDKCacheMaintenanceDefaultMaxRowCountPerEntity;
+        _maxStoreByteSize = kASDKCacheMaintenanceDefaultMaxStoreByteSize;
+        _retentionInterval = kASDKCacheMaintenanceDefaultRetentionInterval;
+        _minimumMaintenanceInterval = kASDKCacheMaintenanceDefaultMinimumInterval;
+        _accessedObjectIDs = [NSMutableSet set];
+        
+        NSString *queueNamePrefix = [NSString stringWithFormat:@"%@.`%@",
+                                     [NSBundle bundleForClass:[self class]].bundleIdentifier,
+                                     NSStringFromClass([self class])];
+        _maintenanceQueue = dispatch_queue_create([[queueNamePrefix stringByAppendingString:@"MaintenanceQueue"] UTF8String],
+                                                  dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_BACKGROUND, 0));
+        _accessRecordingQueue = dispatch_queue_create([[queueNamePrefix stringByAppendingString:@"AccessRecordingQueue"] UTF8String],
+                                                      DISPATCH_QUEUE_SERIAL);
+        
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(handleApplicationDidEnterBackgroundNotification:)
+                                                     name:UIApplicationDidEnterBackgroundNotification
+                                                   object:nil];
+    }
+    
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (void)recordAccessForObjectIDs:(NSArray<NSManagedObjectID *> *)objectIDs {
+    if (!objectIDs.count) {
+        return;
+    }
+    
+    dispatch_async(self.accessRecordingQueue, ^{
+        for (NSManagedObjectID *objectID in objectIDs) {
+            if (!objectID.isTemporaryID) {
+                [self.accessedObjectIDs addObject:objectID];
+            }
+        }
+    });
+}
+
+- (void)performMaintenanceWithCompletionBlock:(ASDKCacheMaintenanceCompletionBlock)completionBlock {
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.maintenanceQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (!strongSelf.persistenceStack.isStoreLoaded) {
+            if (completionBlock) {
+                completionBlock(nil, [strongSelf storeNotLoadedError]);
+            }
+            return;
+        }
+        
+        NSDate *maintenanceStartDate = [NSDate date];
+        ASDKCacheMaintenanceReport *report = [ASDKCacheMaintenanceReport new];
+        report.storeByteSizeBeforeMaintenance = [strongSelf storeByteSize];
+        
+        __block NSError *error = nil;
+        NSManagedObjectContext *managedObjectContext = [strongSelf.persistenceStack backgroundContext];
+        [managedObjectContext performBlockAndWait:^{
+            error = [strongSelf flushRecordedAccessesInContext:managedObjectContext];
+            
+            if (!error) {
+                error = [strongSelf collectUnreferencedRowsInContext:managedObjectContext
+                                                          withReport:report];
+            }
+            
+            if (!error) {
+                error = [strongSelf enforceBudgetsInContext:managedObjectContext
+                                            storeByteSize:report.storeByteSizeBeforeMaintenance
+                                               withReport:report];
+            }
+        }];
+        
+        report.storeByteSizeAfterMaintenance = [strongSelf storeByteSize];
+        report.maintenanceDuration = [[NSDate date] timeIntervalSinceDate:maintenanceStartDate];
+        
+        if (error) {
+            ASDKLogError(@"Cache maintenance failed. Reason:%@", error.localizedDescription);
+        } else {
+            ASDKLogVerbose(@"Cache maintenance finished. %@", report);
+            strongSelf.lastMaintenanceReport = report;
+        }
+        
+        if (completionBlock) {
+            completionBlock(error ? nil : report, error);
+        }
+    });
+}
+
+
+#pragma mark -
+#pragma mark Notification handling
+
+- (void)handleApplicationDidEnterBackgroundNotification:(NSNotification *)notification {
+    if (self.lastMaintenanceDate &&
+        [[NSDate date] timeIntervalSinceDate:self.lastMaintenanceDate] < self.minimumMaintenanceInterval) {
+        return;
+    }
+    self.lastMaintenanceDate = [NSDate date];
+    
+    UIApplication *application = [UIApplication sharedApplication];
+    __block UIBackgroundTaskIdentifier backgroundTaskIdentifier = [application beginBackgroundTaskWithName:NSStringFromClass([self class])
+                                                                                         expirationHandler:^{
+        [application endBackgroundTask:backgroundTaskIdentifier];
+        backgroundTaskIdentifier = UIBackgroundTaskInvalid;
+    }];
+    
+    [self performMaintenanceWithCompletionBlock:^(ASDKCacheMaintenanceReport *report, NSError *error) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            if (UIBackgroundTaskInvalid != backgroundTaskIdentifier) {
+                [application endBackgroundTask:backgroundTaskIdentifier];
+                backgroundTaskIdentifier = UIBackgroundTaskInvalid;
+            }
+        });
+    }];
+}
+
+
+#pragma mark -
+#pragma mark Operations
+
+- (NSError *)flushRecordedAccessesInContext:(NSManagedObjectContext *)managedObjectContext {
+    __block NSArray *accessedObjectIDs = nil;
+    dispatch_sync(self.accessRecordingQueue, ^{
+        accessedObjectIDs = self.accessedObjectIDs.allObjects;
+        [self.accessedObjectIDs removeAllObjects];
+    });
+    
+    if (!accessedObjectIDs.count) {
+        return nil;
+    }
+    
+    NSMutableDictionary *objectIDsByEntityName = [NSMutableDictionary dictionary];
+    for (NSManagedObjectID *objectID in accessedObjectIDs) {
+        NSMutableArray *entityObjectIDs = objectIDsByEntityName[objectID.entity.name];
+        if (!entityObjectIDs) {
+            entityObjectIDs = [NSMutableArray array];
+            objectIDsByEntityName[objectID.entity.name] = entityObjectIDs;
+        }
+        [entityObjectIDs addObject:objectID];
+    }
+    
+    NSDate *accessDate = [NSDate date];
+    for (NSString *entityName in objectIDsByEntityName) {
+        NSBatchUpdateRequest *updateAccessDateRequest = [[NSBatchUpdateRequest alloc] initWithEntityName:entityName];
+        updateAccessDateRequest.predicate = [NSPredicate predicateWithFormat:@"SELF IN %@", objectIDsByEntityName[entityName]];
+        updateAccessDateRequest.propertiesToUpdate = @{NSStringFromSelector(@selector(lastAccessDate)) : accessDate};
+        updateAccessDateRequest.resultType = NSStatusOnlyResultType;
+        
+        NSError *error = nil;
+        [managedObjectContext executeRequest:updateAccessDateRequest
+                                       error:&error];
+        if (error) {
+            return error;
+        }
+    }
+    
+    return nil;
+}
+
+- (NSError *)collectUnreferencedRowsInContext:(NSManagedObjectContext *)managedObjectContext
+                                   withReport:(ASDKCacheMaintenanceReport *)report {
+    NSDate *retentionDate = [NSDate dateWithTimeIntervalSinceNow:-self.retentionInterval];
+    NSPredicate *stalePredicate = [NSPredicate predicateWithFormat:@"lastAccessDate == nil OR lastAccessDate < %@", retentionDate];
+    
+    // Tasks and process instances are collected first so that the profiles and
+    // content they were referencing become unreferenced during the same pass
+    for (NSString *entityName in [self rootEntityNames]) {
+        NSError *error = nil;
+        NSPredicate *unreferencedPredicate = [self unreferencedPredicateForEntityName:entityName
+                                                                            inContext:managedObjectContext
+                                                                                error:&error];
+        if (error) {
+            return error;
+        }
+        
+        NSFetchRequest *unreferencedRowsRequest = [NSFetchRequest fetchRequestWithEntityName:entityName];
+        unreferencedRowsRequest.predicate = [NSCompoundPredicate andPredicateWithSubpredicates:@[unreferencedPredicate, stalePredicate]];
+        
+        NSUInteger deletedRowCount = [self deleteRowsMatchingFetchRequest:unreferencedRowsRequest
+                                                                inContext:managedObjectContext
+                                                                    error:&error];
+        if (error) {
+            return error;
+        }
+        
+        [report addReclaimedRowCount:deletedRowCount
+                       forEntityName:entityName];
+    }
+    
+    return nil;
+}
+
+- (NSError *)enforceBudgetsInContext:(NSManagedObjectContext *)managedObjectContext
+                       storeByteSize:(unsigned long long)storeByteSize
+                          withReport:(ASDKCacheMaintenanceReport *)report {
+    NSError *error = nil;
+    NSMutableDictionary *rowCounts = [NSMutableDictionary dictionary];
+    NSUInteger totalRowCount = 0;
+    
+    for (NSString *entityName in [self rootEntityNames]) {
+        NSUInteger rowCount = [managedObjectContext countForFetchRequest:[NSFetchRequest fetchRequestWithEntityName:entityName]
+                                                                   error:&error];
+        if (error) {
+            return error;
+        }
+        
+        rowCounts[entityName] = @(rowCount);
+        totalRowCount += rowCount;
+    }
+    
+    // Rows are assumed to share the store size evenly, so the byte budget translates
+    // into a proportional shrink of every entity's row count
+    double byteBudgetRatio = 1.0;
+    BOOL isByteBudgetExceeded = (self.maxStoreByteSize &&
+                                 storeByteSize > self.maxStoreByteSize &&
+                                 storeByteSize > self.storeByteSizeAtLastEviction);
+    if (isByteBudgetExceeded && totalRowCount) {
+        byteBudgetRatio = (double)self.maxStoreByteSize / storeByteSize;
+    }
+    
+    BOOL didEvictTasks = NO;
+    for (NSString *entityName in [self rootEntityNames]) {
+        NSUInteger rowCount = [rowCounts[entityName] unsignedIntegerValue];
+        NSUInteger rowBudget = (NSUInteger)(rowCount * byteBudgetRatio);
+        if (self.maxRowCountPerEntity) {
+            rowBudget = MIN(rowBudget, self.maxRowCountPerEntity);
+        }
+        
+        if (rowCount <= rowBudget) {
+            continue;
+        }
+        
+        NSUInteger evictedRowCount = [self evictLeastRecentlyAccessedRowsOfEntityName:entityName
+                                                                             rowCount:rowCount - rowBudget
+                                                                            inContext:managedObjectContext
+                                                                                error:&error];
+        if (error) {
+            return error;
+        }
+        
+        [report addReclaimedRowCount:evictedRowCount
+                       forEntityName:entityName];
+        
+        if (evictedRowCount && [entityName isEqualToString:[ASDKMOTask entityName]]) {
+            didEvictTasks = YES;
+        }
+    }
+    
+    if (isByteBudgetExceeded) {
+        self.storeByteSizeAtLastEviction = [self storeByteSize];
+    }
+    
+    // Evicted tasks leave gaps in cached task lists that incremental synchronization
+    // cannot detect, so the next synchronization must perform a full refresh
+    if (didEvictTasks) {
+        error = [self resetTaskListSyncStateInContext:managedObjectContext];
+    }
+    
+    return error;
+}
+
+- (NSUInteger)evictLeastRecentlyAccessedRowsOfEntityName:(NSString *)entityName
+                                                rowCount:(NSUInteger)rowCount
+                                               inContext:(NSManagedObjectContext *)managedObjectContext
+                                                   error:(NSError **)error {
+    NSError *internalError = nil;
+    NSPredicate *unreferencedPredicate = [self unreferencedPredicateForEntityName:entityName
+                                                                        inContext:managedObjectContext
+                                                                            error:&internalError];
+    NSPredicate *evictablePredicate = [self evictablePredicateForEntityName:entityName];
+    NSUInteger evictedRowCount = 0;
+    
+    // Unreferenced rows are evicted before rows that are still part of a cached list
+    NSArray *evictionPredicates = @[[NSCompoundPredicate andPredicateWithSubpredicates:@[unreferencedPredicate ?: [NSPredicate predicateWithValue:YES], evictablePredicate]],
+                                    evictablePredicate];
+    for (NSPredicate *evictionPredicate in evictionPredicates) {
+        if (internalError || evictedRowCount >= rowCount) {
+            break;
+        }
+        
+        NSFetchRequest *leastRecentlyAccessedRowsRequest = [NSFetchRequest fetchRequestWithEntityName:entityName];
+        leastRecentlyAccessedRowsRequest.predicate = evictionPredicate;
+        leastRecentlyAccessedRowsRequest.sortDescriptors = @[[NSSortDescriptor sortDescriptorWithKey:NSStringFromSelector(@selector(lastAccessDate))
+                                                                                           ascending:YES]];
+        leastRecentlyAccessedRowsRequest.fetchLimit = rowCount - evictedRowCount;
+        
+        evictedRowCount += [self deleteRowsMatchingFetchRequest:leastRecentlyAccessedRowsRequest
+                                                      inContext:managedObjectContext
+                                                          error:&internalError];
+    }
+    
+    *error = internalError;
+    return evictedRowCount;
+}
+
+- (NSUInteger)deleteRowsMatchingFetchRequest:(NSFetchRequest *)fetchRequest
+                                   inContext:(NSManagedObjectContext *)managedObjectContext
+                                       error:(NSError **)error {
+    NSError *internalError = nil;
+    fetchRequest.resultType = NSManagedObjectIDResultType;
+    NSArray *objectIDs = [managedObjectContext executeFetchRequest:fetchRequest
+                                                             error:&internalError];
+    if (internalError || !objectIDs.count) {
+        *error = internalError;
+        return 0;
+    }
+    
+    NSBatchDeleteRequest *removeRowsRequest = [[NSBatchDeleteRequest alloc] initWithObjectIDs:objectIDs];
+    removeRowsRequest.resultType = NSBatchDeleteResultTypeObjectIDs;
+    NSBatchDeleteResult *deletionResult = [managedObjectContext executeRequest:removeRowsRequest
+                                                                         error:&internalError];
+    NSArray *deletedObjectIDs = deletionResult.result;
+    
+    if (!internalError && deletedObjectIDs.count) {
+        [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : deletedObjectIDs}
+                                                  intoContext:managedObjectContext];
+    }
+    
+    *error = internalError;
+    return deletedObjectIDs.count;
+}
+
+- (NSError *)resetTaskListSyncStateInContext:(NSManagedObjectContext *)managedObjectContext {
+    NSBatchUpdateRequest *resetSyncStateRequest = [[NSBatchUpdateRequest alloc] initWithEntityName:[ASDKMOTaskFilterMap entityName]];
+    resetSyncStateRequest.propertiesToUpdate = @{NSStringFromSelector(@selector(reconciliationDate)) : [NSExpression expressionForConstantValue:nil]};
+    resetSyncStateRequest.resultType = NSStatusOnlyResultType;
+    
+    NSError *error = nil;
+    [managedObjectContext executeRequest:resetSyncStateRequest
+                                   error:&error];
+    return error;
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
+- (NSArray *)rootEntityNames {
+    return @[[ASDKMOTask entityName],
+             [ASDKMOProcessInstance entityName],
+             [ASDKMOFormDescription entityName],
+             [ASDKMOContent entityName],
+             [ASDKMOProfile entityName]];
+}
+
+- (NSPredicate *)unreferencedPredicateForEntityName:(NSString *)entityName
+                                          inContext:(NSManagedObjectContext *)managedObjectContext
+                                              error:(NSError **)error {
+    NSError *internalError = nil;
+    NSPredicate *unreferencedPredicate = nil;
+    
+    if ([entityName isEqualToString:[ASDKMOTask entityName]]) {
+        NSArray *referencedTaskIDs = [self placeholderModelIDsForEntityName:[ASDKMOTaskFilterMapPlaceholder entityName]
+                                                                  inContext:managedObjectContext
+                                                                      error:&internalError];
+        unreferencedPredicate = [NSPredicate predicateWithFormat:@"NOT (modelID IN %@)", referencedTaskIDs ?: @[]];
+    } else if ([entityName isEqualToString:[ASDKMOProcessInstance entityName]]) {
+        NSArray *referencedProcessInstanceIDs = [self placeholderModelIDsForEntityName:[ASDKMOProcessInstanceFilterMapPlaceholder entityName]
+                                                                             inContext:managedObjectContext
+                                                                                 error:&internalError];
+        unreferencedPredicate = [NSPredicate predicateWithFormat:@"NOT (modelID IN %@)", referencedProcessInstanceIDs ?: @[]];
+    } else if ([entityName isEqualToString:[ASDKMOContent entityName]]) {
+        unreferencedPredicate = [NSPredicate predicateWithFormat:@"taskContentMap == nil AND processInstanceContent == nil"];
+    } else if ([entityName isEqualToString:[ASDKMOProfile entityName]]) {
+        unreferencedPredicate = [NSPredicate predicateWithFormat:@"currentProfile == nil AND tasks.@count == 0 AND involvedTasks.@count == 0 AND processInstances.@count == 0 AND comment.@count == 0 AND contents.@count == 0"];
+    } else if ([entityName isEqualToString:[ASDKMOFormDescription entityName]]) {
+        unreferencedPredicate = [self evictablePredicateForEntityName:entityName];
+    }
+    
+    *error = internalError;
+    return unreferencedPredicate;
+}
+
+- (NSPredicate *)evictablePredicateForEntityName:(NSString *)entityName {
+    // Form descriptions holding offline saves and the profile of the logged in user
+    // must survive until they are replayed or replaced
+    if ([entityName isEqualToString:[ASDKMOFormDescription entityName]]) {
+        return [NSPredicate predicateWithFormat:@"isSavedFormDescription == NO"];
+    } else if ([entityName isEqualToString:[ASDKMOProfile entityName]]) {
+        return [NSPredicate predicateWithFormat:@"currentProfile == nil"];
+    }
+    
+    return [NSPredicate predicateWithValue:YES];
+}
+
+- (NSArray *)placeholderModelIDsForEntityName:(NSString *)entityName
+                                    inContext:(NSManagedObjectContext *)managedObjectContext
+                                        error:(NSError **)error {
+    NSFetchRequest *placeholderRequest = [NSFetchRequest fetchRequestWithEntityName:entityName];
+    placeholderRequest.resultType = NSDictionaryResultType;
+    placeholderRequest.propertiesToFetch = @[NSStringFromSelector(@selector(modelID))];
+    placeholderRequest.returnsDistinctResults = YES;
+    
+    NSArray *placeholders = [managedObjectContext executeFetchRequest:placeholderRequest
+                                                                error:error];
+    return [placeholders valueForKey:NSStringFromSelector(@selector(modelID))];
+}
+
+- (unsigned long long)storeByteSize {
+    NSURL *storeURL = self.persistenceStack.persistentContainer.persistentStoreDescriptions.firstObject.URL;
+    if (!storeURL) {
+        return 0;
+    }
+    
+    unsigned long long storeByteSize = 0;
+    for (NSString *fileSuffix in @[@"", @"-wal", @"-shm"]) {
+        NSString *filePath = [storeURL.path stringByAppendingString:fileSuffix];
+        NSDictionary *fileAttributes = [[NSFileManager defaultManager] attributesOfItemAtPath:filePath
+                                                                                        error:nil];
+        storeByteSize += fileAttributes.fileSize;
+    }
+    
+    return storeByteSize;
+}
+
+
+#pragma mark -
+#pragma mark Error reporting and handling
+
+- (NSError *)storeNotLoadedError {
+    NSDictionary *userInfo = @{NSLocalizedDescriptionKey            : @"Cannot perform cache maintenance",
+                               NSLocalizedFailureReasonErrorKey     : @"The persistent store is not loaded yet.",
+                               NSLocalizedRecoverySuggestionErrorKey: @"Retry the maintenance pass after the store finished loading."};
+    return [NSError errorWithDomain:ASDKPersistenceStackErrorDomain
+                               code:kASDKPersistenceStackCacheMaintenanceErrorCode
+                           userInfo:userInfo];
+}
+
+@end
@@ -0,0 +1,42 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+#import "ASDKModelCacheProtocol.h"
+
+/**
+ * In-memory cache of mapped models placed in front of the Core Data cache services
+ * so that repeated detail fetches skip the persistent store and the mapping step.
+ * Models are keyed by cache entity name and model ID, are copied in and out so that
+ * callers cannot mutate the cached instance, and are invalidated by the persistence
+ * stack once the changes affecting them are committed to the store.
+ */
+@interface ASDKModelCache : NSObject <ASDKModelCacheProtocol>
+
+@property (assign, nonatomic) NSUInteger            countLimit;
+@property (assign, atomic, readonly) NSUInteger     hitCount;
+@property (assign, atomic, readonly) NSUInteger     missCount;
+@property (assign, atomic, readonly) NSUInteger     generation;
+
+/**
+ * Convenience method returning the model cache registered with the service locator
+ * for the current persistence stack.
+ */
++ (id<ASDKModelCacheProtocol>)registeredModelCache;
+
+@end
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKModelCache.h"
+
+// Managers
+#import "ASDKBootstrap.h"
+#import "ASDKServiceLocator.h"
+
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
+
+static NSUInteger const kASDKModelCacheDefaultCountLimit = 200;
+
+@interface ASDKModelCache ()
+
+@property (assign, atomic, readwrite) NSUInteger    hitCount;
+@property (assign, atomic, readwrite) NSUInteger    missCount;
+@property (assign, atomic, readwrite) NSUInteger    generation;
+
+/**
+ *  Property meant to hold the cached models keyed by entity name and model ID
+ */
+@property (strong, nonatomic) NSCache               *modelStorage;
+
+/**
+ *  Property meant to hold the IDs of the models stored so far keyed by entity name so
+ *  that the models of an entity can be invalidated without knowing their IDs
+ */
+@property (strong, nonatomic) NSMutableDictionary   *modelIDsByEntityName;
+
+/**
+ *  Property meant to hold a reference to the serial queue guarding the counters and
+ *  ordering stores against invalidations
+ */
+@property (strong, nonatomic) dispatch_queue_t      modelCacheQueue;
+
+@end
+
+@implementation ASDKModelCache
+
+
+#pragma mark -
+#pragma mark Life cycle
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _modelStorage = [NSCache new];
+        _modelStorage.countLimit = kASDKModelCacheDefaultCountLimit;
+        _modelIDsByEntityName = [NSMutableDictionary dictionary];
+        _modelCacheQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.`%@ModelCacheQueue",
+                                                   [NSBundle bundleForClass:[self class]].bundleIdentifier,
+                                                   NSStringFromClass([self class])] UTF8String],
+                                                 DISPATCH_QUEUE_SERIAL);
+    }
+    
+    return self;
+}
+
++ (id<ASDKModelCacheProtocol>)registeredModelCache {
+    return [[ASDKBootstrap sharedInstance].serviceLocator serviceConformingToProtocol:@protocol(ASDKModelCacheProtocol)];
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (NSUInteger)countLimit {
+    return self.modelStorage.countLimit;
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit {
+    self.modelStorage.countLimit = countLimit;
+}
+
+- (id)modelForEntityName:(NSString *)entityName
+                 modelID:(NSString *)modelID {
+    if (!modelID.length) {
+        return nil;
+    }
+    
+    __block id model = nil;
+    dispatch_sync(self.modelCacheQueue, ^{
+        model = [self.modelStorage objectForKey:[self keyForEntityName:entityName
+                                                               modelID:modelID]];
+        if (model) {
+            self.hitCount++;
+        } else {
+            self.missCount++;
+        }
+    });
+    
+    return [model copy];
+}
+
+- (void)setModel:(id<NSCopying>)model
+   forEntityName:(NSString *)entityName
+         modelID:(NSString *)modelID
+observedGeneration:(NSUInteger)observedGeneration {
+    if (!model || !modelID.length) {
+        return;
+    }
+    
+    id modelCopy = [(NSObject *)model copy];
+    dispatch_sync(self.modelCacheQueue, ^{
+        // An invalidation happened while the model was being fetched so it might
+        // reflect the state of the store before the upsert
+        if (observedGeneration != self.generation) {
+            return;
+        }
+        
+        [self.modelStorage setObject:modelCopy
+                              forKey:[self keyForEntityName:entityName
+                                                    modelID:modelID]];
+        
+        NSMutableSet *entityModelIDs = self.modelIDsByEntityName[entityName];
+        if (!entityModelIDs) {
+            entityModelIDs = [NSMutableSet set];
+            self.modelIDsByEntityName[entityName] = entityModelIDs;
+        }
+        [entityModelIDs addObject:modelID];
+    });
+}
+
+- (void)invalidateModelsForEntityName:(NSString *)entityName
+                             modelIDs:(NSArray<NSString *> *)modelIDs {
+    if (!modelIDs.count) {
+        return;
+    }
+    
+    dispatch_sync(self.modelCacheQueue, ^{
+        self.generation++;
+        
+        for (NSString *modelID in modelIDs) {
+            [self.modelStorage removeObjectForKey:[self keyForEntityName:entityName
+                                                                 modelID:modelID]];
+        }
+        [self.modelIDsByEntityName[entityName] minusSet:[NSSet setWithArray:modelIDs]];
+    });
+}
+
+- (void)invalidateModelsForEntityNames:(NSSet<NSString *> *)entityNames {
+    if (!entityNames.count) {
+        return;
+    }
+    
+    dispatch_sync(self.modelCacheQueue, ^{
+        self.generation++;
+        
+        for (NSString *entityName in entityNames) {
+            for (NSString *modelID in self.modelIDsByEntityName[entityName]) {
+                [self.modelStorage removeObjectForKey:[self keyForEntityName:entityName
+                                                                     modelID:modelID]];
+            }
+            [self.modelIDsByEntityName removeObjectForKey:entityName];
+        }
+    });
+}
+
+- (void)invalidateAllModels {
+    dispatch_sync(self.modelCacheQueue, ^{
+        self.generation++;
+        [self.modelStorage removeAllObjects];
+        [self.modelIDsByEntityName removeAllObjects];
+    });
+}
+
+- (void)resetStatistics {
+    dispatch_sync(self.modelCacheQueue, ^{
+        self.hitCount = 0;
+        self.missCount = 0;
+    });
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
+- (NSString *)keyForEntityName:(NSString *)entityName
+                       modelID:(NSString *)modelID {
+    return [NSString stringWithFormat:@"%@.%@", entityName, modelID];
+}
+
+@end
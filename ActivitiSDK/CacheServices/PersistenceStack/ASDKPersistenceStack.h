@@ -22,6 +22,9 @@
 
 @interface ASDKPersistenceStack : NSObject <ASDKPersistenceStackProtocol>
 
-@property (strong, nonatomic, readonly) NSPersistentContainer *persistentContainer;
+@property (strong, nonatomic, readonly) NSPersistentContainer         *persistentContainer;
+@property (assign, atomic, readonly)    BOOL                          isStoreLoaded;
+@property (assign, nonatomic)           NSUInteger                    contextResetThreshold;
+@property (strong, nonatomic)           id<ASDKModelCacheProtocol>    modelCache;
 
 @end
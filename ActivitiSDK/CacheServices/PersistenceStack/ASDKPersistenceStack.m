@@ -25,12 +25,79 @@
 // Models
 #import "ASDKModelServerConfiguration.h"
 
+// Managers
+#import "ASDKWriterManagedObjectContext.h"
+#import "ASDKModelCacheProtocol.h"
+
 #if ! __has_feature(objc_arc)
 #warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
 #endif
 
 static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLAG_TRACE;
 
+static NSTimeInterval const kASDKPersistenceStackViewContextMergeInterval   = .3f;
+static NSTimeInterval const kASDKPersistenceStackDeferredSaveInterval       = 1.0f;
+static NSUInteger const     kASDKPersistenceStackContextResetThreshold      = 2000;
+
+@interface ASDKPersistenceStack ()
+
+@property (assign, atomic, readwrite) BOOL      isStoreLoaded;
+
+/**
+ *  Property meant to hold a reference to the serial queue guarding the store loading
+ *  state and the tasks waiting for the store to be loaded
+ */
+@property (strong, nonatomic) dispatch_queue_t  storeLoadingQueue;
+
+/**
+ *  Property meant to hold blocks submitted before the persistent store was loaded
+ */
+@property (strong, nonatomic) NSMutableArray    *pendingTaskBlocks;
+
+/**
+ *  Property meant to hold a reference to the long-lived private context all cache
+ *  writes are routed through
+ */
+@property (strong, nonatomic) ASDKWriterManagedObjectContext *writerContext;
+
+/**
+ *  Property meant to indicate whether committing deferred writer context saves is
+ *  already scheduled. Only accessed on the writer context's queue.
+ */
+@property (assign, nonatomic) BOOL              isDeferredSaveScheduled;
+
+/**
+ *  Property meant to hold weak references to the reusable background contexts
+ *  handed out by the stack so that batch operation changes reach them
+ */
+@property (strong, nonatomic) NSHashTable       *reusableContexts;
+
+/**
+ *  Property meant to hold a reference to the serial queue collecting saved changes
+ *  that are waiting to be merged into the view context
+ */
+@property (strong, nonatomic) dispatch_queue_t  viewContextMergeQueue;
+
+/**
+ *  Property meant to hold the object IDs of saved changes that were not merged into
+ *  the view context yet, keyed by the change type keys of a save notification
+ */
+@property (strong, nonatomic) NSMutableDictionary *pendingViewContextChanges;
+
+/**
+ *  Property meant to indicate whether a merge into the view context is already
+ *  scheduled
+ */
+@property (assign, nonatomic) BOOL              isViewContextMergeScheduled;
+
+/**
+ *  Property meant to hold the model IDs changed by saves in flight keyed by the saving
+ *  context so that the model cache is invalidated once the save is committed
+ */
+@property (strong, nonatomic) NSMapTable        *pendingModelInvalidations;
+
+@end
+
 @implementation ASDKPersistenceStack
 
 
@@ -52,20 +119,72 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
         NSPersistentContainer *persistentContainer = [[NSPersistentContainer alloc] initWithName:[ASDKPersistenceStack persistenceStackModelNameForServerConfiguration: serverConfiguration]
                                                                               managedObjectModel:managedObjectModel];
         
+        // Saved changes are merged into the view context in batches instead of once
+        // per save so that large cache refreshes do not compete with the main thread
+        persistentContainer.viewContext.automaticallyMergesChangesFromParent = NO;
+        persistentContainer.viewContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+        
+        // Migrating or opening a large store must not block the thread bootstrapping the SDK
+        for (NSPersistentStoreDescription *storeDescription in persistentContainer.persistentStoreDescriptions) {
+            storeDescription.shouldAddStoreAsynchronously = YES;
+        }
+        
+        _persistentContainer = persistentContainer;
+        _storeLoadingQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.`%@StoreLoadingQueue",
+                                                     [NSBundle bundleForClass:[self class]].bundleIdentifier,
+                                                     NSStringFromClass([self class])] UTF8String],
+                                                   DISPATCH_QUEUE_SERIAL);
+        _pendingTaskBlocks = [NSMutableArray array];
+        
+        _contextResetThreshold = kASDKPersistenceStackContextResetThreshold;
+        
+        // The writer context stays warm between write tasks so it picks up the
+        // changes other contexts save to the store
+        _writerContext = [[ASDKWriterManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+        _writerContext.persistentStoreCoordinator = persistentContainer.persistentStoreCoordinator;
+        _writerContext.automaticallyMergesChangesFromParent = YES;
+        _writerContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+        _writerContext.undoManager = nil;
+        
+        _reusableContexts = [NSHashTable weakObjectsHashTable];
+        
+        _viewContextMergeQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.`%@ViewContextMergeQueue",
+                                                         [NSBundle bundleForClass:[self class]].bundleIdentifier,
+                                                         NSStringFromClass([self class])] UTF8String],
+                                                       DISPATCH_QUEUE_SERIAL);
+        _pendingViewContextChanges = [NSMutableDictionary dictionary];
+        _pendingModelInvalidations = [NSMapTable weakToStrongObjectsMapTable];
+        
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(handleManagedObjectContextWillSave:)
+                                                     name:NSManagedObjectContextWillSaveNotification
+                                                   object:nil];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(handleManagedObjectContextDidSave:)
+                                                     name:NSManagedObjectContextDidSaveNotification
+                                                   object:nil];
+        
+        __weak typeof(self) weakSelf = self;
         [persistentContainer loadPersistentStoresWithCompletionHandler:^(NSPersistentStoreDescription *description, NSError *error) {
-            persistentContainer.viewContext.automaticallyMergesChangesFromParent = YES;
-            persistentContainer.viewContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+            __strong typeof(self) strongSelf = weakSelf;
+            
             if (errorHandlerBlock) {
                 errorHandlerBlock(error);
             }
+            
+            // Queued tasks are released even if loading failed so that their
+            // callers are notified with the errors reported by Core Data
+            [strongSelf markStoreAsLoaded];
         }];
-        
-        _persistentContainer = persistentContainer;
     }
     
     return self;
 }
 
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
 + (NSString *)persistenceStackModelNameForServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration {
     if (serverConfiguration.hostAddressString.length &&
         serverConfiguration.username.length &&
@@ -103,30 +222,357 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
 }
 
 - (NSManagedObjectContext *)backgroundContext {
-    return [self.persistentContainer newBackgroundContext];
+    NSManagedObjectContext *backgroundContext = [self.persistentContainer newBackgroundContext];
+    backgroundContext.automaticallyMergesChangesFromParent = YES;
+    backgroundContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+    backgroundContext.undoManager = nil;
+    
+    @synchronized (self.reusableContexts) {
+        [self.reusableContexts addObject:backgroundContext];
+    }
+    
+    return backgroundContext;
 }
 
 - (void)performForegroundTask:(ASDKPersistenceTaskBlock)taskBlock {
     __weak typeof(self) weakSelf = self;
-    [[self viewContext] performBlock:^{
+    [self performWhenStoreIsLoaded:^{
         __strong typeof(self) strongSelf = weakSelf;
-        taskBlock([strongSelf viewContext]);
+        
+        [[strongSelf viewContext] performBlock:^{
+            taskBlock([strongSelf viewContext]);
+        }];
     }];
 }
 
 - (void)performBackgroundTask:(ASDKPersistenceTaskBlock)taskBlock {
-    [self.persistentContainer performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
-        taskBlock(managedObjectContext);
+    __weak typeof(self) weakSelf = self;
+    [self performWhenStoreIsLoaded:^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        [strongSelf.persistentContainer performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+            taskBlock(managedObjectContext);
+        }];
+    }];
+}
+
+- (void)performBackgroundTask:(ASDKPersistenceTaskBlock)taskBlock
+                    inContext:(NSManagedObjectContext *)managedObjectContext {
+    __weak typeof(self) weakSelf = self;
+    [self performWhenStoreIsLoaded:^{
+        [managedObjectContext performBlock:^{
+            __strong typeof(self) strongSelf = weakSelf;
+            
+            taskBlock(managedObjectContext);
+            
+            // Reusable contexts are not meant to carry unsaved changes between tasks
+            if (managedObjectContext.hasChanges) {
+                [managedObjectContext rollback];
+            }
+            [strongSelf resetContextIfNeeded:managedObjectContext];
+        }];
+    }];
+}
+
+- (void)performWriteTask:(ASDKPersistenceTaskBlock)taskBlock {
+    [self performWriteTask:taskBlock
+             deferringSave:NO];
+}
+
+- (void)performWriteTask:(ASDKPersistenceTaskBlock)taskBlock
+           deferringSave:(BOOL)deferSave {
+    __weak typeof(self) weakSelf = self;
+    [self performWhenStoreIsLoaded:^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        ASDKWriterManagedObjectContext *writerContext = strongSelf.writerContext;
+        [writerContext performBlock:^{
+            writerContext.defersSaves = deferSave;
+            [writerContext beginWriteTask];
+            taskBlock(writerContext);
+            
+            // A task that did not request a save, most likely because it failed, has
+            // only its own changes reverted so that the deferred changes of other
+            // tasks are neither discarded nor committed along with them
+            [writerContext endWriteTask];
+            writerContext.defersSaves = NO;
+            
+            if (writerContext.hasDeferredSave) {
+                [strongSelf scheduleDeferredSaveCommit];
+            }
+            
+            [strongSelf resetContextIfNeeded:writerContext];
+        }];
     }];
 }
+
+- (void)mergeChangesFromBatchOperation:(NSDictionary *)changes
+                           intoContext:(NSManagedObjectContext *)managedObjectContext {
+    if (managedObjectContext) {
+        [NSManagedObjectContext mergeChangesFromRemoteContextSave:changes
+                                                     intoContexts:@[managedObjectContext]];
+    }
+    
+    NSMutableArray *longLivedContexts = [NSMutableArray arrayWithObject:self.writerContext];
+    @synchronized (self.reusableContexts) {
+        [longLivedContexts addObjectsFromArray:self.reusableContexts.allObjects];
+    }
+    if (managedObjectContext) {
+        [longLivedContexts removeObject:managedObjectContext];
+    }
+    
+    for (NSManagedObjectContext *longLivedContext in longLivedContexts) {
+        [longLivedContext performBlock:^{
+            [NSManagedObjectContext mergeChangesFromRemoteContextSave:changes
+                                                         intoContexts:@[longLivedContext]];
+        }];
+    }
+    
+    // Batch requests are executed directly against the store so their changes are
+    // already committed, but only object IDs are reported for the affected rows
+    NSMutableSet *changedEntityNames = [NSMutableSet set];
+    for (NSString *changeKey in @[NSUpdatedObjectsKey, NSDeletedObjectsKey]) {
+        for (NSManagedObjectID *objectID in changes[changeKey]) {
+            [changedEntityNames addObject:objectID.entity.name];
+        }
+    }
+    [self.modelCache invalidateModelsForEntityNames:changedEntityNames];
+    
+    [self enqueueViewContextChanges:changes];
+}
+
 - (void)saveContext {
-    NSError *error = nil;
-    if ([[self viewContext] hasChanges]) {
-        if (![[self viewContext] save:&error]) {
-            ASDKLogError(@"Cannot save view context. Reason:%@.\nCore Data stack error:%@", [self saveViewContextOperationError], error.localizedDescription);
-            [[self viewContext] rollback];
+    __weak typeof(self) weakSelf = self;
+    [self performWhenStoreIsLoaded:^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        ASDKWriterManagedObjectContext *writerContext = strongSelf.writerContext;
+        [writerContext performBlock:^{
+            NSError *error = nil;
+            if (writerContext.hasChanges) {
+                if (![writerContext commitChanges:&error]) {
+                    ASDKLogError(@"Cannot save writer context. Reason:%@.\nCore Data stack error:%@", [weakSelf saveWriterContextOperationError], error.localizedDescription);
+                    [writerContext rollback];
+                }
+            }
+            
+            [weakSelf mergePendingChangesIntoViewContext];
+        }];
+        
+        NSManagedObjectContext *viewContext = [strongSelf viewContext];
+        [viewContext performBlock:^{
+            NSError *error = nil;
+            if (viewContext.hasChanges) {
+                if (![viewContext save:&error]) {
+                    ASDKLogError(@"Cannot save view context. Reason:%@.\nCore Data stack error:%@", [weakSelf saveViewContextOperationError], error.localizedDescription);
+                    [viewContext rollback];
+                }
+            }
+        }];
+    }];
+}
+
+
+#pragma mark -
+#pragma mark View context merging
+
+- (void)handleManagedObjectContextWillSave:(NSNotification *)notification {
+    NSManagedObjectContext *savingContext = notification.object;
+    if (!self.modelCache ||
+        savingContext.persistentStoreCoordinator != self.persistentContainer.persistentStoreCoordinator) {
+        return;
+    }
+    
+    // Model IDs are read before the save since deleted objects cannot be accessed afterwards
+    NSMutableDictionary *changedModelIDs = [NSMutableDictionary dictionary];
+    for (NSSet *changedObjects in @[savingContext.insertedObjects, savingContext.updatedObjects, savingContext.deletedObjects]) {
+        for (NSManagedObject *changedObject in changedObjects) {
+            if (!changedObject.entity.attributesByName[@"modelID"]) {
+                continue;
+            }
+            
+            NSString *modelID = [changedObject valueForKey:@"modelID"];
+            if (!modelID) {
+                continue;
+            }
+            
+            NSMutableSet *entityModelIDs = changedModelIDs[changedObject.entity.name];
+            if (!entityModelIDs) {
+                entityModelIDs = [NSMutableSet set];
+                changedModelIDs[changedObject.entity.name] = entityModelIDs;
+            }
+            [entityModelIDs addObject:modelID];
+        }
+    }
+    
+    @synchronized (self.pendingModelInvalidations) {
+        [self.pendingModelInvalidations setObject:changedModelIDs
+                                           forKey:savingContext];
+    }
+}
+
+- (void)handleManagedObjectContextDidSave:(NSNotification *)notification {
+    NSManagedObjectContext *savedContext = notification.object;
+    if (savedContext.persistentStoreCoordinator != self.persistentContainer.persistentStoreCoordinator) {
+        return;
+    }
+    
+    // Invalidating only now that the changes are committed guarantees that a reader
+    // observing the new generation fetches the saved state
+    NSDictionary *changedModelIDs = nil;
+    @synchronized (self.pendingModelInvalidations) {
+        changedModelIDs = [self.pendingModelInvalidations objectForKey:savedContext];
+        [self.pendingModelInvalidations removeObjectForKey:savedContext];
+    }
+    for (NSString *entityName in changedModelIDs) {
+        [self.modelCache invalidateModelsForEntityName:entityName
+                                              modelIDs:[changedModelIDs[entityName] allObjects]];
+    }
+    
+    if (savedContext == self.persistentContainer.viewContext) {
+        return;
+    }
+    
+    // Only object IDs cross the queue boundary, the view context refreshes the
+    // objects it has registered when the batch is merged
+    NSMutableDictionary *savedChanges = [NSMutableDictionary dictionary];
+    for (NSString *changeKey in @[NSInsertedObjectsKey, NSUpdatedObjectsKey, NSDeletedObjectsKey]) {
+        NSSet *changedObjects = notification.userInfo[changeKey];
+        if (changedObjects.count) {
+            savedChanges[changeKey] = [[changedObjects valueForKey:NSStringFromSelector(@selector(objectID))] allObjects];
         }
     }
+    
+    [self enqueueViewContextChanges:savedChanges];
+}
+
+- (void)enqueueViewContextChanges:(NSDictionary *)changes {
+    if (!changes.count) {
+        return;
+    }
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.viewContextMergeQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        for (NSString *changeKey in changes) {
+            NSMutableSet *pendingObjectIDs = strongSelf.pendingViewContextChanges[changeKey];
+            if (!pendingObjectIDs) {
+                pendingObjectIDs = [NSMutableSet set];
+                strongSelf.pendingViewContextChanges[changeKey] = pendingObjectIDs;
+            }
+            [pendingObjectIDs addObjectsFromArray:changes[changeKey]];
+        }
+        
+        if (!strongSelf.isViewContextMergeScheduled) {
+            strongSelf.isViewContextMergeScheduled = YES;
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kASDKPersistenceStackViewContextMergeInterval * NSEC_PER_SEC)), strongSelf.viewContextMergeQueue, ^{
+                [weakSelf mergePendingChangesIntoViewContext];
+            });
+        }
+    });
+}
+
+- (void)mergePendingChangesIntoViewContext {
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.viewContextMergeQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        strongSelf.isViewContextMergeScheduled = NO;
+        if (!strongSelf.pendingViewContextChanges.count) {
+            return;
+        }
+        
+        NSMutableDictionary *pendingChanges = [NSMutableDictionary dictionary];
+        for (NSString *changeKey in strongSelf.pendingViewContextChanges) {
+            pendingChanges[changeKey] = [strongSelf.pendingViewContextChanges[changeKey] allObjects];
+        }
+        [strongSelf.pendingViewContextChanges removeAllObjects];
+        
+        NSManagedObjectContext *viewContext = [strongSelf viewContext];
+        [viewContext performBlock:^{
+            [NSManagedObjectContext mergeChangesFromRemoteContextSave:pendingChanges
+                                                         intoContexts:@[viewContext]];
+        }];
+    });
+}
+
+
+#pragma mark -
+#pragma mark Context reuse
+
+- (void)resetContextIfNeeded:(NSManagedObjectContext *)managedObjectContext {
+    // Warm contexts avoid repeated faulting, but their row cache is trimmed once
+    // it grows past the threshold
+    if (!managedObjectContext.hasChanges &&
+        managedObjectContext.registeredObjects.count >= self.contextResetThreshold) {
+        [managedObjectContext reset];
+    }
+}
+
+- (void)scheduleDeferredSaveCommit {
+    if (self.isDeferredSaveScheduled) {
+        return;
+    }
+    self.isDeferredSaveScheduled = YES;
+    
+    // Deferred saves are committed by the next saveContext call at the latest after
+    // the deferred save interval so that no write chain leaves its changes behind
+    __weak typeof(self) weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kASDKPersistenceStackDeferredSaveInterval * NSEC_PER_SEC)), dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        ASDKWriterManagedObjectContext *writerContext = strongSelf.writerContext;
+        [writerContext performBlock:^{
+            strongSelf.isDeferredSaveScheduled = NO;
+            
+            NSError *error = nil;
+            if (writerContext.hasDeferredSave &&
+                ![writerContext commitChanges:&error]) {
+                ASDKLogError(@"Cannot save writer context. Reason:%@.\nCore Data stack error:%@", [strongSelf saveWriterContextOperationError], error.localizedDescription);
+                [writerContext rollback];
+            }
+        }];
+    });
+}
+
+
+#pragma mark -
+#pragma mark Store loading
+
+- (void)performWhenStoreIsLoaded:(dispatch_block_t)taskBlock {
+    if (self.isStoreLoaded) {
+        taskBlock();
+        return;
+    }
+    
+    __block BOOL isStoreLoaded = NO;
+    dispatch_sync(self.storeLoadingQueue, ^{
+        isStoreLoaded = self.isStoreLoaded;
+        
+        if (!isStoreLoaded) {
+            [self.pendingTaskBlocks addObject:[taskBlock copy]];
+        }
+    });
+    
+    // Loading finished while the block was being submitted
+    if (isStoreLoaded) {
+        taskBlock();
+    }
+}
+
+- (void)markStoreAsLoaded {
+    dispatch_async(self.storeLoadingQueue, ^{
+        self.isStoreLoaded = YES;
+        
+        NSArray *pendingTaskBlocks = [self.pendingTaskBlocks copy];
+        [self.pendingTaskBlocks removeAllObjects];
+        
+        ASDKLogVerbose(@"Persistent store loaded. Executing %lu queued tasks.", (unsigned long)pendingTaskBlocks.count);
+        for (dispatch_block_t taskBlock in pendingTaskBlocks) {
+            taskBlock();
+        }
+    });
 }
 
 
@@ -142,6 +588,15 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
                            userInfo:userInfo];
 }
 
+- (NSError *)saveWriterContextOperationError {
+    NSDictionary *userInfo = @{NSLocalizedDescriptionKey            : @"Cannot save writer context",
+                               NSLocalizedFailureReasonErrorKey     : @"An error occured during the save operation. Rolling back changes.",
+                               NSLocalizedRecoverySuggestionErrorKey: @"Investigate the detailed error responses thrown by Core Data during the save operation."};
+    return [NSError errorWithDomain:ASDKPersistenceStackErrorDomain
+                               code:kASDKPersistenceStackSaveWriterContextErrorCode
+                           userInfo:userInfo];
+}
+
 - (NSError *)saveViewContextOperationError {
     NSDictionary *userInfo = @{NSLocalizedDescriptionKey            : @"Cannot save view context",
                                NSLocalizedFailureReasonErrorKey     : @"An error occured during the save operation. Rolling back changes.",
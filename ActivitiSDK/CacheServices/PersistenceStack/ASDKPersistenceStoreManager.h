@@ -0,0 +1,35 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+#import "ASDKPersistenceStoreManagerProtocol.h"
+
+/**
+ * Keeps a bounded, least recently used set of persistence stores open so that moving
+ * between accounts reuses a warm store instead of opening it again. Each open store
+ * owns its cache maintenance service and model cache.
+ */
+@interface ASDKPersistenceStoreManager : NSObject <ASDKPersistenceStoreManagerProtocol>
+
+@property (assign, nonatomic) NSUInteger        maxOpenStoreCount;
+@property (assign, nonatomic) NSTimeInterval    idleStoreMaintenanceInterval;
+@property (strong, nonatomic, readonly) id<ASDKPersistenceStackProtocol>           activePersistenceStack;
+@property (strong, nonatomic, readonly) id<ASDKCacheMaintenanceServiceProtocol>    activeCacheMaintenanceService;
+@property (strong, nonatomic, readonly) id<ASDKModelCacheProtocol>                 activeModelCache;
+
+@end
@@ -0,0 +1,274 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKPersistenceStoreManager.h"
+
+// Constants
+#import "ASDKLogConfiguration.h"
+
+// Models
+#import "ASDKModelServerConfiguration.h"
+
+// Managers
+#import "ASDKPersistenceStack.h"
+#import "ASDKCacheMaintenanceService.h"
+#import "ASDKModelCache.h"
+
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
+
+static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLAG_TRACE;
+
+static NSUInteger const     kASDKPersistenceStoreManagerDefaultMaxOpenStoreCount            = 3;
+static NSTimeInterval const kASDKPersistenceStoreManagerDefaultIdleStoreMaintenanceInterval = 30.0f;
+
+@interface ASDKPersistenceStoreManager ()
+
+/**
+ *  Property meant to hold a reference to the serial queue guarding the open stores
+ */
+@property (strong, nonatomic) dispatch_queue_t      storeManagerQueue;
+
+/**
+ *  Property meant to hold the persistence stacks of the open stores keyed by store key
+ */
+@property (strong, nonatomic) NSMutableDictionary   *persistenceStacks;
+
+/**
+ *  Property meant to hold the cache maintenance services of the open stores keyed by
+ *  store key
+ */
+@property (strong, nonatomic) NSMutableDictionary   *cacheMaintenanceServices;
+
+/**
+ *  Property meant to hold the model caches of the open stores keyed by store key
+ */
+@property (strong, nonatomic) NSMutableDictionary   *modelCaches;
+
+/**
+ *  Property meant to hold the keys of the open stores ordered from the least to the
+ *  most recently activated one
+ */
+@property (strong, nonatomic) NSMutableArray        *storeKeysByRecentUse;
+
+/**
+ *  Property meant to hold the key of the active store
+ */
+@property (strong, nonatomic) NSString              *activeStoreKey;
+
+/**
+ *  Property meant to count store activations
+ */
+@property (assign, nonatomic) NSUInteger            activationCount;
+
+/**
+ *  Property meant to hold, for every inactive open store, the activation count at the
+ *  time it became inactive. It is used to tell whether the store was activated again
+ *  before its idle maintenance pass was due.
+ */
+@property (strong, nonatomic) NSMutableDictionary   *idleStoreActivationCounts;
+
+@end
+
+@implementation ASDKPersistenceStoreManager
+
+
+#pragma mark -
+#pragma mark Life cycle
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _maxOpenStoreCount = kASDKPersistenceStoreManagerDefaultMaxOpenStoreCount;
+        _idleStoreMaintenanceInterval = kASDKPersistenceStoreManagerDefaultIdleStoreMaintenanceInterval;
+        _storeManagerQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.`%@StoreManagerQueue",
+                                                     [NSBundle bundleForClass:[self class]].bundleIdentifier,
+                                                     NSStringFromClass([self class])] UTF8String],
+                                                   DISPATCH_QUEUE_SERIAL);
+        _persistenceStacks = [NSMutableDictionary dictionary];
+        _cacheMaintenanceServices = [NSMutableDictionary dictionary];
+        _modelCaches = [NSMutableDictionary dictionary];
+        _storeKeysByRecentUse = [NSMutableArray array];
+        _idleStoreActivationCounts = [NSMutableDictionary dictionary];
+    }
+    
+    return self;
+}
+
++ (NSString *)storeKeyForServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration {
+    return [ASDKPersistenceStack persistenceStackModelNameForServerConfiguration:serverConfiguration];
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (id<ASDKPersistenceStackProtocol>)activePersistenceStack {
+    __block id<ASDKPersistenceStackProtocol> persistenceStack = nil;
+    dispatch_sync(self.storeManagerQueue, ^{
+        persistenceStack = self.activeStoreKey ? self.persistenceStacks[self.activeStoreKey] : nil;
+    });
+    
+    return persistenceStack;
+}
+
+- (id<ASDKCacheMaintenanceServiceProtocol>)activeCacheMaintenanceService {
+    __block id<ASDKCacheMaintenanceServiceProtocol> cacheMaintenanceService = nil;
+    dispatch_sync(self.storeManagerQueue, ^{
+        cacheMaintenanceService = self.activeStoreKey ? self.cacheMaintenanceServices[self.activeStoreKey] : nil;
+    });
+    
+    return cacheMaintenanceService;
+}
+
+- (id<ASDKModelCacheProtocol>)activeModelCache {
+    __block id<ASDKModelCacheProtocol> modelCache = nil;
+    dispatch_sync(self.storeManagerQueue, ^{
+        modelCache = self.activeStoreKey ? self.modelCaches[self.activeStoreKey] : nil;
+    });
+    
+    return modelCache;
+}
+
+- (BOOL)isStoreOpenForServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration {
+    NSString *storeKey = [ASDKPersistenceStoreManager storeKeyForServerConfiguration:serverConfiguration];
+    if (!storeKey) {
+        return NO;
+    }
+    
+    __block BOOL isStoreOpen = NO;
+    dispatch_sync(self.storeManagerQueue, ^{
+        isStoreOpen = self.persistenceStacks[storeKey] ? YES : NO;
+    });
+    
+    return isStoreOpen;
+}
+
+- (id<ASDKPersistenceStackProtocol>)activatePersistenceStackForServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration
+                                                                      errorHandler:(ASDKPersistenceErrorHandlerBlock)errorHandlerBlock {
+    NSString *storeKey = [ASDKPersistenceStoreManager storeKeyForServerConfiguration:serverConfiguration];
+    if (!storeKey) {
+        ASDKLogError(@"Cannot activate a persistence store for an incomplete server configuration.");
+        return nil;
+    }
+    
+    __block id<ASDKPersistenceStackProtocol> persistenceStack = nil;
+    __block NSString *deactivatedStoreKey = nil;
+    __block NSUInteger activationCount = 0;
+    __block NSArray *evictedPersistenceStacks = nil;
+    dispatch_sync(self.storeManagerQueue, ^{
+        persistenceStack = self.persistenceStacks[storeKey];
+        
+        if (persistenceStack) {
+            ASDKLogVerbose(@"Reusing open persistence store for key:%@", storeKey);
+            
+            // Models may have been written to the store while it was inactive without
+            // the model cache being told, so it starts cold
+            [self.modelCaches[storeKey] invalidateAllModels];
+            [self.storeKeysByRecentUse removeObject:storeKey];
+        } else {
+            persistenceStack = [[ASDKPersistenceStack alloc] initWithServerConfiguration:serverConfiguration
+                                                                            errorHandler:errorHandlerBlock];
+            if (!persistenceStack) {
+                return;
+            }
+            
+            self.persistenceStacks[storeKey] = persistenceStack;
+            self.cacheMaintenanceServices[storeKey] = [[ASDKCacheMaintenanceService alloc] initWithPersistenceStack:persistenceStack];
+            self.modelCaches[storeKey] = [ASDKModelCache new];
+            persistenceStack.modelCache = self.modelCaches[storeKey];
+        }
+        
+        [self.storeKeysByRecentUse addObject:storeKey];
+        self.activationCount++;
+        activationCount = self.activationCount;
+        if (self.activeStoreKey && ![self.activeStoreKey isEqualToString:storeKey]) {
+            deactivatedStoreKey = self.activeStoreKey;
+            self.idleStoreActivationCounts[deactivatedStoreKey] = @(activationCount);
+        }
+        [self.idleStoreActivationCounts removeObjectForKey:storeKey];
+        self.activeStoreKey = storeKey;
+        
+        evictedPersistenceStacks = [self evictLeastRecentlyUsedStores];
+    });
+    
+    [self closePersistenceStacks:evictedPersistenceStacks];
+    
+    if (deactivatedStoreKey) {
+        [self scheduleIdleStoreMaintenanceForStoreKey:deactivatedStoreKey
+                                      activationCount:activationCount];
+    }
+    
+    return persistenceStack;
+}
+
+
+#pragma mark -
+#pragma mark Store life cycle
+
+- (NSArray *)evictLeastRecentlyUsedStores {
+    NSMutableArray *evictedPersistenceStacks = [NSMutableArray array];
+    NSUInteger maxOpenStoreCount = MAX(self.maxOpenStoreCount, 1);
+    
+    while (self.storeKeysByRecentUse.count > maxOpenStoreCount) {
+        NSString *storeKey = self.storeKeysByRecentUse.firstObject;
+        [self.storeKeysByRecentUse removeObjectAtIndex:0];
+        
+        ASDKLogVerbose(@"Closing least recently used persistence store for key:%@", storeKey);
+        [evictedPersistenceStacks addObject:self.persistenceStacks[storeKey]];
+        [self.persistenceStacks removeObjectForKey:storeKey];
+        [self.cacheMaintenanceServices removeObjectForKey:storeKey];
+        [self.modelCaches removeObjectForKey:storeKey];
+        [self.idleStoreActivationCounts removeObjectForKey:storeKey];
+    }
+    
+    return evictedPersistenceStacks;
+}
+
+- (void)closePersistenceStacks:(NSArray *)persistenceStacks {
+    // Pending writes are committed on the stack's own queues and the store is closed
+    // once the last cache service holding on to the stack is released
+    for (id<ASDKPersistenceStackProtocol> persistenceStack in persistenceStacks) {
+        [persistenceStack saveContext];
+    }
+}
+
+- (void)scheduleIdleStoreMaintenanceForStoreKey:(NSString *)storeKey
+                                activationCount:(NSUInteger)activationCount {
+    if (self.idleStoreMaintenanceInterval <= 0) {
+        return;
+    }
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.idleStoreMaintenanceInterval * NSEC_PER_SEC)), self.storeManagerQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        // Skip the pass if the store was closed or activated again since it became idle
+        if (![strongSelf.idleStoreActivationCounts[storeKey] isEqualToNumber:@(activationCount)]) {
+            return;
+        }
+        
+        id<ASDKCacheMaintenanceServiceProtocol> cacheMaintenanceService = strongSelf.cacheMaintenanceServices[storeKey];
+        
+        ASDKLogVerbose(@"Running maintenance on idle persistence store for key:%@", storeKey);
+        [cacheMaintenanceService performMaintenanceWithCompletionBlock:nil];
+    });
+}
+
+@end
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+@import CoreData;
+
+/**
+ * Private queue context used by the persistence stack as the single long-lived
+ * writer. While defersSaves is set, save requests are recorded instead of being
+ * performed so that the writes of a data accessor operation chain end up in a
+ * single save when the changes are committed.
+ */
+@interface ASDKWriterManagedObjectContext : NSManagedObjectContext
+
+/**
+ * Indicates whether save requests are deferred until the changes are committed.
+ */
+@property (assign, nonatomic) BOOL              defersSaves;
+
+/**
+ * Indicates whether a save request was deferred and the changes it covered are
+ * still waiting to be committed.
+ */
+@property (assign, nonatomic, readonly) BOOL    hasDeferredSave;
+
+/**
+ * Marks the start of a write task. When deferred changes of other tasks are pending,
+ * the changes made by the task are recorded so that they can be reverted on their own.
+ */
+- (void)beginWriteTask;
+
+/**
+ * Marks the end of a write task. If the task did not request a save, most likely because
+ * it failed, its changes are reverted while the deferred changes of other tasks are kept.
+ *
+ * @return YES if the task requested a save, NO if its changes were reverted
+ */
+- (BOOL)endWriteTask;
+
+/**
+ * Persists all pending changes regardless of whether saves are being deferred.
+ *
+ * @param error Error reported by Core Data if the save operation fails
+ * @return YES if the changes were saved, NO otherwise
+ */
+- (BOOL)commitChanges:(NSError **)error;
+
+@end
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKWriterManagedObjectContext.h"
+
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
+
+@interface ASDKWriterManagedObjectContext ()
+
+@property (assign, nonatomic, readwrite) BOOL   hasDeferredSave;
+
+/**
+ *  Property meant to indicate whether the write task in progress requested a save
+ */
+@property (assign, nonatomic) BOOL              isSaveRequestedByWriteTask;
+
+@end
+
+@implementation ASDKWriterManagedObjectContext
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (BOOL)save:(NSError **)error {
+    self.isSaveRequestedByWriteTask = YES;
+    
+    if (self.defersSaves) {
+        if (self.hasChanges) {
+            self.hasDeferredSave = YES;
+        }
+        
+        return YES;
+    }
+    
+    return [self commitChanges:error];
+}
+
+- (void)beginWriteTask {
+    self.isSaveRequestedByWriteTask = NO;
+    
+    // Undo registration is only paid for when there are deferred changes of other
+    // tasks that a rollback would discard along with the ones of this task
+    if (self.hasDeferredSave) {
+        NSUndoManager *undoManager = [NSUndoManager new];
+        undoManager.groupsByEvent = NO;
+        self.undoManager = undoManager;
+        [undoManager beginUndoGrouping];
+    }
+}
+
+- (BOOL)endWriteTask {
+    BOOL isSaveRequested = self.isSaveRequestedByWriteTask;
+    NSUndoManager *undoManager = self.undoManager;
+    
+    if (undoManager) {
+        [self processPendingChanges];
+        [undoManager endUndoGrouping];
+        
+        if (!isSaveRequested && undoManager.canUndo) {
+            [undoManager undo];
+            [self processPendingChanges];
+        }
+        
+        [undoManager removeAllActions];
+        self.undoManager = nil;
+    } else if (!isSaveRequested && self.hasChanges) {
+        [self rollback];
+    }
+    
+    self.isSaveRequestedByWriteTask = NO;
+    
+    return isSaveRequested;
+}
+
+- (BOOL)commitChanges:(NSError **)error {
+    BOOL didSave = [super save:error];
+    if (didSave) {
+        self.hasDeferredSave = NO;
+    }
+    
+    return didSave;
+}
+
+- (void)rollback {
+    [super rollback];
+    self.hasDeferredSave = NO;
+}
+
+- (void)reset {
+    [super reset];
+    self.hasDeferredSave = NO;
+}
+
+@end
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+@class ASDKCacheMaintenanceReport,
+NSManagedObjectID;
+
+@protocol ASDKPersistenceStackProtocol;
+
+typedef void (^ASDKCacheMaintenanceCompletionBlock) (ASDKCacheMaintenanceReport *report, NSError *error);
+
+@protocol ASDKCacheMaintenanceServiceProtocol <NSObject>
+
+/**
+ * Maximum number of rows kept for each root entity (tasks, process instances, profiles,
+ * content and form descriptions). When exceeded, the least recently accessed rows are
+ * evicted. A value of 0 disables the row budget.
+ */
+@property (assign, nonatomic) NSUInteger            maxRowCountPerEntity;
+
+/**
+ * Maximum on-disk size of the store in bytes. When exceeded, the row budget of every
+ * root entity is shrunk proportionally and least recently accessed rows are evicted.
+ * A value of 0 disables the byte budget.
+ */
+@property (assign, nonatomic) unsigned long long    maxStoreByteSize;
+
+/**
+ * Interval after which rows that are no longer referenced by any filter map, content
+ * map or relationship become eligible for garbage collection.
+ */
+@property (assign, nonatomic) NSTimeInterval        retentionInterval;
+
+/**
+ * Minimum interval between two automatically scheduled maintenance passes.
+ */
+@property (assign, nonatomic) NSTimeInterval        minimumMaintenanceInterval;
+
+/**
+ * Report of the last finished maintenance pass.
+ */
+@property (strong, atomic, readonly) ASDKCacheMaintenanceReport *lastMaintenanceReport;
+
+
+/**
+ * Initializes the maintenance service for the passed persistence stack. A maintenance
+ * pass is scheduled automatically whenever the application enters the background.
+ *
+ * @param persistenceStack Persistence stack whose store is maintained
+ * @return Initialized instance
+ */
+- (instancetype)initWithPersistenceStack:(id<ASDKPersistenceStackProtocol>)persistenceStack;
+
+/**
+ * Records a read access to the passed managed objects. Accesses are kept in memory
+ * and persisted as last access dates at the beginning of the next maintenance pass
+ * so that reads do not incur additional writes.
+ *
+ * @param objectIDs Collection of managed object IDs that have been read
+ */
+- (void)recordAccessForObjectIDs:(NSArray<NSManagedObjectID *> *)objectIDs;
+
+/**
+ * Runs a maintenance pass on a low priority queue. Unreferenced rows past the retention
+ * interval are garbage collected first, then least recently accessed rows are evicted
+ * until the row and byte budgets are met.
+ *
+ * @param completionBlock Completion block providing a report of the reclaimed rows or
+ *                        an error if the pass could not be completed
+ */
+- (void)performMaintenanceWithCompletionBlock:(ASDKCacheMaintenanceCompletionBlock)completionBlock;
+
+@end
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+@protocol ASDKModelCacheProtocol <NSObject>
+
+/**
+ * Maximum number of models kept in memory. When exceeded, models are evicted.
+ */
+@property (assign, nonatomic) NSUInteger            countLimit;
+
+/**
+ * Number of lookups answered from memory since the statistics were last reset.
+ */
+@property (assign, atomic, readonly) NSUInteger     hitCount;
+
+/**
+ * Number of lookups that had to fall through to the persistent store since the
+ * statistics were last reset.
+ */
+@property (assign, atomic, readonly) NSUInteger     missCount;
+
+/**
+ * Counter incremented on every invalidation. Readers capture it before fetching
+ * from the persistent store and pass it back when storing the mapped model so that
+ * a model fetched while an upsert was in flight is not cached.
+ */
+@property (assign, atomic, readonly) NSUInteger     generation;
+
+
+/**
+ * Returns a copy of the cached model for the given entity and model ID and updates
+ * the hit and miss counters.
+ *
+ * @param entityName Name of the cache entity the model was mapped from
+ * @param modelID    Model ID of the model
+ * @return Copy of the cached model or nil if not cached
+ */
+- (id)modelForEntityName:(NSString *)entityName
+                 modelID:(NSString *)modelID;
+
+/**
+ * Caches a copy of the passed model unless the cache was invalidated since the
+ * passed generation was read.
+ *
+ * @param model              Model object to be cached
+ * @param entityName         Name of the cache entity the model was mapped from
+ * @param modelID            Model ID of the model
+ * @param observedGeneration Value of the generation property read before fetching
+ *                           the model from the persistent store
+ */
+- (void)setModel:(id<NSCopying>)model
+   forEntityName:(NSString *)entityName
+         modelID:(NSString *)modelID
+observedGeneration:(NSUInteger)observedGeneration;
+
+/**
+ * Removes the cached models for the given entity and model IDs.
+ *
+ * @param entityName Name of the cache entity the models were mapped from
+ * @param modelIDs   Collection of model IDs to invalidate
+ */
+- (void)invalidateModelsForEntityName:(NSString *)entityName
+                             modelIDs:(NSArray<NSString *> *)modelIDs;
+
+/**
+ * Removes the cached models for the given entities. Meant for changes made by batch
+ * requests, which only report the object IDs of the affected rows.
+ *
+ * @param entityNames Names of the cache entities whose models are invalidated
+ */
+- (void)invalidateModelsForEntityNames:(NSSet<NSString *> *)entityNames;
+
+/**
+ * Removes all cached models.
+ */
+- (void)invalidateAllModels;
+
+/**
+ * Resets the hit and miss counters.
+ */
+- (void)resetStatistics;
+
+@end
@@ -21,6 +21,7 @@
 @class NSPersistentContainer,
 NSManagedObjectContext,
 ASDKModelServerConfiguration;
+@protocol ASDKModelCacheProtocol;
 
 typedef void (^ASDKPersistenceTaskBlock) (NSManagedObjectContext *managedObjectContext);
 typedef void (^ASDKPersistenceErrorHandlerBlock) (NSError *error);
@@ -32,10 +33,31 @@ typedef void (^ASDKPersistenceErrorHandlerBlock) (NSError *error);
  */
 @property (strong, nonatomic, readonly) NSPersistentContainer *persistentContainer;
 
+/**
+ * Indicates whether loading the persistent store finished. Stores are loaded asynchronously
+ * and tasks submitted before loading finishes are queued and executed afterwards.
+ */
+@property (assign, atomic, readonly) BOOL isStoreLoaded;
+
+/**
+ * Number of registered objects past which a long-lived context (the writer context and
+ * the reusable background contexts) is reset once it has no pending changes. Higher
+ * values keep more rows warm between tasks at the cost of memory.
+ */
+@property (assign, nonatomic) NSUInteger contextResetThreshold;
+
+/**
+ * In-memory model cache placed in front of the store. The models affected by a save or
+ * by a batch request are invalidated only after the changes are committed to the store,
+ * so that a concurrent reader cannot cache the state that preceded them.
+ */
+@property (strong, nonatomic) id<ASDKModelCacheProtocol> modelCache;
+
 
 /**
- * Initializes, configures and loads a persistence store dedicated to caching and
- * fetching cached data.
+ * Initializes, configures and starts loading a persistence store dedicated to caching and
+ * fetching cached data. The store is loaded in the background so that a migration or a
+ * large store does not block the calling thread.
  *
  * @param serverConfiguration   Server configuration data structure used to diferentiate
  *                              the same data model but on different persistence stores
@@ -63,13 +85,18 @@ typedef void (^ASDKPersistenceErrorHandlerBlock) (NSError *error);
 
 
 /**
- * Creates and returns a private managed object context.
+ * Creates and returns a private managed object context meant to be reused across tasks
+ * through performBackgroundTask:inContext:. The context merges changes saved by other
+ * contexts and receives the changes of batch operations reported to the stack. Note
+ * that the context can only be used to access persisted data after the store finished
+ * loading.
  */
 - (NSManagedObjectContext *)backgroundContext;
 
 
 /**
- * Executes the passed block on the context associated with the main queue.
+ * Executes the passed block on the context associated with the main queue. If the
+ * persistent store is not loaded yet the block is queued until it is.
  *
  * @param taskBlock Block to be executed
  */
@@ -77,7 +104,8 @@ typedef void (^ASDKPersistenceErrorHandlerBlock) (NSError *error);
 
 
 /**
- * Executes the passed block on a private managed object context.
+ * Executes the passed block on a private managed object context. If the persistent
+ * store is not loaded yet the block is queued until it is.
  *
  * @param taskBlock Block to be executed.
  */
@@ -85,8 +113,65 @@ typedef void (^ASDKPersistenceErrorHandlerBlock) (NSError *error);
 
 
 /**
- * Persists changes (if there are any) on the view context and rolls back changes
- * if the save operation fails.
+ * Executes the passed block on a reusable context obtained from backgroundContext.
+ * Unsaved changes are rolled back after the block runs and the context is reset once
+ * it holds more registered objects than the reset threshold.
+ *
+ * @param taskBlock             Block to be executed
+ * @param managedObjectContext  Reusable context the block is executed on
+ */
+- (void)performBackgroundTask:(ASDKPersistenceTaskBlock)taskBlock
+                    inContext:(NSManagedObjectContext *)managedObjectContext;
+
+
+/**
+ * Executes the passed block on the long-lived private writer context. Write tasks
+ * are serialized and the block is expected to save its changes. The changes of a block
+ * that did not save are reverted afterwards so that they do not leak into the next task,
+ * without touching the deferred changes of other tasks. The context stays warm
+ * between tasks and is reset once it grows past the reset threshold.
+ * Saved changes are merged into the view context asynchronously and in batches. If
+ * the persistent store is not loaded yet the block is queued until it is.
+ *
+ * @param taskBlock Block to be executed.
+ */
+- (void)performWriteTask:(ASDKPersistenceTaskBlock)taskBlock;
+
+
+/**
+ * Executes the passed block on the writer context. When deferring, save requests
+ * issued by the block are recorded and the changes are persisted together with the
+ * ones of subsequent write tasks by the next saveContext call, or after a short
+ * delay at the latest. Until then they are only visible to later write tasks and
+ * not to the read contexts.
+ *
+ * @param taskBlock Block to be executed
+ * @param deferSave Whether save requests issued by the block are deferred
+ */
+- (void)performWriteTask:(ASDKPersistenceTaskBlock)taskBlock
+           deferringSave:(BOOL)deferSave;
+
+
+/**
+ * Propagates the changes of a batch request, which bypasses managed object contexts,
+ * to the long-lived contexts of the stack and to the view context.
+ *
+ * @param changes               Object IDs affected by the batch request keyed by
+ *                              NSInsertedObjectsKey, NSUpdatedObjectsKey or
+ *                              NSDeletedObjectsKey
+ * @param managedObjectContext  Context the batch request was executed from. Changes are
+ *                              merged synchronously into it, the method must be
+ *                              called on its queue.
+ */
+- (void)mergeChangesFromBatchOperation:(NSDictionary *)changes
+                           intoContext:(NSManagedObjectContext *)managedObjectContext;
+
+
+/**
+ * Persists pending changes (if there are any), deferred saves included, on the writer
+ * context off the main queue and rolls back changes if the save operation fails. Changes merged into the
+ * view context that are still pending are delivered right away. The view context
+ * is meant to be read-only and is only saved if it was explicitly modified.
  */
 - (void)saveContext;
 
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+#import "ASDKPersistenceStackProtocol.h"
+
+@class ASDKModelServerConfiguration;
+
+@protocol ASDKCacheMaintenanceServiceProtocol,
+ASDKModelCacheProtocol;
+
+@protocol ASDKPersistenceStoreManagerProtocol <NSObject>
+
+/**
+ * Maximum number of persistence stores kept open at the same time. When a store is
+ * activated past this limit, the least recently used inactive store is saved and
+ * closed in the background.
+ */
+@property (assign, nonatomic) NSUInteger        maxOpenStoreCount;
+
+/**
+ * Interval after which a store that is no longer active goes through a cache maintenance
+ * pass in the background, unless it was activated again in the meantime.
+ */
+@property (assign, nonatomic) NSTimeInterval    idleStoreMaintenanceInterval;
+
+/**
+ * Persistence stack of the active store.
+ */
+@property (strong, nonatomic, readonly) id<ASDKPersistenceStackProtocol>           activePersistenceStack;
+
+/**
+ * Cache maintenance service bound to the active store.
+ */
+@property (strong, nonatomic, readonly) id<ASDKCacheMaintenanceServiceProtocol>    activeCacheMaintenanceService;
+
+/**
+ * In-memory model cache bound to the active store.
+ */
+@property (strong, nonatomic, readonly) id<ASDKModelCacheProtocol>                 activeModelCache;
+
+
+/**
+ * Makes the store corresponding to the passed server configuration the active one. A store
+ * that is still open is reused as is, with its contexts and maintenance state warm, otherwise
+ * a new persistence stack is initialized and starts loading.
+ *
+ * @param serverConfiguration   Server configuration identifying the store
+ * @param errorHandlerBlock     Error reporting block that gets called once the store is loaded
+ *                              if a new persistence stack had to be initialized
+ * @return Persistence stack of the activated store
+ */
+- (id<ASDKPersistenceStackProtocol>)activatePersistenceStackForServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration
+                                                                      errorHandler:(ASDKPersistenceErrorHandlerBlock)errorHandlerBlock;
+
+/**
+ * Returns whether the store corresponding to the passed server configuration is open.
+ *
+ * @param serverConfiguration Server configuration identifying the store
+ * @return YES if the store is open, NO otherwise
+ */
+- (BOOL)isStoreOpenForServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration;
+
+/**
+ * Returns the key open stores are tracked by. This is the normalized host, service document
+ * and user name combination the store file is named after.
+ *
+ * @param serverConfiguration Server configuration identifying the store
+ * @return Normalized store key or nil if the configuration is incomplete
+ */
++ (NSString *)storeKeyForServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration;
+
+@end
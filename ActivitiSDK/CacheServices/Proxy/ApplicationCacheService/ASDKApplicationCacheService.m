@@ -34,7 +34,7 @@
 
 - (void)cacheRuntimeApplicationDefinitions:(NSArray *)appDefinitionList
                       withtCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -46,8 +46,8 @@
         NSBatchDeleteResult *deletionResult = [managedObjectContext executeRequest:removeOldAppsRequest
                                                                              error:&error];
         NSArray *moIDArr = deletionResult.result;
-        [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                     intoContexts:@[managedObjectContext]];
+        [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                                  intoContext:managedObjectContext];
         
         if (!error) {
             for (ASDKModelApp *app in appDefinitionList) {
@@ -37,7 +37,7 @@
                withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
     
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         [strongSelf cacheTaskFilterList:filterList
@@ -52,7 +52,7 @@
         withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
     
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         [strongSelf cacheTaskFilterList:filterList
@@ -65,7 +65,7 @@
 - (void)fetchDefaultTaskFilterList:(ASDKCacheServiceFilterListCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
     
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         [strongSelf fetchFilterListUsingPredicate:[strongSelf adhocTaskFilterPredicate]
@@ -78,7 +78,7 @@
                 usingFilter:(ASDKFilterListRequestRepresentation *)filter {
     __weak typeof(self) weakSelf = self;
     
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         [strongSelf fetchFilterListUsingPredicate:[strongSelf appTaskFilterPredicateForAppID:filter.appID]
@@ -90,7 +90,7 @@
 - (void)cacheDefaultProcessInstanceFilterList:(NSArray *)filterList
                           withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         [strongSelf cacheProcessInstanceFilterList:filterList
                                     usingPredicate:[strongSelf adhocProcessInstanceFilterPredicate]
@@ -104,7 +104,7 @@
                    withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
     
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         [strongSelf cacheProcessInstanceFilterList:filterList
@@ -116,7 +116,7 @@
 - (void)fetchDefaultProcessInstanceFilterList:(ASDKCacheServiceFilterListCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
     
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         [strongSelf fetchFilterListUsingPredicate:[strongSelf adhocProcessInstanceFilterPredicate]
@@ -129,7 +129,7 @@
                            usingFilter:(ASDKFilterListRequestRepresentation *)filter {
     __weak typeof(self) weakSelf = self;
     
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         [strongSelf fetchFilterListUsingPredicate:[strongSelf appProcessInstanceFilterPredicateForAppID:filter.appID]
@@ -182,8 +182,8 @@
     NSBatchDeleteResult *deletionResult = [managedObjectContext executeRequest:removeOldDefaultTaskFiltersRequest
                                                                          error:&error];
     NSArray *moIDArr = deletionResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     
     if (!error) {
         for (ASDKModelFilter *filter in filterList) {
@@ -26,6 +26,7 @@
 #import "ASDKMOFormFieldOption.h"
 #import "ASDKMOFormDescription.h"
 #import "ASDKMOFormFieldValueRepresentation.h"
+#import "ASDKMOFormFieldValue.h"
 
 // Model upsert
 #import "ASDKFormFieldOptionCacheModelUpsert.h"
@@ -50,7 +51,7 @@
              withFormFieldID:(NSString *)fieldID
          withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -88,7 +89,7 @@
              withFormFieldID:(NSString *)fieldID
          withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -127,7 +128,7 @@
                 withColumnID:(NSString *)columnID
          withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -170,7 +171,7 @@
                 withColumnID:(NSString *)columnID
          withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -229,7 +230,7 @@
                        forTaskID:(NSString *)taskID
            isSaveFormDescription:(BOOL)isSaveFormDescription
              withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -255,7 +256,7 @@
 
 - (void)fetchTaskFormDescriptionForTaskID:(NSString *)taskID
                       withCompletionBlock:(ASDKCacheServiceTaskSavedFormDescriptionCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -265,6 +266,7 @@
         fetchRequest.predicate = [ASDKFormDescriptionCacheModelUpsert formDescriptionPredicateForTaskID:taskID];
         NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchRequest
                                                                     error:&error];
+        [self recordAccessForManagedObjects:fetchResults];
         
         if (completionBlock) {
             ASDKMOFormDescription *moFormDescription = fetchResults.firstObject;
@@ -282,7 +284,7 @@
 - (void)cacheProcessInstanceFormDescription:(ASDKModelFormDescription *)formDescription
                        forProcessInstanceID:(NSString *)processInstanceID
                         withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -312,7 +314,7 @@
 - (void)cacheProcessDefinitionFormDescription:(ASDKModelFormDescription *)formDescription
                        forProcessDefinitionID:(NSString *)processDefinitionID
                           withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -341,7 +343,7 @@
 
 - (void)fetchFormDescriptionWithPredicate:(NSPredicate *)predicate
                       withCompletionBlock:(ASDKCacheServiceFormDescriptionCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -351,6 +353,7 @@
         fetchRequest.predicate = predicate;
         NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchRequest
                                                                     error:&error];
+        [self recordAccessForManagedObjects:fetchResults];
         
         if (completionBlock) {
             ASDKMOFormDescription *moFormDescription = fetchResults.firstObject;
@@ -368,7 +371,7 @@
 - (void)cacheTaskFormFieldValuesRepresentation:(ASDKFormFieldValueRequestRepresentation *)formFieldValueRequestRepresentation
                                      forTaskID:(NSString *)taskID
                            withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -391,13 +394,14 @@
 
 - (void)fetchTaskFormFieldValuesRepresentationForTaskID:(NSString *)taskID
                                     withCompletionBlock:(ASDKCacheServiceTaskFormValueRepresentationCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
         NSError *error = nil;
         NSFetchRequest *fetchFormFieldValuesRepresentationRequest = [ASDKMOFormFieldValueRepresentation fetchRequest];
         fetchFormFieldValuesRepresentationRequest.predicate = [NSPredicate predicateWithFormat:@"taskID == %@", taskID];
+        fetchFormFieldValuesRepresentationRequest.relationshipKeyPathsForPrefetching = @[@"formFieldValues"];
         NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchFormFieldValuesRepresentationRequest
                                                                     error:&error];
         
@@ -416,7 +420,7 @@
 
 - (void)removeStalledFormFieldValuesRepresentationsForTaskIDs:(NSArray *)taskIDs
                                           withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -430,9 +434,23 @@
         removeOldFormFieldValuesRequest.resultType = NSBatchDeleteResultTypeObjectIDs;
         NSBatchDeleteResult *removeOldFormFieldValuesResult = [managedObjectContext executeRequest:removeOldFormFieldValuesRequest
                                                                                              error:&error];
-        NSArray *moIDArr = removeOldFormFieldValuesResult.result;
-        [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                     intoContexts:@[managedObjectContext]];
+        NSMutableArray *moIDArr = [NSMutableArray arrayWithArray:removeOldFormFieldValuesResult.result];
+        
+        // Batch deletes don't apply the cascade rule so the value rows are removed explicitly
+        if (!error) {
+            NSFetchRequest *oldFormFieldValueRowsRequest = [ASDKMOFormFieldValue fetchRequest];
+            oldFormFieldValueRowsRequest.predicate = [NSPredicate predicateWithFormat:@"SELF.taskID IN %@", taskIDs];
+            oldFormFieldValueRowsRequest.resultType = NSManagedObjectIDResultType;
+            
+            NSBatchDeleteRequest *removeOldFormFieldValueRowsRequest = [[NSBatchDeleteRequest alloc] initWithFetchRequest:oldFormFieldValueRowsRequest];
+            removeOldFormFieldValueRowsRequest.resultType = NSBatchDeleteResultTypeObjectIDs;
+            NSBatchDeleteResult *removeOldFormFieldValueRowsResult = [managedObjectContext executeRequest:removeOldFormFieldValueRowsRequest
+                                                                                                     error:&error];
+            [moIDArr addObjectsFromArray:removeOldFormFieldValueRowsResult.result];
+        }
+        
+        [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                                  intoContext:managedObjectContext];
         if (error) {
             error = [self clearCacheStalledDataError];
         }
@@ -448,12 +466,15 @@
 }
 
 - (void)fetchAllTaskFormFieldValueRepresentationsWithCompletionBlock:(ASDKCacheServiceTaskFormValueRepresentationListCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
         NSError *error = nil;
         NSFetchRequest *fetchFormFieldValuesRepresentationRequest = [ASDKMOFormFieldValueRepresentation fetchRequest];
+        fetchFormFieldValuesRepresentationRequest.sortDescriptors = @[[NSSortDescriptor sortDescriptorWithKey:@"journalDate"
+                                                                                                     ascending:YES]];
+        fetchFormFieldValuesRepresentationRequest.relationshipKeyPathsForPrefetching = @[@"formFieldValues"];
         NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchFormFieldValuesRepresentationRequest
                                                                     error:&error];
         
@@ -475,6 +496,111 @@
     }];
 }
 
+- (void)fetchFormSaveJournalEntriesWithCompletionBlock:(ASDKCacheServiceFormSaveJournalEntryListCompletionBlock)completionBlock {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
+        managedObjectContext.automaticallyMergesChangesFromParent = YES;
+        managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+        
+        NSError *error = nil;
+        NSFetchRequest *fetchJournalEntriesRequest = [ASDKMOFormFieldValueRepresentation fetchRequest];
+        fetchJournalEntriesRequest.sortDescriptors = @[[NSSortDescriptor sortDescriptorWithKey:@"journalDate"
+                                                                                      ascending:YES]];
+        fetchJournalEntriesRequest.relationshipKeyPathsForPrefetching = @[@"formFieldValues"];
+        NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchJournalEntriesRequest
+                                                                    error:&error];
+        
+        if (completionBlock) {
+            if (error) {
+                completionBlock(nil, error);
+            } else {
+                NSMutableArray *journalEntries = [NSMutableArray array];
+                for (ASDKMOFormFieldValueRepresentation *moFormFieldValueRepresentation in fetchResults) {
+                    [journalEntries addObject:[ASDKFormFieldValueRepresentationCacheMapper mapCacheMOToFormSaveJournalEntry:moFormFieldValueRepresentation]];
+                }
+                
+                completionBlock(journalEntries, nil);
+            }
+        }
+    }];
+}
+
+- (void)fetchFormSaveJournalEntryCountForTaskID:(NSString *)taskID
+                                completionBlock:(ASDKCacheServiceFormSaveJournalEntryCountCompletionBlock)completionBlock {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
+        managedObjectContext.automaticallyMergesChangesFromParent = YES;
+        managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+        
+        NSError *error = nil;
+        NSFetchRequest *countJournalEntriesRequest = [ASDKMOFormFieldValueRepresentation fetchRequest];
+        if (taskID) {
+            countJournalEntriesRequest.predicate = [NSPredicate predicateWithFormat:@"taskID == %@", taskID];
+        }
+        NSUInteger entryCount = [managedObjectContext countForFetchRequest:countJournalEntriesRequest
+                                                                     error:&error];
+        
+        if (completionBlock) {
+            completionBlock((NSNotFound == entryCount) ? 0 : entryCount, error);
+        }
+    }];
+}
+
+- (void)removeFormSaveJournalEntryForTaskID:(NSString *)taskID
+                               withRevision:(int64_t)revision
+                            completionBlock:(ASDKCacheServiceFormSaveJournalEntryRemovalCompletionBlock)completionBlock {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        managedObjectContext.automaticallyMergesChangesFromParent = YES;
+        managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+        
+        NSError *error = nil;
+        NSFetchRequest *fetchJournalEntryRequest = [ASDKMOFormFieldValueRepresentation fetchRequest];
+        fetchJournalEntryRequest.predicate = [NSPredicate predicateWithFormat:@"taskID == %@ AND revision == %lld", taskID, revision];
+        NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchJournalEntryRequest
+                                                                    error:&error];
+        
+        for (ASDKMOFormFieldValueRepresentation *moFormFieldValueRepresentation in fetchResults) {
+            [managedObjectContext deleteObject:moFormFieldValueRepresentation];
+        }
+        
+        if (!error && fetchResults.count) {
+            [managedObjectContext save:&error];
+        }
+        
+        if (completionBlock) {
+            completionBlock((!error && fetchResults.count) ? YES : NO, error);
+        }
+    }];
+}
+
+- (void)updateFormSaveJournalEntryForTaskID:(NSString *)taskID
+                               withRevision:(int64_t)revision
+                               attemptCount:(NSInteger)attemptCount
+                            nextAttemptDate:(NSDate *)nextAttemptDate
+                            completionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        managedObjectContext.automaticallyMergesChangesFromParent = YES;
+        managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+        
+        NSError *error = nil;
+        NSFetchRequest *fetchJournalEntryRequest = [ASDKMOFormFieldValueRepresentation fetchRequest];
+        fetchJournalEntryRequest.predicate = [NSPredicate predicateWithFormat:@"taskID == %@ AND revision == %lld", taskID, revision];
+        NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchJournalEntryRequest
+                                                                    error:&error];
+        
+        for (ASDKMOFormFieldValueRepresentation *moFormFieldValueRepresentation in fetchResults) {
+            moFormFieldValueRepresentation.attemptCount = (int16_t)attemptCount;
+            moFormFieldValueRepresentation.nextAttemptDate = nextAttemptDate;
+        }
+        
+        if (!error && managedObjectContext.hasChanges) {
+            [managedObjectContext save:&error];
+        }
+        
+        if (completionBlock) {
+            completionBlock(error);
+        }
+    }];
+}
+
 
 #pragma mark -
 #pragma mark Operations
@@ -491,8 +617,8 @@
     NSBatchDeleteResult *removeOldRestFieldValuesResult = [managedObjectContext executeRequest:removeOldRestFieldValuesRequest
                                                                                          error:&internalError];
     NSArray *moIDArr = removeOldRestFieldValuesResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     if (internalError) {
         return [self clearCacheStalledDataError];
     }
@@ -502,7 +628,7 @@
 
 - (void)fetchRestFieldValuesWithPredicate:(NSPredicate *)predicate
                       withCompletionBlock:(ASDKCacheServiceTaskRestFieldValuesCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         NSError *error = nil;
         NSArray *matchingRestFieldValueArr = nil;
         
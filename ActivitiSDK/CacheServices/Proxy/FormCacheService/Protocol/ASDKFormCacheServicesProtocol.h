@@ -19,13 +19,17 @@
 #import <Foundation/Foundation.h>
 
 @class ASDKModelFormDescription,
-ASDKFormFieldValueRequestRepresentation;
+ASDKFormFieldValueRequestRepresentation,
+ASDKFormSaveJournalEntry;
 
 typedef void (^ASDKCacheServiceTaskRestFieldValuesCompletionBlock) (NSArray *restFieldValues, NSError *error);
 typedef void (^ASDKCacheServiceFormDescriptionCompletionBlock) (ASDKModelFormDescription *formDescription, NSError *error);
 typedef void (^ASDKCacheServiceTaskSavedFormDescriptionCompletionBlock) (ASDKModelFormDescription *formDescription, NSError *error, BOOL isSavedForm);
 typedef void (^ASDKCacheServiceTaskFormValueRepresentationCompletionBlock) (ASDKFormFieldValueRequestRepresentation *formFieldValueRequestRepresentation, NSError *error);
 typedef void (^ASDKCacheServiceTaskFormValueRepresentationListCompletionBlock) (NSArray *formFieldValueRepresentationList, NSArray *taskIDs, NSError *error);
+typedef void (^ASDKCacheServiceFormSaveJournalEntryListCompletionBlock) (NSArray *journalEntries, NSError *error);
+typedef void (^ASDKCacheServiceFormSaveJournalEntryRemovalCompletionBlock) (BOOL isEntryRemoved, NSError *error);
+typedef void (^ASDKCacheServiceFormSaveJournalEntryCountCompletionBlock) (NSUInteger entryCount, NSError *error);
 
 @protocol ASDKFormCacheServicesProtocol <NSObject>
 
@@ -221,6 +225,52 @@ typedef void (^ASDKCacheServiceTaskFormValueRepresentationListCompletionBlock) (
 - (void)removeStalledFormFieldValuesRepresentationsForTaskIDs:(NSArray *)taskIDs
                                           withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock;
 
+/**
+ * Fetches and reports via a completion block the journal of form field value representations
+ * pending upload, ordered by the date they were first journaled.
+ *
+ * @param completionBlock Completion block returning a list of ASDKFormSaveJournalEntry objects
+ */
+- (void)fetchFormSaveJournalEntriesWithCompletionBlock:(ASDKCacheServiceFormSaveJournalEntryListCompletionBlock)completionBlock;
+
+/**
+ * Counts and reports via a completion block the form field value representations pending upload
+ * without loading their values. Passing a task ID restricts the count to that task.
+ *
+ * @param taskID            ID of the task for which pending values are counted or nil for all tasks
+ * @param completionBlock   Completion block returning the number of journal entries
+ */
+- (void)fetchFormSaveJournalEntryCountForTaskID:(NSString *)taskID
+                                completionBlock:(ASDKCacheServiceFormSaveJournalEntryCountCompletionBlock)completionBlock;
+
+/**
+ * Removes the journaled form field value representation of the specified task only if it still
+ * has the provided revision. A representation saved again after the upload started is kept.
+ *
+ * @param taskID            ID of the task for which the journal entry is removed
+ * @param revision          Revision of the journal entry that was uploaded
+ * @param completionBlock   Completion block returning whether the entry has been removed
+ */
+- (void)removeFormSaveJournalEntryForTaskID:(NSString *)taskID
+                               withRevision:(int64_t)revision
+                            completionBlock:(ASDKCacheServiceFormSaveJournalEntryRemovalCompletionBlock)completionBlock;
+
+/**
+ * Records a failed upload attempt for the journaled form field value representation of the specified
+ * task if it still has the provided revision and reports the operation success over a completion block.
+ *
+ * @param taskID            ID of the task for which the attempt is recorded
+ * @param revision          Revision of the journal entry that failed to upload
+ * @param attemptCount      Number of failed attempts for the revision
+ * @param nextAttemptDate   Earliest date at which the upload can be retried
+ * @param completionBlock   Completion block indicating the success of the operation
+ */
+- (void)updateFormSaveJournalEntryForTaskID:(NSString *)taskID
+                               withRevision:(int64_t)revision
+                               attemptCount:(NSInteger)attemptCount
+                            nextAttemptDate:(NSDate *)nextAttemptDate
+                            completionBlock:(ASDKCacheServiceCompletionBlock)completionBlock;
+
 /**
  * Caches provided start form description for the specified process instance and reports the operation
  * success over a completion block.
@@ -41,7 +41,7 @@
 - (void)cacheIntegrationList:(NSArray *)integrationList
          withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -65,7 +65,7 @@
 
 - (void)fetchIntegrationListWithCompletionBlock:(ASDKCacheServiceIntegrationAccountListCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         ASDKModelPaging *paging = nil;
@@ -112,8 +112,8 @@
     NSBatchDeleteResult *removeOldIntegrationListResult = [manangedObjectContext executeRequest:removeOldIntegrationListRequest
                                                                                           error:&internalError];
     NSArray *moIDArr = removeOldIntegrationListResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[manangedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:manangedObjectContext];
     if (internalError) {
         return [self clearCacheStalledDataError];
     }
@@ -44,7 +44,7 @@
                           forAppID:(NSString *)applicationID
                withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -71,7 +71,7 @@
 - (void)fetchProcessDefinitionListForAppID:(NSString *)applicationID
                        withCompletionBlock:(ASDKCacheServiceProcessDefinitionListCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         ASDKModelPaging *paging = nil;
@@ -123,8 +123,8 @@
     NSBatchDeleteResult *removeOldProcessDefinitionResult = [managedObjectContext executeRequest:removeOldProcessDefinitionsRequest
                                                                                            error:&internalError];
     NSArray *moIDArr = removeOldProcessDefinitionResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     if (internalError) {
         return [self clearCacheStalledDataError];
     }
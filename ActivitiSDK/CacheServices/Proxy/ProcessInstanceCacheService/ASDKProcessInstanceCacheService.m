@@ -23,6 +23,7 @@
 
 // Model upsert
 #import "ASDKProcessInstanceCacheModelUpsert.h"
+#import "ASDKCacheModelBulkInsert.h"
 #import "ASDKProcessInstanceContentCacheModelUpsert.h"
 #import "ASDKCommentCacheModelUpsert.h"
 
@@ -43,6 +44,7 @@
 #import "ASDKProcessInstanceContentCacheMapper.h"
 #import "ASDKProcessInstanceCommentMapCacheMapper.h"
 #import "ASDKCommentCacheMapper.h"
+#import "ASDKSearchTokensCacheMapper.h"
 
 @implementation ASDKProcessInstanceCacheService
 
@@ -54,7 +56,7 @@
                      usingFilter:(ASDKFilterRequestRepresentation *)filter
              withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -66,6 +68,13 @@
          process instances in relation to a specific filter and application.
          */
         NSError *error = nil;
+        
+        // A filter map holding no process instances yet marks a first synchronization
+        // for which rows are ingested in bulk instead of being upserted one by one
+        BOOL usingBulkInsert = [strongSelf shouldBulkInsertProcessInstanceList:processInstanceList
+                                                                     forFilter:filter
+                                                                     inContext:managedObjectContext];
+        
         if (!filter.page &&
             ASDKModelFilterStateTypeAll != filter.filterModel.state) {
             error = [strongSelf cleanStalledProcessInstancesInContext:managedObjectContext
@@ -75,6 +84,7 @@
         if (!error) {
             error = [strongSelf saveProcessInstanceListAndGenerateFilterMap:processInstanceList
                                                                   forFilter:filter
+                                                            usingBulkInsert:usingBulkInsert
                                                                   inContext:managedObjectContext];
         }
         
@@ -91,7 +101,7 @@
 - (void)fetchProcessInstanceList:(ASDKCacheServiceProcessInstanceListCompletionBlock)completionBlock
                      usingFilter:(ASDKFilterRequestRepresentation *)filter {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         ASDKModelPaging *paging = nil;
@@ -119,8 +129,18 @@
             NSArray *processInstancesIDs = [allProcessInstanceFilterMapPlaceholdersOfCurrentApp valueForKey:@"modelID"];
             
             if (processInstancesIDs.count) {
+                // Name searches are answered by the store through the search tokens column
                 NSFetchRequest *processInstanceFetchRequest = [ASDKMOProcessInstance fetchRequest];
-                processInstanceFetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", processInstancesIDs];
+                NSPredicate *membershipPredicate = [NSPredicate predicateWithFormat:@"modelID IN %@", processInstancesIDs];
+                NSPredicate *namePredicate = [strongSelf namePredicateForFilter:filter];
+                if (namePredicate) {
+                    processInstanceFetchRequest.predicate = [[NSCompoundPredicate alloc] initWithType:NSAndPredicateType
+                                                                                        subpredicates:@[membershipPredicate, namePredicate]];
+                } else {
+                    processInstanceFetchRequest.predicate = membershipPredicate;
+                }
+                [ASDKProcessInstanceCacheMapper configureFetchRequest:processInstanceFetchRequest
+                                                    forMappingProfile:ASDKCacheMappingProfileListSummary];
                 processInstances = [managedObjectContext executeFetchRequest:processInstanceFetchRequest
                                                                        error:&error];
             }
@@ -135,14 +155,7 @@
                     sortedProcessInstances = processInstances;
                 }
                 
-                NSPredicate *namePredicate = [strongSelf namePredicateForFilter:filter];
-                
-                NSArray *matchingProcessInstanceArr = nil;
-                if (namePredicate) {
-                    matchingProcessInstanceArr = [sortedProcessInstances filteredArrayUsingPredicate:namePredicate];
-                } else {
-                    matchingProcessInstanceArr = sortedProcessInstances;
-                }
+                NSArray *matchingProcessInstanceArr = sortedProcessInstances;
                 
                 NSUInteger fetchOffset = filter.size * filter.page;
                 NSInteger location = matchingProcessInstanceArr.count - fetchOffset;
@@ -157,13 +170,18 @@
             }
         }
         
+        if (!error) {
+            [strongSelf recordAccessForManagedObjects:pagedProcessInstanceArr];
+        }
+        
         if (completionBlock) {
             if (error || !pagedProcessInstanceArr.count) {
                 completionBlock(nil, error, paging);
             } else {
                 NSMutableArray *processInstances = [NSMutableArray array];
                 for (ASDKMOProcessInstance *moProcessInstance in pagedProcessInstanceArr) {
-                    ASDKModelProcessInstance *processInstance = [ASDKProcessInstanceCacheMapper mapCacheMOToProcessInstance:moProcessInstance];
+                    ASDKModelProcessInstance *processInstance = [ASDKProcessInstanceCacheMapper mapCacheMOToProcessInstance:moProcessInstance
+                                                                                                             mappingProfile:ASDKCacheMappingProfileListSummary];
                     [processInstances addObject:processInstance];
                 }
                 
@@ -175,7 +193,7 @@
 
 - (void)cacheProcessInstanceDetails:(ASDKModelProcessInstance *)processInstance
                 withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -196,13 +214,30 @@
 
 - (void)fetchProcesInstanceDetailsForID:(NSString *)processInstanceID
                     withCompletionBlock:(ASDKCacheServiceProcessInstanceDetailsCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    ASDKModelProcessInstance *cachedProcessInstance = [self.modelCache modelForEntityName:[ASDKMOProcessInstance entityName]
+                                                                                  modelID:processInstanceID];
+    if (cachedProcessInstance) {
+        if (completionBlock) {
+            completionBlock(cachedProcessInstance, nil);
+        }
+        
+        return;
+    }
+    
+    // Capture the generation before reading the store so that a concurrent upsert
+    // prevents the soon to be stale model from being cached
+    NSUInteger observedGeneration = self.modelCache.generation;
+    
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         NSFetchRequest *fetchRequest = [ASDKMOProcessInstance fetchRequest];
         fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID == %@", processInstanceID];
+        [ASDKProcessInstanceCacheMapper configureFetchRequest:fetchRequest
+                                            forMappingProfile:ASDKCacheMappingProfileDetails];
         
         NSError *error = nil;
         NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchRequest
                                                                     error:&error];
+        [self recordAccessForManagedObjects:fetchResults];
         
         if (completionBlock) {
             ASDKMOProcessInstance *moProcessInstance = fetchResults.firstObject;
@@ -211,6 +246,10 @@
                 completionBlock(nil, error);
             } else {
                 ASDKModelProcessInstance *processInstance = [ASDKProcessInstanceCacheMapper mapCacheMOToProcessInstance:moProcessInstance];
+                [self.modelCache setModel:processInstance
+                            forEntityName:[ASDKMOProcessInstance entityName]
+                                  modelID:processInstanceID
+                       observedGeneration:observedGeneration];
                 completionBlock(processInstance, nil);
             }
         }
@@ -221,7 +260,7 @@
                forProcessInstanceID:(NSString *)processInstanceID
                 withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -248,7 +287,7 @@
 
 - (void)fetchProcessInstanceContentForID:(NSString *)processInstanceID
                      withCompletionBlock:(ASDKCacheServiceProcessInstanceContentListCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         NSFetchRequest *fetchRequest = [ASDKMOProcessInstanceContent fetchRequest];
         fetchRequest.predicate = [self processInstancePredicateForProcessInstanceID:processInstanceID];
         
@@ -275,7 +314,7 @@
                    forProcessInstanceID:(NSString *)processInstanceID
                     withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -306,7 +345,7 @@
 - (void)fetchProcessInstanceCommentListForID:(NSString *)processInstanceID
                          withCompletionBlock:(ASDKCacheServiceProcessInstanceCommentListCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         ASDKModelPaging *paging = nil;
@@ -359,8 +398,8 @@
     NSBatchDeleteResult *removeOldProcessInstanceFilterMapResult = [managedObjectContext executeRequest:removeOldProcessInstanceFilterMapRequest
                                                                                                   error:&internalError];
     NSArray *moIDArr = removeOldProcessInstanceFilterMapResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     if (internalError) {
         return [self clearCacheStalledDataError];
     }
@@ -368,16 +407,54 @@
     return nil;
 }
 
+- (BOOL)shouldBulkInsertProcessInstanceList:(NSArray *)processInstanceList
+                                   forFilter:(ASDKFilterRequestRepresentation *)filter
+                                   inContext:(NSManagedObjectContext *)managedObjectContext {
+    if (!processInstanceList.count ||
+        ![ASDKCacheModelBulkInsert isBulkInsertAvailable]) {
+        return NO;
+    }
+    
+    NSError *error = nil;
+    NSFetchRequest *processInstanceFilterMapFetchRequest = [ASDKMOProcessInstanceFilterMap fetchRequest];
+    processInstanceFilterMapFetchRequest.predicate = [self filterMapMembershipPredicateForFilter:filter];
+    NSArray *fetchResults = [managedObjectContext executeFetchRequest:processInstanceFilterMapFetchRequest
+                                                                error:&error];
+    if (error) {
+        return NO;
+    }
+    
+    ASDKMOProcessInstanceFilterMap *processInstanceFilterMap = fetchResults.firstObject;
+    return !processInstanceFilterMap.processInstancePlaceholders.count;
+}
+
 - (NSError *)saveProcessInstanceListAndGenerateFilterMap:(NSArray *)processInstanceList
                                                forFilter:(ASDKFilterRequestRepresentation *)filter
+                                         usingBulkInsert:(BOOL)usingBulkInsert
                                                inContext:(NSManagedObjectContext *)managedObjectContext {
     // Upsert process instances
     NSError *error = nil;
-    NSArray *moProcessInstanceList = [ASDKProcessInstanceCacheModelUpsert upsertProcessInstanceListToCache:processInstanceList
-                                                                                                     error:&error
-                                                                                               inMOContext:managedObjectContext];
-    if (error) {
-        return error;
+    NSArray *processInstanceIDs = nil;
+    if (usingBulkInsert) {
+        NSArray *insertedObjectIDs = [ASDKProcessInstanceCacheModelUpsert bulkInsertProcessInstanceListToCache:processInstanceList
+                                                                                                         error:&error
+                                                                                                   inMOContext:managedObjectContext];
+        if (error) {
+            return error;
+        }
+        
+        [self.persistenceStack mergeChangesFromBatchOperation:@{NSInsertedObjectsKey : insertedObjectIDs}
+                                                  intoContext:managedObjectContext];
+        processInstanceIDs = [processInstanceList valueForKey:@"modelID"];
+    } else {
+        NSArray *moProcessInstanceList = [ASDKProcessInstanceCacheModelUpsert upsertProcessInstanceListToCache:processInstanceList
+                                                                                                         error:&error
+                                                                                                   inMOContext:managedObjectContext];
+        if (error) {
+            return error;
+        }
+        
+        processInstanceIDs = [moProcessInstanceList valueForKey:@"modelID"];
     }
     
     // Fetch existing or create a process instance filter map
@@ -397,11 +474,11 @@
     
     // Populate the process instance filter map with placeholders pointing to the actual entities
     NSMutableArray *processInstanceFilterMapPlaceholders = [NSMutableArray array];
-    for (ASDKMOProcessInstance *moProcessInstance in moProcessInstanceList) {
+    for (NSString *processInstanceID in processInstanceIDs) {
         ASDKMOProcessInstanceFilterMapPlaceholder *processInstanceFilterMapPlaceholder =
         [NSEntityDescription insertNewObjectForEntityForName:[ASDKMOProcessInstanceFilterMapPlaceholder entityName]
                                       inManagedObjectContext:managedObjectContext];
-        processInstanceFilterMapPlaceholder.modelID = moProcessInstance.modelID;
+        processInstanceFilterMapPlaceholder.modelID = processInstanceID;
         [processInstanceFilterMapPlaceholders addObject:processInstanceFilterMapPlaceholder];
     }
     
@@ -426,8 +503,8 @@
     [managedObjectContext executeRequest:removeOldProcessInstanceContentRequest
                                    error:&internalError];
     NSArray *moIDArr = removeOldProcessInstanceContentResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     if (internalError) {
         return [self clearCacheStalledDataError];
     }
@@ -447,8 +524,8 @@
     NSBatchDeleteResult *processInstanceCommentMapDeletionResult = [managedObjectContext executeRequest:removeOldProcessInstanceCommentMapRequest
                                                                                                   error:&internalError];
     NSArray *moIDArr = processInstanceCommentMapDeletionResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     
     if (internalError) {
         return [self clearCacheStalledDataError];
@@ -513,11 +590,8 @@
 }
 
 - (NSPredicate *)namePredicateForFilter:(ASDKFilterRequestRepresentation *)filter {
-    if (filter.filterModel.name.length) {
-        return [NSPredicate predicateWithFormat:@"name CONTAINS[cd] %@", filter.filterModel.name];
-    }
-    
-    return nil;
+    return [ASDKSearchTokensCacheMapper searchTokensPredicateForQuery:filter.filterModel.name
+                                                          nameKeyPath:@"name"];
 }
 
 - (NSPredicate *)processInstancePredicateForProcessInstanceID:(NSString *)processInstanceID {
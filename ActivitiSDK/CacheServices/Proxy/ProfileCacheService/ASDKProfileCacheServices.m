@@ -38,7 +38,7 @@
 
 - (void)cacheCurrentUserProfile:(ASDKModelProfile *)profile
             withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -39,6 +39,7 @@
 
 // Model upsert
 #import "ASDKTaskCacheModelUpsert.h"
+#import "ASDKCacheModelBulkInsert.h"
 #import "ASDKContentCacheModelUpsert.h"
 #import "ASDKCommentCacheModelUpsert.h"
 #import "ASDKCommentCacheMapper.h"
@@ -50,6 +51,7 @@
 #import "ASDKContentCacheMapper.h"
 #import "ASDKTaskCommentMapCacheMapper.h"
 #import "ASDKProcessTaskFilterMapCacheMapper.h"
+#import "ASDKSearchTokensCacheMapper.h"
 
 @implementation ASDKTaskCacheService
 
@@ -61,7 +63,7 @@
           usingFilter:(ASDKFilterRequestRepresentation *)filter
   withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -77,6 +79,13 @@
          to locally store these kind of relations.
          */
         NSError *error = nil;
+        
+        // A filter map holding no tasks yet marks a first synchronization for which
+        // rows are ingested in bulk instead of being upserted one by one
+        BOOL usingBulkInsert = [strongSelf shouldBulkInsertTaskList:taskList
+                                                          forFilter:filter
+                                                          inContext:managedObjectContext];
+        
         if (!filter.page) {
             error = [strongSelf cleanStalledTasksAndFilterMapInContext:managedObjectContext
                                                              forFilter:filter];
@@ -85,9 +94,17 @@
         if (!error) {
             error = [strongSelf saveTasksAndGenerateFilterMap:taskList
                                                     forFilter:filter
+                                              usingBulkInsert:usingBulkInsert
                                                     inContext:managedObjectContext];
         }
         
+        // A rebuilt first page is the starting point of subsequent delta synchronizations
+        if (!error && !filter.page) {
+            error = [strongSelf resetSyncStateOfTaskFilterMapForTaskList:taskList
+                                                               forFilter:filter
+                                                               inContext:managedObjectContext];
+        }
+        
         if (!error) {
             [managedObjectContext save:&error];
         }
@@ -101,7 +118,7 @@
 - (void)fetchTaskList:(ASDKCacheServiceTaskListCompletionBlock)completionBlock
           usingFilter:(ASDKFilterRequestRepresentation *)filter {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         ASDKModelPaging *paging = nil;
@@ -120,8 +137,18 @@
             NSArray *taskIDs = [taskFilterMap.taskPlaceholders valueForKey:@"modelID"];
             
             if (taskIDs.count) {
+                // Name searches are answered by the store through the search tokens column
                 NSFetchRequest *taskFetchRequest = [ASDKMOTask fetchRequest];
-                taskFetchRequest.predicate = [self predicateMatchingModelIDList:taskIDs];
+                NSPredicate *membershipPredicate = [self predicateMatchingModelIDList:taskIDs];
+                NSPredicate *namePredicate = [strongSelf namePredicateForFilter:filter];
+                if (namePredicate) {
+                    taskFetchRequest.predicate = [[NSCompoundPredicate alloc] initWithType:NSAndPredicateType
+                                                                             subpredicates:@[membershipPredicate, namePredicate]];
+                } else {
+                    taskFetchRequest.predicate = membershipPredicate;
+                }
+                [ASDKTaskCacheMapper configureFetchRequest:taskFetchRequest
+                                         forMappingProfile:ASDKCacheMappingProfileListSummary];
                 tasks = [managedObjectContext executeFetchRequest:taskFetchRequest
                                                             error:&error];
             }
@@ -135,13 +162,7 @@
                 } else {
                     sortedTasks = tasks;
                 }
-                
-                NSPredicate *namePredicate = [strongSelf namePredicateForFilter:filter];
-                if (namePredicate) {
-                    matchingTaskArr = [sortedTasks filteredArrayUsingPredicate:namePredicate];
-                } else {
-                    matchingTaskArr = sortedTasks;
-                }
+                matchingTaskArr = sortedTasks;
                 
                 NSInteger fetchOffset = filter.size * filter.page;
                 NSInteger location = matchingTaskArr.count - fetchOffset;
@@ -156,13 +177,18 @@
             }
         }
         
+        if (!error) {
+            [strongSelf recordAccessForManagedObjects:pagedTaskArr];
+        }
+        
         if (completionBlock) {
             if (error || !pagedTaskArr.count) {
                 completionBlock(nil, error, paging);
             } else {
                 NSMutableArray *tasks = [NSMutableArray array];
                 for (ASDKMOTask *moTask in pagedTaskArr) {
-                    ASDKModelTask *task = [ASDKTaskCacheMapper mapCacheMOToTask:moTask];
+                    ASDKModelTask *task = [ASDKTaskCacheMapper mapCacheMOToTask:moTask
+                                                                 mappingProfile:ASDKCacheMappingProfileListSummary];
                     [tasks addObject:task];
                 }
                 
@@ -172,11 +198,60 @@
     }];
 }
 
+- (void)fetchTaskListSyncStateUsingFilter:(ASDKFilterRequestRepresentation *)filter
+                      withCompletionBlock:(ASDKCacheServiceTaskListSyncStateCompletionBlock)completionBlock {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSFetchRequest *taskFilterMapRequest = [ASDKMOTaskFilterMap fetchRequest];
+        taskFilterMapRequest.predicate = [self taskFilterMapMembershipPredicateForFilter:filter];
+        
+        NSError *error = nil;
+        NSArray *taskFilterMapArr = [managedObjectContext executeFetchRequest:taskFilterMapRequest
+                                                                        error:&error];
+        
+        if (completionBlock) {
+            ASDKMOTaskFilterMap *taskFilterMap = taskFilterMapArr.firstObject;
+            
+            if (error || !taskFilterMap) {
+                completionBlock(nil, nil, error);
+            } else {
+                completionBlock(taskFilterMap.highWaterMarkDate, taskFilterMap.reconciliationDate, nil);
+            }
+        }
+    }];
+}
+
+- (void)applyTaskListDelta:(NSArray *)taskList
+               usingFilter:(ASDKFilterRequestRepresentation *)filter
+           windowStartDate:(NSDate *)windowStartDate
+       withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
+    // The synchronizer reads the list back right after the delta is applied and read
+    // contexts only see committed changes, so this write is never deferred
+    __weak typeof(self) weakSelf = self;
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        __strong typeof(self) strongSelf = weakSelf;
+        managedObjectContext.automaticallyMergesChangesFromParent = YES;
+        managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+        
+        NSError *error = [strongSelf saveTaskListDelta:taskList
+                                             forFilter:filter
+                                       windowStartDate:windowStartDate
+                                             inContext:managedObjectContext];
+        
+        if (!error) {
+            [managedObjectContext save:&error];
+        }
+        
+        if (completionBlock) {
+            completionBlock(error);
+        }
+    }];
+}
+
 - (void)cacheTaskList:(NSArray *)taskList
     usingQuerryFilter:(ASDKTaskListQuerryRequestRepresentation *)filter
   withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
@@ -203,7 +278,7 @@
 - (void)fetchTaskList:(ASDKCacheServiceTaskListCompletionBlock)completionBlock
     usingQuerryFilter:(ASDKTaskListQuerryRequestRepresentation *)filter {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         ASDKModelPaging *paging = nil;
@@ -221,6 +296,8 @@
             if (taskIDs.count) {
                 NSFetchRequest *taskFetchRequest = [ASDKMOTask fetchRequest];
                 taskFetchRequest.predicate = [self predicateMatchingModelIDList:taskIDs];
+                [ASDKTaskCacheMapper configureFetchRequest:taskFetchRequest
+                                         forMappingProfile:ASDKCacheMappingProfileListSummary];
                 moTaskArr = [managedObjectContext executeFetchRequest:taskFetchRequest
                                                             error:&error];
             }
@@ -232,13 +309,18 @@
             }
         }
         
+        if (!error) {
+            [strongSelf recordAccessForManagedObjects:moTaskArr];
+        }
+        
         if (completionBlock) {
             if (error || !moTaskArr.count) {
                 completionBlock(nil, error, paging);
             } else {
                 NSMutableArray *tasks = [NSMutableArray array];
                 for (ASDKMOTask *moTask in moTaskArr) {
-                    ASDKModelTask *task = [ASDKTaskCacheMapper mapCacheMOToTask:moTask];
+                    ASDKModelTask *task = [ASDKTaskCacheMapper mapCacheMOToTask:moTask
+                                                                 mappingProfile:ASDKCacheMappingProfileListSummary];
                     [tasks addObject:task];
                 }
                 
@@ -250,7 +332,7 @@
 
 - (void)cacheTaskDetails:(ASDKModelTask *)task
      withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
         managedObjectContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
         
@@ -271,13 +353,30 @@
 
 - (void)fetchTaskDetailsForID:(NSString *)taskID
           withCompletionBlock:(ASDKCacheServiceTaskDetailsCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    ASDKModelTask *cachedTask = [self.modelCache modelForEntityName:[ASDKMOTask entityName]
+                                                            modelID:taskID];
+    if (cachedTask) {
+        if (completionBlock) {
+            completionBlock(cachedTask, nil);
+        }
+        
+        return;
+    }
+    
+    // Capture the generation before reading the store so that a concurrent upsert
+    // prevents the soon to be stale model from being cached
+    NSUInteger observedGeneration = self.modelCache.generation;
+    
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         NSFetchRequest *fetchRequest = [ASDKMOTask fetchRequest];
         fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID == %@", taskID];
+        [ASDKTaskCacheMapper configureFetchRequest:fetchRequest
+                                 forMappingProfile:ASDKCacheMappingProfileDetails];
         
         NSError *error = nil;
         NSArray *fetchResults = [managedObjectContext executeFetchRequest:fetchRequest
                                                                     error:&error];
+        [self recordAccessForManagedObjects:fetchResults];
         
         if (completionBlock) {
             ASDKMOTask *moTask = fetchResults.firstObject;
@@ -286,6 +385,10 @@
                 completionBlock(nil, error);
             } else {
                 ASDKModelTask *task = [ASDKTaskCacheMapper mapCacheMOToTask:moTask];
+                [self.modelCache setModel:task
+                            forEntityName:[ASDKMOTask entityName]
+                                  modelID:taskID
+                       observedGeneration:observedGeneration];
                 completionBlock(task, nil);
             }
         }
@@ -296,7 +399,7 @@
                forTaskWithID:(NSString *)taskID
          withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
@@ -327,21 +430,18 @@
 
 - (void)fetchTaskContentListForTaskWithID:(NSString *)taskID
                       withCompletionBlock:(ASDKCacheServiceTaskContentListCompletionBlock)completionBlock {
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         NSError *error = nil;
-        NSArray *matchingContentArr = nil;
-        
-        NSFetchRequest *taskContentMapRequest = [ASDKMOTaskContentMap fetchRequest];
-        taskContentMapRequest.predicate = [NSPredicate predicateWithFormat:@"taskID == %@", taskID];
-        NSArray *taskContentMapArr = [managedObjectContext executeFetchRequest:taskContentMapRequest
-                                                                         error:&error];
         
-        if (!error) {
-            ASDKMOTaskContentMap *taskContentMap = taskContentMapArr.firstObject;
-            NSSortDescriptor *contentSortDescriptor = [NSSortDescriptor sortDescriptorWithKey:@"creationDate"
-                                                                                    ascending:YES];
-            matchingContentArr = [[taskContentMap.taskContentList allObjects] sortedArrayUsingDescriptors:@[contentSortDescriptor]];
-        }
+        // Fetch the content through its map membership so that owners can be prefetched
+        NSFetchRequest *taskContentRequest = [ASDKMOContent fetchRequest];
+        taskContentRequest.predicate = [NSPredicate predicateWithFormat:@"taskContentMap.taskID == %@", taskID];
+        taskContentRequest.sortDescriptors = @[[NSSortDescriptor sortDescriptorWithKey:@"creationDate"
+                                                                             ascending:YES]];
+        [ASDKContentCacheMapper configureFetchRequest:taskContentRequest
+                                    forMappingProfile:ASDKCacheMappingProfileListSummary];
+        NSArray *matchingContentArr = [managedObjectContext executeFetchRequest:taskContentRequest
+                                                                          error:&error];
         
         if (completionBlock) {
             if (error || !matchingContentArr.count) {
@@ -349,7 +449,8 @@
             } else {
                 NSMutableArray *contentList = [NSMutableArray array];
                 for (ASDKMOContent *moContent in matchingContentArr) {
-                    ASDKModelContent *content = [ASDKContentCacheMapper mapCacheMOToContent:moContent];
+                    ASDKModelContent *content = [ASDKContentCacheMapper mapCacheMOToContent:moContent
+                                                                             mappingProfile:ASDKCacheMappingProfileListSummary];
                     [contentList addObject:content];
                 }
                 
@@ -363,7 +464,7 @@
                forTaskWithID:(NSString *)taskID
          withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
@@ -395,7 +496,7 @@
 - (void)fetchTaskCommentListForTaskWithID:(NSString *)taskID
                       withCompletionBlock:(ASDKCacheServiceTaskCommentListCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         ASDKModelPaging *paging = nil;
@@ -434,7 +535,7 @@
              forTaskWithID:(NSString *)taskID
        withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         managedObjectContext.automaticallyMergesChangesFromParent = YES;
@@ -463,7 +564,7 @@
 - (void)fetchTaskCheckListForTaskWithID:(NSString *)taskID
                     withCompletionBlock:(ASDKCacheServiceTaskListCompletionBlock)completionBlock {
     __weak typeof(self) weakSelf = self;
-    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+    [self performReadTask:^(NSManagedObjectContext *managedObjectContext) {
         __strong typeof(self) strongSelf = weakSelf;
         
         NSError *error = nil;
@@ -471,6 +572,8 @@
         
         NSFetchRequest *taskChecklistRequest = [ASDKMOTask fetchRequest];
         taskChecklistRequest.predicate = [NSPredicate predicateWithFormat:@"parentTaskID == %@", taskID];
+        [ASDKTaskCacheMapper configureFetchRequest:taskChecklistRequest
+                                 forMappingProfile:ASDKCacheMappingProfileListSummary];
         NSArray *moTaskChecklistArr = [managedObjectContext executeFetchRequest:taskChecklistRequest
                                                                           error:&error];
         
@@ -486,7 +589,8 @@
             } else {
                 NSMutableArray *taskChecklistArr = [NSMutableArray array];
                 for (ASDKMOTask *moTask in moTaskChecklistArr) {
-                    ASDKModelTask *task = [ASDKTaskCacheMapper mapCacheMOToTask:moTask];
+                    ASDKModelTask *task = [ASDKTaskCacheMapper mapCacheMOToTask:moTask
+                                                                 mappingProfile:ASDKCacheMappingProfileListSummary];
                     [taskChecklistArr addObject:task];
                 }
                 
@@ -513,8 +617,8 @@
                                                                                       error:&internalError];
     
     NSArray *moIDArr = taskFilterMapDeletionResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     
     if (internalError) {
         return [self clearCacheStalledDataError];
@@ -536,8 +640,8 @@
                                                                                       error:&internalError];
     
     NSArray *moIDArr = taskChecklistDeletionResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     
     if (internalError) {
         return [self clearCacheStalledDataError];
@@ -546,11 +650,121 @@
     return nil;
 }
 
+- (BOOL)shouldBulkInsertTaskList:(NSArray *)taskList
+                        forFilter:(ASDKFilterRequestRepresentation *)filter
+                        inContext:(NSManagedObjectContext *)managedObjectContext {
+    if (!taskList.count ||
+        ![ASDKCacheModelBulkInsert isBulkInsertAvailable]) {
+        return NO;
+    }
+    
+    NSError *error = nil;
+    NSFetchRequest *taskFilterMapFetchRequest = [ASDKMOTaskFilterMap fetchRequest];
+    taskFilterMapFetchRequest.predicate = [self taskFilterMapMembershipPredicateForFilter:filter];
+    NSArray *fetchResults = [managedObjectContext executeFetchRequest:taskFilterMapFetchRequest
+                                                                error:&error];
+    if (error) {
+        return NO;
+    }
+    
+    ASDKMOTaskFilterMap *taskFilterMap = fetchResults.firstObject;
+    return !taskFilterMap.taskPlaceholders.count;
+}
+
 - (NSError *)saveTasksAndGenerateFilterMap:(NSArray *)taskList
                                  forFilter:(ASDKFilterRequestRepresentation *)filter
+                           usingBulkInsert:(BOOL)usingBulkInsert
                                  inContext:(NSManagedObjectContext *)managedObjectContext {
     // Upsert tasks
     NSError *error = nil;
+    NSArray *taskIDs = nil;
+    if (usingBulkInsert) {
+        NSArray *insertedObjectIDs = [ASDKTaskCacheModelUpsert bulkInsertTaskListToCache:taskList
+                                                                                   error:&error
+                                                                             inMOContext:managedObjectContext];
+        if (error) {
+            return error;
+        }
+        
+        [self.persistenceStack mergeChangesFromBatchOperation:@{NSInsertedObjectsKey : insertedObjectIDs}
+                                                  intoContext:managedObjectContext];
+        taskIDs = [taskList valueForKey:@"modelID"];
+    } else {
+        NSArray *moTasks = [ASDKTaskCacheModelUpsert upsertTaskListToCache:taskList
+                                                                     error:&error
+                                                               inMOContext:managedObjectContext];
+        if (error) {
+            return error;
+        }
+        
+        taskIDs = [moTasks valueForKey:@"modelID"];
+    }
+    
+    // Fetch existing or create a task filter map
+    NSFetchRequest *taskFilterMapFetchRequest = [ASDKMOTaskFilterMap fetchRequest];
+    taskFilterMapFetchRequest.predicate = [self taskFilterMapMembershipPredicateForFilter:filter];
+    NSArray *fetchResults = [managedObjectContext executeFetchRequest:taskFilterMapFetchRequest
+                                                                error:&error];
+    if (error) {
+        return error;
+    }
+    
+    ASDKMOTaskFilterMap *taskFilterMap = fetchResults.firstObject;
+    if (!taskFilterMap) {
+        taskFilterMap = [NSEntityDescription insertNewObjectForEntityForName:[ASDKMOTaskFilterMap entityName]
+                                                      inManagedObjectContext:managedObjectContext];
+    }
+    
+    // Populate the task filter map with placeholders pointing to the actual entities
+    NSMutableArray *taskFilterMapPlaceholders = [NSMutableArray array];
+    for (NSString *taskID in taskIDs) {
+        ASDKMOTaskFilterMapPlaceholder *taskFilterMapPlaceholder = [NSEntityDescription insertNewObjectForEntityForName:[ASDKMOTaskFilterMapPlaceholder entityName]
+                                                                                                 inManagedObjectContext:managedObjectContext];
+        taskFilterMapPlaceholder.modelID = taskID;
+        [taskFilterMapPlaceholders addObject:taskFilterMapPlaceholder];
+    }
+    
+    [ASDKTaskFilterMapCacheMapper mapTaskPlaceholderList:taskFilterMapPlaceholders
+                                              withFilter:filter
+                                               toCacheMO:taskFilterMap];
+    
+    return nil;
+}
+
+- (NSError *)resetSyncStateOfTaskFilterMapForTaskList:(NSArray *)taskList
+                                            forFilter:(ASDKFilterRequestRepresentation *)filter
+                                            inContext:(NSManagedObjectContext *)managedObjectContext {
+    NSError *error = nil;
+    NSFetchRequest *taskFilterMapFetchRequest = [ASDKMOTaskFilterMap fetchRequest];
+    taskFilterMapFetchRequest.predicate = [self taskFilterMapMembershipPredicateForFilter:filter];
+    NSArray *fetchResults = [managedObjectContext executeFetchRequest:taskFilterMapFetchRequest
+                                                                error:&error];
+    if (error) {
+        return error;
+    }
+    
+    /* The newest task of the first page is a valid high water mark only when
+     the list is sorted by creation date in descending order, otherwise newer
+     tasks might be sitting on pages that were not loaded yet
+     */
+    ASDKMOTaskFilterMap *taskFilterMap = fetchResults.firstObject;
+    if (ASDKModelFilterSortTypeCreatedDesc == filter.filterModel.sortType) {
+        taskFilterMap.highWaterMarkDate = [taskList valueForKeyPath:@"@max.creationDate"];
+        taskFilterMap.reconciliationDate = [NSDate date];
+    } else {
+        taskFilterMap.highWaterMarkDate = nil;
+        taskFilterMap.reconciliationDate = nil;
+    }
+    
+    return nil;
+}
+
+- (NSError *)saveTaskListDelta:(NSArray *)taskList
+                     forFilter:(ASDKFilterRequestRepresentation *)filter
+               windowStartDate:(NSDate *)windowStartDate
+                     inContext:(NSManagedObjectContext *)managedObjectContext {
+    // Upsert changed tasks
+    NSError *error = nil;
     NSArray *moTasks = [ASDKTaskCacheModelUpsert upsertTaskListToCache:taskList
                                                                  error:&error
                                                            inMOContext:managedObjectContext];
@@ -573,19 +787,73 @@
                                                       inManagedObjectContext:managedObjectContext];
     }
     
-    // Populate the task filter map with placeholders pointing to the actual entities
+    // Identify cached members created inside the window covered by the delta
+    NSSet *windowTaskIDs = nil;
+    if (windowStartDate) {
+        NSFetchRequest *windowTaskFetchRequest = [ASDKMOTask fetchRequest];
+        NSPredicate *memberPredicate = [self predicateMatchingModelIDList:[taskFilterMap.taskPlaceholders valueForKey:@"modelID"]];
+        NSPredicate *windowPredicate = [NSPredicate predicateWithFormat:@"creationDate > %@", windowStartDate];
+        windowTaskFetchRequest.predicate = [[NSCompoundPredicate alloc] initWithType:NSAndPredicateType
+                                                                       subpredicates:@[memberPredicate, windowPredicate]];
+        NSArray *windowTasks = [managedObjectContext executeFetchRequest:windowTaskFetchRequest
+                                                                   error:&error];
+        if (error) {
+            return error;
+        }
+        
+        windowTaskIDs = [NSSet setWithArray:[windowTasks valueForKey:@"modelID"]];
+    }
+    
+    // Remove members that are no longer part of the list on the server
+    NSSet *deltaTaskIDs = [NSSet setWithArray:[moTasks valueForKey:@"modelID"]];
+    NSMutableSet *memberTaskIDs = [NSMutableSet set];
+    NSMutableSet *stalledTaskFilterMapPlaceholders = [NSMutableSet set];
+    
+    for (ASDKMOTaskFilterMapPlaceholder *taskFilterMapPlaceholder in taskFilterMap.taskPlaceholders) {
+        BOOL isInsideWindow = !windowStartDate || [windowTaskIDs containsObject:taskFilterMapPlaceholder.modelID];
+        BOOL isStalled = ![deltaTaskIDs containsObject:taskFilterMapPlaceholder.modelID] && isInsideWindow;
+        
+        if (isStalled || [memberTaskIDs containsObject:taskFilterMapPlaceholder.modelID]) {
+            [stalledTaskFilterMapPlaceholders addObject:taskFilterMapPlaceholder];
+        } else {
+            [memberTaskIDs addObject:taskFilterMapPlaceholder.modelID];
+        }
+    }
+    
+    [taskFilterMap removeTaskPlaceholders:stalledTaskFilterMapPlaceholders];
+    for (ASDKMOTaskFilterMapPlaceholder *taskFilterMapPlaceholder in stalledTaskFilterMapPlaceholders) {
+        [managedObjectContext deleteObject:taskFilterMapPlaceholder];
+    }
+    
+    // Add placeholders only for tasks that are not already members of the list
     NSMutableArray *taskFilterMapPlaceholders = [NSMutableArray array];
     for (ASDKMOTask *moTask in moTasks) {
+        if ([memberTaskIDs containsObject:moTask.modelID]) {
+            continue;
+        }
+        
         ASDKMOTaskFilterMapPlaceholder *taskFilterMapPlaceholder = [NSEntityDescription insertNewObjectForEntityForName:[ASDKMOTaskFilterMapPlaceholder entityName]
                                                                                                  inManagedObjectContext:managedObjectContext];
         taskFilterMapPlaceholder.modelID = moTask.modelID;
         [taskFilterMapPlaceholders addObject:taskFilterMapPlaceholder];
+        [memberTaskIDs addObject:moTask.modelID];
     }
     
     [ASDKTaskFilterMapCacheMapper mapTaskPlaceholderList:taskFilterMapPlaceholders
                                               withFilter:filter
                                                toCacheMO:taskFilterMap];
     
+    // Advance the high water mark past the newest task of the delta
+    NSDate *newestCreationDate = [taskList valueForKeyPath:@"@max.creationDate"];
+    if (newestCreationDate &&
+        (!taskFilterMap.highWaterMarkDate || NSOrderedDescending == [newestCreationDate compare:taskFilterMap.highWaterMarkDate])) {
+        taskFilterMap.highWaterMarkDate = newestCreationDate;
+    }
+    
+    if (!windowStartDate) {
+        taskFilterMap.reconciliationDate = [NSDate date];
+    }
+    
     return nil;
 }
 
@@ -601,8 +869,8 @@
     NSBatchDeleteResult *taskFilterMapDeletionResult = [managedObjectContext executeRequest:removeOldTaskFilterMapRequest
                                                                                       error:&internalError];
     NSArray *moIDArr = taskFilterMapDeletionResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     
     if (internalError) {
         return [self clearCacheStalledDataError];
@@ -667,8 +935,8 @@
     NSBatchDeleteResult *taskContentMapDeletionResult = [managedObjectContext executeRequest:removeOldTaskContentMapRequest
                                                                                        error:&internalError];
     NSArray *moIDArr = taskContentMapDeletionResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     
     if (internalError) {
         return [self clearCacheStalledDataError];
@@ -721,8 +989,8 @@
     NSBatchDeleteResult *taskCommentMapDeletionResult = [managedObjectContext executeRequest:removeOldTaskCommentMapRequest
                                                                                        error:&internalError];
     NSArray *moIDArr = taskCommentMapDeletionResult.result;
-    [NSManagedObjectContext mergeChangesFromRemoteContextSave:@{NSDeletedObjectsKey : moIDArr}
-                                                 intoContexts:@[managedObjectContext]];
+    [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : moIDArr}
+                                              intoContext:managedObjectContext];
     
     if (internalError) {
         return [self clearCacheStalledDataError];
@@ -799,11 +1067,8 @@
 }
 
 - (NSPredicate *)namePredicateForFilter:(ASDKFilterRequestRepresentation *)filter {
-    if (filter.filterModel.name.length) {
-        return [NSPredicate predicateWithFormat:@"name CONTAINS[cd] %@", filter.filterModel.name];
-    }
-    
-    return nil;
+    return [ASDKSearchTokensCacheMapper searchTokensPredicateForQuery:filter.filterModel.name
+                                                          nameKeyPath:@"name"];
 }
 
 - (NSPredicate *)predicateMatchingModelID:(NSString *)modelID {
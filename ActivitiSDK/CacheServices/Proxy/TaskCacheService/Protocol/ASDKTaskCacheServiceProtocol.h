@@ -27,6 +27,7 @@ typedef void (^ASDKCacheServiceTaskListCompletionBlock) (NSArray *taskList, NSEr
 typedef void (^ASDKCacheServiceTaskDetailsCompletionBlock) (ASDKModelTask *task, NSError *error);
 typedef void (^ASDKCacheServiceTaskContentListCompletionBlock) (NSArray *taskContentList, NSError *error);
 typedef void (^ASDKCacheServiceTaskCommentListCompletionBlock) (NSArray *commentList, NSError *error, ASDKModelPaging *paging);
+typedef void (^ASDKCacheServiceTaskListSyncStateCompletionBlock) (NSDate *highWaterMarkDate, NSDate *reconciliationDate, NSError *error);
 
 @protocol ASDKTaskCacheServiceProtocol <NSObject>
 
@@ -57,6 +58,40 @@ typedef void (^ASDKCacheServiceTaskCommentListCompletionBlock) (NSArray *comment
 - (void)fetchTaskList:(ASDKCacheServiceTaskListCompletionBlock)completionBlock
           usingFilter:(ASDKFilterRequestRepresentation *)filter;
 
+/**
+ * Fetches and reports via a completion block the synchronization state of the task list
+ * described by the passed filter. The high water mark is the creation date of the newest
+ * task known to the cached list and the reconciliation date is the last time the whole
+ * cached list was checked against the server. Both are nil if the list was never
+ * synchronized using a creation date descending sort order.
+ *
+ * @param filter            Filter object describing the task list
+ * @param completionBlock   Completion block providing the high water mark date, the
+ *                          reconciliation date and an optional error reason
+ */
+- (void)fetchTaskListSyncStateUsingFilter:(ASDKFilterRequestRepresentation *)filter
+                      withCompletionBlock:(ASDKCacheServiceTaskListSyncStateCompletionBlock)completionBlock;
+
+/**
+ * Applies a set of changed tasks to the cached task list described by the passed filter
+ * without rebuilding it. Tasks are upserted and added to the list if they are not
+ * already part of it. The delta is expected to hold all the tasks created after the
+ * window start date, therefore cached members created after that date which are missing
+ * from the delta are removed from the list. A nil window start date means the delta holds
+ * the whole list on the server and also marks the list as reconciled. The changes are
+ * committed before the completion block is called, regardless of deferred saves, so that
+ * the updated list can be read back right away.
+ *
+ * @param taskList          List of changed tasks sorted by creation date in descending order
+ * @param filter            Filter object describing the task list
+ * @param windowStartDate   Creation date after which the delta is complete
+ * @param completionBlock   Completion block indicating the success of the operation
+ */
+- (void)applyTaskListDelta:(NSArray *)taskList
+               usingFilter:(ASDKFilterRequestRepresentation *)filter
+           windowStartDate:(NSDate *)windowStartDate
+       withCompletionBlock:(ASDKCacheServiceCompletionBlock)completionBlock;
+
 /**
  * Caches provided tasks by leveraging information from the filter that was provided
  * to the actual network request and repots the operation success over a completion block.
@@ -42,6 +42,7 @@
 
 // Managers
 #import "ASDKFormVisibilityConditionsProcessor.h"
+#import "ASDKFormValidityIndex.h"
 #import "ASDKKVOManager.h"
 
 #if ! __has_feature(objc_arc)
@@ -79,6 +80,24 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
  */
 @property (strong, nonatomic) ASDKKVOManager *kvoManager;
 
+/**
+ *  Property meant to hold a reference to the form description whose form
+ *  variables are indexed and observed for changes.
+ */
+@property (strong, nonatomic) ASDKModelFormDescription *variablesFormDescription;
+
+/**
+ *  Property meant to hold form variable objects indexed by their name, which
+ *  matches the model ID of the form field parameters they are attached to.
+ */
+@property (strong, nonatomic) NSDictionary *formVariablesIndex;
+
+/**
+ *  Property meant to hold a reference to the validity index which keeps track
+ *  of required form fields that are missing values for the visible sections.
+ */
+@property (strong, nonatomic) ASDKFormValidityIndex *validityIndex;
+
 @end
 
 @implementation ASDKFormRenderDataSource
@@ -139,6 +158,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     // Prepare the KVO manager to handle visibility conditions re-evaluations
     self.kvoManager = [ASDKKVOManager managerWithObserver:self];
     
+    // Index form variables so that cell models can be resolved without scanning the variable list
+    [self registerFormVariablesHandlerForFormDescription:formDescription];
+    
     // Parse the renderable form fields from the form description to a tab/section disposed array
     NSArray *renderableParsedFormFields = [self parseRenderableFormFieldsFromContainerList:formDescription.formFields
                                                                                    tabList:formDescription.formTabs];
@@ -187,6 +209,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     // Prepare the KVO manager to handle visibility conditions re-evaluations
     self.kvoManager = [ASDKKVOManager managerWithObserver:self];
     
+    // Index form variables so that cell models can be resolved without scanning the variable list
+    [self registerFormVariablesHandlerForFormDescription:formTabDescription];
+    
     // Parse the renderable form fields from the form description to a tab/section disposed array
     NSArray *renderableParsedFormFields = [self parseRenderableFormFieldsFromContainerList:formTabDescription.renderableTabFormFields
                                                                                    tabList:formTabDescription.formTabs];
@@ -205,8 +230,20 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
     [self registerVisibilityHandlersForInfluencialFormFields:[self.visibilityConditionsProcessor visibilityInfluentialFormFields]];
 }
 
+- (void)setVisibleFormFields:(NSArray *)visibleFormFields {
+    _visibleFormFields = visibleFormFields;
+    
+    // Visible sections and their form fields changed, the validity index must
+    // track the new structure
+    if (!self.validityIndex) {
+        self.validityIndex = [ASDKFormValidityIndex new];
+    }
+    [self.validityIndex rebuildWithSections:visibleFormFields];
+}
+
 - (void)dealloc {
     [self unregisterVisibilityHandlersForInfluencialFormFields:[self.visibilityConditionsProcessor visibilityInfluentialFormFields]];
+    [self unregisterFormVariablesHandler];
 }
 
 
@@ -295,11 +332,9 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
                     // Double check if formFieldParams is a ASDKModelFormField derived object because it is
                     // probable to have other types of parameters that do not have the same inheritance
                     if ([formFieldForCurrentIndexPath.formFieldParams isKindOfClass:[ASDKModelFormField class]]) {
-                        NSPredicate *searchVariablePredicate = [NSPredicate predicateWithFormat:@"name==%@", formFieldForCurrentIndexPath.formFieldParams.modelID];
-                        NSArray *matchingVariables = [self.currenFormDescription.formVariables filteredArrayUsingPredicate:searchVariablePredicate];
-                        if (matchingVariables.count &&
+                        ASDKModelFormVariable *formVariable = [self formVariableForFormField:formFieldForCurrentIndexPath];
+                        if (formVariable.value &&
                             !formFieldForCurrentIndexPath.values.count) {
-                            ASDKModelFormVariable *formVariable = (ASDKModelFormVariable *)matchingVariables.firstObject;
                             formFieldForCurrentIndexPath.values = @[formVariable.value];
                         }
                     }
@@ -626,46 +661,53 @@ static const int activitiSDKLogLevel = ASDK_LOG_LEVEL_VERBOSE; // | ASDK_LOG_FLA
 }
 
 - (BOOL)areFormFieldMetadataValuesValid {
-    BOOL formFieldsAreValid = YES;
+    return self.validityIndex ? self.validityIndex.areFormFieldsValid : [ASDKFormValidityIndex areFormFieldsValidInSections:self.visibleFormFields];
+}
+
+
+#pragma mark -
+#pragma mark Form variables methods
+
+- (void)registerFormVariablesHandlerForFormDescription:(ASDKModelFormDescription *)formDescription {
+    self.variablesFormDescription = formDescription;
+    self.formVariablesIndex = [self indexFormVariables:formDescription.formVariables];
     
-    // Check if mandatory form field values had been addressed
-    for (ASDKModelFormField *sectionFormField in self.visibleFormFields) {
-        if ([sectionFormField isKindOfClass:ASDKModelDynamicTableFormField.class]) { // Extract formfields from dynamic table
-            NSMutableArray *dynamicTableFormFields = [NSMutableArray new];
-            
-            // Add the dynamic table itself
-            [dynamicTableFormFields addObject:sectionFormField];
-            
-            for (NSArray *dynamicTableRow in sectionFormField.values) {
-                [dynamicTableFormFields addObjectsFromArray:dynamicTableRow];
-            }
-        }
-        
-        // Enumerate through the associated form fields and check if they
-        // have a value or attached metadata values
-        for (ASDKModelFormField *formField in sectionFormField.formFields) {
-            if (formField.isRequired) {
-                if (formField.representationType == ASDKModelFormFieldRepresentationTypeBoolean) {
-                    BOOL checked = NO;
-                    if (formField.metadataValue.attachedValue.length) {
-                        checked = [formField.metadataValue.attachedValue isEqualToString:kASDKFormFieldTrueStringValue] ? YES : NO;
-                    } else if (formField.values) {
-                        checked = [formField.values.firstObject boolValue];
-                    }
-                    
-                    if (!checked) {
-                        formFieldsAreValid = NO;
-                        break;
-                    }
-                } else if (!formField.values.count && !formField.metadataValue.attachedValue.length && !formField.metadataValue.option.attachedValue.length) {
-                    formFieldsAreValid = NO;
-                    break;
-                }
-            }
+    if (formDescription) {
+        __weak typeof(self) weakSelf = self;
+        [self.kvoManager observeObject:formDescription
+                            forKeyPath:NSStringFromSelector(@selector(formVariables))
+                               options:NSKeyValueObservingOptionNew
+                                 block:^(id observer, id object, NSDictionary *change) {
+                                     __strong typeof(self) strongSelf = weakSelf;
+                                     strongSelf.formVariablesIndex = [strongSelf indexFormVariables:((ASDKModelFormDescription *)object).formVariables];
+                                 }];
+    }
+}
+
+- (void)unregisterFormVariablesHandler {
+    if (self.variablesFormDescription) {
+        [self.kvoManager removeObserver:self.variablesFormDescription
+                             forKeyPath:NSStringFromSelector(@selector(formVariables))];
+    }
+}
+
+- (NSDictionary *)indexFormVariables:(NSArray *)formVariables {
+    NSMutableDictionary *formVariablesIndex = [NSMutableDictionary dictionaryWithCapacity:formVariables.count];
+    
+    // Enumerate in reverse so that the first occurence of a variable name takes
+    // precedence, mirroring the previous first match lookup behaviour
+    for (ASDKModelFormVariable *formVariable in formVariables.reverseObjectEnumerator) {
+        if (formVariable.name) {
+            formVariablesIndex[formVariable.name] = formVariable;
         }
     }
     
-    return formFieldsAreValid;
+    return formVariablesIndex;
+}
+
+- (ASDKModelFormVariable *)formVariableForFormField:(ASDKModelFormField *)formField {
+    NSString *variableName = formField.formFieldParams.modelID;
+    return variableName ? self.formVariablesIndex[variableName] : nil;
 }
 
 
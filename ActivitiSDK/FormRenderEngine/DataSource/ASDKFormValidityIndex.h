@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+@class ASDKModelFormField;
+
+@interface ASDKFormValidityIndex : NSObject
+
+/**
+ *  Property meant to indicate whether all required form fields tracked by the
+ *  index have a value or attached metadata values. The answer is given from a
+ *  running count of invalid required form fields and does not traverse the form.
+ */
+@property (assign, nonatomic, readonly) BOOL areFormFieldsValid;
+
+/**
+ *  Property meant to hold the number of required form fields that are currently
+ *  missing a value across all indexed sections.
+ */
+@property (assign, nonatomic, readonly) NSUInteger invalidFormFieldsCount;
+
+/**
+ *  Rebuilds the index for the passed section collection. Each section is expected
+ *  to be a container-like object (section form field or tab) exposing a formFields
+ *  collection. Value changes on the contained form fields are observed and the
+ *  running counts are updated as they occur.
+ *
+ *  @param sections Collection of visible sections
+ */
+- (void)rebuildWithSections:(NSArray *)sections;
+
+/**
+ *  Returns the number of required form fields missing a value in the provided
+ *  section.
+ *
+ *  @param section Index of the section as passed in the last rebuild
+ *
+ *  @return        Number of invalid required form fields
+ */
+- (NSUInteger)invalidFormFieldsCountForSection:(NSUInteger)section;
+
+/**
+ *  Re-evaluates the validity of a single form field and updates the running counts.
+ *  This is called automatically when an observed form field's value changes and is
+ *  exposed for callers that mutate form field values in place.
+ *
+ *  @param formField Form field whose validity needs to be re-evaluated
+ */
+- (void)updateValidityForFormField:(ASDKModelFormField *)formField;
+
+/**
+ *  Returns whether the passed form field satisfies its required constraint.
+ *
+ *  @param formField Form field to be checked
+ *
+ *  @return          YES if the form field is not required or has a value, NO otherwise
+ */
++ (BOOL)isFormFieldValid:(ASDKModelFormField *)formField;
+
+/**
+ *  Walks all the passed sections and checks every contained form field. This is the
+ *  full traversal the index replaces and it is kept as a reference implementation.
+ *
+ *  @param sections Collection of visible sections
+ *
+ *  @return         YES if all required form fields have values, NO otherwise
+ */
++ (BOOL)areFormFieldsValidInSections:(NSArray *)sections;
+
+@end
@@ -0,0 +1,240 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKFormValidityIndex.h"
+
+// Constants
+#import "ASDKFormRenderEngineConstants.h"
+
+// Models
+#import "ASDKModelFormField.h"
+#import "ASDKModelFormFieldValue.h"
+
+// Managers
+#import "ASDKKVOManager.h"
+
+#if ! __has_feature(objc_arc)
+#warning This file must be compiled with ARC. Use -fobjc-arc flag (or convert project to ARC).
+#endif
+
+@interface ASDKFormValidityIndex ()
+
+@property (assign, nonatomic, readwrite) NSUInteger invalidFormFieldsCount;
+
+/**
+ *  Property meant to hold a reference to a KVO manager that will be monitoring
+ *  value changes on required form field objects
+ */
+@property (strong, nonatomic) ASDKKVOManager *kvoManager;
+
+/**
+ *  Maps each observed required form field to the section index it belongs to
+ */
+@property (strong, nonatomic) NSMapTable *formFieldSectionMap;
+
+/**
+ *  Maps each observed required form field to its last recorded validity
+ */
+@property (strong, nonatomic) NSMapTable *formFieldValidityMap;
+
+/**
+ *  Running count of invalid required form fields per section
+ */
+@property (strong, nonatomic) NSMutableArray *sectionInvalidCounts;
+
+@end
+
+@implementation ASDKFormValidityIndex
+
+
+#pragma mark -
+#pragma mark Life cycle
+
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _kvoManager = [ASDKKVOManager managerWithObserver:self];
+        _formFieldSectionMap = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                     valueOptions:NSPointerFunctionsStrongMemory];
+        _formFieldValidityMap = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                      valueOptions:NSPointerFunctionsStrongMemory];
+        _sectionInvalidCounts = [NSMutableArray array];
+    }
+    
+    return self;
+}
+
+- (void)dealloc {
+    [self unregisterValueHandlers];
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (BOOL)areFormFieldsValid {
+    return !self.invalidFormFieldsCount;
+}
+
+- (void)rebuildWithSections:(NSArray *)sections {
+    [self unregisterValueHandlers];
+    [self.formFieldSectionMap removeAllObjects];
+    [self.formFieldValidityMap removeAllObjects];
+    [self.sectionInvalidCounts removeAllObjects];
+    
+    NSUInteger invalidFormFieldsCount = 0;
+    
+    for (NSUInteger section = 0; section < sections.count; section++) {
+        NSUInteger sectionInvalidCount = 0;
+        
+        for (ASDKModelFormField *formField in [self formFieldsForSection:sections[section]]) {
+            // Only required form fields can influence the validity of the form and
+            // a form field is tracked only once even if referenced repeatedly
+            if (!formField.isRequired ||
+                [self.formFieldSectionMap objectForKey:formField]) {
+                continue;
+            }
+            
+            BOOL isValid = [ASDKFormValidityIndex isFormFieldValid:formField];
+            [self.formFieldSectionMap setObject:@(section)
+                                         forKey:formField];
+            [self.formFieldValidityMap setObject:@(isValid)
+                                          forKey:formField];
+            if (!isValid) {
+                sectionInvalidCount++;
+            }
+            
+            [self registerValueHandlersForFormField:formField];
+        }
+        
+        [self.sectionInvalidCounts addObject:@(sectionInvalidCount)];
+        invalidFormFieldsCount += sectionInvalidCount;
+    }
+    
+    self.invalidFormFieldsCount = invalidFormFieldsCount;
+}
+
+- (NSUInteger)invalidFormFieldsCountForSection:(NSUInteger)section {
+    return (section < self.sectionInvalidCounts.count) ? [self.sectionInvalidCounts[section] unsignedIntegerValue] : 0;
+}
+
+- (void)updateValidityForFormField:(ASDKModelFormField *)formField {
+    NSNumber *section = [self.formFieldSectionMap objectForKey:formField];
+    if (!section) {
+        return;
+    }
+    
+    BOOL wasValid = [[self.formFieldValidityMap objectForKey:formField] boolValue];
+    BOOL isValid = [ASDKFormValidityIndex isFormFieldValid:formField];
+    if (wasValid == isValid) {
+        return;
+    }
+    
+    [self.formFieldValidityMap setObject:@(isValid)
+                                  forKey:formField];
+    
+    NSUInteger sectionIndex = section.unsignedIntegerValue;
+    NSUInteger sectionInvalidCount = [self.sectionInvalidCounts[sectionIndex] unsignedIntegerValue];
+    if (isValid) {
+        self.sectionInvalidCounts[sectionIndex] = @(sectionInvalidCount - 1);
+        self.invalidFormFieldsCount--;
+    } else {
+        self.sectionInvalidCounts[sectionIndex] = @(sectionInvalidCount + 1);
+        self.invalidFormFieldsCount++;
+    }
+}
+
++ (BOOL)isFormFieldValid:(ASDKModelFormField *)formField {
+    if (!formField.isRequired) {
+        return YES;
+    }
+    
+    if (formField.representationType == ASDKModelFormFieldRepresentationTypeBoolean) {
+        BOOL checked = NO;
+        if (formField.metadataValue.attachedValue.length) {
+            checked = [formField.metadataValue.attachedValue isEqualToString:kASDKFormFieldTrueStringValue] ? YES : NO;
+        } else if (formField.values) {
+            checked = [formField.values.firstObject boolValue];
+        }
+        
+        return checked;
+    }
+    
+    return (formField.values.count ||
+            formField.metadataValue.attachedValue.length ||
+            formField.metadataValue.option.attachedValue.length) ? YES : NO;
+}
+
++ (BOOL)areFormFieldsValidInSections:(NSArray *)sections {
+    // Enumerate through the associated form fields and check if they
+    // have a value or attached metadata values
+    for (ASDKModelFormField *sectionFormField in sections) {
+        for (ASDKModelFormField *formField in sectionFormField.formFields) {
+            if (![self isFormFieldValid:formField]) {
+                return NO;
+            }
+        }
+    }
+    
+    return YES;
+}
+
+
+#pragma mark -
+#pragma mark Value handler methods
+
+- (void)registerValueHandlersForFormField:(ASDKModelFormField *)formField {
+    __weak typeof(self) weakSelf = self;
+    ASDKKVOManagerNotificationBlock valueChangeBlock = ^(id observer, id object, NSDictionary *change) {
+        __strong typeof(self) strongSelf = weakSelf;
+        [strongSelf updateValidityForFormField:(ASDKModelFormField *)object];
+    };
+    
+    [self.kvoManager observeObject:formField
+                        forKeyPath:NSStringFromSelector(@selector(metadataValue))
+                           options:NSKeyValueObservingOptionNew
+                             block:valueChangeBlock];
+    [self.kvoManager observeObject:formField
+                        forKeyPath:NSStringFromSelector(@selector(values))
+                           options:NSKeyValueObservingOptionNew
+                             block:valueChangeBlock];
+}
+
+- (void)unregisterValueHandlers {
+    for (ASDKModelFormField *formField in self.formFieldSectionMap.keyEnumerator.allObjects) {
+        [self.kvoManager removeObserver:formField
+                             forKeyPath:NSStringFromSelector(@selector(metadataValue))];
+        [self.kvoManager removeObserver:formField
+                             forKeyPath:NSStringFromSelector(@selector(values))];
+    }
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
+- (NSArray *)formFieldsForSection:(id)section {
+    if ([section respondsToSelector:@selector(formFields)]) {
+        return [section formFields];
+    }
+    
+    return nil;
+}
+
+@end
@@ -23,4 +23,20 @@
 @property (strong, nonatomic) NSArray   *formFields;
 @property (strong, nonatomic) NSString  *outcome;
 
+/**
+ *  Flattened form field values keyed by form field ID. When set, these values are
+ *  sent instead of the ones extracted from formFields. Representations restored
+ *  from cache are described this way as their form field models are not persisted.
+ */
+@property (strong, nonatomic) NSDictionary *formFieldValues;
+
+/**
+ *  Extracts the values that are to be submitted for the passed form fields.
+ *
+ *  @param formFields Collection of section form fields, dynamic tables or form tabs
+ *
+ *  @return           Dictionary of submitted values keyed by form field ID
+ */
++ (NSDictionary *)formFieldValuesForFormFields:(NSArray *)formFields;
+
 @end
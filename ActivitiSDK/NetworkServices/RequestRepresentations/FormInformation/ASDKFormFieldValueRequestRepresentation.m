@@ -43,56 +43,76 @@
 }
 
 
+#pragma mark -
+#pragma mark JSON conversion
+
+- (NSDictionary *)jsonDictionary {
+    NSDictionary *jsonDict = [super jsonDictionary];
+    
+    if (self.formFieldValues) {
+        NSMutableDictionary *formFieldValuesJSONDict = [NSMutableDictionary dictionaryWithDictionary:jsonDict];
+        formFieldValuesJSONDict[@"values"] = self.formFieldValues;
+        jsonDict = formFieldValuesJSONDict;
+    }
+    
+    return jsonDict;
+}
+
+
 #pragma mark -
 #pragma mark Value transformations
 
 + (NSValueTransformer *)formFieldsJSONTransformer {
     return [MTLValueTransformer transformerUsingReversibleBlock:^id(NSArray *formFields, BOOL *success, NSError *__autoreleasing *error) {
-        NSMutableDictionary *formFieldMetadataValuesDict = [NSMutableDictionary dictionary];
-        
-        // If form tabs are present extract the form field sections from them
-        NSMutableArray *sectionFormFields = [NSMutableArray array];
-        for (id model in formFields) {
-            if ([model isKindOfClass:ASDKModelFormTab.class]) {
-                [sectionFormFields addObjectsFromArray:((ASDKModelFormTab *)model).formFields];
-            } else {
-                [sectionFormFields addObject:model];
-            }
+        return [self formFieldValuesForFormFields:formFields];
+    }];
+}
+
++ (NSDictionary *)formFieldValuesForFormFields:(NSArray *)formFields {
+    NSMutableDictionary *formFieldMetadataValuesDict = [NSMutableDictionary dictionary];
+    
+    // If form tabs are present extract the form field sections from them
+    NSMutableArray *sectionFormFields = [NSMutableArray array];
+    for (id model in formFields) {
+        if ([model isKindOfClass:ASDKModelFormTab.class]) {
+            [sectionFormFields addObjectsFromArray:((ASDKModelFormTab *)model).formFields];
+        } else {
+            [sectionFormFields addObject:model];
         }
-        
-        for (ASDKModelFormField *sectionFormField in sectionFormFields) {
-            // Extract the form fields for the correspondent container
-            if ([sectionFormField isKindOfClass:ASDKModelDynamicTableFormField.class]) {
-                NSMutableArray *rowValues = [NSMutableArray new];
-                
-                for (NSArray *row in sectionFormField.values) {
-                    NSMutableDictionary *columnValues = [NSMutableDictionary new];
-                    
-                    for (ASDKModelFormField *columnFormField in row) {
-                        id formFieldValue = [self determineValueForFormField:columnFormField];
-                        if (formFieldValue) {
-                            [columnValues setObject:formFieldValue
-                                             forKey:columnFormField.modelID];
-                        }
-                    }
-                    [rowValues addObject:columnValues];
-                }
-                [formFieldMetadataValuesDict setObject:rowValues
-                                                forKey:sectionFormField.modelID];
+    }
+    
+    for (ASDKModelFormField *sectionFormField in sectionFormFields) {
+        // Extract the form fields for the correspondent container
+        if ([sectionFormField isKindOfClass:ASDKModelDynamicTableFormField.class]) {
+            NSMutableArray *rowValues = [NSMutableArray new];
+            
+            for (NSArray *row in sectionFormField.values) {
+                NSMutableDictionary *columnValues = [NSMutableDictionary new];
                 
-            } else {
-                for (ASDKModelFormField *formField in sectionFormField.formFields) {
-                    id formFieldValue = [self determineValueForFormField:formField];
+                for (ASDKModelFormField *columnFormField in row) {
+                    id formFieldValue = [self determineValueForFormField:columnFormField];
                     if (formFieldValue) {
-                        [formFieldMetadataValuesDict setObject:formFieldValue
-                                                        forKey:formField.modelID];
+                        [columnValues setObject:formFieldValue
+                                         forKey:columnFormField.modelID];
                     }
                 }
+                [rowValues addObject:columnValues];
             }
-        }
+            [formFieldMetadataValuesDict setObject:rowValues
+                                            forKey:sectionFormField.modelID];
         
-        return formFieldMetadataValuesDict;
-    }];
+        } else {
+            for (ASDKModelFormField *formField in sectionFormField.formFields) {
+                id formFieldValue = [self determineValueForFormField:formField];
+                if (formFieldValue) {
+                    [formFieldMetadataValuesDict setObject:formFieldValue
+                                                    forKey:formField.modelID];
+                }
+            }
+        }
+    }
+    
+    return formFieldMetadataValuesDict;
 }
 
 + (id)determineValueForFormField:(ASDKModelFormField *)formField {
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKPersistenceStack.h"
+#import "ASDKCacheMaintenanceService.h"
+#import "ASDKCacheMaintenanceReport.h"
+
+static NSUInteger const kASDKCacheMaintenanceServiceTestTaskCount = 20;
+
+@interface ASDKCacheMaintenanceServiceTest : ASDKBaseTest
+
+@property (strong, nonatomic) ASDKModelServerConfiguration  *serverConfiguration;
+@property (strong, nonatomic) ASDKPersistenceStack          *persistenceStack;
+@property (strong, nonatomic) ASDKCacheMaintenanceService   *cacheMaintenanceService;
+
+@end
+
+@implementation ASDKCacheMaintenanceServiceTest
+
+- (void)setUp {
+    [super setUp];
+    
+    // Use a dedicated store for each test run
+    self.serverConfiguration = [ASDKModelServerConfiguration new];
+    self.serverConfiguration.hostAddressString = [NSUUID UUID].UUIDString;
+    self.serverConfiguration.username = @"test";
+    self.serverConfiguration.serviceDocument = @"activiti-app";
+    
+    self.persistenceStack = [[ASDKPersistenceStack alloc] initWithServerConfiguration:self.serverConfiguration
+                                                                         errorHandler:^(NSError *error) {
+                                                                             XCTAssertNil(error);
+                                                                         }];
+    self.cacheMaintenanceService = [[ASDKCacheMaintenanceService alloc] initWithPersistenceStack:self.persistenceStack];
+}
+
+- (void)tearDown {
+    self.cacheMaintenanceService = nil;
+    self.persistenceStack = nil;
+    [self removeStore];
+    
+    [super tearDown];
+}
+
+- (void)testThatItCollectsUnreferencedStaleRows {
+    // given
+    NSDate *staleAccessDate = [NSDate dateWithTimeIntervalSinceNow:-2 * self.cacheMaintenanceService.retentionInterval];
+    [self populateStoreWithTaskCount:kASDKCacheMaintenanceServiceTestTaskCount
+                 referencedTaskCount:kASDKCacheMaintenanceServiceTestTaskCount / 2
+                          accessDate:staleAccessDate];
+    
+    // when
+    ASDKCacheMaintenanceReport *report = [self performMaintenance];
+    
+    // then
+    NSUInteger unreferencedTaskCount = kASDKCacheMaintenanceServiceTestTaskCount / 2;
+    XCTAssertEqual(report.reclaimedRowCount, unreferencedTaskCount);
+    XCTAssertEqualObjects(report.reclaimedRowCounts[@"ASDKMOTask"], @(unreferencedTaskCount));
+    XCTAssertEqualObjects([self cachedTaskIDs], [self taskIDsInRange:NSMakeRange(0, kASDKCacheMaintenanceServiceTestTaskCount - unreferencedTaskCount)]);
+}
+
+- (void)testThatItKeepsUnreferencedRowsWithinTheRetentionInterval {
+    // given
+    [self populateStoreWithTaskCount:kASDKCacheMaintenanceServiceTestTaskCount
+                 referencedTaskCount:kASDKCacheMaintenanceServiceTestTaskCount / 2
+                          accessDate:[NSDate date]];
+    
+    // when
+    ASDKCacheMaintenanceReport *report = [self performMaintenance];
+    
+    // then
+    XCTAssertEqual(report.reclaimedRowCount, (NSUInteger)0);
+    XCTAssertEqual([self cachedTaskIDs].count, kASDKCacheMaintenanceServiceTestTaskCount);
+}
+
+- (void)testThatItEvictsLeastRecentlyAccessedRowsOverTheRowBudget {
+    // given
+    NSUInteger rowBudget = 5;
+    self.cacheMaintenanceService.maxRowCountPerEntity = rowBudget;
+    [self populateStoreWithTaskCount:kASDKCacheMaintenanceServiceTestTaskCount
+                 referencedTaskCount:0
+                          accessDate:nil];
+    
+    // Reading the least recently accessed task makes it the most recently used one
+    [self.cacheMaintenanceService recordAccessForObjectIDs:[self objectIDsOfTasksWithIDs:@[@"0"]]];
+    
+    // when
+    ASDKCacheMaintenanceReport *report = [self performMaintenance];
+    
+    // then
+    XCTAssertEqual(report.reclaimedRowCount, kASDKCacheMaintenanceServiceTestTaskCount - rowBudget);
+    
+    NSMutableSet *expectedTaskIDs = [NSMutableSet setWithObject:@"0"];
+    [expectedTaskIDs unionSet:[self taskIDsInRange:NSMakeRange(kASDKCacheMaintenanceServiceTestTaskCount - rowBudget + 1, rowBudget - 1)]];
+    XCTAssertEqualObjects([self cachedTaskIDs], expectedTaskIDs);
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+/**
+ *  Inserts tasks with increasing last access dates. The first referencedTaskCount
+ *  tasks are referenced from a task list placeholder.
+ */
+- (void)populateStoreWithTaskCount:(NSUInteger)taskCount
+               referencedTaskCount:(NSUInteger)referencedTaskCount
+                        accessDate:(NSDate *)accessDate {
+    NSDate *baseAccessDate = accessDate ?: [NSDate date];
+    
+    XCTestExpectation *populateExpectation = [self expectationWithDescription:@"Store populated"];
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        for (NSUInteger idx = 0; idx < taskCount; idx++) {
+            NSString *taskID = [NSString stringWithFormat:@"%lu", (unsigned long)idx];
+            NSManagedObject *task = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTask"
+                                                                  inManagedObjectContext:managedObjectContext];
+            [task setValue:taskID
+                    forKey:@"modelID"];
+            [task setValue:[baseAccessDate dateByAddingTimeInterval:idx - (NSTimeInterval)taskCount]
+                    forKey:@"lastAccessDate"];
+            
+            if (idx < referencedTaskCount) {
+                NSManagedObject *placeholder = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTaskFilterMapPlaceholder"
+                                                                             inManagedObjectContext:managedObjectContext];
+                [placeholder setValue:taskID
+                               forKey:@"modelID"];
+            }
+        }
+        
+        NSError *error = nil;
+        [managedObjectContext save:&error];
+        XCTAssertNil(error);
+        
+        [populateExpectation fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:10.0f
+                                 handler:nil];
+}
+
+- (ASDKCacheMaintenanceReport *)performMaintenance {
+    __block ASDKCacheMaintenanceReport *maintenanceReport = nil;
+    
+    XCTestExpectation *maintenanceExpectation = [self expectationWithDescription:@"Maintenance performed"];
+    [self.cacheMaintenanceService performMaintenanceWithCompletionBlock:^(ASDKCacheMaintenanceReport *report, NSError *error) {
+        XCTAssertNil(error);
+        XCTAssertNotNil(report);
+        maintenanceReport = report;
+        
+        [maintenanceExpectation fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:10.0f
+                                 handler:nil];
+    
+    return maintenanceReport;
+}
+
+- (NSSet *)cachedTaskIDs {
+    __block NSSet *taskIDs = nil;
+    
+    XCTestExpectation *fetchExpectation = [self expectationWithDescription:@"Cached tasks fetched"];
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSArray *tasks = [managedObjectContext executeFetchRequest:[NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"]
+                                                             error:nil];
+        taskIDs = [NSSet setWithArray:[tasks valueForKey:@"modelID"]];
+        
+        [fetchExpectation fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:10.0f
+                                 handler:nil];
+    
+    return taskIDs;
+}
+
+- (NSArray *)objectIDsOfTasksWithIDs:(NSArray *)taskIDs {
+    __block NSArray *objectIDs = nil;
+    
+    XCTestExpectation *fetchExpectation = [self expectationWithDescription:@"Task object IDs fetched"];
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"];
+        fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", taskIDs];
+        fetchRequest.resultType = NSManagedObjectIDResultType;
+        objectIDs = [managedObjectContext executeFetchRequest:fetchRequest
+                                                        error:nil];
+        
+        [fetchExpectation fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:10.0f
+                                 handler:nil];
+    
+    return objectIDs;
+}
+
+- (NSSet *)taskIDsInRange:(NSRange)range {
+    NSMutableSet *taskIDs = [NSMutableSet set];
+    for (NSUInteger idx = range.location; idx < NSMaxRange(range); idx++) {
+        [taskIDs addObject:[NSString stringWithFormat:@"%lu", (unsigned long)idx]];
+    }
+    
+    return taskIDs;
+}
+
+- (void)removeStore {
+    NSString *storeName = [ASDKPersistenceStack persistenceStackModelNameForServerConfiguration:self.serverConfiguration];
+    NSURL *storeURL = [[NSPersistentContainer defaultDirectoryURL] URLByAppendingPathComponent:[storeName stringByAppendingPathExtension:@"sqlite"]];
+    
+    for (NSString *suffix in @[@"", @"-shm", @"-wal"]) {
+        NSURL *fileURL = [NSURL fileURLWithPath:[storeURL.path stringByAppendingString:suffix]];
+        [[NSFileManager defaultManager] removeItemAtURL:fileURL
+                                                  error:nil];
+    }
+}
+
+@end
@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+
+@interface ASDKFilterDataAccessor ()
+
+- (NSArray *)missingDefaultTaskFilterRepresentationsForFilterList:(NSArray *)filterList
+                                                    applicationID:(NSString *)appID;
+- (void)createDefaultTaskFilters:(NSArray *)filterRepresentations
+                   forFilterList:(NSArray *)filterList
+                 completionBlock:(ASDKFilterListCompletionBlock)completionBlock;
+
+@end
+
+@interface ASDKFilterDataAccessorTest : ASDKBaseTest
+
+// Local server stand-in replying to filter creation requests out of order
+@property (strong, nonatomic) id                    filterNetworkServiceMock;
+@property (strong, nonatomic) NSMutableDictionary   *creationAttemptCounts;
+@property (strong, nonatomic) NSMutableDictionary   *failingAttemptCounts;
+
+@property (strong, nonatomic) ASDKFilterDataAccessor *filterDataAccessor;
+
+@end
+
+@implementation ASDKFilterDataAccessorTest
+
+- (void)setUp {
+    [super setUp];
+    
+    self.creationAttemptCounts = [NSMutableDictionary dictionary];
+    self.failingAttemptCounts = [NSMutableDictionary dictionary];
+    [self setUpFilterNetworkServiceMock];
+    
+    self.filterDataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:nil];
+    [self.filterDataAccessor setValue:self.filterNetworkServiceMock
+                               forKey:@"networkService"];
+}
+
+- (void)tearDown {
+    self.filterDataAccessor = nil;
+    [super tearDown];
+}
+
+- (void)testThatItReportsTheDefaultFiltersInTheirDefaultOrder {
+    // when
+    __block NSArray *defaultFilterList = nil;
+    __block NSError *creationError = nil;
+    __block ASDKModelPaging *creationPaging = nil;
+    [self createDefaultTaskFilterList:^(NSArray *filterList, NSError *error, ASDKModelPaging *paging) {
+        defaultFilterList = filterList;
+        creationError = error;
+        creationPaging = paging;
+    }];
+    
+    // then
+    XCTAssertNil(creationError);
+    XCTAssertEqualObjects([defaultFilterList valueForKey:@"modelID"], (@[@"0", @"1", @"2", @"3"]));
+    XCTAssertEqual(creationPaging.start, (NSInteger)0);
+    XCTAssertEqual(creationPaging.size, (NSInteger)4);
+    XCTAssertEqual(creationPaging.total, (NSInteger)4);
+}
+
+- (void)testThatItRetriesTheDefaultFiltersThatFailedToBeCreated {
+    // given
+    self.failingAttemptCounts[@"1"] = @1;
+    self.failingAttemptCounts[@"3"] = @1;
+    
+    // when
+    __block NSArray *defaultFilterList = nil;
+    __block NSError *creationError = nil;
+    [self createDefaultTaskFilterList:^(NSArray *filterList, NSError *error, ASDKModelPaging *paging) {
+        defaultFilterList = filterList;
+        creationError = error;
+    }];
+    
+    // then
+    XCTAssertNil(creationError);
+    XCTAssertEqualObjects([defaultFilterList valueForKey:@"modelID"], (@[@"0", @"1", @"2", @"3"]));
+    XCTAssertEqualObjects(self.creationAttemptCounts, (@{@"0" : @1, @"1" : @2, @"2" : @1, @"3" : @2}));
+}
+
+- (void)testThatItReportsThePartiallyCreatedDefaultFilterList {
+    // given
+    self.failingAttemptCounts[@"2"] = @2;
+    
+    // when
+    __block NSArray *defaultFilterList = nil;
+    __block NSError *creationError = nil;
+    __block ASDKModelPaging *creationPaging = nil;
+    [self createDefaultTaskFilterList:^(NSArray *filterList, NSError *error, ASDKModelPaging *paging) {
+        defaultFilterList = filterList;
+        creationError = error;
+        creationPaging = paging;
+    }];
+    
+    // then
+    XCTAssertNil(creationError);
+    XCTAssertFalse([defaultFilterList isKindOfClass:[NSMutableArray class]]);
+    XCTAssertEqualObjects([defaultFilterList valueForKey:@"modelID"], (@[@"0", @"1", @"3"]));
+    XCTAssertEqual(creationPaging.total, (NSInteger)3);
+    XCTAssertEqualObjects(self.creationAttemptCounts, (@{@"0" : @1, @"1" : @1, @"2" : @2, @"3" : @1}));
+}
+
+- (void)testThatItCreatesOnlyTheDefaultFiltersMissingFromAPartialFilterList {
+    // given
+    NSArray *partialFilterList = @[[self filterWithID:@"10"
+                                                 name:[self defaultFilterNameAtIndex:0]],
+                                   [self filterWithID:@"11"
+                                                 name:[self defaultFilterNameAtIndex:1]],
+                                   [self filterWithID:@"13"
+                                                 name:[self defaultFilterNameAtIndex:3]]];
+    NSArray *missingFilterRepresentations = [self.filterDataAccessor missingDefaultTaskFilterRepresentationsForFilterList:partialFilterList
+                                                                                                            applicationID:@"1"];
+    
+    // when
+    __block NSArray *completedFilterList = nil;
+    __block ASDKModelPaging *completedPaging = nil;
+    [self createDefaultTaskFilters:missingFilterRepresentations
+                     forFilterList:partialFilterList
+                   completionBlock:^(NSArray *filterList, NSError *error, ASDKModelPaging *paging) {
+                       completedFilterList = filterList;
+                       completedPaging = paging;
+                   }];
+    
+    // then
+    XCTAssertEqualObjects([missingFilterRepresentations valueForKey:@"name"], (@[[self defaultFilterNameAtIndex:2]]));
+    XCTAssertEqualObjects([completedFilterList valueForKey:@"modelID"], (@[@"10", @"11", @"13", @"2"]));
+    XCTAssertEqual(completedPaging.total, (NSInteger)4);
+    XCTAssertEqualObjects(self.creationAttemptCounts, (@{@"2" : @1}));
+}
+
+- (void)testThatItDoesNotCreateDefaultFiltersForAUserDefinedFilterList {
+    // given
+    NSArray *userFilterList = @[[self filterWithID:@"20"
+                                              name:@"Urgent tasks"]];
+    
+    // when
+    NSArray *missingFilterRepresentations = [self.filterDataAccessor missingDefaultTaskFilterRepresentationsForFilterList:userFilterList
+                                                                                                            applicationID:@"1"];
+    
+    // then
+    XCTAssertEqual(missingFilterRepresentations.count, (NSUInteger)0);
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (void)createDefaultTaskFilterList:(ASDKFilterListCompletionBlock)completionBlock {
+    [self createDefaultTaskFilters:[self.filterDataAccessor missingDefaultTaskFilterRepresentationsForFilterList:@[]
+                                                                                                   applicationID:@"1"]
+                     forFilterList:@[]
+                   completionBlock:completionBlock];
+}
+
+- (void)createDefaultTaskFilters:(NSArray *)filterRepresentations
+                   forFilterList:(NSArray *)filterList
+                 completionBlock:(ASDKFilterListCompletionBlock)completionBlock {
+    // expect
+    XCTestExpectation *creationExpectation = [self expectationWithDescription:NSStringFromSelector(_cmd)];
+    
+    [self.filterDataAccessor createDefaultTaskFilters:filterRepresentations
+                                        forFilterList:filterList
+                                      completionBlock:^(NSArray *completedFilterList, NSError *error, ASDKModelPaging *paging) {
+                                          completionBlock(completedFilterList, error, paging);
+                                          [creationExpectation fulfill];
+                                      }];
+    
+    [self waitForExpectationsWithTimeout:5.0f
+                                 handler:nil];
+}
+
+- (NSString *)defaultFilterNameAtIndex:(NSUInteger)index {
+    NSArray *defaultFilterRepresentations = [self.filterDataAccessor missingDefaultTaskFilterRepresentationsForFilterList:@[]
+                                                                                                            applicationID:@"1"];
+    return [defaultFilterRepresentations[index] name];
+}
+
+- (ASDKModelFilter *)filterWithID:(NSString *)filterID
+                             name:(NSString *)name {
+    ASDKModelFilter *filter = [ASDKModelFilter new];
+    filter.modelID = filterID;
+    filter.name = name;
+    
+    return filter;
+}
+
+- (void)setUpFilterNetworkServiceMock {
+    self.filterNetworkServiceMock = OCMClassMock([ASDKFilterNetworkServices class]);
+    
+    __weak typeof(self) weakSelf = self;
+    OCMStub([self.filterNetworkServiceMock createUserTaskFilterWithRepresentation:OCMOCK_ANY
+                                                             withCompletionBlock:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained ASDKFilterCreationRequestRepresentation *filterRepresentation;
+        __unsafe_unretained ASDKFilterModelCompletionBlock completionBlock;
+        [invocation getArgument:&filterRepresentation
+                        atIndex:2];
+        [invocation getArgument:&completionBlock
+                        atIndex:3];
+        
+        NSString *filterID = [NSString stringWithFormat:@"%ld", (long)filterRepresentation.index];
+        NSString *filterName = filterRepresentation.name;
+        ASDKFilterModelCompletionBlock reply = [completionBlock copy];
+        
+        BOOL shouldFail = NO;
+        @synchronized (strongSelf) {
+            NSUInteger attemptCount = [strongSelf.creationAttemptCounts[filterID] unsignedIntegerValue] + 1;
+            strongSelf.creationAttemptCounts[filterID] = @(attemptCount);
+            shouldFail = attemptCount <= [strongSelf.failingAttemptCounts[filterID] unsignedIntegerValue];
+        }
+        
+        // Reply in the reverse order of the requests so the join can't rely on arrival order
+        int64_t replyDelay = (int64_t)((4 - filterRepresentation.index) * 20 * NSEC_PER_MSEC);
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, replyDelay), dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            if (shouldFail) {
+                reply(nil, [NSError errorWithDomain:NSURLErrorDomain
+                                               code:NSURLErrorTimedOut
+                                           userInfo:nil]);
+            } else {
+                ASDKModelFilter *filter = [ASDKModelFilter new];
+                filter.modelID = filterID;
+                filter.name = filterName;
+                reply(filter, nil);
+            }
+        });
+    });
+}
+
+@end
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKPersistenceStack.h"
+#import "ASDKFormFieldValueRepresentationCacheModelUpsert.h"
+#import "ASDKFormFieldValueRepresentationCacheMapper.h"
+#import "ASDKMOFormFieldValueRepresentation.h"
+#import "ASDKMOFormFieldValue.h"
+
+@interface ASDKFormFieldValueRepresentationCacheModelUpsertTest : ASDKBaseTest
+
+@property (strong, nonatomic) NSPersistentContainer *persistentContainer;
+
+@end
+
+@implementation ASDKFormFieldValueRepresentationCacheModelUpsertTest
+
+- (void)setUp {
+    [super setUp];
+    
+    NSURL *modelURL = [[NSBundle bundleForClass:[ASDKPersistenceStack class]] URLForResource:@"CacheServicesDataModel"
+                                                                               withExtension:@"momd"];
+    NSManagedObjectModel *managedObjectModel = [[NSManagedObjectModel alloc] initWithContentsOfURL:modelURL];
+    self.persistentContainer = [[NSPersistentContainer alloc] initWithName:NSStringFromClass([self class])
+                                                        managedObjectModel:managedObjectModel];
+    
+    NSPersistentStoreDescription *storeDescription = [NSPersistentStoreDescription new];
+    storeDescription.type = NSInMemoryStoreType;
+    storeDescription.shouldAddStoreAsynchronously = NO;
+    self.persistentContainer.persistentStoreDescriptions = @[storeDescription];
+    [self.persistentContainer loadPersistentStoresWithCompletionHandler:^(NSPersistentStoreDescription *description, NSError *error) {
+        XCTAssertNil(error);
+    }];
+}
+
+- (void)tearDown {
+    self.persistentContainer = nil;
+    
+    [super tearDown];
+}
+
+- (void)testThatItStoresFormFieldValuesAsIndividualRows {
+    // given
+    ASDKFormFieldValueRequestRepresentation *formFieldValueRepresentation = [ASDKFormFieldValueRequestRepresentation new];
+    formFieldValueRepresentation.outcome = @"outcome";
+    formFieldValueRepresentation.formFieldValues = @{@"text"    : @"value",
+                                                     @"boolean" : @YES,
+                                                     @"people"  : @{@"id"   : @1,
+                                                                    @"email": @"user@example.com"}};
+    NSManagedObjectContext *managedObjectContext = self.persistentContainer.viewContext;
+    
+    // when
+    NSError *error = nil;
+    ASDKMOFormFieldValueRepresentation *moFormFieldValueRepresentation =
+    [ASDKFormFieldValueRepresentationCacheModelUpsert upsertFormFieldValueToCache:formFieldValueRepresentation
+                                                                        forTaskID:@"task"
+                                                                            error:&error
+                                                                      inMOContext:managedObjectContext];
+    [managedObjectContext save:&error];
+    
+    // then
+    XCTAssertNil(error);
+    XCTAssertNil(moFormFieldValueRepresentation.formFields);
+    XCTAssertEqual(moFormFieldValueRepresentation.formFieldValues.count, 3);
+    
+    NSFetchRequest *fetchFormFieldValueRequest = [ASDKMOFormFieldValue fetchRequest];
+    fetchFormFieldValueRequest.predicate = [NSPredicate predicateWithFormat:@"taskID == %@ AND formFieldID == %@", @"task", @"text"];
+    ASDKMOFormFieldValue *moFormFieldValue = [managedObjectContext executeFetchRequest:fetchFormFieldValueRequest
+                                                                                error:&error].firstObject;
+    XCTAssertEqualObjects([ASDKFormFieldValueRepresentationCacheMapper mapCacheMOToFormFieldValue:moFormFieldValue], @"value");
+    
+    ASDKFormFieldValueRequestRepresentation *cachedFormFieldValueRepresentation = [ASDKFormFieldValueRepresentationCacheMapper mapCacheMOToFormFieldValueRepresentation:moFormFieldValueRepresentation];
+    XCTAssertEqualObjects(cachedFormFieldValueRepresentation.outcome, @"outcome");
+    XCTAssertEqualObjects([cachedFormFieldValueRepresentation jsonDictionary][@"values"], formFieldValueRepresentation.formFieldValues);
+}
+
+- (void)testThatItOnlyRewritesChangedFormFieldValues {
+    // given
+    ASDKFormFieldValueRequestRepresentation *formFieldValueRepresentation = [ASDKFormFieldValueRequestRepresentation new];
+    formFieldValueRepresentation.formFieldValues = @{@"unchanged" : @"value",
+                                                     @"changed"   : @"value",
+                                                     @"removed"   : @"value"};
+    NSManagedObjectContext *managedObjectContext = self.persistentContainer.viewContext;
+    NSError *error = nil;
+    ASDKMOFormFieldValueRepresentation *moFormFieldValueRepresentation =
+    [ASDKFormFieldValueRepresentationCacheModelUpsert upsertFormFieldValueToCache:formFieldValueRepresentation
+                                                                        forTaskID:@"task"
+                                                                            error:&error
+                                                                      inMOContext:managedObjectContext];
+    [managedObjectContext save:&error];
+    int64_t revision = moFormFieldValueRepresentation.revision;
+    
+    // when
+    formFieldValueRepresentation.formFieldValues = @{@"unchanged" : @"value",
+                                                     @"changed"   : @"updatedValue"};
+    [ASDKFormFieldValueRepresentationCacheModelUpsert upsertFormFieldValueToCache:formFieldValueRepresentation
+                                                                        forTaskID:@"task"
+                                                                            error:&error
+                                                                      inMOContext:managedObjectContext];
+    
+    // then
+    XCTAssertNil(error);
+    XCTAssertEqual(moFormFieldValueRepresentation.revision, revision + 1);
+    XCTAssertEqual(managedObjectContext.deletedObjects.count, 1);
+    
+    NSSet *updatedFormFieldValues = [managedObjectContext.updatedObjects filteredSetUsingPredicate:[NSPredicate predicateWithFormat:@"self isKindOfClass: %@", [ASDKMOFormFieldValue class]]];
+    XCTAssertEqual(updatedFormFieldValues.count, 1);
+    XCTAssertEqualObjects([updatedFormFieldValues.anyObject formFieldID], @"changed");
+}
+
+@end
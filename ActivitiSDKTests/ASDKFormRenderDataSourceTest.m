@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKFormRenderDataSource.h"
+
+static NSUInteger const kASDKFormRenderDataSourceTestFieldCount = 500;
+
+@interface ASDKFormRenderDataSourceTest : ASDKBaseTest
+
+@end
+
+@implementation ASDKFormRenderDataSourceTest
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)testThatItAttachesFormVariableValuesToFormFields {
+    // given
+    ASDKModelFormDescription *formDescription = [self formDescriptionWithFieldCount:kASDKFormRenderDataSourceTestFieldCount];
+    ASDKFormRenderDataSource *dataSource = [[ASDKFormRenderDataSource alloc] initWithTaskFormDescription:formDescription];
+    
+    // when
+    ASDKModelFormField *firstFormField = (ASDKModelFormField *)[dataSource modelForIndexPath:[NSIndexPath indexPathForRow:0
+                                                                                                               inSection:0]];
+    ASDKModelFormField *lastFormField = (ASDKModelFormField *)[dataSource modelForIndexPath:[NSIndexPath indexPathForRow:kASDKFormRenderDataSourceTestFieldCount - 1
+                                                                                                              inSection:0]];
+    
+    // then
+    XCTAssertEqualObjects(firstFormField.values.firstObject, @"value0");
+    XCTAssertEqualObjects(lastFormField.values.firstObject, ([NSString stringWithFormat:@"value%lu", (unsigned long)kASDKFormRenderDataSourceTestFieldCount - 1]));
+}
+
+- (void)testThatItReindexesFormVariablesWhenTheyChange {
+    // given
+    ASDKModelFormDescription *formDescription = [self formDescriptionWithFieldCount:1];
+    ASDKFormRenderDataSource *dataSource = [[ASDKFormRenderDataSource alloc] initWithTaskFormDescription:formDescription];
+    
+    // when
+    ASDKModelFormVariable *updatedFormVariable = [ASDKModelFormVariable new];
+    updatedFormVariable.name = @"param0";
+    updatedFormVariable.value = @"updatedValue";
+    formDescription.formVariables = @[updatedFormVariable];
+    
+    ASDKModelFormField *formField = (ASDKModelFormField *)[dataSource modelForIndexPath:[NSIndexPath indexPathForRow:0
+                                                                                                          inSection:0]];
+    
+    // then
+    XCTAssertEqualObjects(formField.values.firstObject, @"updatedValue");
+}
+
+- (void)testModelForIndexPathScrollingPerformance {
+    ASDKModelFormDescription *formDescription = [self formDescriptionWithFieldCount:kASDKFormRenderDataSourceTestFieldCount];
+    ASDKFormRenderDataSource *dataSource = [[ASDKFormRenderDataSource alloc] initWithTaskFormDescription:formDescription];
+    NSInteger fieldCount = [dataSource numberOfFormFieldsForSection:0];
+    
+    // Simulate repeated scrolling passes over the whole form
+    [self measureBlock:^{
+        for (NSUInteger pass = 0; pass < 10; pass++) {
+            for (NSInteger row = 0; row < fieldCount; row++) {
+                [dataSource modelForIndexPath:[NSIndexPath indexPathForRow:row
+                                                                 inSection:0]];
+            }
+        }
+    }];
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (ASDKModelFormDescription *)formDescriptionWithFieldCount:(NSUInteger)fieldCount {
+    NSMutableArray *formFields = [NSMutableArray array];
+    NSMutableArray *formVariables = [NSMutableArray array];
+    
+    for (NSUInteger idx = 0; idx < fieldCount; idx++) {
+        ASDKModelFormField *formFieldParams = [ASDKModelFormField new];
+        formFieldParams.modelID = [NSString stringWithFormat:@"param%lu", (unsigned long)idx];
+        
+        ASDKModelFormField *formField = [ASDKModelFormField new];
+        formField.modelID = [NSString stringWithFormat:@"field%lu", (unsigned long)idx];
+        formField.fieldType = ASDKModelFormFieldTypeFormField;
+        formField.representationType = ASDKModelFormFieldRepresentationTypeText;
+        formField.formFieldParams = formFieldParams;
+        [formFields addObject:formField];
+        
+        ASDKModelFormVariable *formVariable = [ASDKModelFormVariable new];
+        formVariable.name = formFieldParams.modelID;
+        formVariable.value = [NSString stringWithFormat:@"value%lu", (unsigned long)idx];
+        [formVariables addObject:formVariable];
+    }
+    
+    ASDKModelFormField *containerFormField = [ASDKModelFormField new];
+    containerFormField.modelID = @"container";
+    containerFormField.fieldType = ASDKModelFormFieldTypeContainer;
+    containerFormField.representationType = ASDKModelFormFieldRepresentationTypeContainer;
+    containerFormField.formFields = formFields;
+    
+    ASDKModelFormDescription *formDescription = [ASDKModelFormDescription new];
+    formDescription.formFields = @[containerFormField];
+    formDescription.formVariables = formVariables;
+    
+    return formDescription;
+}
+
+@end
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKFormValidityIndex.h"
+
+static NSUInteger const kASDKFormValidityIndexTestSectionCount  = 10;
+static NSUInteger const kASDKFormValidityIndexTestFieldCount    = 20;
+static NSUInteger const kASDKFormValidityIndexTestEditCount     = 2000;
+
+@interface ASDKFormValidityIndexTest : ASDKBaseTest
+
+@end
+
+@implementation ASDKFormValidityIndexTest
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)testThatItReportsInvalidRequiredFormFields {
+    // given
+    ASDKModelFormField *requiredFormField = [self formFieldWithRepresentationType:ASDKModelFormFieldRepresentationTypeText
+                                                                       isRequired:YES];
+    ASDKModelFormField *sectionFormField = [self sectionFormFieldWithFormFields:@[requiredFormField]];
+    ASDKFormValidityIndex *validityIndex = [ASDKFormValidityIndex new];
+    
+    // when
+    [validityIndex rebuildWithSections:@[sectionFormField]];
+    
+    // then
+    XCTAssertFalse(validityIndex.areFormFieldsValid);
+    XCTAssertEqual([validityIndex invalidFormFieldsCountForSection:0], 1);
+    
+    // when
+    ASDKModelFormFieldValue *metadataValue = [ASDKModelFormFieldValue new];
+    metadataValue.attachedValue = @"value";
+    requiredFormField.metadataValue = metadataValue;
+    
+    // then
+    XCTAssertTrue(validityIndex.areFormFieldsValid);
+    XCTAssertEqual([validityIndex invalidFormFieldsCountForSection:0], 0);
+}
+
+- (void)testThatItMatchesFullValidationForRandomizedEdits {
+    // given
+    NSMutableArray *sections = [NSMutableArray array];
+    NSMutableArray *formFields = [NSMutableArray array];
+    
+    for (NSUInteger sectionIdx = 0; sectionIdx < kASDKFormValidityIndexTestSectionCount; sectionIdx++) {
+        NSMutableArray *sectionFormFields = [NSMutableArray array];
+        
+        for (NSUInteger fieldIdx = 0; fieldIdx < kASDKFormValidityIndexTestFieldCount; fieldIdx++) {
+            ASDKModelFormFieldRepresentationType representationType = arc4random_uniform(2) ? ASDKModelFormFieldRepresentationTypeBoolean : ASDKModelFormFieldRepresentationTypeText;
+            ASDKModelFormField *formField = [self formFieldWithRepresentationType:representationType
+                                                                       isRequired:arc4random_uniform(3) ? NO : YES];
+            [sectionFormFields addObject:formField];
+        }
+        
+        [formFields addObjectsFromArray:sectionFormFields];
+        [sections addObject:[self sectionFormFieldWithFormFields:sectionFormFields]];
+    }
+    
+    ASDKFormValidityIndex *validityIndex = [ASDKFormValidityIndex new];
+    [validityIndex rebuildWithSections:sections];
+    XCTAssertEqual(validityIndex.areFormFieldsValid, [ASDKFormValidityIndex areFormFieldsValidInSections:sections]);
+    
+    // when
+    for (NSUInteger editIdx = 0; editIdx < kASDKFormValidityIndexTestEditCount; editIdx++) {
+        ASDKModelFormField *formField = formFields[arc4random_uniform((u_int32_t)formFields.count)];
+        [self applyRandomEditToFormField:formField];
+        
+        // then
+        XCTAssertEqual(validityIndex.areFormFieldsValid, [ASDKFormValidityIndex areFormFieldsValidInSections:sections]);
+    }
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (ASDKModelFormField *)formFieldWithRepresentationType:(ASDKModelFormFieldRepresentationType)representationType
+                                             isRequired:(BOOL)isRequired {
+    ASDKModelFormField *formField = [ASDKModelFormField new];
+    formField.fieldType = ASDKModelFormFieldTypeFormField;
+    formField.representationType = representationType;
+    formField.isRequired = isRequired;
+    
+    return formField;
+}
+
+- (ASDKModelFormField *)sectionFormFieldWithFormFields:(NSArray *)formFields {
+    ASDKModelFormField *sectionFormField = [ASDKModelFormField new];
+    sectionFormField.fieldType = ASDKModelFormFieldTypeContainer;
+    sectionFormField.representationType = ASDKModelFormFieldRepresentationTypeContainer;
+    sectionFormField.formFields = formFields;
+    
+    return sectionFormField;
+}
+
+- (void)applyRandomEditToFormField:(ASDKModelFormField *)formField {
+    switch (arc4random_uniform(4)) {
+        case 0: {
+            ASDKModelFormFieldValue *metadataValue = [ASDKModelFormFieldValue new];
+            metadataValue.attachedValue = (ASDKModelFormFieldRepresentationTypeBoolean == formField.representationType) ? kASDKFormFieldTrueStringValue : @"value";
+            formField.metadataValue = metadataValue;
+        }
+            break;
+        
+        case 1: {
+            ASDKModelFormFieldValue *metadataValue = [ASDKModelFormFieldValue new];
+            metadataValue.attachedValue = (ASDKModelFormFieldRepresentationTypeBoolean == formField.representationType) ? kASDKFormFieldFalseStringValue : @"";
+            formField.metadataValue = metadataValue;
+        }
+            break;
+        
+        case 2: {
+            formField.metadataValue = nil;
+        }
+            break;
+        
+        case 3: {
+            formField.values = arc4random_uniform(2) ? @[@YES] : nil;
+        }
+            break;
+        
+        default:
+            break;
+    }
+}
+
+@end
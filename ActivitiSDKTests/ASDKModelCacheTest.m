@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKModelCache.h"
+
+static NSString * const kASDKModelCacheTestEntityName = @"ASDKMOTask";
+
+@interface ASDKModelCacheTest : ASDKBaseTest
+
+@property (strong, nonatomic) ASDKModelCache *modelCache;
+
+@end
+
+@implementation ASDKModelCacheTest
+
+- (void)setUp {
+    [super setUp];
+    
+    self.modelCache = [ASDKModelCache new];
+}
+
+- (void)tearDown {
+    self.modelCache = nil;
+    
+    [super tearDown];
+}
+
+- (void)testThatItReturnsCopiesOfCachedModelsAndCountsHitsAndMisses {
+    // given
+    ASDKModelTask *task = [self taskWithModelID:@"1"];
+    
+    // when
+    ASDKModelTask *missedTask = [self.modelCache modelForEntityName:kASDKModelCacheTestEntityName
+                                                            modelID:task.modelID];
+    [self.modelCache setModel:task
+                forEntityName:kASDKModelCacheTestEntityName
+                      modelID:task.modelID
+           observedGeneration:self.modelCache.generation];
+    task.name = @"Mutated after caching";
+    ASDKModelTask *cachedTask = [self.modelCache modelForEntityName:kASDKModelCacheTestEntityName
+                                                            modelID:task.modelID];
+    
+    // then
+    XCTAssertNil(missedTask);
+    XCTAssertNotNil(cachedTask);
+    XCTAssertNotEqual(cachedTask, task);
+    XCTAssertEqualObjects(cachedTask.name, @"Task 1");
+    XCTAssertEqual(self.modelCache.hitCount, (NSUInteger)1);
+    XCTAssertEqual(self.modelCache.missCount, (NSUInteger)1);
+    
+    // when
+    [self.modelCache resetStatistics];
+    
+    // then
+    XCTAssertEqual(self.modelCache.hitCount, (NSUInteger)0);
+    XCTAssertEqual(self.modelCache.missCount, (NSUInteger)0);
+}
+
+- (void)testThatItInvalidatesCachedModels {
+    // given
+    ASDKModelTask *firstTask = [self taskWithModelID:@"1"];
+    ASDKModelTask *secondTask = [self taskWithModelID:@"2"];
+    for (ASDKModelTask *task in @[firstTask, secondTask]) {
+        [self.modelCache setModel:task
+                    forEntityName:kASDKModelCacheTestEntityName
+                          modelID:task.modelID
+               observedGeneration:self.modelCache.generation];
+    }
+    
+    // when
+    [self.modelCache invalidateModelsForEntityName:kASDKModelCacheTestEntityName
+                                          modelIDs:@[firstTask.modelID]];
+    
+    // then
+    XCTAssertNil([self.modelCache modelForEntityName:kASDKModelCacheTestEntityName
+                                             modelID:firstTask.modelID]);
+    XCTAssertNotNil([self.modelCache modelForEntityName:kASDKModelCacheTestEntityName
+                                                modelID:secondTask.modelID]);
+    XCTAssertNil([self.modelCache modelForEntityName:@"ASDKMOProcessInstance"
+                                             modelID:secondTask.modelID]);
+    
+    // when
+    [self.modelCache invalidateAllModels];
+    
+    // then
+    XCTAssertNil([self.modelCache modelForEntityName:kASDKModelCacheTestEntityName
+                                             modelID:secondTask.modelID]);
+}
+
+- (void)testThatItInvalidatesTheModelsOfAnEntity {
+    // given
+    ASDKModelTask *task = [self taskWithModelID:@"1"];
+    NSUInteger observedGeneration = self.modelCache.generation;
+    for (NSString *entityName in @[kASDKModelCacheTestEntityName, @"ASDKMOProcessInstance"]) {
+        [self.modelCache setModel:task
+                    forEntityName:entityName
+                          modelID:task.modelID
+               observedGeneration:observedGeneration];
+    }
+    
+    // when
+    [self.modelCache invalidateModelsForEntityNames:[NSSet setWithObject:kASDKModelCacheTestEntityName]];
+    
+    // then
+    XCTAssertNotEqual(self.modelCache.generation, observedGeneration);
+    XCTAssertNil([self.modelCache modelForEntityName:kASDKModelCacheTestEntityName
+                                             modelID:task.modelID]);
+    XCTAssertNotNil([self.modelCache modelForEntityName:@"ASDKMOProcessInstance"
+                                                modelID:task.modelID]);
+}
+
+- (void)testThatItDiscardsModelsFetchedBeforeAnInvalidation {
+    // given
+    ASDKModelTask *task = [self taskWithModelID:@"1"];
+    NSUInteger observedGeneration = self.modelCache.generation;
+    
+    // when
+    [self.modelCache invalidateModelsForEntityName:kASDKModelCacheTestEntityName
+                                          modelIDs:@[task.modelID]];
+    [self.modelCache setModel:task
+                forEntityName:kASDKModelCacheTestEntityName
+                      modelID:task.modelID
+           observedGeneration:observedGeneration];
+    
+    // then
+    XCTAssertNil([self.modelCache modelForEntityName:kASDKModelCacheTestEntityName
+                                             modelID:task.modelID]);
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (ASDKModelTask *)taskWithModelID:(NSString *)modelID {
+    ASDKModelTask *task = [ASDKModelTask new];
+    task.modelID = modelID;
+    task.name = [NSString stringWithFormat:@"Task %@", modelID];
+    
+    return task;
+}
+
+@end
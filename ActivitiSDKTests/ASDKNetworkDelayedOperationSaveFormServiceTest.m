@@ -0,0 +1,399 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKNetworkDelayedOperationSaveFormService.h"
+#import "ASDKFormSaveJournalEntry.h"
+#import "ASDKFormNetworkServiceProtocol.h"
+#import "ASDKFormCacheService.h"
+#import "ASDKHTTPCodes.h"
+@import AFNetworking;
+
+static NSUInteger const kASDKSaveFormServiceTestJournalEntryCount = 10;
+
+@interface ASDKNetworkDelayedOperationSaveFormServiceTest : ASDKBaseTest
+
+// Journal stand-in for the persistent store
+@property (strong, nonatomic) NSMutableArray        *journal;
+@property (strong, nonatomic) id                    formCacheServiceMock;
+@property (assign, nonatomic) NSUInteger            journalFetchCount;
+@property (strong, nonatomic) XCTestExpectation     *journalCountExpectation;
+
+// Local server stand-in injecting failures for the configured tasks
+@property (strong, nonatomic) id                    formNetworkServiceMock;
+@property (strong, nonatomic) NSMutableDictionary   *failureCountsForTaskIDs;
+@property (strong, nonatomic) NSMutableDictionary   *failureStatusCodesForTaskIDs;
+@property (strong, nonatomic) NSMutableDictionary   *saveCountsForTaskIDs;
+@property (strong, nonatomic) NSMutableArray        *removedTaskIDs;
+@property (assign, nonatomic) NSUInteger            concurrentSaveCount;
+@property (assign, nonatomic) NSUInteger            maxObservedConcurrentSaveCount;
+
+@property (strong, nonatomic) XCTestExpectation     *emptyJournalExpectation;
+@property (strong, nonatomic) ASDKNetworkDelayedOperationSaveFormService *saveFormService;
+
+@end
+
+@implementation ASDKNetworkDelayedOperationSaveFormServiceTest
+
+- (void)setUp {
+    [super setUp];
+    
+    self.journal = [NSMutableArray array];
+    self.failureCountsForTaskIDs = [NSMutableDictionary dictionary];
+    self.failureStatusCodesForTaskIDs = [NSMutableDictionary dictionary];
+    self.saveCountsForTaskIDs = [NSMutableDictionary dictionary];
+    self.removedTaskIDs = [NSMutableArray array];
+    
+    [self setUpFormCacheServiceMock];
+    [self setUpFormNetworkServiceMock];
+    
+    self.saveFormService = [[ASDKNetworkDelayedOperationSaveFormService alloc] initWithFormNetworkService:self.formNetworkServiceMock
+                                                                                         formCacheService:self.formCacheServiceMock
+                                                                                      reachabilityManager:nil];
+    self.saveFormService.baseRetryInterval = .05f;
+    self.saveFormService.maxRetryInterval = .2f;
+}
+
+- (void)tearDown {
+    self.saveFormService = nil;
+    [super tearDown];
+}
+
+- (void)testThatItRemovesEachJournalEntryAfterItsOwnSuccessfulSave {
+    // given
+    [self journalFormsForTaskIDs:@[@"task1", @"task2", @"task3"]];
+    self.failureCountsForTaskIDs[@"task2"] = @(2);
+    
+    // expect
+    self.emptyJournalExpectation = [self expectationWithDescription:NSStringFromSelector(_cmd)];
+    
+    // when
+    [self.saveFormService runNetworkConnectivityRestorationChecks];
+    
+    // then
+    [self waitForExpectationsWithTimeout:5.0f
+                                 handler:nil];
+    
+    XCTAssertEqualObjects(self.saveCountsForTaskIDs[@"task1"], @(1));
+    XCTAssertEqualObjects(self.saveCountsForTaskIDs[@"task2"], @(3));
+    XCTAssertEqualObjects(self.saveCountsForTaskIDs[@"task3"], @(1));
+    XCTAssertEqualObjects(self.removedTaskIDs.lastObject, @"task2");
+}
+
+- (void)testThatItBoundsTheNumberOfConcurrentSaves {
+    // given
+    NSMutableArray *taskIDs = [NSMutableArray array];
+    for (NSUInteger idx = 0; idx < kASDKSaveFormServiceTestJournalEntryCount; idx++) {
+        NSString *taskID = [NSString stringWithFormat:@"task%lu", (unsigned long)idx];
+        [taskIDs addObject:taskID];
+        
+        if (idx % 3 == 0) {
+            self.failureCountsForTaskIDs[taskID] = @(1);
+        }
+    }
+    [self journalFormsForTaskIDs:taskIDs];
+    self.saveFormService.maxConcurrentSaveCount = 2;
+    
+    // expect
+    self.emptyJournalExpectation = [self expectationWithDescription:NSStringFromSelector(_cmd)];
+    
+    // when
+    [self.saveFormService runNetworkConnectivityRestorationChecks];
+    
+    // then
+    [self waitForExpectationsWithTimeout:5.0f
+                                 handler:nil];
+    
+    XCTAssertLessThanOrEqual(self.maxObservedConcurrentSaveCount, 2);
+    XCTAssertEqual(self.removedTaskIDs.count, kASDKSaveFormServiceTestJournalEntryCount);
+}
+
+- (void)testThatItDoesNotUploadTheSameFormTwiceWhenReplayIsRequestedRepeatedly {
+    // given
+    [self journalFormsForTaskIDs:@[@"task1"]];
+    
+    // expect
+    self.emptyJournalExpectation = [self expectationWithDescription:NSStringFromSelector(_cmd)];
+    
+    // when
+    for (NSUInteger idx = 0; idx < 5; idx++) {
+        [self.saveFormService runNetworkConnectivityRestorationChecks];
+    }
+    
+    // then
+    [self waitForExpectationsWithTimeout:5.0f
+                                 handler:nil];
+    
+    XCTAssertEqualObjects(self.saveCountsForTaskIDs[@"task1"], @(1));
+}
+
+- (void)testThatItDropsFormsRejectedWithAPermanentClientError {
+    // given
+    [self journalFormsForTaskIDs:@[@"task1", @"task2", @"task3"]];
+    self.failureCountsForTaskIDs[@"task1"] = @(1);
+    self.failureStatusCodesForTaskIDs[@"task1"] = @(ASDKHTTPCode404NotFound);
+    self.failureCountsForTaskIDs[@"task2"] = @(1);
+    self.failureStatusCodesForTaskIDs[@"task2"] = @(ASDKHTTPCode403Forbidden);
+    self.failureCountsForTaskIDs[@"task3"] = @(2);
+    self.failureStatusCodesForTaskIDs[@"task3"] = @(ASDKHTTPCode429TooManyRequests);
+    
+    // expect
+    self.emptyJournalExpectation = [self expectationWithDescription:NSStringFromSelector(_cmd)];
+    
+    // when
+    [self.saveFormService runNetworkConnectivityRestorationChecks];
+    
+    // then
+    [self waitForExpectationsWithTimeout:5.0f
+                                 handler:nil];
+    
+    XCTAssertEqualObjects(self.saveCountsForTaskIDs[@"task1"], @(1));
+    XCTAssertEqualObjects(self.saveCountsForTaskIDs[@"task2"], @(1));
+    XCTAssertEqualObjects(self.saveCountsForTaskIDs[@"task3"], @(3));
+    XCTAssertEqualObjects(self.removedTaskIDs.lastObject, @"task3");
+}
+
+- (void)testThatItDoesNotLoadTheJournalWhenNoFormsArePending {
+    // expect
+    self.journalCountExpectation = [self expectationWithDescription:NSStringFromSelector(_cmd)];
+    
+    // when
+    [self.saveFormService runNetworkConnectivityRestorationChecks];
+    
+    // then
+    [self waitForExpectationsWithTimeout:5.0f
+                                 handler:nil];
+    
+    XCTAssertEqual(self.journalFetchCount, 0);
+    XCTAssertEqual(self.saveCountsForTaskIDs.count, 0);
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (void)journalFormsForTaskIDs:(NSArray *)taskIDs {
+    for (NSString *taskID in taskIDs) {
+        ASDKFormSaveJournalEntry *journalEntry = [ASDKFormSaveJournalEntry new];
+        journalEntry.taskID = taskID;
+        journalEntry.formFieldValueRequestRepresentation = [ASDKFormFieldValueRequestRepresentation new];
+        journalEntry.revision = 1;
+        journalEntry.journalDate = [NSDate date];
+        [self.journal addObject:journalEntry];
+    }
+}
+
+- (NSError *)saveErrorForTaskID:(NSString *)taskID {
+    NSDictionary *userInfo = nil;
+    NSNumber *statusCode = self.failureStatusCodesForTaskIDs[taskID];
+    if (statusCode) {
+        NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"http://localhost"]
+                                                                  statusCode:statusCode.integerValue
+                                                                 HTTPVersion:nil
+                                                                headerFields:nil];
+        userInfo = @{AFNetworkingOperationFailingURLResponseErrorKey : response};
+    }
+    
+    return [NSError errorWithDomain:@"com.activitiSDK.tests"
+                               code:0
+                           userInfo:userInfo];
+}
+
+- (ASDKFormSaveJournalEntry *)journalEntryForTaskID:(NSString *)taskID
+                                       withRevision:(int64_t)revision {
+    for (ASDKFormSaveJournalEntry *journalEntry in self.journal) {
+        if ([journalEntry.taskID isEqualToString:taskID] &&
+            journalEntry.revision == revision) {
+            return journalEntry;
+        }
+    }
+    
+    return nil;
+}
+
+- (void)setUpFormCacheServiceMock {
+    self.formCacheServiceMock = OCMProtocolMock(@protocol(ASDKFormCacheServicesProtocol));
+    
+    __weak typeof(self) weakSelf = self;
+    OCMStub([self.formCacheServiceMock fetchFormSaveJournalEntryCountForTaskID:OCMOCK_ANY
+                                                               completionBlock:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained ASDKCacheServiceFormSaveJournalEntryCountCompletionBlock completionBlock;
+        [invocation getArgument:&completionBlock
+                        atIndex:3];
+        
+        NSUInteger entryCount = 0;
+        @synchronized (strongSelf.journal) {
+            entryCount = strongSelf.journal.count;
+        }
+        
+        completionBlock(entryCount, nil);
+        [strongSelf.journalCountExpectation fulfill];
+    });
+    
+    OCMStub([self.formCacheServiceMock fetchFormSaveJournalEntriesWithCompletionBlock:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        @synchronized (strongSelf.journal) {
+            strongSelf.journalFetchCount += 1;
+        }
+        
+        __unsafe_unretained ASDKCacheServiceFormSaveJournalEntryListCompletionBlock completionBlockArg;
+        [invocation getArgument:&completionBlockArg
+                        atIndex:2];
+        ASDKCacheServiceFormSaveJournalEntryListCompletionBlock completionBlock = completionBlockArg;
+        
+        // Hand out copies just like entries mapped from a managed object context
+        NSMutableArray *journalEntries = [NSMutableArray array];
+        @synchronized (strongSelf.journal) {
+            for (ASDKFormSaveJournalEntry *journalEntry in strongSelf.journal) {
+                ASDKFormSaveJournalEntry *journalEntryCopy = [ASDKFormSaveJournalEntry new];
+                journalEntryCopy.taskID = journalEntry.taskID;
+                journalEntryCopy.formFieldValueRequestRepresentation = journalEntry.formFieldValueRequestRepresentation;
+                journalEntryCopy.revision = journalEntry.revision;
+                journalEntryCopy.attemptCount = journalEntry.attemptCount;
+                journalEntryCopy.journalDate = journalEntry.journalDate;
+                journalEntryCopy.nextAttemptDate = journalEntry.nextAttemptDate;
+                [journalEntries addObject:journalEntryCopy];
+            }
+        }
+        
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            completionBlock(journalEntries, nil);
+        });
+    });
+    
+    OCMStub([self.formCacheServiceMock removeFormSaveJournalEntryForTaskID:OCMOCK_ANY
+                                                               withRevision:0
+                                                            completionBlock:OCMOCK_ANY]).ignoringNonObjectArgs().andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained NSString *taskID;
+        int64_t revision;
+        __unsafe_unretained ASDKCacheServiceFormSaveJournalEntryRemovalCompletionBlock completionBlockArg;
+        [invocation getArgument:&taskID
+                        atIndex:2];
+        [invocation getArgument:&revision
+                        atIndex:3];
+        [invocation getArgument:&completionBlockArg
+                        atIndex:4];
+        ASDKCacheServiceFormSaveJournalEntryRemovalCompletionBlock completionBlock = completionBlockArg;
+        
+        BOOL isEntryRemoved = NO;
+        BOOL isJournalEmpty = NO;
+        @synchronized (strongSelf.journal) {
+            ASDKFormSaveJournalEntry *journalEntry = [strongSelf journalEntryForTaskID:taskID
+                                                                         withRevision:revision];
+            if (journalEntry) {
+                [strongSelf.journal removeObject:journalEntry];
+                [strongSelf.removedTaskIDs addObject:taskID];
+                isEntryRemoved = YES;
+            }
+            isJournalEmpty = !strongSelf.journal.count;
+        }
+        
+        completionBlock(isEntryRemoved, nil);
+        
+        if (isEntryRemoved && isJournalEmpty) {
+            [strongSelf.emptyJournalExpectation fulfill];
+        }
+    });
+    
+    OCMStub([self.formCacheServiceMock updateFormSaveJournalEntryForTaskID:OCMOCK_ANY
+                                                               withRevision:0
+                                                               attemptCount:0
+                                                            nextAttemptDate:OCMOCK_ANY
+                                                            completionBlock:OCMOCK_ANY]).ignoringNonObjectArgs().andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained NSString *taskID;
+        int64_t revision;
+        NSInteger attemptCount;
+        __unsafe_unretained NSDate *nextAttemptDate;
+        __unsafe_unretained ASDKCacheServiceCompletionBlock completionBlock;
+        [invocation getArgument:&taskID
+                        atIndex:2];
+        [invocation getArgument:&revision
+                        atIndex:3];
+        [invocation getArgument:&attemptCount
+                        atIndex:4];
+        [invocation getArgument:&nextAttemptDate
+                        atIndex:5];
+        [invocation getArgument:&completionBlock
+                        atIndex:6];
+        
+        @synchronized (strongSelf.journal) {
+            ASDKFormSaveJournalEntry *journalEntry = [strongSelf journalEntryForTaskID:taskID
+                                                                         withRevision:revision];
+            journalEntry.attemptCount = attemptCount;
+            journalEntry.nextAttemptDate = nextAttemptDate;
+        }
+        
+        completionBlock(nil);
+    });
+}
+
+- (void)setUpFormNetworkServiceMock {
+    self.formNetworkServiceMock = OCMProtocolMock(@protocol(ASDKFormNetworkServiceProtocol));
+    
+    __weak typeof(self) weakSelf = self;
+    OCMStub([self.formNetworkServiceMock saveFormForTaskID:OCMOCK_ANY
+                  withFormFieldValuesRequestRepresentation:OCMOCK_ANY
+                                           completionBlock:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained NSString *taskIDArg;
+        __unsafe_unretained ASDKFormSaveBlock completionBlockArg;
+        [invocation getArgument:&taskIDArg
+                        atIndex:2];
+        [invocation getArgument:&completionBlockArg
+                        atIndex:4];
+        NSString *taskID = taskIDArg;
+        ASDKFormSaveBlock completionBlock = completionBlockArg;
+        
+        BOOL shouldFail = NO;
+        @synchronized (strongSelf) {
+            strongSelf.saveCountsForTaskIDs[taskID] = @([strongSelf.saveCountsForTaskIDs[taskID] unsignedIntegerValue] + 1);
+            
+            NSUInteger failureCount = [strongSelf.failureCountsForTaskIDs[taskID] unsignedIntegerValue];
+            if (failureCount) {
+                strongSelf.failureCountsForTaskIDs[taskID] = @(failureCount - 1);
+                shouldFail = YES;
+            }
+            
+            strongSelf.concurrentSaveCount++;
+            strongSelf.maxObservedConcurrentSaveCount = MAX(strongSelf.maxObservedConcurrentSaveCount, strongSelf.concurrentSaveCount);
+        }
+        
+        // Simulate the request round trip
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(.02f * NSEC_PER_SEC)), dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            @synchronized (strongSelf) {
+                strongSelf.concurrentSaveCount--;
+            }
+            
+            if (shouldFail) {
+                completionBlock(NO, [strongSelf saveErrorForTaskID:taskID]);
+            } else {
+                completionBlock(YES, nil);
+            }
+        });
+    });
+}
+
+@end
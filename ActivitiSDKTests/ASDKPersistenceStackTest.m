@@ -0,0 +1,552 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKPersistenceStack.h"
+#import "ASDKCoreDataCacheService.h"
+#import "ASDKModelCache.h"
+
+static NSUInteger const kASDKPersistenceStackTestSyntheticTaskCount = 20000;
+static NSUInteger const kASDKPersistenceStackTestSaveBatchSize      = 1000;
+static NSUInteger const kASDKPersistenceStackTestWriteTaskCount     = 10;
+
+@interface ASDKPersistenceStackTest : ASDKBaseTest
+
+@property (strong, nonatomic) ASDKModelServerConfiguration  *serverConfiguration;
+@property (strong, nonatomic) ASDKPersistenceStack          *persistenceStack;
+
+@end
+
+@implementation ASDKPersistenceStackTest
+
+- (void)setUp {
+    [super setUp];
+    
+    // Use a dedicated store for each test run
+    self.serverConfiguration = [ASDKModelServerConfiguration new];
+    self.serverConfiguration.hostAddressString = [NSUUID UUID].UUIDString;
+    self.serverConfiguration.username = @"test";
+    self.serverConfiguration.serviceDocument = @"activiti-app";
+    
+    [self populateSyntheticStore];
+}
+
+- (void)tearDown {
+    [[ASDKBootstrap sharedInstance].serviceLocator removeServiceConformingToProtocol:@protocol(ASDKPersistenceStackProtocol)];
+    [self waitForStoreToLoad];
+    self.persistenceStack = nil;
+    [self removeSyntheticStore];
+    
+    [super tearDown];
+}
+
+- (void)testThatItRunsTasksSubmittedBeforeTheStoreIsLoaded {
+    // given
+    self.persistenceStack = [self loadPersistenceStack];
+    
+    // expect
+    XCTestExpectation *backgroundTaskExpectation = [self expectationWithDescription:@"Background task executed"];
+    
+    // when
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        // then
+        XCTAssertTrue(self.persistenceStack.isStoreLoaded);
+        
+        NSError *error = nil;
+        NSUInteger taskCount = [managedObjectContext countForFetchRequest:[NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"]
+                                                                    error:&error];
+        XCTAssertNil(error);
+        XCTAssertEqual(taskCount, kASDKPersistenceStackTestSyntheticTaskCount);
+        
+        [backgroundTaskExpectation fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+}
+
+- (void)testThatDataAccessorsFallBackToRemoteOnlyWhileTheStoreIsWarming {
+    // given
+    self.persistenceStack = [self loadPersistenceStack];
+    [[ASDKBootstrap sharedInstance].serviceLocator addService:self.persistenceStack];
+    
+    ASDKDataAccessor *dataAccessor = [[ASDKDataAccessor alloc] initWithDelegate:nil];
+    dataAccessor.cachePolicy = ASDKServiceDataAccessorCachingPolicyHybrid;
+    dataAccessor.cacheService = [ASDKCoreDataCacheService new];
+    
+    // when
+    ASDKServiceDataAccessorCachingPolicy warmingCachePolicy = dataAccessor.cachePolicy;
+    
+    // then
+    XCTAssertTrue(ASDKServiceDataAccessorCachingPolicyAPIOnly == warmingCachePolicy ||
+                  self.persistenceStack.isStoreLoaded);
+    
+    // when
+    [self waitForStoreToLoad];
+    
+    // then
+    XCTAssertEqual(dataAccessor.cachePolicy, ASDKServiceDataAccessorCachingPolicyHybrid);
+}
+
+- (void)testThatCacheWritesNeverReachTheStoreOnTheMainThread {
+    // given
+    self.persistenceStack = [self loadPersistenceStack];
+    [self waitForStoreToLoad];
+    
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = self.persistenceStack.persistentContainer.persistentStoreCoordinator;
+    __block NSUInteger saveCount = 0;
+    __block NSUInteger mainThreadSaveCount = 0;
+    id saveObserver = [[NSNotificationCenter defaultCenter] addObserverForName:NSManagedObjectContextWillSaveNotification
+                                                                        object:nil
+                                                                         queue:nil
+                                                                    usingBlock:^(NSNotification *notification) {
+        NSManagedObjectContext *managedObjectContext = notification.object;
+        if (managedObjectContext.persistentStoreCoordinator != persistentStoreCoordinator) {
+            return;
+        }
+        
+        @synchronized (self) {
+            saveCount++;
+            if ([NSThread isMainThread]) {
+                mainThreadSaveCount++;
+            }
+        }
+    }];
+    
+    // expect
+    XCTestExpectation *writeTasksExpectation = [self expectationWithDescription:@"Write tasks performed"];
+    
+    // when
+    dispatch_group_t writeTaskGroup = dispatch_group_create();
+    for (NSUInteger writeTaskIdx = 0; writeTaskIdx < kASDKPersistenceStackTestWriteTaskCount; writeTaskIdx++) {
+        dispatch_group_enter(writeTaskGroup);
+        [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+            for (NSUInteger idx = 0; idx < kASDKPersistenceStackTestSaveBatchSize; idx++) {
+                NSManagedObject *task = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTask"
+                                                                      inManagedObjectContext:managedObjectContext];
+                [task setValue:[NSString stringWithFormat:@"write-%lu-%lu", (unsigned long)writeTaskIdx, (unsigned long)idx]
+                        forKey:@"modelID"];
+            }
+            
+            NSError *error = nil;
+            [managedObjectContext save:&error];
+            XCTAssertNil(error);
+            
+            dispatch_group_leave(writeTaskGroup);
+        }];
+    }
+    
+    // Cache services request a save from whatever queue their completion runs on
+    dispatch_group_notify(writeTaskGroup, dispatch_get_main_queue(), ^{
+        [self.persistenceStack saveContext];
+        
+        // Let the batched merge into the view context go through
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(1.0f * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+            [[self.persistenceStack viewContext] performBlock:^{
+                [writeTasksExpectation fulfill];
+            }];
+        });
+    });
+    
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+    [[NSNotificationCenter defaultCenter] removeObserver:saveObserver];
+    
+    // then
+    XCTAssertEqual(saveCount, kASDKPersistenceStackTestWriteTaskCount);
+    XCTAssertEqual(mainThreadSaveCount, (NSUInteger)0);
+    XCTAssertFalse([self.persistenceStack viewContext].hasChanges);
+}
+
+- (void)testThatDeferredWritesArePersistedWithASingleSave {
+    // given
+    self.persistenceStack = [self loadPersistenceStack];
+    [self waitForStoreToLoad];
+    
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = self.persistenceStack.persistentContainer.persistentStoreCoordinator;
+    __block NSUInteger saveCount = 0;
+    id saveObserver = [[NSNotificationCenter defaultCenter] addObserverForName:NSManagedObjectContextDidSaveNotification
+                                                                        object:nil
+                                                                         queue:nil
+                                                                    usingBlock:^(NSNotification *notification) {
+        NSManagedObjectContext *managedObjectContext = notification.object;
+        if (managedObjectContext.persistentStoreCoordinator == persistentStoreCoordinator) {
+            @synchronized (self) {
+                saveCount++;
+            }
+        }
+    }];
+    
+    // when
+    for (NSUInteger writeTaskIdx = 0; writeTaskIdx < kASDKPersistenceStackTestWriteTaskCount; writeTaskIdx++) {
+        [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+            NSManagedObject *task = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTask"
+                                                                  inManagedObjectContext:managedObjectContext];
+            [task setValue:[NSString stringWithFormat:@"deferred-%lu", (unsigned long)writeTaskIdx]
+                    forKey:@"modelID"];
+            
+            NSError *error = nil;
+            XCTAssertTrue([managedObjectContext save:&error]);
+        } deferringSave:YES];
+    }
+    [self.persistenceStack saveContext];
+    
+    // Write tasks are serialized so this one runs after the deferred saves are committed
+    XCTestExpectation *commitExpectation = [self expectationWithDescription:@"Deferred writes committed"];
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        [commitExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+    
+    // then
+    XCTestExpectation *readExpectation = [self expectationWithDescription:@"Deferred writes read back"];
+    NSManagedObjectContext *readContext = [self.persistenceStack backgroundContext];
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"];
+        fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID BEGINSWITH %@", @"deferred-"];
+        XCTAssertEqual([managedObjectContext countForFetchRequest:fetchRequest
+                                                            error:nil], kASDKPersistenceStackTestWriteTaskCount);
+        
+        [readExpectation fulfill];
+    } inContext:readContext];
+    
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+    [[NSNotificationCenter defaultCenter] removeObserver:saveObserver];
+    
+    XCTAssertEqual(saveCount, (NSUInteger)1);
+}
+
+- (void)testThatAFailingWriteTaskOnlyRevertsItsOwnChanges {
+    // given
+    self.persistenceStack = [self loadPersistenceStack];
+    [self waitForStoreToLoad];
+    
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSManagedObject *task = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTask"
+                                                              inManagedObjectContext:managedObjectContext];
+        [task setValue:@"1"
+                forKey:@"modelID"];
+        [task setValue:@"Task 1"
+                forKey:@"name"];
+        
+        NSError *error = nil;
+        XCTAssertTrue([managedObjectContext save:&error]);
+    }];
+    
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSManagedObject *task = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTask"
+                                                              inManagedObjectContext:managedObjectContext];
+        [task setValue:@"deferred"
+                forKey:@"modelID"];
+        
+        NSError *error = nil;
+        XCTAssertTrue([managedObjectContext save:&error]);
+    } deferringSave:YES];
+    
+    // when
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSManagedObject *task = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTask"
+                                                              inManagedObjectContext:managedObjectContext];
+        [task setValue:@"failed"
+                forKey:@"modelID"];
+        
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"];
+        fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID == %@", @"1"];
+        NSManagedObject *existingTask = [managedObjectContext executeFetchRequest:fetchRequest
+                                                                            error:nil].firstObject;
+        [existingTask setValue:@"Partially updated task"
+                        forKey:@"name"];
+        
+        // The task fails before requesting a save
+    } deferringSave:YES];
+    [self.persistenceStack saveContext];
+    
+    // Write tasks are serialized so this one runs after the deferred saves are committed
+    XCTestExpectation *commitExpectation = [self expectationWithDescription:@"Deferred writes committed"];
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        [commitExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+    
+    // then
+    XCTestExpectation *readExpectation = [self expectationWithDescription:@"Committed writes read back"];
+    NSManagedObjectContext *readContext = [self.persistenceStack backgroundContext];
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"];
+        fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID IN %@", @[@"deferred", @"failed"]];
+        NSArray *tasks = [managedObjectContext executeFetchRequest:fetchRequest
+                                                             error:nil];
+        XCTAssertEqualObjects([tasks valueForKey:@"modelID"], @[@"deferred"]);
+        
+        fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID == %@", @"1"];
+        NSManagedObject *existingTask = [managedObjectContext executeFetchRequest:fetchRequest
+                                                                            error:nil].firstObject;
+        XCTAssertEqualObjects([existingTask valueForKey:@"name"], @"Task 1");
+        
+        [readExpectation fulfill];
+    } inContext:readContext];
+    
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+}
+
+- (void)testThatCachedModelsAreInvalidatedOnceTheSaveIsCommitted {
+    // given
+    self.persistenceStack = [self loadPersistenceStack];
+    [self waitForStoreToLoad];
+    
+    ASDKModelCache *modelCache = [ASDKModelCache new];
+    self.persistenceStack.modelCache = modelCache;
+    for (NSString *modelID in @[@"1", @"2"]) {
+        [modelCache setModel:[self taskWithModelID:modelID]
+               forEntityName:@"ASDKMOTask"
+                     modelID:modelID
+          observedGeneration:modelCache.generation];
+    }
+    
+    // when
+    XCTestExpectation *deferredWriteExpectation = [self expectationWithDescription:@"Deferred write performed"];
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"];
+        fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID == %@", @"1"];
+        NSManagedObject *task = [managedObjectContext executeFetchRequest:fetchRequest
+                                                                    error:nil].firstObject;
+        [task setValue:@"Renamed task"
+                forKey:@"name"];
+        
+        NSError *error = nil;
+        XCTAssertTrue([managedObjectContext save:&error]);
+        [deferredWriteExpectation fulfill];
+    } deferringSave:YES];
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+    
+    // then
+    XCTAssertNotNil([modelCache modelForEntityName:@"ASDKMOTask"
+                                           modelID:@"1"]);
+    
+    // when
+    [self.persistenceStack saveContext];
+    XCTestExpectation *commitExpectation = [self expectationWithDescription:@"Deferred write committed"];
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        [commitExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+    
+    // then
+    XCTAssertNil([modelCache modelForEntityName:@"ASDKMOTask"
+                                        modelID:@"1"]);
+    XCTAssertNotNil([modelCache modelForEntityName:@"ASDKMOTask"
+                                           modelID:@"2"]);
+    
+    // when
+    XCTestExpectation *batchDeleteExpectation = [self expectationWithDescription:@"Batch delete performed"];
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"];
+        fetchRequest.predicate = [NSPredicate predicateWithFormat:@"modelID == %@", @"2"];
+        NSBatchDeleteRequest *deleteRequest = [[NSBatchDeleteRequest alloc] initWithFetchRequest:fetchRequest];
+        deleteRequest.resultType = NSBatchDeleteResultTypeObjectIDs;
+        NSBatchDeleteResult *deleteResult = [managedObjectContext executeRequest:deleteRequest
+                                                                           error:nil];
+        [self.persistenceStack mergeChangesFromBatchOperation:@{NSDeletedObjectsKey : deleteResult.result}
+                                                  intoContext:managedObjectContext];
+        [batchDeleteExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+    
+    // then
+    XCTAssertNil([modelCache modelForEntityName:@"ASDKMOTask"
+                                        modelID:@"2"]);
+}
+
+- (void)testThatReusableContextsAreResetPastTheThreshold {
+    // given
+    self.persistenceStack = [self loadPersistenceStack];
+    [self waitForStoreToLoad];
+    NSManagedObjectContext *readContext = [self.persistenceStack backgroundContext];
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"];
+    fetchRequest.fetchLimit = kASDKPersistenceStackTestSaveBatchSize;
+    
+    // when
+    self.persistenceStack.contextResetThreshold = kASDKPersistenceStackTestSaveBatchSize + 1;
+    [self performFetchRequest:fetchRequest
+                    inContext:readContext];
+    
+    // then
+    XCTAssertEqual([self registeredObjectCountInContext:readContext], kASDKPersistenceStackTestSaveBatchSize);
+    
+    // when
+    self.persistenceStack.contextResetThreshold = kASDKPersistenceStackTestSaveBatchSize;
+    [self performFetchRequest:fetchRequest
+                    inContext:readContext];
+    
+    // then
+    XCTAssertEqual([self registeredObjectCountInContext:readContext], (NSUInteger)0);
+}
+
+- (void)testTimeToFirstNetworkRequestPerformance {
+    [self measureMetrics:[[self class] defaultPerformanceMetrics]
+    automaticallyStartMeasuring:NO
+                       forBlock:^{
+        XCTestExpectation *networkRequestExpectation = [self expectationWithDescription:@"First network request issued"];
+        
+        [self startMeasuring];
+        self.persistenceStack = [self loadPersistenceStack];
+        [[ASDKBootstrap sharedInstance].serviceLocator addService:self.persistenceStack];
+        
+        ASDKDataAccessor *dataAccessor = [[ASDKDataAccessor alloc] initWithDelegate:nil];
+        dataAccessor.cachePolicy = ASDKServiceDataAccessorCachingPolicyHybrid;
+        dataAccessor.cacheService = [ASDKCoreDataCacheService new];
+        
+        // Mirror the hybrid chain where the network request waits for the cached results
+        dispatch_block_t networkRequestBlock = ^{
+            [self stopMeasuring];
+            [networkRequestExpectation fulfill];
+        };
+        
+        if (ASDKServiceDataAccessorCachingPolicyHybrid == dataAccessor.cachePolicy) {
+            [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+                [managedObjectContext countForFetchRequest:[NSFetchRequest fetchRequestWithEntityName:@"ASDKMOTask"]
+                                                     error:nil];
+                networkRequestBlock();
+            }];
+        } else {
+            networkRequestBlock();
+        }
+        
+        [self waitForExpectationsWithTimeout:30.0f
+                                     handler:nil];
+        [self waitForStoreToLoad];
+    }];
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (ASDKPersistenceStack *)loadPersistenceStack {
+    return [[ASDKPersistenceStack alloc] initWithServerConfiguration:self.serverConfiguration
+                                                        errorHandler:^(NSError *error) {
+                                                            XCTAssertNil(error);
+                                                        }];
+}
+
+- (ASDKModelTask *)taskWithModelID:(NSString *)modelID {
+    ASDKModelTask *task = [ASDKModelTask new];
+    task.modelID = modelID;
+    task.name = [NSString stringWithFormat:@"Task %@", modelID];
+    
+    return task;
+}
+
+- (void)waitForStoreToLoad {
+    if (!self.persistenceStack) {
+        return;
+    }
+    
+    XCTestExpectation *storeLoadedExpectation = [self expectationWithDescription:@"Store loaded"];
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        [storeLoadedExpectation fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+}
+
+- (void)performFetchRequest:(NSFetchRequest *)fetchRequest
+                  inContext:(NSManagedObjectContext *)managedObjectContext {
+    XCTestExpectation *fetchExpectation = [self expectationWithDescription:@"Fetch performed"];
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSError *error = nil;
+        [managedObjectContext executeFetchRequest:fetchRequest
+                                            error:&error];
+        XCTAssertNil(error);
+        
+        [fetchExpectation fulfill];
+    } inContext:managedObjectContext];
+    
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+}
+
+- (NSUInteger)registeredObjectCountInContext:(NSManagedObjectContext *)managedObjectContext {
+    __block NSUInteger registeredObjectCount = 0;
+    [managedObjectContext performBlockAndWait:^{
+        registeredObjectCount = managedObjectContext.registeredObjects.count;
+    }];
+    
+    return registeredObjectCount;
+}
+
+- (void)populateSyntheticStore {
+    self.persistenceStack = [self loadPersistenceStack];
+    
+    XCTestExpectation *populateExpectation = [self expectationWithDescription:@"Synthetic store populated"];
+    [self.persistenceStack performBackgroundTask:^(NSManagedObjectContext *managedObjectContext) {
+        NSError *error = nil;
+        
+        for (NSUInteger idx = 0; idx < kASDKPersistenceStackTestSyntheticTaskCount; idx++) {
+            NSManagedObject *task = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTask"
+                                                                  inManagedObjectContext:managedObjectContext];
+            [task setValue:[NSString stringWithFormat:@"%lu", (unsigned long)idx]
+                    forKey:@"modelID"];
+            [task setValue:[NSString stringWithFormat:@"Task %lu", (unsigned long)idx]
+                    forKey:@"name"];
+            [task setValue:[NSDate dateWithTimeIntervalSince1970:idx * 60]
+                    forKey:@"creationDate"];
+            
+            if (!((idx + 1) % kASDKPersistenceStackTestSaveBatchSize)) {
+                [managedObjectContext save:&error];
+                [managedObjectContext reset];
+            }
+        }
+        
+        [managedObjectContext save:&error];
+        XCTAssertNil(error);
+        
+        [populateExpectation fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:120.0f
+                                 handler:nil];
+    
+    // Close the store so that every test opens it from disk
+    for (NSPersistentStore *persistentStore in self.persistenceStack.persistentContainer.persistentStoreCoordinator.persistentStores) {
+        [self.persistenceStack.persistentContainer.persistentStoreCoordinator removePersistentStore:persistentStore
+                                                                                             error:nil];
+    }
+    self.persistenceStack = nil;
+}
+
+- (void)removeSyntheticStore {
+    NSString *storeName = [ASDKPersistenceStack persistenceStackModelNameForServerConfiguration:self.serverConfiguration];
+    NSURL *storeURL = [[NSPersistentContainer defaultDirectoryURL] URLByAppendingPathComponent:[storeName stringByAppendingPathExtension:@"sqlite"]];
+    
+    for (NSString *suffix in @[@"", @"-shm", @"-wal"]) {
+        NSURL *fileURL = [NSURL fileURLWithPath:[storeURL.path stringByAppendingString:suffix]];
+        [[NSFileManager defaultManager] removeItemAtURL:fileURL
+                                                  error:nil];
+    }
+}
+
+@end
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKPersistenceStack.h"
+#import "ASDKPersistenceStoreManager.h"
+#import "ASDKModelCache.h"
+
+@interface ASDKPersistenceStoreManagerTest : ASDKBaseTest
+
+@property (strong, nonatomic) ASDKPersistenceStoreManager   *persistenceStoreManager;
+@property (strong, nonatomic) NSMutableArray                *serverConfigurations;
+
+@end
+
+@implementation ASDKPersistenceStoreManagerTest
+
+- (void)setUp {
+    [super setUp];
+    
+    self.persistenceStoreManager = [ASDKPersistenceStoreManager new];
+    self.persistenceStoreManager.maxOpenStoreCount = 2;
+    self.persistenceStoreManager.idleStoreMaintenanceInterval = 0;
+    self.serverConfigurations = [NSMutableArray array];
+}
+
+- (void)tearDown {
+    self.persistenceStoreManager = nil;
+    
+    for (ASDKModelServerConfiguration *serverConfiguration in self.serverConfigurations) {
+        [self removeStoreForServerConfiguration:serverConfiguration];
+    }
+    
+    [super tearDown];
+}
+
+- (void)testThatItReusesTheOpenStoreWhenSwitchingBackToAnAccount {
+    // given
+    ASDKModelServerConfiguration *firstServerConfiguration = [self serverConfigurationForUsername:@"first"];
+    ASDKModelServerConfiguration *secondServerConfiguration = [self serverConfigurationForUsername:@"second"];
+    
+    // when
+    id<ASDKPersistenceStackProtocol> firstPersistenceStack = [self.persistenceStoreManager activatePersistenceStackForServerConfiguration:firstServerConfiguration
+                                                                                                                              errorHandler:nil];
+    id<ASDKModelCacheProtocol> firstModelCache = self.persistenceStoreManager.activeModelCache;
+    id<ASDKPersistenceStackProtocol> secondPersistenceStack = [self.persistenceStoreManager activatePersistenceStackForServerConfiguration:secondServerConfiguration
+                                                                                                                               errorHandler:nil];
+    id<ASDKPersistenceStackProtocol> reactivatedPersistenceStack = [self.persistenceStoreManager activatePersistenceStackForServerConfiguration:[self serverConfigurationForUsername:@"first"]
+                                                                                                                                    errorHandler:nil];
+    
+    // then
+    XCTAssertNotEqual(firstPersistenceStack, secondPersistenceStack);
+    XCTAssertEqual(firstPersistenceStack, reactivatedPersistenceStack);
+    XCTAssertEqual(self.persistenceStoreManager.activePersistenceStack, firstPersistenceStack);
+    XCTAssertEqual(self.persistenceStoreManager.activeModelCache, firstModelCache);
+    XCTAssertTrue([self.persistenceStoreManager isStoreOpenForServerConfiguration:secondServerConfiguration]);
+}
+
+- (void)testThatItClosesTheLeastRecentlyUsedStore {
+    // given
+    ASDKModelServerConfiguration *firstServerConfiguration = [self serverConfigurationForUsername:@"first"];
+    ASDKModelServerConfiguration *secondServerConfiguration = [self serverConfigurationForUsername:@"second"];
+    ASDKModelServerConfiguration *thirdServerConfiguration = [self serverConfigurationForUsername:@"third"];
+    
+    // when
+    [self.persistenceStoreManager activatePersistenceStackForServerConfiguration:firstServerConfiguration
+                                                                    errorHandler:nil];
+    [self.persistenceStoreManager activatePersistenceStackForServerConfiguration:secondServerConfiguration
+                                                                    errorHandler:nil];
+    [self.persistenceStoreManager activatePersistenceStackForServerConfiguration:firstServerConfiguration
+                                                                    errorHandler:nil];
+    [self.persistenceStoreManager activatePersistenceStackForServerConfiguration:thirdServerConfiguration
+                                                                    errorHandler:nil];
+    
+    // then
+    XCTAssertTrue([self.persistenceStoreManager isStoreOpenForServerConfiguration:firstServerConfiguration]);
+    XCTAssertFalse([self.persistenceStoreManager isStoreOpenForServerConfiguration:secondServerConfiguration]);
+    XCTAssertTrue([self.persistenceStoreManager isStoreOpenForServerConfiguration:thirdServerConfiguration]);
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (ASDKModelServerConfiguration *)serverConfigurationForUsername:(NSString *)username {
+    ASDKModelServerConfiguration *serverConfiguration = [ASDKModelServerConfiguration new];
+    serverConfiguration.hostAddressString = NSStringFromClass([self class]);
+    serverConfiguration.username = username;
+    serverConfiguration.serviceDocument = @"activiti-app";
+    [self.serverConfigurations addObject:serverConfiguration];
+    
+    return serverConfiguration;
+}
+
+- (void)removeStoreForServerConfiguration:(ASDKModelServerConfiguration *)serverConfiguration {
+    NSString *storeName = [ASDKPersistenceStack persistenceStackModelNameForServerConfiguration:serverConfiguration];
+    NSURL *storeURL = [[NSPersistentContainer defaultDirectoryURL] URLByAppendingPathComponent:[storeName stringByAppendingPathExtension:@"sqlite"]];
+    
+    for (NSString *suffix in @[@"", @"-shm", @"-wal"]) {
+        NSURL *fileURL = [NSURL fileURLWithPath:[storeURL.path stringByAppendingString:suffix]];
+        [[NSFileManager defaultManager] removeItemAtURL:fileURL
+                                                  error:nil];
+    }
+}
+
+@end
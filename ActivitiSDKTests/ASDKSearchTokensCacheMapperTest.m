@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKSearchTokensCacheMapper.h"
+
+@interface ASDKSearchTokensCacheMapperTest : ASDKBaseTest
+
+@end
+
+@implementation ASDKSearchTokensCacheMapperTest
+
+- (void)setUp {
+    [super setUp];
+}
+
+- (void)tearDown {
+    [super tearDown];
+}
+
+- (void)testThatItFoldsAndTokenizesStrings {
+    // then
+    XCTAssertEqualObjects([ASDKSearchTokensCacheMapper searchTokensForString:@"Révision du  Contrat-2018"], @"revision du contrat 2018");
+    XCTAssertNil([ASDKSearchTokensCacheMapper searchTokensForString:@" - "]);
+    XCTAssertNil([ASDKSearchTokensCacheMapper searchTokensForString:nil]);
+}
+
+- (void)testThatQueriesMatchTokenPrefixes {
+    // given
+    NSDictionary *row = @{@"name"           : @"Approve Invoice Now",
+                          @"searchTokens"   : [ASDKSearchTokensCacheMapper searchTokensForString:@"Approve Invoice Now"]};
+    
+    // then
+    XCTAssertTrue([[self predicateForQuery:@"inv"] evaluateWithObject:row]);
+    XCTAssertTrue([[self predicateForQuery:@"APPR inv"] evaluateWithObject:row]);
+    XCTAssertTrue([[self predicateForQuery:@"Nöw"] evaluateWithObject:row]);
+    XCTAssertFalse([[self predicateForQuery:@"voice"] evaluateWithObject:row]);
+    XCTAssertFalse([[self predicateForQuery:@"approve later"] evaluateWithObject:row]);
+    XCTAssertNil([self predicateForQuery:@""]);
+}
+
+- (void)testThatRowsWithoutSearchTokensFallBackToTheName {
+    // given
+    NSDictionary *row = @{@"name" : @"Approve Invoice Now"};
+    
+    // then
+    XCTAssertTrue([[self predicateForQuery:@"voice"] evaluateWithObject:row]);
+    XCTAssertFalse([[self predicateForQuery:@"reject"] evaluateWithObject:row]);
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (NSPredicate *)predicateForQuery:(NSString *)query {
+    return [ASDKSearchTokensCacheMapper searchTokensPredicateForQuery:query
+                                                          nameKeyPath:@"name"];
+}
+
+@end
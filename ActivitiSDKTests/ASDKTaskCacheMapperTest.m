@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKPersistenceStack.h"
+#import "ASDKTaskCacheMapper.h"
+#import "ASDKMOTask.h"
+
+static NSUInteger const kASDKTaskCacheMapperTestTaskCount           = 1000;
+static NSUInteger const kASDKTaskCacheMapperTestInvolvedPeopleCount = 3;
+static NSUInteger const kASDKTaskCacheMapperTestGroupCount          = 2;
+
+@interface ASDKTaskCacheMapperTest : ASDKBaseTest
+
+@property (strong, nonatomic) NSPersistentContainer *persistentContainer;
+
+@end
+
+@implementation ASDKTaskCacheMapperTest
+
+- (void)setUp {
+    [super setUp];
+    
+    NSURL *modelURL = [[NSBundle bundleForClass:[ASDKPersistenceStack class]] URLForResource:@"CacheServicesDataModel"
+                                                                               withExtension:@"momd"];
+    NSManagedObjectModel *managedObjectModel = [[NSManagedObjectModel alloc] initWithContentsOfURL:modelURL];
+    self.persistentContainer = [[NSPersistentContainer alloc] initWithName:NSStringFromClass([self class])
+                                                        managedObjectModel:managedObjectModel];
+    
+    NSPersistentStoreDescription *storeDescription = [NSPersistentStoreDescription new];
+    storeDescription.type = NSInMemoryStoreType;
+    storeDescription.shouldAddStoreAsynchronously = NO;
+    self.persistentContainer.persistentStoreDescriptions = @[storeDescription];
+    [self.persistentContainer loadPersistentStoresWithCompletionHandler:^(NSPersistentStoreDescription *description, NSError *error) {
+        XCTAssertNil(error);
+    }];
+    
+    [self populateStore];
+}
+
+- (void)tearDown {
+    self.persistentContainer = nil;
+    
+    [super tearDown];
+}
+
+- (void)testThatListSummaryMappingSkipsDetailRelationships {
+    // given
+    NSManagedObjectContext *managedObjectContext = [self.persistentContainer newBackgroundContext];
+    
+    [managedObjectContext performBlockAndWait:^{
+        // when
+        ASDKMOTask *moTask = [self fetchTasksInContext:managedObjectContext
+                                        mappingProfile:ASDKCacheMappingProfileListSummary].firstObject;
+        ASDKModelTask *summaryTask = [ASDKTaskCacheMapper mapCacheMOToTask:moTask
+                                                            mappingProfile:ASDKCacheMappingProfileListSummary];
+        ASDKModelTask *detailsTask = [ASDKTaskCacheMapper mapCacheMOToTask:moTask
+                                                            mappingProfile:ASDKCacheMappingProfileDetails];
+        
+        // then
+        XCTAssertNotNil(summaryTask.name);
+        XCTAssertNotNil(summaryTask.assigneeModel.userFirstName);
+        XCTAssertNil(summaryTask.assigneeModel.groups);
+        XCTAssertNil(summaryTask.involvedPeople);
+        
+        XCTAssertEqualObjects(detailsTask.name, summaryTask.name);
+        XCTAssertEqual(detailsTask.assigneeModel.groups.count, kASDKTaskCacheMapperTestGroupCount);
+        XCTAssertEqual(detailsTask.involvedPeople.count, kASDKTaskCacheMapperTestInvolvedPeopleCount);
+    }];
+}
+
+- (void)testListSummaryPageMappingPerformance {
+    [self measureMappingOfTaskPageWithMappingProfile:ASDKCacheMappingProfileListSummary];
+}
+
+- (void)testDetailsPageMappingPerformance {
+    [self measureMappingOfTaskPageWithMappingProfile:ASDKCacheMappingProfileDetails];
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (void)measureMappingOfTaskPageWithMappingProfile:(ASDKCacheMappingProfile)mappingProfile {
+    [self measureBlock:^{
+        // Start from a cold context so that every pass fetches and faults in rows
+        NSManagedObjectContext *managedObjectContext = [self.persistentContainer newBackgroundContext];
+        
+        [managedObjectContext performBlockAndWait:^{
+            NSArray *moTasks = [self fetchTasksInContext:managedObjectContext
+                                          mappingProfile:mappingProfile];
+            
+            NSMutableArray *tasks = [NSMutableArray array];
+            for (ASDKMOTask *moTask in moTasks) {
+                [tasks addObject:[ASDKTaskCacheMapper mapCacheMOToTask:moTask
+                                                        mappingProfile:mappingProfile]];
+            }
+            XCTAssertEqual(tasks.count, kASDKTaskCacheMapperTestTaskCount);
+        }];
+    }];
+}
+
+- (NSArray *)fetchTasksInContext:(NSManagedObjectContext *)managedObjectContext
+                  mappingProfile:(ASDKCacheMappingProfile)mappingProfile {
+    NSFetchRequest *fetchRequest = [ASDKMOTask fetchRequest];
+    fetchRequest.sortDescriptors = @[[NSSortDescriptor sortDescriptorWithKey:@"modelID"
+                                                                   ascending:YES]];
+    [ASDKTaskCacheMapper configureFetchRequest:fetchRequest
+                             forMappingProfile:mappingProfile];
+    
+    NSError *error = nil;
+    NSArray *moTasks = [managedObjectContext executeFetchRequest:fetchRequest
+                                                           error:&error];
+    XCTAssertNil(error);
+    
+    return moTasks;
+}
+
+- (void)populateStore {
+    NSManagedObjectContext *managedObjectContext = [self.persistentContainer newBackgroundContext];
+    
+    [managedObjectContext performBlockAndWait:^{
+        NSMutableArray *groups = [NSMutableArray array];
+        for (NSUInteger idx = 0; idx < kASDKTaskCacheMapperTestGroupCount; idx++) {
+            NSManagedObject *group = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOGroup"
+                                                                   inManagedObjectContext:managedObjectContext];
+            [group setValue:[NSString stringWithFormat:@"group%lu", (unsigned long)idx]
+                     forKey:@"modelID"];
+            [groups addObject:group];
+        }
+        
+        for (NSUInteger idx = 0; idx < kASDKTaskCacheMapperTestTaskCount; idx++) {
+            NSManagedObject *task = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOTask"
+                                                                  inManagedObjectContext:managedObjectContext];
+            [task setValue:[NSString stringWithFormat:@"%04lu", (unsigned long)idx]
+                    forKey:@"modelID"];
+            [task setValue:[NSString stringWithFormat:@"Task %lu", (unsigned long)idx]
+                    forKey:@"name"];
+            [task setValue:[NSDate dateWithTimeIntervalSince1970:idx * 60]
+                    forKey:@"creationDate"];
+            [task setValue:[self insertProfileWithGroups:groups
+                                               inContext:managedObjectContext]
+                    forKey:@"assignee"];
+            
+            NSMutableSet *involvedPeople = [NSMutableSet set];
+            for (NSUInteger profileIdx = 0; profileIdx < kASDKTaskCacheMapperTestInvolvedPeopleCount; profileIdx++) {
+                [involvedPeople addObject:[self insertProfileWithGroups:groups
+                                                              inContext:managedObjectContext]];
+            }
+            [task setValue:involvedPeople
+                    forKey:@"involvedPeople"];
+        }
+        
+        NSError *error = nil;
+        [managedObjectContext save:&error];
+        XCTAssertNil(error);
+    }];
+}
+
+- (NSManagedObject *)insertProfileWithGroups:(NSArray *)groups
+                                   inContext:(NSManagedObjectContext *)managedObjectContext {
+    NSManagedObject *profile = [NSEntityDescription insertNewObjectForEntityForName:@"ASDKMOProfile"
+                                                             inManagedObjectContext:managedObjectContext];
+    [profile setValue:[NSUUID UUID].UUIDString
+               forKey:@"modelID"];
+    [profile setValue:@"John"
+               forKey:@"userFirstName"];
+    [profile setValue:@"Doe"
+               forKey:@"userLastName"];
+    [profile setValue:[NSSet setWithArray:groups]
+               forKey:@"groups"];
+    
+    return profile;
+}
+
+@end
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKPersistenceStack.h"
+#import "ASDKTaskCacheModelUpsert.h"
+#import "ASDKCacheModelBulkInsert.h"
+#import "ASDKMOTask.h"
+#import "ASDKMOProfile.h"
+
+static NSUInteger const kASDKTaskCacheModelBulkInsertTestTaskCount            = 5000;
+static NSUInteger const kASDKTaskCacheModelBulkInsertTestProfileCount         = 50;
+static NSUInteger const kASDKTaskCacheModelBulkInsertTestInvolvedPeopleCount  = 3;
+
+@interface ASDKTaskCacheModelBulkInsertTest : ASDKBaseTest
+
+@property (strong, nonatomic) NSPersistentContainer *persistentContainer;
+@property (strong, nonatomic) NSURL                 *storeURL;
+
+@end
+
+@implementation ASDKTaskCacheModelBulkInsertTest
+
+- (void)setUp {
+    [super setUp];
+    
+    // Batch insert requests are not supported by in-memory stores
+    NSURL *modelURL = [[NSBundle bundleForClass:[ASDKPersistenceStack class]] URLForResource:@"CacheServicesDataModel"
+                                                                               withExtension:@"momd"];
+    NSManagedObjectModel *managedObjectModel = [[NSManagedObjectModel alloc] initWithContentsOfURL:modelURL];
+    self.persistentContainer = [[NSPersistentContainer alloc] initWithName:NSStringFromClass([self class])
+                                                        managedObjectModel:managedObjectModel];
+    
+    self.storeURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:[[NSUUID UUID].UUIDString stringByAppendingPathExtension:@"sqlite"]];
+    NSPersistentStoreDescription *storeDescription = [NSPersistentStoreDescription persistentStoreDescriptionWithURL:self.storeURL];
+    storeDescription.type = NSSQLiteStoreType;
+    storeDescription.shouldAddStoreAsynchronously = NO;
+    self.persistentContainer.persistentStoreDescriptions = @[storeDescription];
+    [self.persistentContainer loadPersistentStoresWithCompletionHandler:^(NSPersistentStoreDescription *description, NSError *error) {
+        XCTAssertNil(error);
+    }];
+}
+
+- (void)tearDown {
+    [self.persistentContainer.persistentStoreCoordinator destroyPersistentStoreAtURL:self.storeURL
+                                                                            withType:NSSQLiteStoreType
+                                                                             options:nil
+                                                                               error:nil];
+    self.persistentContainer = nil;
+    
+    [super tearDown];
+}
+
+- (void)testThatBulkInsertWiresRelationshipsLikeTheRegularUpsert {
+    if (![ASDKCacheModelBulkInsert isBulkInsertAvailable]) {
+        return;
+    }
+    
+    // given
+    NSArray *taskList = [self taskListWithPrefix:@"bulk"];
+    NSManagedObjectContext *managedObjectContext = [self.persistentContainer newBackgroundContext];
+    
+    [managedObjectContext performBlockAndWait:^{
+        // when
+        NSError *error = nil;
+        NSArray *insertedObjectIDs = [ASDKTaskCacheModelUpsert bulkInsertTaskListToCache:taskList
+                                                                                   error:&error
+                                                                             inMOContext:managedObjectContext];
+        
+        // then
+        XCTAssertNil(error);
+        XCTAssertEqual(insertedObjectIDs.count, kASDKTaskCacheModelBulkInsertTestTaskCount + kASDKTaskCacheModelBulkInsertTestProfileCount);
+        XCTAssertEqual([managedObjectContext countForFetchRequest:[ASDKMOTask fetchRequest]
+                                                            error:&error], kASDKTaskCacheModelBulkInsertTestTaskCount);
+        XCTAssertEqual([managedObjectContext countForFetchRequest:[ASDKMOProfile fetchRequest]
+                                                            error:&error], kASDKTaskCacheModelBulkInsertTestProfileCount);
+        
+        ASDKModelTask *task = taskList.lastObject;
+        NSFetchRequest *fetchTaskRequest = [ASDKMOTask fetchRequest];
+        fetchTaskRequest.predicate = [NSPredicate predicateWithFormat:@"modelID == %@", task.modelID];
+        ASDKMOTask *moTask = [managedObjectContext executeFetchRequest:fetchTaskRequest
+                                                                 error:&error].firstObject;
+        XCTAssertEqualObjects(moTask.name, task.name);
+        XCTAssertNotNil(moTask.lastAccessDate);
+        XCTAssertEqualObjects(moTask.assignee.modelID, task.assigneeModel.modelID);
+        XCTAssertEqual(moTask.involvedPeople.count, kASDKTaskCacheModelBulkInsertTestInvolvedPeopleCount);
+    }];
+}
+
+- (void)testThatBulkInsertRoutesCachedTasksThroughTheRegularUpsert {
+    if (![ASDKCacheModelBulkInsert isBulkInsertAvailable]) {
+        return;
+    }
+    
+    // given
+    NSArray *taskList = [self taskListWithPrefix:@"bulk"];
+    NSManagedObjectContext *managedObjectContext = [self.persistentContainer newBackgroundContext];
+    
+    [managedObjectContext performBlockAndWait:^{
+        NSError *error = nil;
+        ASDKModelTask *cachedTask = taskList.firstObject;
+        [ASDKTaskCacheModelUpsert upsertTaskListToCache:@[cachedTask]
+                                                  error:&error
+                                            inMOContext:managedObjectContext];
+        [managedObjectContext save:&error];
+        XCTAssertNil(error);
+        
+        // when
+        cachedTask.name = @"Updated";
+        [ASDKTaskCacheModelUpsert bulkInsertTaskListToCache:taskList
+                                                      error:&error
+                                                inMOContext:managedObjectContext];
+        [managedObjectContext save:&error];
+        
+        // then
+        XCTAssertNil(error);
+        XCTAssertEqual([managedObjectContext countForFetchRequest:[ASDKMOTask fetchRequest]
+                                                            error:&error], kASDKTaskCacheModelBulkInsertTestTaskCount);
+        
+        NSFetchRequest *fetchTaskRequest = [ASDKMOTask fetchRequest];
+        fetchTaskRequest.predicate = [NSPredicate predicateWithFormat:@"modelID == %@", cachedTask.modelID];
+        ASDKMOTask *moTask = [managedObjectContext executeFetchRequest:fetchTaskRequest
+                                                                 error:&error].firstObject;
+        XCTAssertEqualObjects(moTask.name, @"Updated");
+    }];
+}
+
+- (void)testRegularUpsertFirstSyncPerformance {
+    [self measureFirstSyncUsingBulkInsert:NO];
+}
+
+- (void)testBulkInsertFirstSyncPerformance {
+    if (![ASDKCacheModelBulkInsert isBulkInsertAvailable]) {
+        return;
+    }
+    
+    [self measureFirstSyncUsingBulkInsert:YES];
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (void)measureFirstSyncUsingBulkInsert:(BOOL)usingBulkInsert {
+    __block NSUInteger iteration = 0;
+    
+    [self measureBlock:^{
+        // Every pass ingests rows that are not cached yet
+        NSArray *taskList = [self taskListWithPrefix:[NSString stringWithFormat:@"pass%lu", (unsigned long)iteration++]];
+        NSManagedObjectContext *managedObjectContext = [self.persistentContainer newBackgroundContext];
+        
+        [managedObjectContext performBlockAndWait:^{
+            NSError *error = nil;
+            if (usingBulkInsert) {
+                [ASDKTaskCacheModelUpsert bulkInsertTaskListToCache:taskList
+                                                              error:&error
+                                                        inMOContext:managedObjectContext];
+            } else {
+                [ASDKTaskCacheModelUpsert upsertTaskListToCache:taskList
+                                                          error:&error
+                                                    inMOContext:managedObjectContext];
+            }
+            [managedObjectContext save:&error];
+            XCTAssertNil(error);
+        }];
+    }];
+}
+
+- (NSArray *)taskListWithPrefix:(NSString *)prefix {
+    NSMutableArray *profileList = [NSMutableArray array];
+    for (NSUInteger idx = 0; idx < kASDKTaskCacheModelBulkInsertTestProfileCount; idx++) {
+        ASDKModelProfile *profile = [ASDKModelProfile new];
+        profile.modelID = [NSString stringWithFormat:@"%@-profile%lu", prefix, (unsigned long)idx];
+        profile.userFirstName = @"John";
+        profile.userLastName = @"Doe";
+        [profileList addObject:profile];
+    }
+    
+    NSMutableArray *taskList = [NSMutableArray array];
+    for (NSUInteger idx = 0; idx < kASDKTaskCacheModelBulkInsertTestTaskCount; idx++) {
+        ASDKModelTask *task = [ASDKModelTask new];
+        task.modelID = [NSString stringWithFormat:@"%@-task%lu", prefix, (unsigned long)idx];
+        task.name = [NSString stringWithFormat:@"Task %lu", (unsigned long)idx];
+        task.creationDate = [NSDate dateWithTimeIntervalSince1970:idx * 60];
+        task.assigneeModel = profileList[idx % kASDKTaskCacheModelBulkInsertTestProfileCount];
+        
+        NSMutableArray *involvedPeople = [NSMutableArray array];
+        for (NSUInteger profileIdx = 1; profileIdx <= kASDKTaskCacheModelBulkInsertTestInvolvedPeopleCount; profileIdx++) {
+            [involvedPeople addObject:profileList[(idx + profileIdx) % kASDKTaskCacheModelBulkInsertTestProfileCount]];
+        }
+        task.involvedPeople = involvedPeople;
+        
+        [taskList addObject:task];
+    }
+    
+    return taskList;
+}
+
+@end
@@ -0,0 +1,429 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile SDK.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "ASDKBaseTest.h"
+#import "ASDKTaskListDeltaSynchronizer.h"
+#import "ASDKTaskNetworkServiceProtocol.h"
+#import "ASDKTaskCacheService.h"
+#import "ASDKPersistenceStack.h"
+
+static NSUInteger const kASDKTaskListDeltaSynchronizerTestServerTaskCount   = 100;
+static NSInteger const kASDKTaskListDeltaSynchronizerTestPageSize           = 10;
+
+@interface ASDKTaskListDeltaSynchronizerTest : ASDKBaseTest
+
+// Local server stand-in holding the task list sorted by creation date in descending order
+@property (strong, nonatomic) id                    taskNetworkServiceMock;
+@property (strong, nonatomic) NSMutableArray        *serverTasks;
+@property (assign, nonatomic) NSUInteger            serverTaskCounter;
+@property (assign, nonatomic) NSUInteger            fetchedPageCount;
+
+// Cache stand-in for the persistent task filter map
+@property (strong, nonatomic) id                    taskCacheServiceMock;
+@property (strong, nonatomic) NSMutableDictionary   *cachedTasks;
+@property (strong, nonatomic) NSDate                *highWaterMarkDate;
+@property (strong, nonatomic) NSDate                *reconciliationDate;
+@property (assign, nonatomic) NSUInteger            fullRefreshCount;
+@property (assign, nonatomic) NSUInteger            deltaTaskCount;
+
+@property (strong, nonatomic) ASDKTaskListDeltaSynchronizer *taskListSynchronizer;
+
+// Persistent store used by the tests exercising the Core Data backed cache service
+@property (strong, nonatomic) ASDKModelServerConfiguration  *serverConfiguration;
+@property (strong, nonatomic) ASDKPersistenceStack          *persistenceStack;
+
+@end
+
+@implementation ASDKTaskListDeltaSynchronizerTest
+
+- (void)setUp {
+    [super setUp];
+    
+    self.serverTasks = [NSMutableArray array];
+    self.cachedTasks = [NSMutableDictionary dictionary];
+    [self createServerTasks:kASDKTaskListDeltaSynchronizerTestServerTaskCount];
+    
+    [self setUpTaskNetworkServiceMock];
+    [self setUpTaskCacheServiceMock];
+    
+    self.taskListSynchronizer = [[ASDKTaskListDeltaSynchronizer alloc] initWithTaskNetworkService:self.taskNetworkServiceMock
+                                                                                 taskCacheService:self.taskCacheServiceMock];
+}
+
+- (void)tearDown {
+    self.taskListSynchronizer = nil;
+    
+    if (self.persistenceStack) {
+        [[ASDKBootstrap sharedInstance].serviceLocator removeServiceConformingToProtocol:@protocol(ASDKPersistenceStackProtocol)];
+        [self waitForWriteTasks];
+        self.persistenceStack = nil;
+        [self removePersistentStore];
+    }
+    
+    [super tearDown];
+}
+
+- (void)testThatItOnlyDownloadsTasksCreatedAfterTheHighWaterMark {
+    // given
+    [self synchronizeTaskList];
+    XCTAssertEqual(self.fullRefreshCount, 1);
+    
+    self.fetchedPageCount = 0;
+    [self createServerTasks:3];
+    
+    // when
+    NSArray *taskList = [self synchronizeTaskList];
+    
+    // then
+    XCTAssertEqual(self.fullRefreshCount, 1);
+    XCTAssertEqual(self.fetchedPageCount, 1);
+    XCTAssertEqual((NSInteger)self.cachedTasks.count, kASDKTaskListDeltaSynchronizerTestPageSize + 3);
+    XCTAssertEqualObjects([taskList valueForKey:@"modelID"], [self serverTaskIDsForFirstPage]);
+}
+
+- (void)testThatItDropsTasksThatLeftTheListInsideTheDeltaWindow {
+    // given
+    [self synchronizeTaskList];
+    
+    ASDKModelTask *completedTask = self.serverTasks[2];
+    ASDKModelTask *reassignedTask = self.serverTasks[5];
+    [self.serverTasks removeObject:completedTask];
+    [self.serverTasks removeObject:reassignedTask];
+    [self createServerTasks:1];
+    
+    // when
+    NSArray *taskList = [self synchronizeTaskList];
+    
+    // then
+    XCTAssertEqual(self.fullRefreshCount, 1);
+    XCTAssertNil(self.cachedTasks[completedTask.modelID]);
+    XCTAssertNil(self.cachedTasks[reassignedTask.modelID]);
+    XCTAssertEqualObjects([taskList valueForKey:@"modelID"], [self serverTaskIDsForFirstPage]);
+}
+
+- (void)testThatItAppliesRandomizedChurnIncrementally {
+    // given
+    [self synchronizeTaskList];
+    
+    for (NSUInteger iteration = 0; iteration < 20; iteration++) {
+        [self createServerTasks:arc4random_uniform(2 * kASDKTaskListDeltaSynchronizerTestPageSize)];
+        
+        NSUInteger removedTaskCount = arc4random_uniform(3);
+        for (NSUInteger idx = 0; idx < removedTaskCount; idx++) {
+            [self.serverTasks removeObjectAtIndex:arc4random_uniform(kASDKTaskListDeltaSynchronizerTestPageSize)];
+        }
+        
+        // when
+        NSArray *taskList = [self synchronizeTaskList];
+        
+        // then
+        XCTAssertEqual(self.fullRefreshCount, 1);
+        XCTAssertEqualObjects([taskList valueForKey:@"modelID"], [self serverTaskIDsForFirstPage]);
+    }
+}
+
+- (void)testThatItPerformsAFullRefreshWhenTheReconciliationIntervalElapses {
+    // given
+    [self synchronizeTaskList];
+    self.taskListSynchronizer.reconciliationInterval = 0;
+    [self createServerTasks:1];
+    
+    // when
+    [self synchronizeTaskList];
+    
+    // then
+    XCTAssertEqual(self.fullRefreshCount, 2);
+    XCTAssertEqual(self.deltaTaskCount, 0);
+}
+
+- (void)testThatItPerformsAFullRefreshWhenTooManyTasksChanged {
+    // given
+    [self synchronizeTaskList];
+    self.taskListSynchronizer.maxDeltaPageCount = 2;
+    [self createServerTasks:3 * kASDKTaskListDeltaSynchronizerTestPageSize];
+    self.fetchedPageCount = 0;
+    
+    // when
+    NSArray *taskList = [self synchronizeTaskList];
+    
+    // then
+    XCTAssertEqual(self.fullRefreshCount, 2);
+    XCTAssertEqual(self.fetchedPageCount, 3);
+    XCTAssertEqualObjects([taskList valueForKey:@"modelID"], [self serverTaskIDsForFirstPage]);
+}
+
+- (void)testThatTheDeltaIsReadBackFromAPersistentStoreWhenSavesAreDeferred {
+    // given
+    ASDKTaskCacheService *taskCacheService = [self persistentTaskCacheService];
+    taskCacheService.defersSavesUntilSaveChanges = YES;
+    self.taskListSynchronizer = [[ASDKTaskListDeltaSynchronizer alloc] initWithTaskNetworkService:self.taskNetworkServiceMock
+                                                                                 taskCacheService:taskCacheService];
+    
+    // Mirror the task data accessor which commits the operation chain once it completes
+    [self synchronizeTaskList];
+    [taskCacheService saveChanges];
+    [self waitForWriteTasks];
+    
+    ASDKModelTask *completedTask = self.serverTasks[2];
+    [self.serverTasks removeObject:completedTask];
+    [self createServerTasks:3];
+    self.fetchedPageCount = 0;
+    
+    // when
+    NSArray *taskList = [self synchronizeTaskList];
+    
+    // then
+    XCTAssertEqual(self.fetchedPageCount, 1);
+    XCTAssertFalse([[taskList valueForKey:@"modelID"] containsObject:completedTask.modelID]);
+    XCTAssertEqualObjects([taskList valueForKey:@"modelID"], [self serverTaskIDsForFirstPage]);
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (ASDKTaskCacheService *)persistentTaskCacheService {
+    // Use a dedicated store for each test run
+    self.serverConfiguration = [ASDKModelServerConfiguration new];
+    self.serverConfiguration.hostAddressString = [NSUUID UUID].UUIDString;
+    self.serverConfiguration.username = @"test";
+    self.serverConfiguration.serviceDocument = @"activiti-app";
+    
+    self.persistenceStack = [[ASDKPersistenceStack alloc] initWithServerConfiguration:self.serverConfiguration
+                                                                         errorHandler:^(NSError *error) {
+                                                                             XCTAssertNil(error);
+                                                                         }];
+    [[ASDKBootstrap sharedInstance].serviceLocator addService:self.persistenceStack];
+    [self waitForWriteTasks];
+    
+    return [ASDKTaskCacheService new];
+}
+
+- (void)waitForWriteTasks {
+    // Write tasks are serialized so this one runs after the ones already submitted
+    XCTestExpectation *writeTasksExpectation = [self expectationWithDescription:NSStringFromSelector(_cmd)];
+    [self.persistenceStack performWriteTask:^(NSManagedObjectContext *managedObjectContext) {
+        [writeTasksExpectation fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:30.0f
+                                 handler:nil];
+}
+
+- (void)removePersistentStore {
+    NSString *storeName = [ASDKPersistenceStack persistenceStackModelNameForServerConfiguration:self.serverConfiguration];
+    NSURL *storeURL = [[NSPersistentContainer defaultDirectoryURL] URLByAppendingPathComponent:[storeName stringByAppendingPathExtension:@"sqlite"]];
+    
+    for (NSString *suffix in @[@"", @"-shm", @"-wal"]) {
+        NSURL *fileURL = [NSURL fileURLWithPath:[storeURL.path stringByAppendingString:suffix]];
+        [[NSFileManager defaultManager] removeItemAtURL:fileURL
+                                                  error:nil];
+    }
+}
+
+- (ASDKFilterRequestRepresentation *)filter {
+    ASDKModelFilter *modelFilter = [ASDKModelFilter new];
+    modelFilter.sortType = ASDKModelFilterSortTypeCreatedDesc;
+    modelFilter.state = ASDKModelFilterStateTypeActive;
+    modelFilter.assignmentType = ASDKModelFilterAssignmentTypeInvolved;
+    
+    ASDKFilterRequestRepresentation *filter = [ASDKFilterRequestRepresentation new];
+    filter.appDefinitionID = @"1";
+    filter.filterModel = modelFilter;
+    filter.page = 0;
+    filter.size = kASDKTaskListDeltaSynchronizerTestPageSize;
+    
+    return filter;
+}
+
+- (NSArray *)synchronizeTaskList {
+    __block NSArray *synchronizedTaskList = nil;
+    
+    // expect
+    XCTestExpectation *synchronizationExpectation = [self expectationWithDescription:NSStringFromSelector(_cmd)];
+    
+    [self.taskListSynchronizer synchronizeTaskListWithFilter:[self filter]
+                                             completionBlock:^(NSArray *taskList, ASDKModelPaging *paging, NSError *error) {
+                                                 XCTAssertNil(error);
+                                                 XCTAssertEqual((NSUInteger)paging.total, self.serverTasks.count);
+                                                 
+                                                 synchronizedTaskList = taskList;
+                                                 [synchronizationExpectation fulfill];
+                                             }];
+    
+    [self waitForExpectationsWithTimeout:5.0f
+                                 handler:nil];
+    
+    return synchronizedTaskList;
+}
+
+- (void)createServerTasks:(NSUInteger)taskCount {
+    for (NSUInteger idx = 0; idx < taskCount; idx++) {
+        self.serverTaskCounter++;
+        
+        ASDKModelTask *task = [ASDKModelTask new];
+        task.modelID = [NSString stringWithFormat:@"%lu", (unsigned long)self.serverTaskCounter];
+        task.name = [NSString stringWithFormat:@"Task %lu", (unsigned long)self.serverTaskCounter];
+        task.creationDate = [NSDate dateWithTimeIntervalSince1970:self.serverTaskCounter * 60];
+        [self.serverTasks insertObject:task
+                               atIndex:0];
+    }
+}
+
+- (NSArray *)serverTaskIDsForFirstPage {
+    NSUInteger length = MIN(self.serverTasks.count, kASDKTaskListDeltaSynchronizerTestPageSize);
+    return [[self.serverTasks subarrayWithRange:NSMakeRange(0, length)] valueForKey:@"modelID"];
+}
+
+- (NSArray *)cachedTasksSortedByCreationDate {
+    return [self.cachedTasks.allValues sortedArrayUsingDescriptors:@[[NSSortDescriptor sortDescriptorWithKey:@"creationDate"
+                                                                                                   ascending:NO]]];
+}
+
+- (void)setUpTaskNetworkServiceMock {
+    self.taskNetworkServiceMock = OCMProtocolMock(@protocol(ASDKTaskNetworkServiceProtocol));
+    
+    __weak typeof(self) weakSelf = self;
+    OCMStub([self.taskNetworkServiceMock fetchTaskListWithFilterRepresentation:OCMOCK_ANY
+                                                              completionBlock:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained ASDKFilterRequestRepresentation *filter;
+        __unsafe_unretained ASDKTaskListCompletionBlock completionBlock;
+        [invocation getArgument:&filter
+                        atIndex:2];
+        [invocation getArgument:&completionBlock
+                        atIndex:3];
+        
+        strongSelf.fetchedPageCount++;
+        
+        NSInteger start = filter.page * filter.size;
+        NSInteger length = MAX(0, MIN((NSInteger)strongSelf.serverTasks.count - start, filter.size));
+        NSArray *taskList = [strongSelf.serverTasks subarrayWithRange:NSMakeRange(start, length)];
+        
+        ASDKModelPaging *paging = [ASDKModelPaging new];
+        paging.start = start;
+        paging.size = length;
+        paging.total = strongSelf.serverTasks.count;
+        
+        completionBlock(taskList, nil, paging);
+    });
+}
+
+- (void)setUpTaskCacheServiceMock {
+    self.taskCacheServiceMock = OCMProtocolMock(@protocol(ASDKTaskCacheServiceProtocol));
+    
+    __weak typeof(self) weakSelf = self;
+    OCMStub([self.taskCacheServiceMock cacheTaskList:OCMOCK_ANY
+                                         usingFilter:OCMOCK_ANY
+                                 withCompletionBlock:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained NSArray *taskList;
+        __unsafe_unretained ASDKCacheServiceCompletionBlock completionBlock;
+        [invocation getArgument:&taskList
+                        atIndex:2];
+        [invocation getArgument:&completionBlock
+                        atIndex:4];
+        
+        // Rebuild the first page and reset the synchronization state
+        strongSelf.fullRefreshCount++;
+        [strongSelf.cachedTasks removeAllObjects];
+        for (ASDKModelTask *task in taskList) {
+            strongSelf.cachedTasks[task.modelID] = task;
+        }
+        strongSelf.highWaterMarkDate = [taskList valueForKeyPath:@"@max.creationDate"];
+        strongSelf.reconciliationDate = [NSDate date];
+        
+        completionBlock(nil);
+    });
+    
+    OCMStub([self.taskCacheServiceMock fetchTaskListSyncStateUsingFilter:OCMOCK_ANY
+                                                     withCompletionBlock:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained ASDKCacheServiceTaskListSyncStateCompletionBlock completionBlock;
+        [invocation getArgument:&completionBlock
+                        atIndex:3];
+        
+        completionBlock(strongSelf.highWaterMarkDate, strongSelf.reconciliationDate, nil);
+    });
+    
+    OCMStub([self.taskCacheServiceMock applyTaskListDelta:OCMOCK_ANY
+                                              usingFilter:OCMOCK_ANY
+                                          windowStartDate:OCMOCK_ANY
+                                      withCompletionBlock:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained NSArray *taskList;
+        __unsafe_unretained NSDate *windowStartDate;
+        __unsafe_unretained ASDKCacheServiceCompletionBlock completionBlock;
+        [invocation getArgument:&taskList
+                        atIndex:2];
+        [invocation getArgument:&windowStartDate
+                        atIndex:4];
+        [invocation getArgument:&completionBlock
+                        atIndex:5];
+        
+        strongSelf.deltaTaskCount += taskList.count;
+        
+        // Drop cached members inside the window that are missing from the delta
+        NSSet *deltaTaskIDs = [NSSet setWithArray:[taskList valueForKey:@"modelID"]];
+        for (ASDKModelTask *cachedTask in strongSelf.cachedTasks.allValues) {
+            BOOL isInsideWindow = !windowStartDate || NSOrderedDescending == [cachedTask.creationDate compare:windowStartDate];
+            if (isInsideWindow && ![deltaTaskIDs containsObject:cachedTask.modelID]) {
+                [strongSelf.cachedTasks removeObjectForKey:cachedTask.modelID];
+            }
+        }
+        
+        for (ASDKModelTask *task in taskList) {
+            strongSelf.cachedTasks[task.modelID] = task;
+        }
+        
+        NSDate *newestCreationDate = [taskList valueForKeyPath:@"@max.creationDate"];
+        if (newestCreationDate) {
+            strongSelf.highWaterMarkDate = newestCreationDate;
+        }
+        
+        completionBlock(nil);
+    });
+    
+    OCMStub([self.taskCacheServiceMock fetchTaskList:OCMOCK_ANY
+                                         usingFilter:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        __unsafe_unretained ASDKCacheServiceTaskListCompletionBlock completionBlock;
+        __unsafe_unretained ASDKFilterRequestRepresentation *filter;
+        [invocation getArgument:&completionBlock
+                        atIndex:2];
+        [invocation getArgument:&filter
+                        atIndex:3];
+        
+        NSArray *cachedTasks = [strongSelf cachedTasksSortedByCreationDate];
+        NSInteger length = MIN((NSInteger)cachedTasks.count, filter.size);
+        
+        ASDKModelPaging *paging = [ASDKModelPaging new];
+        paging.start = 0;
+        paging.size = length;
+        paging.total = cachedTasks.count;
+        
+        completionBlock([cachedTasks subarrayWithRange:NSMakeRange(0, length)], nil, paging);
+    });
+}
+
+@end
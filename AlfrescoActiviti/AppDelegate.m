@@ -28,6 +28,7 @@
 // Managers
 #import "AFAServiceRepository.h"
 #import "AFAThumbnailManager.h"
+#import "AFAAvatarCache.h"
 #import "AFAKeychainWrapper.h"
 #import "AFALogFormatter.h"
 
@@ -118,6 +119,9 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
     // Clean up image cache
     AFAThumbnailManager *thumbnailsManager = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeThumbnailManager];
     [thumbnailsManager cleanupMemoryCache];
+    
+    AFAAvatarCache *avatarCache = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeAvatarCache];
+    [avatarCache cleanupMemoryCache];
 }
 
 - (void)applicationDidBecomeActive:(UIApplication *)application {
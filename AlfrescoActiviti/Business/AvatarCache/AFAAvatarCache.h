@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <UIKit/UIKit.h>
+
+typedef void (^AFAAvatarCacheCompletionBlock)(UIImage *avatarImage, NSError *error);
+
+/**
+ *  Cache of user avatars keyed by user ID and scoped by the server that is signed in.
+ *  Images are kept in memory and on disk already decoded and scaled to the size they
+ *  are displayed at, so that list cells can show them without any further processing.
+ *  Disk cached avatars expire after a day so that changed pictures are picked up.
+ *  Concurrent requests for the same user share a single download.
+ *  The public interface is meant to be used from the main thread and completion
+ *  blocks are delivered on the main queue.
+ */
+@interface AFAAvatarCache : NSObject
+
+/**
+ *  ID of the signed in user. Avatar requests for this ID share the cache entries of
+ *  the current user's profile picture.
+ */
+@property (strong, nonatomic, readonly) NSString *currentUserID;
+
+/**
+ *  Maximum number of bytes the disk cached avatars of all servers are allowed to take.
+ *  When the budget is exceeded the least recently accessed avatars are evicted first.
+ *  Defaults to 10MB.
+ */
+@property (assign, nonatomic) unsigned long long diskCacheBudget;
+
+/**
+ *  Records the signed in user of the current server. When a different user signs in to
+ *  the server or the user's picture ID changed, the cached profile picture is dropped.
+ *
+ *  @param userID    ID of the signed in user
+ *  @param pictureID ID of the user's profile picture or nil if there is none
+ */
+- (void)updateCurrentUserWithID:(NSString *)userID
+                      pictureID:(NSString *)pictureID;
+
+/**
+ *  Returns a local placeholder image to be displayed until an avatar is available
+ *
+ *  @return     Local placeholder image
+ */
+- (UIImage *)placeholderAvatarImage;
+
+/**
+ *  Returns the in-memory cached avatar of the specified user at the specified size.
+ *  Neither the disk cache or the network are consulted.
+ *
+ *  @param userID     ID of the user for which the avatar is requested
+ *  @param avatarSize Maximum width and height in pixels of the avatar. Remember to pass
+ *                    the size with consideration to the screen scale
+ *
+ *  @return           Cached avatar or nil
+ */
+- (UIImage *)cachedAvatarForUserID:(NSString *)userID
+                          withSize:(CGFloat)avatarSize;
+
+/**
+ *  Looks up the avatar of the specified user in memory, then on disk and lastly
+ *  downloads it. In-memory hits are returned synchronously.
+ *
+ *  @param userID          ID of the user for which the avatar is requested
+ *  @param avatarSize      Maximum width and height in pixels of the avatar
+ *  @param completionBlock Completion block providing the scaled avatar and an optional
+ *                         error reason
+ */
+- (void)avatarForUserID:(NSString *)userID
+               withSize:(CGFloat)avatarSize
+        completionBlock:(AFAAvatarCacheCompletionBlock)completionBlock;
+
+/**
+ *  Same as the user ID based variant but for the signed in user's profile picture.
+ *
+ *  @param avatarSize      Maximum width and height in pixels of the avatar
+ *  @param completionBlock Completion block providing the scaled avatar and an optional
+ *                         error reason
+ */
+- (void)currentUserAvatarWithSize:(CGFloat)avatarSize
+                  completionBlock:(AFAAvatarCacheCompletionBlock)completionBlock;
+
+/**
+ *  Removes the cached avatars of the specified user from memory and disk. Downloads
+ *  in flight for the user won't be cached once they complete.
+ *
+ *  @param userID ID of the user whose avatar changed
+ */
+- (void)invalidateAvatarForUserID:(NSString *)userID;
+
+/**
+ *  Removes the cached avatars of the signed in user, typically after a new profile
+ *  picture was uploaded.
+ */
+- (void)invalidateCurrentUserAvatar;
+
+/**
+ *  Cleans the avatar images stored in memory
+ */
+- (void)cleanupMemoryCache;
+
+@end
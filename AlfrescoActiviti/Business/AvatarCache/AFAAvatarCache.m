@@ -0,0 +1,726 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "AFAAvatarCache.h"
+#import <CommonCrypto/CommonDigest.h>
+@import ActivitiSDK;
+
+// Categories
+#import "UIImage+AFAThumbnailCreation.h"
+
+// Configurations
+#import "AFALogConfiguration.h"
+
+// Managers
+#import "AFAUserServices.h"
+#import "AFAProfileServices.h"
+
+static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRACE;
+static NSString * const kAFAAvatarCacheDirectoryName = @"Avatars";
+static NSString * const kAFAAvatarCacheCurrentUserKey = @"currentUser";
+static NSString * const kAFAAvatarCacheLastCurrentUserKey = @"AFAAvatarCacheLastCurrentUser";
+static NSString * const kAFAAvatarCacheUserIDKey = @"userID";
+static NSString * const kAFAAvatarCachePictureIDKey = @"pictureID";
+static NSString * const kAFAAvatarCachePNGPathExtension = @"png";
+static NSString * const kAFAAvatarCacheJPEGPathExtension = @"jpg";
+static const CGFloat kAFAAvatarCacheJPEGCompressionQuality = .8f;
+static const NSTimeInterval kAFAAvatarCacheFailedDownloadRetryInterval = 60.0f;
+static const NSTimeInterval kAFAAvatarCacheDiskMaxAge = 24 * 60 * 60;
+static const unsigned long long kAFAAvatarCacheDefaultDiskCacheBudget = 10 * 1024 * 1024;
+
+@interface AFAAvatarCacheRequest : NSObject
+
+@property (assign, nonatomic) NSUInteger                    avatarSize;
+@property (copy, nonatomic) AFAAvatarCacheCompletionBlock   completionBlock;
+
+@end
+
+@implementation AFAAvatarCacheRequest
+@end
+
+@interface AFAAvatarCacheDownload : NSObject
+
+// Service instance performing the download. Every download gets its own instance
+// because services only keep track of the last requested completion block.
+@property (strong, nonatomic) id                            service;
+@property (strong, nonatomic) NSMutableArray                *requests;
+@property (strong, nonatomic) NSDate                        *failureDate;
+@property (strong, nonatomic) NSError                       *error;
+
+@end
+
+@implementation AFAAvatarCacheDownload
+@end
+
+@interface AFAAvatarCacheDiskCacheEntry : NSObject
+
+@property (assign, nonatomic) unsigned long long    fileSize;
+@property (strong, nonatomic) NSDate                *creationDate;
+@property (strong, nonatomic) NSDate                *accessDate;
+
+@end
+
+@implementation AFAAvatarCacheDiskCacheEntry
+@end
+
+@interface AFAAvatarCache ()
+
+@property (strong, nonatomic) NSCache               *memoryCache;
+@property (strong, nonatomic) dispatch_queue_t      imageProcessingQueue;
+@property (strong, nonatomic) dispatch_queue_t      ioProcessingQueue;
+@property (strong, nonatomic) UIImage               *placeholderAvatarImage;
+// Downloads in flight keyed by avatar key. Requests for an avatar that is already
+// being downloaded are attached to the existing download.
+@property (strong, nonatomic) NSMutableDictionary   *pendingDownloads;
+// Recently failed downloads keyed by avatar key. Users without a profile picture
+// are not requested again until the retry interval elapses.
+@property (strong, nonatomic) NSMutableDictionary   *failedDownloads;
+// Sizes stored in memory for each avatar key so that they can be evicted on
+// invalidation, NSCache doesn't allow enumerating its keys
+@property (strong, nonatomic) NSMutableDictionary   *memoryCacheSizes;
+// Incremented on every invalidation so that disk reads and downloads started
+// before it don't repopulate the cache with the outdated image
+@property (strong, nonatomic) NSMutableDictionary   *cacheGenerations;
+@property (assign, nonatomic) NSUInteger            lastCacheGeneration;
+// Generation at which the server scope last changed. It applies to every avatar
+// key because user IDs are only unique within a server.
+@property (assign, nonatomic) NSUInteger            serverScopeCacheGeneration;
+// Host and port of the server the cached avatars belong to
+@property (strong, nonatomic) NSString              *serverScope;
+// Index of the avatars on disk keyed by their path relative to the avatar cache
+// directory. It is built once at start-up and only accessed from the IO processing queue.
+@property (strong, nonatomic) NSMutableDictionary   *diskCacheIndex;
+@property (assign, nonatomic) unsigned long long    diskCacheSize;
+
+@end
+
+@implementation AFAAvatarCache
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _memoryCache = [[NSCache alloc] init];
+        _memoryCache.name = [NSString stringWithFormat:@"%@.avatarCache", [NSBundle mainBundle].bundleIdentifier];
+        _imageProcessingQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.avatarProcessingQueue", [NSBundle mainBundle].bundleIdentifier] UTF8String], DISPATCH_QUEUE_SERIAL);
+        _ioProcessingQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.avatarIOProcessingQueue", [NSBundle mainBundle].bundleIdentifier] UTF8String], DISPATCH_QUEUE_SERIAL);
+        _placeholderAvatarImage = [UIImage imageNamed:@"image-placeholder-icon"];
+        _pendingDownloads = [NSMutableDictionary dictionary];
+        _failedDownloads = [NSMutableDictionary dictionary];
+        _memoryCacheSizes = [NSMutableDictionary dictionary];
+        _cacheGenerations = [NSMutableDictionary dictionary];
+        _diskCacheIndex = [NSMutableDictionary dictionary];
+        _diskCacheBudget = kAFAAvatarCacheDefaultDiskCacheBudget;
+        
+        __weak typeof(self) weakSelf = self;
+        dispatch_async(_ioProcessingQueue, ^{
+            __strong typeof(self) strongSelf = weakSelf;
+            [strongSelf buildDiskCacheIndex];
+        });
+        
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(cleanupMemoryCache)
+                                                     name:UIApplicationDidReceiveMemoryWarningNotification
+                                                   object:nil];
+    }
+    
+    return self;
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (void)updateCurrentUserWithID:(NSString *)userID
+                      pictureID:(NSString *)pictureID {
+    [self updateServerScopeIfNeeded];
+    
+    if (!userID) {
+        return;
+    }
+    
+    _currentUserID = userID;
+    
+    // The current user's profile picture is cached under a reserved key, so it has
+    // to be dropped when somebody else signs in to the same server or the picture
+    // was changed, possibly from another device
+    NSUserDefaults *userDefaults = [NSUserDefaults standardUserDefaults];
+    NSString *lastCurrentUserDefaultsKey = [self lastCurrentUserDefaultsKeyForServerScope:self.serverScope];
+    NSDictionary *lastCurrentUser = [userDefaults objectForKey:lastCurrentUserDefaultsKey];
+    NSString *lastCurrentUserID = lastCurrentUser[kAFAAvatarCacheUserIDKey];
+    NSString *lastPictureID = lastCurrentUser[kAFAAvatarCachePictureIDKey];
+    
+    BOOL isSamePicture = (lastPictureID == pictureID || [lastPictureID isEqualToString:pictureID]);
+    if (![lastCurrentUserID isEqualToString:userID] || !isSamePicture) {
+        if (lastCurrentUser) {
+            [self invalidateCurrentUserAvatar];
+        }
+        
+        NSMutableDictionary *currentUser = [NSMutableDictionary dictionaryWithObject:userID
+                                                                              forKey:kAFAAvatarCacheUserIDKey];
+        currentUser[kAFAAvatarCachePictureIDKey] = pictureID;
+        [userDefaults setObject:currentUser
+                         forKey:lastCurrentUserDefaultsKey];
+    }
+}
+
+- (UIImage *)cachedAvatarForUserID:(NSString *)userID
+                          withSize:(CGFloat)avatarSize {
+    [self updateServerScopeIfNeeded];
+    
+    NSString *avatarKey = [self avatarKeyForUserID:userID];
+    if (!avatarKey) {
+        return nil;
+    }
+    
+    return [self.memoryCache objectForKey:[self memoryCacheKeyForAvatarKey:avatarKey
+                                                                  withSize:[self pixelSizeForAvatarSize:avatarSize]]];
+}
+
+- (void)avatarForUserID:(NSString *)userID
+               withSize:(CGFloat)avatarSize
+        completionBlock:(AFAAvatarCacheCompletionBlock)completionBlock {
+    NSParameterAssert(completionBlock);
+    
+    [self updateServerScopeIfNeeded];
+    
+    NSString *avatarKey = [self avatarKeyForUserID:userID];
+    if (!avatarKey) {
+        completionBlock(nil, nil);
+        return;
+    }
+    
+    [self avatarForKey:avatarKey
+              withSize:[self pixelSizeForAvatarSize:avatarSize]
+       completionBlock:completionBlock];
+}
+
+- (void)currentUserAvatarWithSize:(CGFloat)avatarSize
+                  completionBlock:(AFAAvatarCacheCompletionBlock)completionBlock {
+    NSParameterAssert(completionBlock);
+    
+    [self updateServerScopeIfNeeded];
+    
+    [self avatarForKey:kAFAAvatarCacheCurrentUserKey
+              withSize:[self pixelSizeForAvatarSize:avatarSize]
+       completionBlock:completionBlock];
+}
+
+- (void)invalidateAvatarForUserID:(NSString *)userID {
+    [self updateServerScopeIfNeeded];
+    
+    NSString *avatarKey = [self avatarKeyForUserID:userID];
+    if (avatarKey) {
+        [self invalidateAvatarForKey:avatarKey];
+    }
+}
+
+- (void)invalidateCurrentUserAvatar {
+    [self updateServerScopeIfNeeded];
+    
+    [self invalidateAvatarForKey:kAFAAvatarCacheCurrentUserKey];
+}
+
+- (void)cleanupMemoryCache {
+    [self.memoryCache removeAllObjects];
+    [self.memoryCacheSizes removeAllObjects];
+}
+
+- (void)setDiskCacheBudget:(unsigned long long)diskCacheBudget {
+    _diskCacheBudget = diskCacheBudget;
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.ioProcessingQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        [strongSelf trimDiskCacheToBudget];
+    });
+}
+
+
+#pragma mark -
+#pragma mark Private interface
+
+- (void)avatarForKey:(NSString *)avatarKey
+            withSize:(NSUInteger)avatarSize
+     completionBlock:(AFAAvatarCacheCompletionBlock)completionBlock {
+    UIImage *cachedAvatar = [self.memoryCache objectForKey:[self memoryCacheKeyForAvatarKey:avatarKey
+                                                                                   withSize:avatarSize]];
+    if (cachedAvatar) {
+        completionBlock(cachedAvatar, nil);
+        return;
+    }
+    
+    // Look into the disk cache before downloading the avatar
+    NSUInteger cacheGeneration = [self cacheGenerationForAvatarKey:avatarKey];
+    NSString *avatarDirectoryName = [self avatarDirectoryNameForKey:avatarKey];
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.ioProcessingQueue, ^{
+        UIImage *diskAvatar = [weakSelf diskCachedAvatarInDirectory:avatarDirectoryName
+                                                           withSize:avatarSize];
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            __strong typeof(self) strongSelf = weakSelf;
+            
+            if (diskAvatar &&
+                cacheGeneration == [strongSelf cacheGenerationForAvatarKey:avatarKey]) {
+                [strongSelf storeAvatar:diskAvatar
+                                 forKey:avatarKey
+                               withSize:avatarSize];
+                completionBlock(diskAvatar, nil);
+            } else {
+                [strongSelf downloadAvatarForKey:avatarKey
+                                        withSize:avatarSize
+                                 completionBlock:completionBlock];
+            }
+        });
+    });
+}
+
+- (void)downloadAvatarForKey:(NSString *)avatarKey
+                    withSize:(NSUInteger)avatarSize
+             completionBlock:(AFAAvatarCacheCompletionBlock)completionBlock {
+    AFAAvatarCacheDownload *failedDownload = self.failedDownloads[avatarKey];
+    if (failedDownload) {
+        if ([[NSDate date] timeIntervalSinceDate:failedDownload.failureDate] < kAFAAvatarCacheFailedDownloadRetryInterval) {
+            completionBlock(nil, failedDownload.error);
+            return;
+        }
+        
+        [self.failedDownloads removeObjectForKey:avatarKey];
+    }
+    
+    AFAAvatarCacheRequest *request = [AFAAvatarCacheRequest new];
+    request.avatarSize = avatarSize;
+    request.completionBlock = completionBlock;
+    
+    AFAAvatarCacheDownload *download = self.pendingDownloads[avatarKey];
+    if (download) {
+        [download.requests addObject:request];
+        return;
+    }
+    
+    download = [AFAAvatarCacheDownload new];
+    download.requests = [NSMutableArray arrayWithObject:request];
+    self.pendingDownloads[avatarKey] = download;
+    
+    __weak typeof(self) weakSelf = self;
+    AFAUserPictureCompletionBlock downloadCompletionBlock = ^(UIImage *avatarImage, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        [strongSelf handleDownloadedAvatar:avatarImage
+                                     error:error
+                               forDownload:download
+                                    forKey:avatarKey];
+    };
+    
+    if ([kAFAAvatarCacheCurrentUserKey isEqualToString:avatarKey]) {
+        AFAProfileServices *profileServices = [AFAProfileServices new];
+        download.service = profileServices;
+        [profileServices requestProfileImageWithCompletionBlock:downloadCompletionBlock];
+    } else {
+        AFAUserServices *userServices = [AFAUserServices new];
+        download.service = userServices;
+        [userServices requestPictureForUserID:avatarKey
+                              completionBlock:downloadCompletionBlock];
+    }
+}
+
+- (void)handleDownloadedAvatar:(UIImage *)avatarImage
+                         error:(NSError *)error
+                   forDownload:(AFAAvatarCacheDownload *)download
+                        forKey:(NSString *)avatarKey {
+    // Downloads invalidated while in flight still serve their requests but
+    // their result is not cached
+    BOOL isCurrentDownload = (self.pendingDownloads[avatarKey] == download);
+    if (isCurrentDownload) {
+        [self.pendingDownloads removeObjectForKey:avatarKey];
+    }
+    download.service = nil;
+    
+    NSArray *requests = [download.requests copy];
+    
+    if (!avatarImage) {
+        AFALogError(@"Cannot download avatar for key: %@. Reason:%@", avatarKey, error.localizedDescription);
+        
+        if (isCurrentDownload) {
+            download.failureDate = [NSDate date];
+            download.error = error;
+            [download.requests removeAllObjects];
+            self.failedDownloads[avatarKey] = download;
+        }
+        
+        for (AFAAvatarCacheRequest *request in requests) {
+            request.completionBlock(nil, error);
+        }
+        
+        return;
+    }
+    
+    // Scale the downloaded image once for every distinct requested size
+    NSUInteger cacheGeneration = [self cacheGenerationForAvatarKey:avatarKey];
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.imageProcessingQueue, ^{
+        NSMutableDictionary *scaledAvatars = [NSMutableDictionary dictionary];
+        for (AFAAvatarCacheRequest *request in requests) {
+            if (!scaledAvatars[@(request.avatarSize)]) {
+                UIImage *scaledAvatar = [UIImage createThumbnailForImage:avatarImage
+                                                                withSize:request.avatarSize];
+                if (scaledAvatar) {
+                    scaledAvatars[@(request.avatarSize)] = scaledAvatar;
+                }
+            }
+        }
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            __strong typeof(self) strongSelf = weakSelf;
+            
+            if (isCurrentDownload &&
+                cacheGeneration == [strongSelf cacheGenerationForAvatarKey:avatarKey]) {
+                [scaledAvatars enumerateKeysAndObjectsUsingBlock:^(NSNumber *avatarSize, UIImage *scaledAvatar, BOOL *stop) {
+                    [strongSelf storeAvatar:scaledAvatar
+                                     forKey:avatarKey
+                                   withSize:avatarSize.unsignedIntegerValue];
+                    [strongSelf cacheAvatarToDisk:scaledAvatar
+                                           forKey:avatarKey
+                                         withSize:avatarSize.unsignedIntegerValue];
+                }];
+            }
+            
+            for (AFAAvatarCacheRequest *request in requests) {
+                request.completionBlock(scaledAvatars[@(request.avatarSize)], nil);
+            }
+        });
+    });
+}
+
+- (void)invalidateAvatarForKey:(NSString *)avatarKey {
+    self.lastCacheGeneration++;
+    self.cacheGenerations[avatarKey] = @(self.lastCacheGeneration);
+    [self.pendingDownloads removeObjectForKey:avatarKey];
+    [self.failedDownloads removeObjectForKey:avatarKey];
+    
+    for (NSNumber *avatarSize in self.memoryCacheSizes[avatarKey]) {
+        [self.memoryCache removeObjectForKey:[self memoryCacheKeyForAvatarKey:avatarKey
+                                                                     withSize:avatarSize.unsignedIntegerValue]];
+    }
+    [self.memoryCacheSizes removeObjectForKey:avatarKey];
+    
+    NSString *avatarDirectoryName = [self avatarDirectoryNameForKey:avatarKey];
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.ioProcessingQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        NSString *avatarDirectoryPath = [strongSelf avatarCachePathForRelativePath:avatarDirectoryName];
+        NSFileManager *fileManager = [NSFileManager defaultManager];
+        if ([fileManager fileExistsAtPath:avatarDirectoryPath]) {
+            NSError *error = nil;
+            if (![fileManager removeItemAtPath:avatarDirectoryPath
+                                         error:&error]) {
+                AFALogError(@"Cannot remove disk cached avatars for key: %@. Reason:%@", avatarKey, error.localizedDescription);
+            }
+        }
+        
+        NSString *avatarDirectoryPrefix = [avatarDirectoryName stringByAppendingString:@"/"];
+        for (NSString *relativePath in strongSelf.diskCacheIndex.allKeys) {
+            if ([relativePath hasPrefix:avatarDirectoryPrefix]) {
+                AFAAvatarCacheDiskCacheEntry *entry = strongSelf.diskCacheIndex[relativePath];
+                strongSelf.diskCacheSize -= entry.fileSize;
+                [strongSelf.diskCacheIndex removeObjectForKey:relativePath];
+            }
+        }
+    });
+}
+
+- (void)updateServerScopeIfNeeded {
+    ASDKModelServerConfiguration *serverConfiguration = [ASDKBootstrap sharedInstance].serverConfiguration;
+    NSString *serverScope = [NSString stringWithFormat:@"%@:%@",
+                             serverConfiguration.hostAddressString ?: @"",
+                             serverConfiguration.port ?: @""];
+    if ([self.serverScope isEqualToString:serverScope]) {
+        return;
+    }
+    
+    // User IDs are only unique within a server, so nothing cached or requested
+    // for the previous server can be served once another one is signed in
+    if (self.serverScope) {
+        self.lastCacheGeneration++;
+        self.serverScopeCacheGeneration = self.lastCacheGeneration;
+        [self.pendingDownloads removeAllObjects];
+        [self.failedDownloads removeAllObjects];
+        [self cleanupMemoryCache];
+    }
+    self.serverScope = serverScope;
+    
+    NSDictionary *lastCurrentUser = [[NSUserDefaults standardUserDefaults] objectForKey:[self lastCurrentUserDefaultsKeyForServerScope:serverScope]];
+    _currentUserID = lastCurrentUser[kAFAAvatarCacheUserIDKey];
+}
+
+- (void)storeAvatar:(UIImage *)avatarImage
+             forKey:(NSString *)avatarKey
+           withSize:(NSUInteger)avatarSize {
+    NSUInteger imageCosts = avatarImage.size.height * avatarImage.size.width * avatarImage.scale * avatarImage.scale;
+    [self.memoryCache setObject:avatarImage
+                         forKey:[self memoryCacheKeyForAvatarKey:avatarKey
+                                                        withSize:avatarSize]
+                           cost:imageCosts];
+    
+    NSMutableSet *avatarSizes = self.memoryCacheSizes[avatarKey];
+    if (!avatarSizes) {
+        avatarSizes = [NSMutableSet set];
+        self.memoryCacheSizes[avatarKey] = avatarSizes;
+    }
+    [avatarSizes addObject:@(avatarSize)];
+}
+
+- (void)cacheAvatarToDisk:(UIImage *)avatarImage
+                   forKey:(NSString *)avatarKey
+                 withSize:(NSUInteger)avatarSize {
+    NSString *avatarDirectoryName = [self avatarDirectoryNameForKey:avatarKey];
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.ioProcessingQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        // Keep PNG for avatars that need transparency, everything else is
+        // stored as JPEG which is considerably smaller for photographic content
+        BOOL hasAlpha = [avatarImage hasAlphaChannel];
+        NSData *imageData = hasAlpha ? UIImagePNGRepresentation(avatarImage) : UIImageJPEGRepresentation(avatarImage, kAFAAvatarCacheJPEGCompressionQuality);
+        if (!imageData) {
+            AFALogError(@"Cannot encode avatar for key: %@", avatarKey);
+            return;
+        }
+        
+        NSError *error = nil;
+        if (![[NSFileManager defaultManager] createDirectoryAtPath:[strongSelf avatarCachePathForRelativePath:avatarDirectoryName]
+                                       withIntermediateDirectories:YES
+                                                        attributes:nil
+                                                             error:&error]) {
+            AFALogError(@"Cannot create avatar cache directory for key: %@. Reason:%@", avatarKey, error.localizedDescription);
+            return;
+        }
+        
+        // The encoding might have changed along with the image
+        for (NSString *pathExtension in @[kAFAAvatarCacheJPEGPathExtension, kAFAAvatarCachePNGPathExtension]) {
+            [strongSelf removeDiskCacheEntryForRelativePath:[strongSelf relativePathForAvatarInDirectory:avatarDirectoryName
+                                                                                                 withSize:avatarSize
+                                                                                            pathExtension:pathExtension]];
+        }
+        
+        NSString *relativePath = [strongSelf relativePathForAvatarInDirectory:avatarDirectoryName
+                                                                     withSize:avatarSize
+                                                                pathExtension:hasAlpha ? kAFAAvatarCachePNGPathExtension : kAFAAvatarCacheJPEGPathExtension];
+        if (![imageData writeToFile:[strongSelf avatarCachePathForRelativePath:relativePath]
+                         atomically:YES]) {
+            AFALogError(@"Cannot cache to disk avatar for key: %@", avatarKey);
+            return;
+        }
+        
+        AFAAvatarCacheDiskCacheEntry *entry = [AFAAvatarCacheDiskCacheEntry new];
+        entry.fileSize = imageData.length;
+        entry.creationDate = [NSDate date];
+        entry.accessDate = entry.creationDate;
+        strongSelf.diskCacheIndex[relativePath] = entry;
+        strongSelf.diskCacheSize += entry.fileSize;
+        
+        [strongSelf trimDiskCacheToBudget];
+    });
+}
+
+- (UIImage *)diskCachedAvatarInDirectory:(NSString *)avatarDirectoryName
+                                withSize:(NSUInteger)avatarSize {
+    for (NSString *pathExtension in @[kAFAAvatarCacheJPEGPathExtension, kAFAAvatarCachePNGPathExtension]) {
+        // Avatars that aren't indexed are not on disk either
+        NSString *relativePath = [self relativePathForAvatarInDirectory:avatarDirectoryName
+                                                               withSize:avatarSize
+                                                          pathExtension:pathExtension];
+        AFAAvatarCacheDiskCacheEntry *entry = self.diskCacheIndex[relativePath];
+        if (!entry) {
+            continue;
+        }
+        
+        // Profile pictures can be changed at any time, so expired avatars are
+        // downloaded again instead of being served
+        if ([[NSDate date] timeIntervalSinceDate:entry.creationDate] > kAFAAvatarCacheDiskMaxAge) {
+            [self removeDiskCacheEntryForRelativePath:relativePath];
+            continue;
+        }
+        
+        NSString *avatarPath = [self avatarCachePathForRelativePath:relativePath];
+        NSData *imageData = [NSData dataWithContentsOfFile:avatarPath
+                                                   options:NSDataReadingUncached
+                                                     error:nil];
+        if (!imageData) {
+            AFALogError(@"Encountered an error while loading disk cached avatar at path: %@", relativePath);
+            [self removeDiskCacheEntryForRelativePath:relativePath];
+            continue;
+        }
+        
+        // Record the access so that eviction can pick the least recently used
+        // avatars, also across launches
+        entry.accessDate = [NSDate date];
+        [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate : entry.accessDate}
+                                         ofItemAtPath:avatarPath
+                                                error:nil];
+        
+        // Decode off the main thread so the first render doesn't pay for it
+        return [UIImage createDecodedImageWithData:imageData];
+    }
+    
+    return nil;
+}
+
+- (void)buildDiskCacheIndex {
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSArray *resourceKeys = @[NSURLIsDirectoryKey, NSURLFileSizeKey, NSURLCreationDateKey, NSURLContentModificationDateKey];
+    NSURL *avatarsDirectoryURL = [NSURL fileURLWithPath:[self avatarCachePathForRelativePath:@""]];
+    
+    // Avatars are stored as <server scope>/<avatar key>/<size>.<extension>
+    for (NSURL *serverScopeURL in [self contentsOfDirectoryAtURL:avatarsDirectoryURL
+                                                  resourceKeys:resourceKeys]) {
+        for (NSURL *avatarDirectoryURL in [self contentsOfDirectoryAtURL:serverScopeURL
+                                                            resourceKeys:resourceKeys]) {
+            if (![[avatarDirectoryURL resourceValuesForKeys:@[NSURLIsDirectoryKey]
+                                                      error:nil][NSURLIsDirectoryKey] boolValue]) {
+                // Avatars stored before they were scoped by server cannot be
+                // looked up anymore
+                [fileManager removeItemAtURL:serverScopeURL
+                                       error:nil];
+                break;
+            }
+            
+            for (NSURL *fileURL in [self contentsOfDirectoryAtURL:avatarDirectoryURL
+                                                     resourceKeys:resourceKeys]) {
+                NSDictionary *resourceValues = [fileURL resourceValuesForKeys:resourceKeys
+                                                                        error:nil];
+                AFAAvatarCacheDiskCacheEntry *entry = [AFAAvatarCacheDiskCacheEntry new];
+                entry.fileSize = [resourceValues[NSURLFileSizeKey] unsignedLongLongValue];
+                entry.creationDate = resourceValues[NSURLCreationDateKey] ?: [NSDate distantPast];
+                entry.accessDate = resourceValues[NSURLContentModificationDateKey] ?: [NSDate distantPast];
+                
+                NSString *relativePath = [NSString pathWithComponents:@[serverScopeURL.lastPathComponent,
+                                                                        avatarDirectoryURL.lastPathComponent,
+                                                                        fileURL.lastPathComponent]];
+                self.diskCacheIndex[relativePath] = entry;
+                self.diskCacheSize += entry.fileSize;
+            }
+        }
+    }
+    
+    [self trimDiskCacheToBudget];
+}
+
+- (void)trimDiskCacheToBudget {
+    if (self.diskCacheSize <= self.diskCacheBudget) {
+        return;
+    }
+    
+    NSArray *relativePaths = [self.diskCacheIndex keysSortedByValueUsingComparator:^NSComparisonResult(AFAAvatarCacheDiskCacheEntry *firstEntry, AFAAvatarCacheDiskCacheEntry *secondEntry) {
+        return [firstEntry.accessDate compare:secondEntry.accessDate];
+    }];
+    
+    for (NSString *relativePath in relativePaths) {
+        if (self.diskCacheSize <= self.diskCacheBudget) {
+            break;
+        }
+        
+        [self removeDiskCacheEntryForRelativePath:relativePath];
+    }
+}
+
+- (void)removeDiskCacheEntryForRelativePath:(NSString *)relativePath {
+    AFAAvatarCacheDiskCacheEntry *entry = self.diskCacheIndex[relativePath];
+    if (!entry) {
+        return;
+    }
+    
+    [[NSFileManager defaultManager] removeItemAtPath:[self avatarCachePathForRelativePath:relativePath]
+                                               error:nil];
+    self.diskCacheSize -= entry.fileSize;
+    [self.diskCacheIndex removeObjectForKey:relativePath];
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
+- (NSString *)avatarKeyForUserID:(NSString *)userID {
+    if (!userID.length) {
+        return nil;
+    }
+    
+    return [self.currentUserID isEqualToString:userID] ? kAFAAvatarCacheCurrentUserKey : userID;
+}
+
+- (NSUInteger)pixelSizeForAvatarSize:(CGFloat)avatarSize {
+    // Sizes are rounded so that layout rounding differences map to the same entry
+    return (NSUInteger)ceil(avatarSize);
+}
+
+- (NSUInteger)cacheGenerationForAvatarKey:(NSString *)avatarKey {
+    return MAX([self.cacheGenerations[avatarKey] unsignedIntegerValue], self.serverScopeCacheGeneration);
+}
+
+- (NSString *)memoryCacheKeyForAvatarKey:(NSString *)avatarKey
+                                withSize:(NSUInteger)avatarSize {
+    return [NSString stringWithFormat:@"%@@%lu", avatarKey, (unsigned long)avatarSize];
+}
+
+- (NSString *)lastCurrentUserDefaultsKeyForServerScope:(NSString *)serverScope {
+    return [NSString stringWithFormat:@"%@.%@", kAFAAvatarCacheLastCurrentUserKey, [self cacheNameForKey:serverScope]];
+}
+
+- (NSString *)cacheNameForKey:(NSString *)key {
+    const char *str = [key UTF8String];
+    if (str == NULL) {
+        str = "";
+    }
+    unsigned char r[CC_MD5_DIGEST_LENGTH];
+    CC_MD5(str, (CC_LONG)strlen(str), r);
+    
+    return [NSString stringWithFormat:@"%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x",
+            r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], r[8], r[9], r[10], r[11], r[12], r[13], r[14], r[15]];
+}
+
+- (NSString *)avatarDirectoryNameForKey:(NSString *)avatarKey {
+    return [[self cacheNameForKey:self.serverScope] stringByAppendingPathComponent:[self cacheNameForKey:avatarKey]];
+}
+
+- (NSString *)relativePathForAvatarInDirectory:(NSString *)avatarDirectoryName
+                                      withSize:(NSUInteger)avatarSize
+                                 pathExtension:(NSString *)pathExtension {
+    return [avatarDirectoryName stringByAppendingPathComponent:[@(avatarSize).stringValue stringByAppendingPathExtension:pathExtension]];
+}
+
+- (NSString *)avatarCachePathForRelativePath:(NSString *)relativePath {
+    NSString *cachesPath = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+    return [[cachesPath stringByAppendingPathComponent:kAFAAvatarCacheDirectoryName] stringByAppendingPathComponent:relativePath];
+}
+
+- (NSArray *)contentsOfDirectoryAtURL:(NSURL *)directoryURL
+                         resourceKeys:(NSArray *)resourceKeys {
+    NSArray *contentURLs = [[NSFileManager defaultManager] contentsOfDirectoryAtURL:directoryURL
+                                                         includingPropertiesForKeys:resourceKeys
+                                                                            options:NSDirectoryEnumerationSkipsHiddenFiles
+                                                                              error:nil];
+    return contentURLs ? contentURLs : @[];
+}
+
+@end
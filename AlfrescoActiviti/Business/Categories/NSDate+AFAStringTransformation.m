@@ -20,6 +20,151 @@
 #import "AFALocalizationConstants.h"
 @import UIKit;
 
+static NSString * const kAFAListDateFormat              = @"MMM dd, YYYY";
+static NSString * const kAFAProcessInstanceDateTemplate = @"MMMMddYYYY";
+static NSString * const kAFACommentDateFormat           = @"MMM d, h:mm a";
+static NSUInteger const kAFARelativeDateStringCacheLimit = 500;
+
+/**
+ *  Date formatters and calendars are expensive to create and the methods in this
+ *  category run while configuring table view cells. The cache keeps them around
+ *  until the user changes the locale or the time zone.
+ */
+@interface AFADateFormattingCache : NSObject {
+    NSLock *_lock;
+}
+
+@property (strong, nonatomic) NSMutableDictionary   *dateFormatters;
+@property (strong, nonatomic) NSCalendar            *calendar;
+// Relative date strings only change when the current hour does, so they are
+// kept until the end of the hour they were computed in
+@property (strong, nonatomic) NSCache               *relativeDateStrings;
+@property (strong, nonatomic) NSDate                *relativeDateStringsExpirationDate;
+
++ (instancetype)sharedCache;
+- (NSDateFormatter *)dateFormatterWithFormat:(NSString *)dateFormat
+                                  isTemplate:(BOOL)isTemplate;
+- (NSCalendar *)currentCalendar;
+- (id)relativeDateStringForDate:(NSDate *)date;
+- (void)setRelativeDateString:(NSString *)relativeDateString
+                      forDate:(NSDate *)date;
+
+@end
+
+@implementation AFADateFormattingCache
+
++ (instancetype)sharedCache {
+    static AFADateFormattingCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [AFADateFormattingCache new];
+    });
+    
+    return sharedCache;
+}
+
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _lock = [NSLock new];
+        _dateFormatters = [NSMutableDictionary dictionary];
+        _relativeDateStrings = [NSCache new];
+        _relativeDateStrings.countLimit = kAFARelativeDateStringCacheLimit;
+        
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(invalidate)
+                                                     name:NSCurrentLocaleDidChangeNotification
+                                                   object:nil];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(invalidate)
+                                                     name:NSSystemTimeZoneDidChangeNotification
+                                                   object:nil];
+    }
+    
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)invalidate {
+    [_lock lock];
+    [self.dateFormatters removeAllObjects];
+    self.calendar = nil;
+    self.relativeDateStringsExpirationDate = nil;
+    [self.relativeDateStrings removeAllObjects];
+    [_lock unlock];
+}
+
+- (NSDateFormatter *)dateFormatterWithFormat:(NSString *)dateFormat
+                                  isTemplate:(BOOL)isTemplate {
+    NSString *cacheKey = [NSString stringWithFormat:@"%d%@", isTemplate, dateFormat];
+    
+    [_lock lock];
+    NSDateFormatter *dateFormatter = self.dateFormatters[cacheKey];
+    if (!dateFormatter) {
+        dateFormatter = [NSDateFormatter new];
+        if (isTemplate) {
+            [dateFormatter setLocalizedDateFormatFromTemplate:dateFormat];
+        } else {
+            [dateFormatter setDateFormat:dateFormat];
+        }
+        self.dateFormatters[cacheKey] = dateFormatter;
+    }
+    [_lock unlock];
+    
+    return dateFormatter;
+}
+
+- (NSCalendar *)currentCalendar {
+    [_lock lock];
+    NSCalendar *calendar = [self lockedCurrentCalendar];
+    [_lock unlock];
+    
+    return calendar;
+}
+
+- (id)relativeDateStringForDate:(NSDate *)date {
+    NSDate *now = [NSDate date];
+    
+    [_lock lock];
+    if (!self.relativeDateStringsExpirationDate ||
+        [now compare:self.relativeDateStringsExpirationDate] != NSOrderedAscending) {
+        [self.relativeDateStrings removeAllObjects];
+        
+        NSDate *currentHourStartDate = nil;
+        NSTimeInterval hourInterval = 0;
+        [[self lockedCurrentCalendar] rangeOfUnit:NSCalendarUnitHour
+                                        startDate:&currentHourStartDate
+                                         interval:&hourInterval
+                                          forDate:now];
+        self.relativeDateStringsExpirationDate = [currentHourStartDate dateByAddingTimeInterval:hourInterval];
+    }
+    id relativeDateString = [self.relativeDateStrings objectForKey:date];
+    [_lock unlock];
+    
+    return relativeDateString;
+}
+
+- (void)setRelativeDateString:(NSString *)relativeDateString
+                      forDate:(NSDate *)date {
+    // Dates without a relative representation are cached as well
+    [self.relativeDateStrings setObject:relativeDateString ? relativeDateString : [NSNull null]
+                                 forKey:date];
+}
+
+- (NSCalendar *)lockedCurrentCalendar {
+    if (!self.calendar) {
+        self.calendar = [NSCalendar currentCalendar];
+    }
+    
+    return self.calendar;
+}
+
+@end
+
 @implementation NSDate (AFAStringTransformation)
 
 
@@ -27,8 +172,8 @@
 #pragma mark Public interface
 
 - (NSString *)listCreationDate {
-    NSDateFormatter *dateFormatter = [NSDateFormatter new];
-    [dateFormatter setDateFormat:@"MMM dd, YYYY"];
+    NSDateFormatter *dateFormatter = [[AFADateFormattingCache sharedCache] dateFormatterWithFormat:kAFAListDateFormat
+                                                                                        isTemplate:NO];
     return [dateFormatter stringFromDate:self];
 }
 
@@ -37,88 +182,28 @@
 }
 
 - (NSString *)processInstanceCreationDate {
-    NSDateFormatter *dateFormatter = [NSDateFormatter new];
-    [dateFormatter setLocalizedDateFormatFromTemplate:@"MMMMddYYYY"];
+    NSDateFormatter *dateFormatter = [[AFADateFormattingCache sharedCache] dateFormatterWithFormat:kAFAProcessInstanceDateTemplate
+                                                                                        isTemplate:YES];
     return [dateFormatter stringFromDate:self];
 }
 
 - (NSString *)dueDateFormattedString {
-    NSCalendar *calendar = [NSCalendar currentCalendar];
-    
-    NSDate *fromDate = nil;
-    NSDate *toDate = nil;
-    
-    [calendar rangeOfUnit:NSCalendarUnitDay | NSCalendarUnitHour | NSCalendarUnitMonth | NSCalendarUnitYear
-                startDate:&fromDate
-                 interval:NULL
-                  forDate:self];
-    [calendar rangeOfUnit:NSCalendarUnitDay | NSCalendarUnitHour | NSCalendarUnitMonth | NSCalendarUnitYear
-                startDate:&toDate
-                 interval:NULL forDate:[NSDate date]];
-    
-    NSDateComponents *taskDateComponents = [calendar components:NSCalendarUnitDay | NSCalendarUnitHour | NSCalendarUnitMonth | NSCalendarUnitYear
-                                                       fromDate:fromDate
-                                                         toDate:toDate
-                                                        options:0];
-    NSInteger dayDiffNumber = taskDateComponents.day;
-    NSInteger hourDiffNumber = taskDateComponents.hour;
-    NSInteger monthDiffNumber = taskDateComponents.month;
-    NSInteger yearDiffNumber = taskDateComponents.year;
-    
-    // Handle future dates
-    if (!dayDiffNumber &&
-        !monthDiffNumber &&
-        !yearDiffNumber &&
-        hourDiffNumber < 0) { // In a few hours
-        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInFutureTextFormat, @"in x units format"),
-                labs(hourDiffNumber) + 1,
-                labs(hourDiffNumber) + 1 > 1 ? NSLocalizedString(kLocalizationTimeUnitHoursText, @"hours time unit") : NSLocalizedString(kLocalizationTimeUnitHourText, "hour time unit")];
-    } else if (dayDiffNumber < 0 &&
-               !monthDiffNumber &&
-               !yearDiffNumber) { // In the next days
-        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInFutureTextFormat, @"in x units format"),
-                labs(dayDiffNumber) + 1,
-                labs(dayDiffNumber) + 1 > 1 ? NSLocalizedString(kLocalizationTimeUnitDaysText, @"days time unit") : NSLocalizedString(kLocalizationTimeUnitDayText, @"day time unit")];
-    } else if (monthDiffNumber < 0 &&
-               !yearDiffNumber) { // In the next months
-        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInFutureTextFormat, @"in x units format"),
-                labs(monthDiffNumber) + (labs(dayDiffNumber) >= 14 ? 1 : 0),
-                labs(monthDiffNumber) + (labs(dayDiffNumber) >= 14 ? 1 : 0) > 1 ? NSLocalizedString(kLocalizationTimeUnitMonthsText, @"months time unit") : NSLocalizedString(kLocalizationTimeUnitMonthText, @"month time unit")];
-    } else if (yearDiffNumber < 0) { //In the next years
-        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInFutureTextFormat, @"in x units format"),
-                labs(yearDiffNumber) + (labs(monthDiffNumber) >= 6 ? 1 : 0),
-                labs(yearDiffNumber) + (labs(monthDiffNumber) >= 6 ? 1 : 0) > 1 ? NSLocalizedString(kLocalizationTimeUnitYearsText, @"years time unit") : NSLocalizedString(kLocalizationTimeUnitYearText, @"year time unit")];
+    AFADateFormattingCache *dateFormattingCache = [AFADateFormattingCache sharedCache];
+    id cachedRelativeDateString = [dateFormattingCache relativeDateStringForDate:self];
+    if (cachedRelativeDateString) {
+        return (cachedRelativeDateString != [NSNull null]) ? cachedRelativeDateString : nil;
     }
     
-    //Handle past dates
-    if (!dayDiffNumber &&
-        hourDiffNumber > 0) { // Few hours ago
-        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInPastTextFormat, @"in x units format"),
-                labs(hourDiffNumber),
-                labs(hourDiffNumber) > 1 ? NSLocalizedString(kLocalizationTimeUnitHoursText, @"hours time unit") : NSLocalizedString(kLocalizationTimeUnitHourText, "hour time unit")];
-    } else if (dayDiffNumber > 0 &&
-               !monthDiffNumber &&
-               !yearDiffNumber) { // Few days ago
-        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInPastTextFormat, @"in x units format"),
-                labs(dayDiffNumber),
-                labs(dayDiffNumber) > 1 ? NSLocalizedString(kLocalizationTimeUnitDaysText, @"days time unit") : NSLocalizedString(kLocalizationTimeUnitDayText, @"day time unit")];
-    } else if (monthDiffNumber > 0 &&
-               !yearDiffNumber) { // Few months ago
-        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInPastTextFormat, @"in x units format"),
-                labs(monthDiffNumber),
-                labs(monthDiffNumber) > 1 ? NSLocalizedString(kLocalizationTimeUnitMonthsText, @"months time unit") : NSLocalizedString(kLocalizationTimeUnitMonthText, @"month time unit")];
-    } else if (yearDiffNumber > 0) { // Few years ago
-        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInPastTextFormat, @"in x units format"),
-                labs(yearDiffNumber),
-                labs(yearDiffNumber) > 1 ? NSLocalizedString(kLocalizationTimeUnitYearsText, @"years time unit") : NSLocalizedString(kLocalizationTimeUnitYearText, @"year time unit")];
-    }
+    NSString *relativeDateString = [self dueDateFormattedStringWithCalendar:[dateFormattingCache currentCalendar]];
+    [dateFormattingCache setRelativeDateString:relativeDateString
+                                       forDate:self];
     
-    return nil;
+    return relativeDateString;
 }
 
 - (NSAttributedString *)lastUpdatedFormattedString {
-    NSDateFormatter *dateFormatter = [[NSDateFormatter alloc] init];
-    [dateFormatter setDateFormat:@"MMM d, h:mm a"];
+    NSDateFormatter *dateFormatter = [[AFADateFormattingCache sharedCache] dateFormatterWithFormat:kAFACommentDateFormat
+                                                                                        isTemplate:NO];
     NSString *title = [NSString stringWithFormat:NSLocalizedString(kLocalizationGeneralUseLastUpdateTextFormat, @"Last update format"), [dateFormatter stringFromDate:[NSDate date]]];
     
     UIColor *titleColor = [UIColor colorWithRed:42 / 255.0f green:41 / 255.0f blue:41 / 255.0f alpha:1.0f];
@@ -128,8 +213,8 @@
 }
 
 - (NSString *)commentFormattedString {
-    NSDateFormatter *dateFormatter = [[NSDateFormatter alloc] init];
-    [dateFormatter setDateFormat:@"MMM d, h:mm a"];
+    NSDateFormatter *dateFormatter = [[AFADateFormattingCache sharedCache] dateFormatterWithFormat:kAFACommentDateFormat
+                                                                                        isTemplate:NO];
     
     return [dateFormatter stringFromDate:self];
 }
@@ -139,10 +224,11 @@
     NSInteger days,hour,minutes = 0;
     NSString *durationString = nil;
     
-    components = [[NSCalendar currentCalendar] components: NSCalendarUnitDay|NSCalendarUnitHour|NSCalendarUnitMinute
-                                                 fromDate:self
-                                                   toDate:endDate
-                                                  options:0];
+    NSCalendar *calendar = [[AFADateFormattingCache sharedCache] currentCalendar];
+    components = [calendar components:NSCalendarUnitDay|NSCalendarUnitHour|NSCalendarUnitMinute
+                             fromDate:self
+                               toDate:endDate
+                              options:0];
     days = [components day];
     hour=[components hour];
     minutes=[components minute];
@@ -176,7 +262,7 @@
     minutes %= 60;
     unsigned long days = hours / 24;
     hours %= 24;
-
+    
     NSMutableString * result = [NSMutableString new];
     
     if (days) {
@@ -199,4 +285,80 @@
     return result;
 }
 
+
+#pragma mark -
+#pragma mark Private interface
+
+- (NSString *)dueDateFormattedStringWithCalendar:(NSCalendar *)calendar {
+    NSDate *fromDate = nil;
+    NSDate *toDate = nil;
+    
+    [calendar rangeOfUnit:NSCalendarUnitDay | NSCalendarUnitHour | NSCalendarUnitMonth | NSCalendarUnitYear
+                startDate:&fromDate
+                 interval:NULL
+                  forDate:self];
+    [calendar rangeOfUnit:NSCalendarUnitDay | NSCalendarUnitHour | NSCalendarUnitMonth | NSCalendarUnitYear
+                startDate:&toDate
+                 interval:NULL forDate:[NSDate date]];
+    
+    NSDateComponents *taskDateComponents = [calendar components:NSCalendarUnitDay | NSCalendarUnitHour | NSCalendarUnitMonth | NSCalendarUnitYear
+                                                       fromDate:fromDate
+                                                         toDate:toDate
+                                                        options:0];
+    NSInteger dayDiffNumber = taskDateComponents.day;
+    NSInteger hourDiffNumber = taskDateComponents.hour;
+    NSInteger monthDiffNumber = taskDateComponents.month;
+    NSInteger yearDiffNumber = taskDateComponents.year;
+    
+    // Handle future dates
+    if (!dayDiffNumber &&
+        !monthDiffNumber &&
+        !yearDiffNumber &&
+        hourDiffNumber < 0) { // In a few hours
+        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInFutureTextFormat, @"in x units format"),
+                labs(hourDiffNumber) + 1,
+                labs(hourDiffNumber) + 1 > 1 ? NSLocalizedString(kLocalizationTimeUnitHoursText, @"hours time unit") : NSLocalizedString(kLocalizationTimeUnitHourText, "hour time unit")];
+    } else if (dayDiffNumber < 0 &&
+               !monthDiffNumber &&
+               !yearDiffNumber) { // In the next days
+        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInFutureTextFormat, @"in x units format"),
+                labs(dayDiffNumber) + 1,
+                labs(dayDiffNumber) + 1 > 1 ? NSLocalizedString(kLocalizationTimeUnitDaysText, @"days time unit") : NSLocalizedString(kLocalizationTimeUnitDayText, @"day time unit")];
+    } else if (monthDiffNumber < 0 &&
+               !yearDiffNumber) { // In the next months
+        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInFutureTextFormat, @"in x units format"),
+                labs(monthDiffNumber) + (labs(dayDiffNumber) >= 14 ? 1 : 0),
+                labs(monthDiffNumber) + (labs(dayDiffNumber) >= 14 ? 1 : 0) > 1 ? NSLocalizedString(kLocalizationTimeUnitMonthsText, @"months time unit") : NSLocalizedString(kLocalizationTimeUnitMonthText, @"month time unit")];
+    } else if (yearDiffNumber < 0) { //In the next years
+        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInFutureTextFormat, @"in x units format"),
+                labs(yearDiffNumber) + (labs(monthDiffNumber) >= 6 ? 1 : 0),
+                labs(yearDiffNumber) + (labs(monthDiffNumber) >= 6 ? 1 : 0) > 1 ? NSLocalizedString(kLocalizationTimeUnitYearsText, @"years time unit") : NSLocalizedString(kLocalizationTimeUnitYearText, @"year time unit")];
+    }
+    
+    //Handle past dates
+    if (!dayDiffNumber &&
+        hourDiffNumber > 0) { // Few hours ago
+        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInPastTextFormat, @"in x units format"),
+                labs(hourDiffNumber),
+                labs(hourDiffNumber) > 1 ? NSLocalizedString(kLocalizationTimeUnitHoursText, @"hours time unit") : NSLocalizedString(kLocalizationTimeUnitHourText, "hour time unit")];
+    } else if (dayDiffNumber > 0 &&
+               !monthDiffNumber &&
+               !yearDiffNumber) { // Few days ago
+        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInPastTextFormat, @"in x units format"),
+                labs(dayDiffNumber),
+                labs(dayDiffNumber) > 1 ? NSLocalizedString(kLocalizationTimeUnitDaysText, @"days time unit") : NSLocalizedString(kLocalizationTimeUnitDayText, @"day time unit")];
+    } else if (monthDiffNumber > 0 &&
+               !yearDiffNumber) { // Few months ago
+        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInPastTextFormat, @"in x units format"),
+                labs(monthDiffNumber),
+                labs(monthDiffNumber) > 1 ? NSLocalizedString(kLocalizationTimeUnitMonthsText, @"months time unit") : NSLocalizedString(kLocalizationTimeUnitMonthText, @"month time unit")];
+    } else if (yearDiffNumber > 0) { // Few years ago
+        return [NSString stringWithFormat:NSLocalizedString(kLocalizationTimeInPastTextFormat, @"in x units format"),
+                labs(yearDiffNumber),
+                labs(yearDiffNumber) > 1 ? NSLocalizedString(kLocalizationTimeUnitYearsText, @"years time unit") : NSLocalizedString(kLocalizationTimeUnitYearText, @"year time unit")];
+    }
+    
+    return nil;
+}
+
 @end
@@ -36,6 +36,19 @@ extern NSInteger  kDefaultTaskListFetchSize;
  */
 extern NSUInteger kTaskPreloadCellThreshold;
 
+/**
+ *  Describes how many seconds ahead of reaching the end of the list, at the current
+ *  scroll velocity, the following page is requested. Pages fetched this way are kept
+ *  aside until the preload cell is reached.
+ */
+extern NSTimeInterval kTaskPrefetchLeadTime;
+
+/**
+ *  Describes the maximum number of list entries that can be held in pages fetched
+ *  ahead of time. It caps how many pages are prefetched when scrolling fast.
+ */
+extern NSUInteger kTaskPrefetchEntryBudget;
+
 // Credential related
 extern NSString *kCloudAuthetificationCredentialIdentifier;
 extern NSString *kPremiseAuthentificationCredentialIdentifier;
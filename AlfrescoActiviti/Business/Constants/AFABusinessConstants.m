@@ -33,6 +33,8 @@ NSInteger kDayDifferenceForHighPriorityTasks        = 1;
 NSInteger kDayDifferenceForMediumPriorityTasks      = 3;
 NSUInteger kTaskPreloadCellThreshold                = 10;
 NSInteger  kDefaultTaskListFetchSize                = 25;
+NSTimeInterval kTaskPrefetchLeadTime                = 1.5;
+NSUInteger kTaskPrefetchEntryBudget                 = 50;
 
 
 #pragma mark -
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#import <Foundation/Foundation.h>
+
+@class ASDKDataAccessor,
+ASDKDataAccessorResponseBase;
+
+/**
+ *  Completion context of a single request issued by a service facade. Blocks are
+ *  stored untyped and are expected to be set and consumed on the main queue.
+ */
+@interface AFAServiceRequest : NSObject
+
+@property (strong, nonatomic, readonly) ASDKDataAccessor    *dataAccessor;
+@property (assign, nonatomic, readonly) SEL                 responseHandler;
+@property (copy, nonatomic)             id                  completionBlock;
+@property (copy, nonatomic)             id                  cachedResultsBlock;
+@property (copy, nonatomic)             id                  progressBlock;
+
+@end
+
+/**
+ *  Maps the data accessors of in flight requests to their completion context, so
+ *  that a service facade can route data accessor responses without comparing the
+ *  sender against a property per request kind. Any number of requests of the same
+ *  kind can be in flight at once and requests are released once they finish.
+ *  Access is thread safe.
+ */
+@interface AFAServiceRequestRegistry : NSObject
+
+/**
+ *  Number of requests currently in flight.
+ */
+@property (assign, nonatomic, readonly) NSUInteger requestCount;
+
+/**
+ *  Initializes the registry for the passed target. The target is not retained and
+ *  is expected to implement the response handlers of the registered requests.
+ *
+ *  @param target Object on which response handlers are called
+ */
+- (instancetype)initWithTarget:(id)target;
+
+/**
+ *  Registers a request for the passed data accessor. This must happen before the data
+ *  accessor is asked to load data. The response handler must have the signature
+ *  - (void)handleResponse:(ASDKDataAccessorResponseBase *)response
+ *              forRequest:(AFAServiceRequest *)request
+ *
+ *  @param dataAccessor    Data accessor performing the request
+ *  @param responseHandler Selector of the target method handling the responses
+ *
+ *  @return                Request object on which completion blocks are set
+ */
+- (AFAServiceRequest *)registerDataAccessor:(ASDKDataAccessor *)dataAccessor
+                            responseHandler:(SEL)responseHandler;
+
+/**
+ *  Hands the response over to the handler of the request registered for the passed
+ *  data accessor. Responses from data accessors that are not registered are dropped.
+ *  A request is released after a remote response reporting an error.
+ *
+ *  @param response     Response loaded by the data accessor
+ *  @param dataAccessor Data accessor that loaded the response
+ */
+- (void)routeResponse:(ASDKDataAccessorResponseBase *)response
+     fromDataAccessor:(ASDKDataAccessor *)dataAccessor;
+
+/**
+ *  Releases the request registered for the passed data accessor and with it the data
+ *  accessor. Called when the data accessor reports it finished loading.
+ *
+ *  @param dataAccessor Data accessor that finished loading
+ */
+- (void)finishRequestForDataAccessor:(ASDKDataAccessor *)dataAccessor;
+
+/**
+ *  Detaches all requests handled by the passed response handler. Their completion blocks
+ *  are discarded and late responses are dropped. Operations of the data accessors are
+ *  left running because the network services are shared with other requests.
+ *
+ *  @param responseHandler Selector the requests were registered with
+ */
+- (void)detachRequestsWithResponseHandler:(SEL)responseHandler;
+
+/**
+ *  Cancels the operations of all requests in flight and detaches them.
+ */
+- (void)cancelAllRequests;
+
+@end
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#import "AFAServiceRequestRegistry.h"
+@import ActivitiSDK;
+
+@interface AFAServiceRequest ()
+
+@property (strong, nonatomic, readwrite) ASDKDataAccessor   *dataAccessor;
+@property (assign, nonatomic, readwrite) SEL                responseHandler;
+
+@end
+
+@implementation AFAServiceRequest
+@end
+
+@interface AFAServiceRequestRegistry ()
+
+@property (weak, nonatomic)   id            target;
+
+// Maps data accessors to their request, compared by pointer
+@property (strong, nonatomic) NSMapTable    *requests;
+
+@end
+
+@implementation AFAServiceRequestRegistry
+
+
+#pragma mark -
+#pragma mark Life cycle
+
+- (instancetype)initWithTarget:(id)target {
+    self = [super init];
+    
+    if (self) {
+        _target = target;
+        _requests = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                          valueOptions:NSPointerFunctionsStrongMemory];
+    }
+    
+    return self;
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (NSUInteger)requestCount {
+    @synchronized (self.requests) {
+        return self.requests.count;
+    }
+}
+
+- (AFAServiceRequest *)registerDataAccessor:(ASDKDataAccessor *)dataAccessor
+                            responseHandler:(SEL)responseHandler {
+    NSParameterAssert(dataAccessor);
+    NSParameterAssert([self.target respondsToSelector:responseHandler]);
+    
+    AFAServiceRequest *request = [AFAServiceRequest new];
+    request.dataAccessor = dataAccessor;
+    request.responseHandler = responseHandler;
+    
+    @synchronized (self.requests) {
+        [self.requests setObject:request
+                          forKey:dataAccessor];
+    }
+    
+    return request;
+}
+
+- (void)routeResponse:(ASDKDataAccessorResponseBase *)response
+     fromDataAccessor:(ASDKDataAccessor *)dataAccessor {
+    AFAServiceRequest *request = nil;
+    
+    @synchronized (self.requests) {
+        request = [self.requests objectForKey:dataAccessor];
+        
+        // Successful requests are released once the data accessor finishes storing
+        // the results in cache, but failed remote loads never report finishing
+        if (request &&
+            response.error &&
+            !response.isCachedData &&
+            ![response isKindOfClass:[ASDKDataAccessorResponseProgress class]]) {
+            [self.requests removeObjectForKey:dataAccessor];
+        }
+    }
+    
+    id target = self.target;
+    if (!request || !target) {
+        return;
+    }
+    
+    void (*responseHandler)(id, SEL, ASDKDataAccessorResponseBase *, AFAServiceRequest *) = (void *)[target methodForSelector:request.responseHandler];
+    responseHandler(target, request.responseHandler, response, request);
+}
+
+- (void)finishRequestForDataAccessor:(ASDKDataAccessor *)dataAccessor {
+    @synchronized (self.requests) {
+        [self.requests removeObjectForKey:dataAccessor];
+    }
+}
+
+- (void)detachRequestsWithResponseHandler:(SEL)responseHandler {
+    for (AFAServiceRequest *request in [self removeRequestsPassingTest:^BOOL(AFAServiceRequest *request) {
+        return sel_isEqual(request.responseHandler, responseHandler);
+    }]) {
+        [self detachRequest:request];
+    }
+}
+
+- (void)cancelAllRequests {
+    for (AFAServiceRequest *request in [self removeRequestsPassingTest:^BOOL(AFAServiceRequest *request) {
+        return YES;
+    }]) {
+        [request.dataAccessor cancelOperations];
+        [self detachRequest:request];
+    }
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
+- (NSArray *)removeRequestsPassingTest:(BOOL (^)(AFAServiceRequest *request))testBlock {
+    NSMutableArray *removedRequests = [NSMutableArray array];
+    
+    @synchronized (self.requests) {
+        for (AFAServiceRequest *request in self.requests.objectEnumerator.allObjects) {
+            if (testBlock(request)) {
+                [removedRequests addObject:request];
+                [self.requests removeObjectForKey:request.dataAccessor];
+            }
+        }
+    }
+    
+    return removedRequests;
+}
+
+- (void)detachRequest:(AFAServiceRequest *)request {
+    request.dataAccessor.delegate = nil;
+    request.completionBlock = nil;
+    request.cachedResultsBlock = nil;
+    request.progressBlock = nil;
+}
+
+@end
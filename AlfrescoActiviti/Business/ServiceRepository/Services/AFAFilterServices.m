@@ -22,32 +22,31 @@
 // Constants
 #import "AFALocalizationConstants.h"
 
+// Managers
+#import "AFAServiceRequestRegistry.h"
+
 
 @interface AFAFilterServices () <ASDKDataAccessorDelegate>
 
-// Default task filter list
-@property (strong, nonatomic) ASDKFilterDataAccessor                    *fetchDefaultTaskFilterListDataAccessor;
-@property (copy, nonatomic) AFAFilterServicesFilterListCompletionBlock  defaultTaskFilterListCompletionBlock;
-@property (copy, nonatomic) AFAFilterServicesFilterListCompletionBlock  defaultTaskFilterListCachedResultsBlock;
+@property (strong, nonatomic) AFAServiceRequestRegistry *requestRegistry;
 
-// Application specific task filter list
-@property (strong, nonatomic) ASDKFilterDataAccessor                    *fetchTaskFilterListDataAccessor;
-@property (copy, nonatomic) AFAFilterServicesFilterListCompletionBlock  taskFilterListCompletionBlock;
-@property (copy, nonatomic) AFAFilterServicesFilterListCompletionBlock  taskFilterListCachedResultsBlock;
+@end
 
-// Default process instance filter list
-@property (strong, nonatomic) ASDKFilterDataAccessor                    *fetchDefaultProcessInstanceFilterListDataAccessor;
-@property (copy, nonatomic) AFAFilterServicesFilterListCompletionBlock  defaultProcessInstanceFilterListCompletionBlock;
-@property (copy, nonatomic) AFAFilterServicesFilterListCompletionBlock  defaultProcessInstanceFilterListCachedResultsBlock;
+@implementation AFAFilterServices
 
-// Application specific process instance filter list
-@property (strong, nonatomic) ASDKFilterDataAccessor                    *fetchProcessInstanceFilterListDataAccessor;
-@property (copy, nonatomic) AFAFilterServicesFilterListCompletionBlock  processInstanceFilterListCompletionBlock;
-@property (copy, nonatomic) AFAFilterServicesFilterListCompletionBlock  processInstanceFilterListCachedResultsBlock;
 
-@end
+#pragma mark -
+#pragma mark Life cycle
 
-@implementation AFAFilterServices
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _requestRegistry = [[AFAServiceRequestRegistry alloc] initWithTarget:self];
+    }
+    
+    return self;
+}
 
 
 #pragma mark -
@@ -57,11 +56,13 @@
                                    cachedResults:(AFAFilterServicesFilterListCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.defaultTaskFilterListCompletionBlock = completionBlock;
-    self.defaultTaskFilterListCachedResultsBlock = cacheCompletionBlock;
+    ASDKFilterDataAccessor *dataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchDefaultTaskFilterListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchDefaultTaskFilterListDataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:self];
-    [self.fetchDefaultTaskFilterListDataAccessor fetchDefaultTaskFilterList];
+    [dataAccessor fetchDefaultTaskFilterList];
 }
 
 - (void)requestTaskFilterListForAppID:(NSString *)appID
@@ -69,22 +70,26 @@
                         cachedResults:(AFAFilterServicesFilterListCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskFilterListCompletionBlock = completionBlock;
-    self.taskFilterListCachedResultsBlock = cacheCompletionBlock;
+    ASDKFilterDataAccessor *dataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchTaskFilterListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchTaskFilterListDataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:self];
-    [self.fetchTaskFilterListDataAccessor fetchTaskFilterListForApplicationID:appID];
+    [dataAccessor fetchTaskFilterListForApplicationID:appID];
 }
 
 - (void)requestProcessInstanceFilterListWithCompletionBlock:(AFAFilterServicesFilterListCompletionBlock)completionBlock
                                               cachedResults:(AFAFilterServicesFilterListCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.defaultProcessInstanceFilterListCompletionBlock = completionBlock;
-    self.defaultProcessInstanceFilterListCachedResultsBlock = cacheCompletionBlock;
+    ASDKFilterDataAccessor *dataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchDefaultProcessInstanceFilterListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchDefaultProcessInstanceFilterListDataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:self];
-    [self.fetchDefaultProcessInstanceFilterListDataAccessor fetchDefaultProcessInstanceFilterList];
+    [dataAccessor fetchDefaultProcessInstanceFilterList];
 }
 
 - (void)requestProcessInstanceFilterListForAppID:(NSString *)appID
@@ -92,11 +97,13 @@
                                    cachedResults:(AFAFilterServicesFilterListCompletionBlock)cacheCompletionBlock{
     NSParameterAssert(completionBlock);
     
-    self.processInstanceFilterListCompletionBlock = completionBlock;
-    self.processInstanceFilterListCachedResultsBlock = cacheCompletionBlock;
+    ASDKFilterDataAccessor *dataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchProcessInstanceFilterListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchProcessInstanceFilterListDataAccessor = [[ASDKFilterDataAccessor alloc] initWithDelegate:self];
-    [self.fetchProcessInstanceFilterListDataAccessor fetchProcessInstanceFilterListForApplicationID:appID];
+    [dataAccessor fetchProcessInstanceFilterListForApplicationID:appID];
 }
 
 
@@ -105,37 +112,31 @@
 
 - (void)dataAccessor:(id<ASDKServiceDataAccessorProtocol>)dataAccessor
  didLoadDataResponse:(ASDKDataAccessorResponseBase *)response {
-    if (self.fetchDefaultTaskFilterListDataAccessor == dataAccessor) {
-        [self handleFetchDefaultTaskFilterListDataAccessorResponse:response];
-    } else if (self.fetchTaskFilterListDataAccessor == dataAccessor) {
-        [self handleFetchTaskFilterListDataAccessorResponse:response];
-    } else if (self.fetchDefaultProcessInstanceFilterListDataAccessor == dataAccessor) {
-        [self handleFetchDefaultProcessInstanceFilterListDataAccessorResponse:response];
-    } else if (self.fetchProcessInstanceFilterListDataAccessor == dataAccessor) {
-        [self handleFetchProcessInstanceFilterListDataAccessorResponse:response];
-    }
+    [self.requestRegistry routeResponse:response
+                       fromDataAccessor:dataAccessor];
 }
 
 - (void)dataAccessorDidFinishedLoadingDataResponse:(id<ASDKServiceDataAccessorProtocol>)dataAccessor {
+    [self.requestRegistry finishRequestForDataAccessor:dataAccessor];
 }
 
 
 #pragma mark -
 #pragma mark Private interface
 
-- (void)handleFetchDefaultTaskFilterListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchDefaultTaskFilterListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                  forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *filterListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *filterList = filterListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!filterListResponse.error) {
         if (filterListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAFilterServicesFilterListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.defaultTaskFilterListCachedResultsBlock) {
-                    strongSelf.defaultTaskFilterListCachedResultsBlock(filterList, nil, filterListResponse.paging);
-                    strongSelf.defaultTaskFilterListCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(filterList, nil, filterListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -144,28 +145,28 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAFilterServicesFilterListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.defaultTaskFilterListCompletionBlock) {
-            strongSelf.defaultTaskFilterListCompletionBlock(filterList, filterListResponse.error, filterListResponse.paging);
-            strongSelf.defaultTaskFilterListCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(filterList, filterListResponse.error, filterListResponse.paging);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleFetchTaskFilterListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchTaskFilterListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                           forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *filterListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *filterList = filterListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!filterListResponse.error) {
         if (filterListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAFilterServicesFilterListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.taskFilterListCachedResultsBlock) {
-                    strongSelf.taskFilterListCachedResultsBlock(filterList, nil, filterListResponse.paging);
-                    strongSelf.taskFilterListCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(filterList, nil, filterListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -174,28 +175,28 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAFilterServicesFilterListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskFilterListCompletionBlock) {
-            strongSelf.taskFilterListCompletionBlock(filterList, filterListResponse.error, filterListResponse.paging);
-            strongSelf.taskFilterListCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(filterList, filterListResponse.error, filterListResponse.paging);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleFetchDefaultProcessInstanceFilterListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchDefaultProcessInstanceFilterListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                             forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *filterListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *filterList = filterListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!filterListResponse.error) {
         if (filterListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAFilterServicesFilterListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.defaultProcessInstanceFilterListCachedResultsBlock) {
-                    strongSelf.defaultProcessInstanceFilterListCachedResultsBlock(filterList, nil, filterListResponse.paging);
-                    strongSelf.defaultProcessInstanceFilterListCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(filterList, nil, filterListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -204,28 +205,28 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAFilterServicesFilterListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.defaultProcessInstanceFilterListCompletionBlock) {
-            strongSelf.defaultProcessInstanceFilterListCompletionBlock(filterList, filterListResponse.error, filterListResponse.paging);
-            strongSelf.defaultProcessInstanceFilterListCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(filterList, filterListResponse.error, filterListResponse.paging);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleFetchProcessInstanceFilterListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchProcessInstanceFilterListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                      forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *filterListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *filterList = filterListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!filterListResponse.error) {
         if (filterListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAFilterServicesFilterListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.processInstanceFilterListCachedResultsBlock) {
-                    strongSelf.processInstanceFilterListCachedResultsBlock(filterList, nil, filterListResponse.paging);
-                    strongSelf.processInstanceFilterListCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(filterList, nil, filterListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -234,11 +235,11 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAFilterServicesFilterListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.processInstanceFilterListCompletionBlock) {
-            strongSelf.processInstanceFilterListCompletionBlock(filterList, filterListResponse.error, filterListResponse.paging);
-            strongSelf.processInstanceFilterListCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(filterList, filterListResponse.error, filterListResponse.paging);
+            request.completionBlock = nil;
         }
     });
 }
@@ -50,6 +50,12 @@ typedef void  (^AFAProcessInstanceContentDownloadCompletionBlock)(NSURL *downloa
                          withCompletionBlock:(AFAProcessServiceProcessInstanceListCompletionBlock)completionBlock
                                cachedResults:(AFAProcessServiceProcessInstanceListCompletionBlock)cacheCompletionBlock;
 
+/**
+ *  Cancels the process instance list requests in flight. Their completion blocks are discarded
+ *  and will not be called, which makes it safe to drop a page that is no longer needed.
+ */
+- (void)cancelProcessInstanceListRequest;
+
 /**
  *  Performs a request for the process definition list.
  *
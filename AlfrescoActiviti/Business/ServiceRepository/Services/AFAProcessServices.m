@@ -22,60 +22,32 @@
 // Models
 #import "AFAGenericFilterModel.h"
 
+// Managers
+#import "AFAServiceRequestRegistry.h"
+
 @interface AFAProcessServices() <ASDKDataAccessorDelegate>
 
-// Process instance list
-@property (strong, nonatomic) ASDKProcessInstanceDataAccessor                   *fetchProcessInstanceListDataAccessor;
-@property (copy, nonatomic) AFAProcessServiceProcessInstanceListCompletionBlock processInstanceListCompletionBlock;
-@property (copy, nonatomic) AFAProcessServiceProcessInstanceListCompletionBlock processInstanceCachedResultsBlock;
-
-// Process instance details
-@property (strong, nonatomic) ASDKProcessInstanceDataAccessor                   *fetchProcessInstanceDetailsDataAccessor;
-@property (copy, nonatomic) AFAProcessInstanceCompletionBlock                   processInstanceDetailsCompletionBlock;
-@property (copy, nonatomic) AFAProcessInstanceCompletionBlock                   processInstanceDetailsCachedResultsBlock;
-
-// Process instance content
-@property (strong, nonatomic) ASDKProcessInstanceDataAccessor                   *fetchProcessInstanceContentDataAccessor;
-@property (copy, nonatomic) AFAProcessInstanceContentCompletionBlock            processInstanceContentCompletionBlock;
-@property (copy, nonatomic) AFAProcessInstanceContentCompletionBlock            processInstanceContentCachedResultsBlock;
-
-// Delete process instance
-@property (strong, nonatomic) ASDKProcessInstanceDataAccessor                   *deleteProcessInstanceDataAccessor;
-@property (copy, nonatomic) AFAProcessInstanceDeleteCompletionBlock             deleteProcessInstanceCompletionBlock;
-
-// Create process instance comment
-@property (strong, nonatomic) ASDKProcessInstanceDataAccessor                   *createProcessInstanceCommentDataAccessor;
-@property (copy, nonatomic) AFAProcessInstanceCreateCommentCompletionBlock      createprocessInstanceCommentCompletionBlock;
-
-// Process instance comment list
-@property (strong, nonatomic) ASDKProcessInstanceDataAccessor                   *fetchProcessInstanceCommentListDataAccessor;
-@property (copy, nonatomic)  AFAProcessInstanceCommentsCompletionBlock          processInstanceCommentsCompletionBlock;
-@property (copy, nonatomic)  AFAProcessInstanceCommentsCompletionBlock          processInstanceCommentsCachedResultsBlock;
-
-// Process instance audit log
-@property (strong, nonatomic) ASDKProcessInstanceDataAccessor                   *processInstanceAuditLogDownloadDataAccessor;
-@property (copy, nonatomic) AFAProcessInstanceContentDownloadProgressBlock      processInstanceAuditLogDownloadProgressBlock;
-@property (copy, nonatomic) AFAProcessInstanceContentDownloadCompletionBlock    processInstanceAuditLogDownloadCompletionBlock;
-
-// Ad-hoc process definition list
-@property (strong, nonatomic) ASDKProcessDefinitionDataAccessor                 *fetchAdhocProcessDefinitionListDataAccessor;
-@property (copy, nonatomic) AFAProcessDefinitionListCompletionBlock             adhocProcessDefinitionCompletionBlock;
-@property (copy, nonatomic) AFAProcessDefinitionListCompletionBlock             adhocProcessDefinitionCachedResultsBlock;
-
-// Process definition list
-@property (strong, nonatomic) ASDKProcessDefinitionDataAccessor                 *fetchProcessDefinitionListDataAccessor;
-@property (copy, nonatomic) AFAProcessDefinitionListCompletionBlock             processDefinitionCompletionBlock;
-@property (copy, nonatomic) AFAProcessDefinitionListCompletionBlock             processDefinitionCachedResultsBlock;
-
-// Process instance start
-@property (strong, nonatomic) ASDKProcessInstanceDataAccessor                   *startProcessInstanceDataAccessor;
-@property (copy, nonatomic) AFAProcessInstanceCompletionBlock                   startProcessInstanceCompletionBlock;
+@property (strong, nonatomic) AFAServiceRequestRegistry *requestRegistry;
 
 @end
 
 @implementation AFAProcessServices
 
 
+#pragma mark -
+#pragma mark Life cycle
+
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _requestRegistry = [[AFAServiceRequestRegistry alloc] initWithTarget:self];
+    }
+    
+    return self;
+}
+
+
 #pragma mark -
 #pragma mark Public interface
 
@@ -84,9 +56,6 @@
                                cachedResults:(AFAProcessServiceProcessInstanceListCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.processInstanceListCompletionBlock = completionBlock;
-    self.processInstanceCachedResultsBlock = cacheCompletionBlock;
-    
     // Create request representation for the filter model
     ASDKFilterRequestRepresentation *filterRequestRepresentation = [ASDKFilterRequestRepresentation new];
     filterRequestRepresentation.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
@@ -104,19 +73,30 @@
     filterRequestRepresentation.page = filter.page;
     filterRequestRepresentation.size = filter.size;
     
-    self.fetchProcessInstanceListDataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
-    [self.fetchProcessInstanceListDataAccessor fetchProcessInstancesWithFilter:filterRequestRepresentation];
+    ASDKProcessInstanceDataAccessor *dataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchProcessInstanceListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
+    
+    [dataAccessor fetchProcessInstancesWithFilter:filterRequestRepresentation];
+}
+
+- (void)cancelProcessInstanceListRequest {
+    [self.requestRegistry detachRequestsWithResponseHandler:@selector(handleFetchProcessInstanceListDataAccessorResponse:forRequest:)];
 }
 
 - (void)requestProcessDefinitionListWithCompletionBlock:(AFAProcessDefinitionListCompletionBlock)completionBlock
                                           cachedResults:(AFAProcessDefinitionListCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.adhocProcessDefinitionCompletionBlock = completionBlock;
-    self.adhocProcessDefinitionCachedResultsBlock = cacheCompletionBlock;
+    ASDKProcessDefinitionDataAccessor *dataAccessor = [[ASDKProcessDefinitionDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchAdhocProcessDefinitionListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchAdhocProcessDefinitionListDataAccessor = [[ASDKProcessDefinitionDataAccessor alloc] initWithDelegate:self];
-    [self.fetchAdhocProcessDefinitionListDataAccessor fetchProcessDefinitionList];
+    [dataAccessor fetchProcessDefinitionList];
 }
 
 - (void)requestProcessDefinitionListForAppID:(NSString *)appID
@@ -124,26 +104,30 @@
                                cachedResults:(AFAProcessDefinitionListCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.processDefinitionCompletionBlock = completionBlock;
-    self.processDefinitionCachedResultsBlock = cacheCompletionBlock;
+    ASDKProcessDefinitionDataAccessor *dataAccessor = [[ASDKProcessDefinitionDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchProcessDefinitionListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchProcessDefinitionListDataAccessor = [[ASDKProcessDefinitionDataAccessor alloc] initWithDelegate:self];
-    [self.fetchProcessDefinitionListDataAccessor fetchProcessDefinitionListForAppID:appID];
+    [dataAccessor fetchProcessDefinitionListForAppID:appID];
 }
 
 - (void)requestProcessInstanceStartForProcessDefinition:(ASDKModelProcessDefinition *)processDefinition
                                         completionBlock:(AFAProcessInstanceCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.startProcessInstanceCompletionBlock = completionBlock;
-    
     ASDKStartProcessRequestRepresentation *startProcessRequestRepresentation = [ASDKStartProcessRequestRepresentation new];
     startProcessRequestRepresentation.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
     startProcessRequestRepresentation.processDefinitionID = processDefinition.modelID;
     startProcessRequestRepresentation.name = processDefinition.name;
     
-    self.startProcessInstanceDataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
-    [self.startProcessInstanceDataAccessor startProcessInstanceWithStartProcessRequestRepresentation:startProcessRequestRepresentation];
+    ASDKProcessInstanceDataAccessor *dataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleStartProcessInstanceDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    
+    [dataAccessor startProcessInstanceWithStartProcessRequestRepresentation:startProcessRequestRepresentation];
 }
 
 - (void)requestProcessInstanceDetailsForID:(NSString *)processInstanceID
@@ -151,11 +135,13 @@
                              cachedResults:(AFAProcessInstanceCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.processInstanceDetailsCompletionBlock = completionBlock;
-    self.processInstanceDetailsCachedResultsBlock = cacheCompletionBlock;
+    ASDKProcessInstanceDataAccessor *dataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchProcessInstanceDetailsDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchProcessInstanceDetailsDataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
-    [self.fetchProcessInstanceDetailsDataAccessor fetchProcessInstanceDetailsForProcessInstanceID:processInstanceID];
+    [dataAccessor fetchProcessInstanceDetailsForProcessInstanceID:processInstanceID];
 }
 
 - (void)requestProcessInstanceContentForProcessInstanceID:(NSString *)processInstanceID
@@ -163,11 +149,13 @@
                                             cachedResults:(AFAProcessInstanceContentCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.processInstanceContentCompletionBlock = completionBlock;
-    self.processInstanceContentCachedResultsBlock = cacheCompletionBlock;
+    ASDKProcessInstanceDataAccessor *dataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchProcessInstanceContentListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchProcessInstanceContentDataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
-    [self.fetchProcessInstanceContentDataAccessor fetchProcessInstanceContentForProcessInstanceID:processInstanceID];
+    [dataAccessor fetchProcessInstanceContentForProcessInstanceID:processInstanceID];
 }
 
 - (void)requestProcessInstanceCommentsForID:(NSString *)processInstanceID
@@ -175,11 +163,13 @@
                               cachedResults:(AFAProcessInstanceCommentsCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.processInstanceCommentsCompletionBlock = completionBlock;
-    self.processInstanceCommentsCachedResultsBlock = cacheCompletionBlock;
+    ASDKProcessInstanceDataAccessor *dataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchProcessInstanceCommentListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchProcessInstanceCommentListDataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
-    [self.fetchProcessInstanceCommentListDataAccessor fetchProcessInstanceCommentsForProcessInstanceID:processInstanceID];
+    [dataAccessor fetchProcessInstanceCommentsForProcessInstanceID:processInstanceID];
 }
 
 - (void)requestCreateComment:(NSString *)comment
@@ -187,21 +177,25 @@
              completionBlock:(AFAProcessInstanceCreateCommentCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.createprocessInstanceCommentCompletionBlock = completionBlock;
+    ASDKProcessInstanceDataAccessor *dataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleCreateProcessInstanceCommentDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.createProcessInstanceCommentDataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
-    [self.createProcessInstanceCommentDataAccessor createComment:comment
-                                            forProcessInstanceID:processInstanceID];
+    [dataAccessor createComment:comment
+           forProcessInstanceID:processInstanceID];
 }
 
 - (void)requestDeleteProcessInstanceWithID:(NSString *)processInstanceID
                            completionBlock:(AFAProcessInstanceDeleteCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.deleteProcessInstanceCompletionBlock = completionBlock;
+    ASDKProcessInstanceDataAccessor *dataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleDeleteProcessInstanceDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.deleteProcessInstanceDataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
-    [self.deleteProcessInstanceDataAccessor deleteProcessInstanceWithID:processInstanceID];
+    [dataAccessor deleteProcessInstanceWithID:processInstanceID];
 }
 
 - (void)requestDownloadAuditLogForProcessInstanceWithID:(NSString *)processInstanceID
@@ -210,12 +204,14 @@
                                         completionBlock:(AFAProcessInstanceContentDownloadCompletionBlock)completionBlock {
     NSParameterAssert(processInstanceID);
     
-    self.processInstanceAuditLogDownloadProgressBlock = progressBlock;
-    self.processInstanceAuditLogDownloadCompletionBlock = completionBlock;
+    ASDKProcessInstanceDataAccessor *dataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
+    dataAccessor.cachePolicy = allowCachedResults ? ASDKServiceDataAccessorCachingPolicyHybrid : ASDKServiceDataAccessorCachingPolicyAPIOnly;
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleProcessInstanceAuditLogDownloadDataAccessorResponse:forRequest:)];
+    request.progressBlock = progressBlock;
+    request.completionBlock = completionBlock;
     
-    self.processInstanceAuditLogDownloadDataAccessor = [[ASDKProcessInstanceDataAccessor alloc] initWithDelegate:self];
-    self.processInstanceAuditLogDownloadDataAccessor.cachePolicy = allowCachedResults ? ASDKServiceDataAccessorCachingPolicyHybrid : ASDKServiceDataAccessorCachingPolicyAPIOnly;
-    [self.processInstanceAuditLogDownloadDataAccessor downloadAuditLogForProcessInstanceWithID:processInstanceID];
+    [dataAccessor downloadAuditLogForProcessInstanceWithID:processInstanceID];
 }
 
 
@@ -224,49 +220,31 @@
 
 - (void)dataAccessor:(id<ASDKServiceDataAccessorProtocol>)dataAccessor
  didLoadDataResponse:(ASDKDataAccessorResponseBase *)response {
-    if (self.fetchProcessInstanceListDataAccessor == dataAccessor) {
-        [self handleFetchProcessInstanceListDataAccessorResponse:response];
-    } else if (self.fetchProcessInstanceDetailsDataAccessor == dataAccessor) {
-        [self handleFetchProcessInstanceDetailsDataAccessorResponse:response];
-    } else if (self.fetchProcessInstanceContentDataAccessor == dataAccessor) {
-        [self handleFetchProcessInstanceContentListDataAccessorResponse:response];
-    } else if (self.deleteProcessInstanceDataAccessor == dataAccessor) {
-        [self handleDeleteProcessInstanceDataAccessorResponse:response];
-    } else if (self.createProcessInstanceCommentDataAccessor == dataAccessor) {
-        [self handleCreateProcessInstanceCommentDataAccessorResponse:response];
-    } else if (self.fetchProcessInstanceCommentListDataAccessor == dataAccessor) {
-        [self handleFetchProcessInstanceCommentListDataAccessorResponse:response];
-    } else if (self.processInstanceAuditLogDownloadDataAccessor == dataAccessor) {
-        [self handleProcessInstanceAuditLogDownloadDataAccessorResponse:response];
-    } else if (self.fetchAdhocProcessDefinitionListDataAccessor == dataAccessor) {
-        [self handleFetchAdhocProcessDefinitionListDataAccessorResponse:response];
-    } else if (self.fetchProcessDefinitionListDataAccessor == dataAccessor) {
-        [self handleFetchProcessDefinitionListDataAccessorResponse:response];
-    } else if (self.startProcessInstanceDataAccessor == dataAccessor) {
-        [self handleStartProcessInstanceDataAccessorResponse:response];
-    }
+    [self.requestRegistry routeResponse:response
+                       fromDataAccessor:dataAccessor];
 }
 
 - (void)dataAccessorDidFinishedLoadingDataResponse:(id<ASDKServiceDataAccessorProtocol>)dataAccessor {
+    [self.requestRegistry finishRequestForDataAccessor:dataAccessor];
 }
 
 
 #pragma mark -
 #pragma mark Private interface
 
-- (void)handleFetchProcessInstanceListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchProcessInstanceListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *processInstanceListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *processInstanceList = processInstanceListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!processInstanceListResponse.error) {
         if (processInstanceListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAProcessServiceProcessInstanceListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.processInstanceCachedResultsBlock) {
-                    strongSelf.processInstanceCachedResultsBlock(processInstanceList, processInstanceListResponse.error, processInstanceListResponse.paging);
-                    strongSelf.processInstanceCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(processInstanceList, processInstanceListResponse.error, processInstanceListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -275,28 +253,28 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessServiceProcessInstanceListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.processInstanceListCompletionBlock) {
-            strongSelf.processInstanceListCompletionBlock(processInstanceList, processInstanceListResponse.error, processInstanceListResponse.paging);
-            strongSelf.processInstanceListCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(processInstanceList, processInstanceListResponse.error, processInstanceListResponse.paging);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleFetchProcessInstanceContentListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchProcessInstanceContentListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                       forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *processInstanceContentListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *processInstanceContentList = processInstanceContentListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!processInstanceContentListResponse.error) {
         if (processInstanceContentListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAProcessInstanceContentCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.processInstanceContentCachedResultsBlock) {
-                    strongSelf.processInstanceContentCachedResultsBlock(processInstanceContentList, processInstanceContentListResponse.error);
-                    strongSelf.processInstanceContentCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(processInstanceContentList, processInstanceContentListResponse.error);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -305,27 +283,27 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessInstanceContentCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.processInstanceContentCompletionBlock) {
-            strongSelf.processInstanceContentCompletionBlock(processInstanceContentList, processInstanceContentListResponse.error);
-            strongSelf.processInstanceContentCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(processInstanceContentList, processInstanceContentListResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleFetchProcessInstanceDetailsDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchProcessInstanceDetailsDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                   forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *processInstanceResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
     if (!processInstanceResponse.error) {
         if (processInstanceResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAProcessInstanceCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.processInstanceDetailsCachedResultsBlock) {
-                    strongSelf.processInstanceDetailsCachedResultsBlock(processInstanceResponse.model, nil);
-                    strongSelf.processInstanceDetailsCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(processInstanceResponse.model, nil);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -334,54 +312,54 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessInstanceCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.processInstanceDetailsCompletionBlock) {
-            strongSelf.processInstanceDetailsCompletionBlock(processInstanceResponse.model, processInstanceResponse.error);
-            strongSelf.processInstanceDetailsCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(processInstanceResponse.model, processInstanceResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleDeleteProcessInstanceDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleDeleteProcessInstanceDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                             forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *processInstanceDeleteResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessInstanceDeleteCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.deleteProcessInstanceCompletionBlock) {
-            strongSelf.deleteProcessInstanceCompletionBlock(processInstanceDeleteResponse.isConfirmation, processInstanceDeleteResponse.error);
+        if (completionBlock) {
+            completionBlock(processInstanceDeleteResponse.isConfirmation, processInstanceDeleteResponse.error);
         }
     });
 }
 
-- (void)handleCreateProcessInstanceCommentDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleCreateProcessInstanceCommentDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                    forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *processInstanceCommentResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessInstanceCreateCommentCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.createprocessInstanceCommentCompletionBlock) {
-            strongSelf.createprocessInstanceCommentCompletionBlock(processInstanceCommentResponse.model, processInstanceCommentResponse.error);
+        if (completionBlock) {
+            completionBlock(processInstanceCommentResponse.model, processInstanceCommentResponse.error);
         }
     });
 }
 
-- (void)handleFetchProcessInstanceCommentListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchProcessInstanceCommentListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                       forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *processInstanceCommentListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *processInstanceCommentList = processInstanceCommentListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!processInstanceCommentListResponse.error) {
         if (processInstanceCommentListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAProcessInstanceCommentsCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.processInstanceCommentsCachedResultsBlock) {
-                    strongSelf.processInstanceCommentsCachedResultsBlock(processInstanceCommentList, processInstanceCommentListResponse.error, processInstanceCommentListResponse.paging);
-                    strongSelf.processInstanceCommentsCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(processInstanceCommentList, processInstanceCommentListResponse.error, processInstanceCommentListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -390,56 +368,56 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessInstanceCommentsCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.processInstanceCommentsCompletionBlock) {
-            strongSelf.processInstanceCommentsCompletionBlock(processInstanceCommentList, processInstanceCommentListResponse.error, processInstanceCommentListResponse.paging);
-            strongSelf.processInstanceCommentsCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(processInstanceCommentList, processInstanceCommentListResponse.error, processInstanceCommentListResponse.paging);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleProcessInstanceAuditLogDownloadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
-    __weak typeof(self) weakSelf = self;
+- (void)handleProcessInstanceAuditLogDownloadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                       forRequest:(AFAServiceRequest *)request {
     if ([response isKindOfClass:[ASDKDataAccessorResponseProgress class]]) {
         ASDKDataAccessorResponseProgress *progressResponse = (ASDKDataAccessorResponseProgress *)response;
         NSString *formattedProgressString = progressResponse.formattedProgressString;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFAProcessInstanceContentDownloadProgressBlock progressBlock = request.progressBlock;
             
-            if (strongSelf.processInstanceAuditLogDownloadProgressBlock) {
-                strongSelf.processInstanceAuditLogDownloadProgressBlock(formattedProgressString, progressResponse.error);
+            if (progressBlock) {
+                progressBlock(formattedProgressString, progressResponse.error);
             }
         });
     } else if ([response isKindOfClass:[ASDKDataAccessorResponseModel class]]) {
         ASDKDataAccessorResponseModel *auditLogResponse = (ASDKDataAccessorResponseModel *)response;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFAProcessInstanceContentDownloadCompletionBlock completionBlock = request.completionBlock;
             
-            if (strongSelf.processInstanceAuditLogDownloadCompletionBlock) {
-                strongSelf.processInstanceAuditLogDownloadCompletionBlock(auditLogResponse.model, auditLogResponse.isCachedData, auditLogResponse.error);
-                strongSelf.processInstanceAuditLogDownloadCompletionBlock = nil;
-                strongSelf.processInstanceAuditLogDownloadProgressBlock = nil;
+            if (completionBlock) {
+                completionBlock(auditLogResponse.model, auditLogResponse.isCachedData, auditLogResponse.error);
+                request.completionBlock = nil;
+                request.progressBlock = nil;
             }
         });
     }
 }
 
-- (void)handleFetchProcessDefinitionListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchProcessDefinitionListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                  forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *processDefinitionListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *processDefinitionList = processDefinitionListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!processDefinitionListResponse.error) {
         if (processDefinitionListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAProcessDefinitionListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.processDefinitionCachedResultsBlock) {
-                    strongSelf.processDefinitionCachedResultsBlock(processDefinitionList, processDefinitionListResponse.error, processDefinitionListResponse.paging);
-                    strongSelf.processDefinitionCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(processDefinitionList, processDefinitionListResponse.error, processDefinitionListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -448,27 +426,27 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessDefinitionListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.processDefinitionCompletionBlock) {
-            strongSelf.processDefinitionCompletionBlock(processDefinitionList, processDefinitionListResponse.error, processDefinitionListResponse.paging);
+        if (completionBlock) {
+            completionBlock(processDefinitionList, processDefinitionListResponse.error, processDefinitionListResponse.paging);
         }
     });
 }
 
-- (void)handleFetchAdhocProcessDefinitionListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchAdhocProcessDefinitionListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                       forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *processDefinitionListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *processDefinitionList = processDefinitionListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!processDefinitionListResponse.error) {
         if (processDefinitionListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAProcessDefinitionListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.adhocProcessDefinitionCachedResultsBlock) {
-                    strongSelf.adhocProcessDefinitionCachedResultsBlock(processDefinitionList, processDefinitionListResponse.error, processDefinitionListResponse.paging);
-                    strongSelf.adhocProcessDefinitionCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(processDefinitionList, processDefinitionListResponse.error, processDefinitionListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -477,24 +455,24 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessDefinitionListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.adhocProcessDefinitionCompletionBlock) {
-            strongSelf.adhocProcessDefinitionCompletionBlock(processDefinitionList, processDefinitionListResponse.error, processDefinitionListResponse.paging);
-            strongSelf.adhocProcessDefinitionCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(processDefinitionList, processDefinitionListResponse.error, processDefinitionListResponse.paging);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleStartProcessInstanceDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleStartProcessInstanceDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                            forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *processInstanceStartResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProcessInstanceCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.startProcessInstanceCompletionBlock) {
-            strongSelf.startProcessInstanceCompletionBlock(processInstanceStartResponse.model, processInstanceStartResponse.error);
+        if (completionBlock) {
+            completionBlock(processInstanceStartResponse.model, processInstanceStartResponse.error);
         }
     });
 }
@@ -26,37 +26,35 @@
 
 // Managers
 #import "AFAKeychainWrapper.h"
+#import "AFAServiceRepository.h"
+#import "AFAUserDirectory.h"
+#import "AFAAvatarCache.h"
+#import "AFAServiceRequestRegistry.h"
 @import ActivitiSDK;
 
 static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRACE;
 
 @interface AFAProfileServices () <ASDKDataAccessorDelegate>
 
-// Current profile
-@property (strong, nonatomic) ASDKProfileDataAccessor                       *fetchCurrentProfileDataAccessor;
-@property (copy, nonatomic) AFAProfileCompletionBlock                       currentProfileCompletionBlock;
-@property (copy, nonatomic) AFAProfileCompletionBlock                       currentProfileCachedResultsBlock;
+@property (strong, nonatomic) AFAServiceRequestRegistry *requestRegistry;
 
-// Fetch current profile image
-@property (strong, nonatomic) ASDKProfileDataAccessor                       *fetchCurrentProfileImageDataAccessor;
-@property (copy, nonatomic) AFAProfileServicesProfileImageCompletionBlock   profileImageCompletionBlock;
-
-// Update current profile
-@property (strong, nonatomic) ASDKProfileDataAccessor                       *updateCurrentProfileDataAccessor;
-@property (copy, nonatomic) AFAProfileCompletionBlock                       updateCurrentProfileCompletionBlock;
+@end
 
-// Current profile password update
-@property (strong, nonatomic) ASDKProfileDataAccessor                       *updateCurrentProfilePasswordDataAccessor;
-@property (copy, nonatomic) AFAProfilePasswordCompletionBlock               updateProfilePasswordCompletionBlock;
+@implementation AFAProfileServices
 
-// Upload current profile image
-@property (strong, nonatomic) ASDKProfileDataAccessor                       *uploadCurrentProfileImageDataAccessor;
-@property (copy, nonatomic) AFAProfileContentProgressBlock                  uploadCurrentProfileImageProgressBlock;
-@property (copy, nonatomic) AFAProfileContentUploadCompletionBlock          uploadCurrentProfileImageCompletionBlock;
 
-@end
+#pragma mark -
+#pragma mark Life cycle
 
-@implementation AFAProfileServices
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _requestRegistry = [[AFAServiceRequestRegistry alloc] initWithTarget:self];
+    }
+    
+    return self;
+}
 
 
 #pragma mark -
@@ -64,10 +62,13 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
 
 - (void)requestProfileImageWithCompletionBlock:(AFAProfileServicesProfileImageCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
-    self.profileImageCompletionBlock = completionBlock;
     
-    self.fetchCurrentProfileImageDataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
-    [self.fetchCurrentProfileImageDataAccessor fetchCurrentUserProfileImage];
+    ASDKProfileDataAccessor *dataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleCurrentProfileImageDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    
+    [dataAccessor fetchCurrentUserProfileImage];
 }
 
 - (void)requestProfileWithCompletionBlock:(AFAProfileCompletionBlock)completionBlock {
@@ -88,33 +89,40 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
                               cachePolicy:(ASDKServiceDataAccessorCachingPolicy)cachePolicy {
     NSParameterAssert(completionBlock);
     
-    self.currentProfileCompletionBlock = completionBlock;
-    self.currentProfileCachedResultsBlock = cacheCompletionBlock;
-    
-    self.fetchCurrentProfileDataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
-    self.fetchCurrentProfileDataAccessor.cachePolicy = cachePolicy;
+    ASDKProfileDataAccessor *dataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
+    dataAccessor.cachePolicy = cachePolicy;
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleCurrentProfileDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    [self.fetchCurrentProfileDataAccessor fetchCurrentUserProfile];
+    [dataAccessor fetchCurrentUserProfile];
 }
 
 - (void)requestProfileUpdateWithModel:(ASDKModelProfile *)profileModel
                       completionBlock:(AFAProfileCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
-    self.updateCurrentProfileCompletionBlock = completionBlock;
     
-    self.updateCurrentProfileDataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
-    [self.updateCurrentProfileDataAccessor updateCurrentProfileWithModel:profileModel];
+    ASDKProfileDataAccessor *dataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleUpdateCurrentProfileDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    
+    [dataAccessor updateCurrentProfileWithModel:profileModel];
 }
 
 - (void)requestProfilePasswordUpdatedWithNewPassword:(NSString *)updatedPassword
                                          oldPassword:(NSString *)oldPassword
                                      completionBlock:(AFAProfilePasswordCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
-    self.updateProfilePasswordCompletionBlock = completionBlock;
     
-    self.updateCurrentProfilePasswordDataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
-    [self.updateCurrentProfilePasswordDataAccessor updateCurrentProfileWithNewPassword:updatedPassword
-                                                                           oldPassword:oldPassword];
+    ASDKProfileDataAccessor *dataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleUpdateCurrentProfilePasswordDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    
+    [dataAccessor updateCurrentProfileWithNewPassword:updatedPassword
+                                          oldPassword:oldPassword];
 }
 
 - (void)requestUploadProfileImageAtFileURL:(NSURL *)fileURL
@@ -123,23 +131,21 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
                            completionBlock:(AFAProfileContentUploadCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.uploadCurrentProfileImageProgressBlock = progressBlock;
-    self.uploadCurrentProfileImageCompletionBlock = completionBlock;
-    
     ASDKModelFileContent *fileContentModel = [ASDKModelFileContent new];
     fileContentModel.modelFileURL = fileURL;
     
-    self.uploadCurrentProfileImageDataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
-    [self.uploadCurrentProfileImageDataAccessor uploadCurrentProfileImageForContentModel:fileContentModel
-                                                                             contentData:contentData];
+    ASDKProfileDataAccessor *dataAccessor = [[ASDKProfileDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleUploadProfileImageForCurrentProfileDataAccessorResponse:forRequest:)];
+    request.progressBlock = progressBlock;
+    request.completionBlock = completionBlock;
+    
+    [dataAccessor uploadCurrentProfileImageForContentModel:fileContentModel
+                                               contentData:contentData];
 }
 
 - (void)cancellProfileNetworkRequests {
-    [self.fetchCurrentProfileDataAccessor cancelOperations];
-    [self.fetchCurrentProfileImageDataAccessor cancelOperations];
-    [self.updateCurrentProfileDataAccessor cancelOperations];
-    [self.updateCurrentProfilePasswordDataAccessor cancelOperations];
-    [self.uploadCurrentProfileImageDataAccessor cancelOperations];
+    [self.requestRegistry cancelAllRequests];
 }
 
 
@@ -148,53 +154,56 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
 
 - (void)dataAccessor:(id<ASDKServiceDataAccessorProtocol>)dataAccessor
  didLoadDataResponse:(ASDKDataAccessorResponseBase *)response {
-    if (self.fetchCurrentProfileImageDataAccessor == dataAccessor) {
-        [self handleCurrentProfileImageDataAccessorResponse:response];
-    } else if (self.fetchCurrentProfileDataAccessor == dataAccessor) {
-        [self handleCurrentProfileDataAccessorResponse:response];
-    } else if (self.updateCurrentProfileDataAccessor == dataAccessor) {
-        [self handleUpdateCurrentProfileDataAccessorResponse:response];
-    } else if (self.updateCurrentProfilePasswordDataAccessor == dataAccessor) {
-        [self handleUpdateCurrentProfilePasswordDataAccessorResponse:response];
-    } else if (self.uploadCurrentProfileImageDataAccessor == dataAccessor) {
-        [self handleUploadProfileImageForCurrentProfileDataAccessorResponse:response];
-    }
+    [self.requestRegistry routeResponse:response
+                       fromDataAccessor:dataAccessor];
 }
 
 - (void)dataAccessorDidFinishedLoadingDataResponse:(id<ASDKServiceDataAccessorProtocol>)dataAccessor {
+    [self.requestRegistry finishRequestForDataAccessor:dataAccessor];
 }
 
 
 #pragma mark -
 #pragma mark Private interface
 
-- (void)handleCurrentProfileImageDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleCurrentProfileImageDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                           forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *profileImageResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProfileServicesProfileImageCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.profileImageCompletionBlock) {
-            strongSelf.profileImageCompletionBlock(profileImageResponse.model, profileImageResponse.error);
-            strongSelf.profileImageCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(profileImageResponse.model, profileImageResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleCurrentProfileDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleCurrentProfileDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                      forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *profileResponse = (ASDKDataAccessorResponseModel *)response;
     ASDKModelProfile *profile = (ASDKModelProfile *)profileResponse.model;
     
-    __weak typeof(self) weakSelf = self;
+    if (!profileResponse.error && profile) {
+        AFAUserDirectory *userDirectory = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeUserDirectory];
+        [userDirectory storeUsers:@[profile]];
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            AFAAvatarCache *avatarCache = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeAvatarCache];
+            [avatarCache updateCurrentUserWithID:profile.modelID
+                                       pictureID:profile.pictureID];
+        });
+    }
+    
     if (!profileResponse.error) {
         if (profileResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFAProfileCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.currentProfileCachedResultsBlock) {
-                    strongSelf.currentProfileCachedResultsBlock(profile, nil);
-                    strongSelf.currentProfileCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(profile, nil);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -203,16 +212,17 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProfileCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.currentProfileCompletionBlock) {
-            strongSelf.currentProfileCompletionBlock(profile, profileResponse.error);
-            strongSelf.currentProfileCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(profile, profileResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleUpdateCurrentProfileDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleUpdateCurrentProfileDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                            forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *profileResponse = (ASDKDataAccessorResponseModel *)response;
     ASDKModelProfile *profile = (ASDKModelProfile *)profileResponse.model;
     
@@ -227,18 +237,18 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
         }
     }
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProfileCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.updateCurrentProfileCompletionBlock) {
-            strongSelf.updateCurrentProfileCompletionBlock(profile, profileResponse.error);
-            strongSelf.updateCurrentProfileCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(profile, profileResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleUpdateCurrentProfilePasswordDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleUpdateCurrentProfilePasswordDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                    forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *profileResponse = (ASDKDataAccessorResponseModel *)response;
     NSString *newPassword = profileResponse.model;
     
@@ -253,41 +263,47 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
         }
     }
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFAProfilePasswordCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.updateProfilePasswordCompletionBlock) {
-            strongSelf.updateProfilePasswordCompletionBlock(newPassword.length ? YES : NO, profileResponse.error);
-            strongSelf.updateProfilePasswordCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(newPassword.length ? YES : NO, profileResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleUploadProfileImageForCurrentProfileDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
-    __weak typeof(self) weakSelf = self;
+- (void)handleUploadProfileImageForCurrentProfileDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                           forRequest:(AFAServiceRequest *)request {
     if ([response isKindOfClass:[ASDKDataAccessorResponseProgress class]]) {
         ASDKDataAccessorResponseProgress *progressResponse = (ASDKDataAccessorResponseProgress *)response;
         NSUInteger progress = progressResponse.progress;
         AFALogVerbose(@"Profile image is %lu%% uploaded", (unsigned long)progress);
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFAProfileContentProgressBlock progressBlock = request.progressBlock;
             
-            if(strongSelf.uploadCurrentProfileImageProgressBlock) {
-                strongSelf.uploadCurrentProfileImageProgressBlock (progress, progressResponse.error);
+            if (progressBlock) {
+                progressBlock(progress, progressResponse.error);
             }
         });
     } else if ([response isKindOfClass:[ASDKDataAccessorResponseModel class]]) {
         ASDKDataAccessorResponseModel *contentResponse = (ASDKDataAccessorResponseModel *)response;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFAProfileContentUploadCompletionBlock completionBlock = request.completionBlock;
+            
+            // Cached avatars of the current user are outdated once a new
+            // profile image is uploaded
+            if (!contentResponse.error) {
+                AFAAvatarCache *avatarCache = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeAvatarCache];
+                [avatarCache invalidateCurrentUserAvatar];
+            }
             
-            if (strongSelf.uploadCurrentProfileImageCompletionBlock) {
-                strongSelf.uploadCurrentProfileImageCompletionBlock(contentResponse.error ? NO : YES, contentResponse.error);
-                strongSelf.uploadCurrentProfileImageCompletionBlock = nil;
-                strongSelf.uploadCurrentProfileImageProgressBlock = nil;
+            if (completionBlock) {
+                completionBlock(contentResponse.error ? NO : YES, contentResponse.error);
+                request.completionBlock = nil;
+                request.progressBlock = nil;
             }
         });
     }
@@ -58,6 +58,28 @@ typedef void  (^AFATaskServicesClaimCompletionBlock)            (BOOL isTaskClai
                   completionBlock:(AFATaskServicesTaskListCompletionBlock)completionBlock
                     cachedResults:(AFATaskServicesTaskListCompletionBlock)cacheCompletionBlock;
 
+/**
+ *  Performs a request for tasks like requestTaskListWithFilter:completionBlock:cachedResults:
+ *  does, but the cached task list is rebuilt from the server response instead of only being
+ *  updated with the tasks created since the last synchronization. Meant for user initiated
+ *  refreshes where tasks that were completed, reassigned or renamed must show up right away.
+ *
+ *  @param taskFilter           Filter object describing what properties should be filtered
+ *  @param completionBlock      Completion block providing the task list, an optional error reason and
+ *                              pagination information
+ *  @param cacheCompletionBlock Completion block providing a cached reference to the task
+ *                              list, an optional error and pagination information
+ */
+- (void)refreshTaskListWithFilter:(AFAGenericFilterModel *)taskFilter
+                  completionBlock:(AFATaskServicesTaskListCompletionBlock)completionBlock
+                    cachedResults:(AFATaskServicesTaskListCompletionBlock)cacheCompletionBlock;
+
+/**
+ *  Cancels the task list requests in flight. Their completion blocks are discarded and
+ *  will not be called, which makes it safe to drop a page that is no longer needed.
+ */
+- (void)cancelTaskListRequest;
+
 /**
  *  Performs a request for a task's details given the task ID.
  *
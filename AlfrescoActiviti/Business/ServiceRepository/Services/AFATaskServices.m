@@ -27,108 +27,35 @@
 // Services
 #import "AFAUserServices.h"
 #import "AFAServiceRepository.h"
+#import "AFAUserDirectory.h"
+
+// Managers
+#import "AFAServiceRequestRegistry.h"
 
 
 @interface AFATaskServices () <ASDKDataAccessorDelegate>
 
-// Task list
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *fetchTaskListDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskListCompletionBlock      taskListCompletionBlock;
-@property (copy, nonatomic) AFATaskServicesTaskListCompletionBlock      taskListCachedResultsBlock;
-
-// Task details
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *fetchTaskDetailsDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskDetailsCompletionBlock   taskDetailsCompletionBlock;
-@property (copy, nonatomic) AFATaskServicesTaskDetailsCompletionBlock   taskDetailsCachedResultsBlock;
-
-// Task content list
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *fetchTaskContentListDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskContentCompletionBlock   taskContentListCompletionBlock;
-@property (copy, nonatomic) AFATaskServicesTaskContentCompletionBlock   taskContentListCachedResultsBlock;
-
-// Task comment list
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *fetchTaskCommentListDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskCommentsCompletionBlock  taskCommentListCompletionBlock;
-@property (copy, nonatomic) AFATaskServicesTaskCommentsCompletionBlock  taskCommentListCachedResultsBlock;
-
-// Task checklist
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *fetchTaskChecklistDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskListCompletionBlock      taskChecklistCompletionBlock;
-@property (copy, nonatomic) AFATaskServicesTaskListCompletionBlock      taskChecklistCachedResultsBlock;
-
-// Task update
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *updateTaskDetailsDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskUpdateCompletionBlock    updateTaskDetailsCompletionBlock;
-
-// Task completion
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *completeTaskDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskCompleteCompletionBlock  completeTaskCompletionBlock;
-
-// Task content upload
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *taskContentUploadDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskContentUploadCompletionBlock taskContentUploadCompletionBlock;
-@property (copy, nonatomic) AFATaskServiceTaskContentProgressBlock      taskContentUploadProgressBlock;
-
-// Task content delete
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *taskContentDeleteDataAccessor;
-@property (copy, nonatomic) AFATaskServiceTaskContentDeleteCompletionBlock taskContentDeleteCompletionBlock;
-
-// Task content download
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *taskContentDownloadDataAccessor;
-@property (copy, nonatomic) AFATaskServiceTaskContentDownloadProgressBlock   taskContentDownloadProgressBlock;
-@property (copy, nonatomic) AFATaskServiceTaskContentDownloadCompletionBlock taskContentDownloadCompletionBlock;
-
-// Task content thumbnail download
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *taskContentThumbnailDownloadDataAccessor;
-@property (copy, nonatomic) AFATaskServiceTaskContentDownloadProgressBlock   taskContentThumbnailDownloadProgressBlock;
-@property (copy, nonatomic) AFATaskServiceTaskContentDownloadCompletionBlock taskContentThumbnailDownloadCompletionBlock;
-
-// Involve user
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *taskInvolveUserDataAccessor;
-@property (copy, nonatomic) AFATaskServicesUserInvolvementCompletionBlock   taskInvolveUserCompletionBlock;
-
-// Remove user
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *taskRemoveUserDataAccesor;
-@property (copy, nonatomic) AFATaskServicesUserInvolvementCompletionBlock   taskRemoveUserCompletionBlock;
-
-// Create task comment
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *createTaskCommentDataAccessor;
-@property (copy, nonatomic) AFATaskServicesCreateCommentCompletionBlock createTaskCommentCompletionBlock;
-
-// Create task
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *createTaskDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskDetailsCompletionBlock   createTaskCompletionBlock;
-
-// Claim task
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *claimTaskDataAccessor;
-@property (copy, nonatomic) AFATaskServicesClaimCompletionBlock         claimTaskCompletionBlock;
-
-// Unclaim task
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *unclaimTaskDataAccessor;
-@property (copy, nonatomic) AFATaskServicesClaimCompletionBlock         unclaimTaskCompletionBlock;
-
-// Assign task
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *assignTaskDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskDetailsCompletionBlock   assignTaskCompletionBlock;
-
-// Download task audit log
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *taskAuditLogDownloadDataAccessor;
-@property (copy, nonatomic) AFATaskServiceTaskContentDownloadProgressBlock   taskAuditLogDownloadProgressBlock;
-@property (copy, nonatomic) AFATaskServiceTaskContentDownloadCompletionBlock taskAuditLogDownloadCompletionBlock;
-
-// Create checklist
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *createTaskChecklistDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskDetailsCompletionBlock   createTaskChecklistCompletionBlock;
-
-// Update checklist order
-@property (strong, nonatomic) ASDKTaskDataAccessor                      *updateChecklistOrderDataAccessor;
-@property (copy, nonatomic) AFATaskServicesTaskUpdateCompletionBlock    updateChecklistOrderCompletionBlock;
+@property (strong, nonatomic) AFAServiceRequestRegistry *requestRegistry;
 
 @end
 
 @implementation AFATaskServices
 
 
+#pragma mark -
+#pragma mark Life cycle
+
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _requestRegistry = [[AFAServiceRequestRegistry alloc] initWithTarget:self];
+    }
+    
+    return self;
+}
+
+
 #pragma mark -
 #pragma mark Public interface
 
@@ -137,29 +64,24 @@
                     cachedResults:(AFATaskServicesTaskListCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskListCompletionBlock = completionBlock;
-    self.taskListCachedResultsBlock = cacheCompletionBlock;
-    
-    // Create request representation for the filter model
-    ASDKFilterRequestRepresentation *filterRequestRepresentation = [ASDKFilterRequestRepresentation new];
-    filterRequestRepresentation.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
-    filterRequestRepresentation.filterID = taskFilter.filterID;
-    filterRequestRepresentation.appDefinitionID = taskFilter.appDefinitionID;
-    filterRequestRepresentation.appDeploymentID = taskFilter.appDeploymentID;
-    
-    ASDKModelFilter *modelFilter = [ASDKModelFilter new];
-    modelFilter.jsonAdapterType = ASDKModelJSONAdapterTypeExcludeNilValues;
-    modelFilter.sortType = (NSInteger)taskFilter.sortType;
-    modelFilter.state = (NSInteger)taskFilter.state;
-    modelFilter.assignmentType = (NSInteger)taskFilter.assignmentType;
-    modelFilter.name = taskFilter.text;
-    
-    filterRequestRepresentation.filterModel = modelFilter;
-    filterRequestRepresentation.page = taskFilter.page;
-    filterRequestRepresentation.size = taskFilter.size;
+    ASDKTaskDataAccessor *dataAccessor = [self taskListDataAccessorWithCompletionBlock:completionBlock
+                                                                         cachedResults:cacheCompletionBlock];
+    [dataAccessor synchronizeTasksWithFilter:[self filterRequestRepresentationForTaskFilter:taskFilter]];
+}
+
+- (void)refreshTaskListWithFilter:(AFAGenericFilterModel *)taskFilter
+                  completionBlock:(AFATaskServicesTaskListCompletionBlock)completionBlock
+                    cachedResults:(AFATaskServicesTaskListCompletionBlock)cacheCompletionBlock {
+    NSParameterAssert(completionBlock);
     
-    self.fetchTaskListDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.fetchTaskListDataAccessor fetchTasksWithFilter:filterRequestRepresentation];
+    // A full fetch rebuilds the cached list and resets its synchronization state
+    ASDKTaskDataAccessor *dataAccessor = [self taskListDataAccessorWithCompletionBlock:completionBlock
+                                                                         cachedResults:cacheCompletionBlock];
+    [dataAccessor fetchTasksWithFilter:[self filterRequestRepresentationForTaskFilter:taskFilter]];
+}
+
+- (void)cancelTaskListRequest {
+    [self.requestRegistry detachRequestsWithResponseHandler:@selector(handleFetchTaskListDataAccessorResponse:forRequest:)];
 }
 
 - (void)requestTaskDetailsForID:(NSString *)taskID
@@ -167,11 +89,13 @@
                   cachedResults:(AFATaskServicesTaskDetailsCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskDetailsCompletionBlock = completionBlock;
-    self.taskDetailsCachedResultsBlock = cacheCompletionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchTaskDetailsDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchTaskDetailsDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.fetchTaskDetailsDataAccessor fetchTaskDetailsForTaskID:taskID];
+    [dataAccessor fetchTaskDetailsForTaskID:taskID];
 }
 
 - (void)requestTaskContentForID:(NSString *)taskID
@@ -179,11 +103,13 @@
                   cachedResults:(AFATaskServicesTaskContentCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskContentListCompletionBlock = completionBlock;
-    self.taskContentListCachedResultsBlock = cacheCompletionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchTaskContentListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchTaskContentListDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.fetchTaskContentListDataAccessor fetchTaskContentForTaskID:taskID];
+    [dataAccessor fetchTaskContentForTaskID:taskID];
 }
 
 - (void)requestTaskCommentsForID:(NSString *)taskID
@@ -191,11 +117,13 @@
                    cachedResults:(AFATaskServicesTaskCommentsCompletionBlock)cacheCompletionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskCommentListCompletionBlock = completionBlock;
-    self.taskCommentListCachedResultsBlock = cacheCompletionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchTaskCommentListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchTaskCommentListDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.fetchTaskCommentListDataAccessor fetchTaskCommentsForTaskID:taskID];
+    [dataAccessor fetchTaskCommentsForTaskID:taskID];
 }
 
 - (void)requestTaskUpdateWithRepresentation:(AFATaskUpdateModel *)update
@@ -203,8 +131,6 @@
                         withCompletionBlock:(AFATaskServicesTaskUpdateCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.updateTaskDetailsCompletionBlock = completionBlock;
-    
     // Create request representation for the task update model
     ASDKTaskUpdateRequestRepresentation *taskUpdateRequestRepresentation = [ASDKTaskUpdateRequestRepresentation new];
     taskUpdateRequestRepresentation.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeCustomPolicy;
@@ -226,19 +152,25 @@
     taskUpdateRequestRepresentation.taskDescription = update.taskDescription;
     taskUpdateRequestRepresentation.dueDate = update.taskDueDate;
     
-    self.updateTaskDetailsDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.updateTaskDetailsDataAccessor updateTaskWithID:taskID
-                                      withRepresentation:taskUpdateRequestRepresentation];
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleUpdateTaskDetailsDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    
+    [dataAccessor updateTaskWithID:taskID
+                withRepresentation:taskUpdateRequestRepresentation];
 }
 
 - (void)requestTaskCompletionForID:(NSString *)taskID
                withCompletionBlock:(AFATaskServicesTaskCompleteCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.completeTaskCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleCompleteTaskDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.completeTaskDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.completeTaskDataAccessor completeTaskWithID:taskID];
+    [dataAccessor completeTaskWithID:taskID];
 }
 
 - (void)requestContentUploadAtFileURL:(NSURL *)fileURL
@@ -248,23 +180,27 @@
                       completionBlock:(AFATaskServicesTaskContentUploadCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskContentUploadProgressBlock = progressBlock;
-    self.taskContentUploadCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskContentUploadDataAccessorResponse:forRequest:)];
+    request.progressBlock = progressBlock;
+    request.completionBlock = completionBlock;
     
-    self.taskContentUploadDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.taskContentUploadDataAccessor uploadContentForTaskWithID:taskID
-                                                       fromFileURL:fileURL
-                                                   withContentData:contentData];
+    [dataAccessor uploadContentForTaskWithID:taskID
+                                 fromFileURL:fileURL
+                             withContentData:contentData];
 }
 
 - (void)requestTaskContentDeleteForContent:(ASDKModelContent *)content
                        withCompletionBlock:(AFATaskServiceTaskContentDeleteCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskContentDeleteCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskContentDeleteDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.taskContentDeleteDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.taskContentDeleteDataAccessor deleteContent:content];
+    [dataAccessor deleteContent:content];
 }
 
 - (void)requestTaskContentDownloadForContent:(ASDKModelContent *)content
@@ -273,13 +209,14 @@
                          withCompletionBlock:(AFATaskServiceTaskContentDownloadCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskContentDownloadProgressBlock = progressBlock;
-    self.taskContentDownloadCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    dataAccessor.cachePolicy = allowCachedResults ? ASDKServiceDataAccessorCachingPolicyHybrid : ASDKServiceDataAccessorCachingPolicyAPIOnly;
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskContentDownloadDataAccessorResponse:forRequest:)];
+    request.progressBlock = progressBlock;
+    request.completionBlock = completionBlock;
     
-    self.taskContentDownloadDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    self.taskContentDownloadDataAccessor.cachePolicy = allowCachedResults ? ASDKServiceDataAccessorCachingPolicyHybrid : ASDKServiceDataAccessorCachingPolicyAPIOnly;
-    
-    [self.taskContentDownloadDataAccessor downloadTaskContent:content];
+    [dataAccessor downloadTaskContent:content];
 }
 
 - (void)requestTaskContentThumbnailDownloadForContent:(ASDKModelContent *)content
@@ -288,12 +225,14 @@
                                   withCompletionBlock:(AFATaskServiceTaskContentDownloadCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskContentThumbnailDownloadProgressBlock = progressBlock;
-    self.taskContentThumbnailDownloadCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    dataAccessor.cachePolicy = allowCachedResults ? ASDKServiceDataAccessorCachingPolicyHybrid : ASDKServiceDataAccessorCachingPolicyAPIOnly;
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskContentThumbnailDownloadDataAccessorResponse:forRequest:)];
+    request.progressBlock = progressBlock;
+    request.completionBlock = completionBlock;
     
-    self.taskContentThumbnailDownloadDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    self.taskContentThumbnailDownloadDataAccessor.cachePolicy = allowCachedResults ? ASDKServiceDataAccessorCachingPolicyHybrid : ASDKServiceDataAccessorCachingPolicyAPIOnly;
-    [self.taskContentThumbnailDownloadDataAccessor downloadThumbnailForTaskContent:content];
+    [dataAccessor downloadThumbnailForTaskContent:content];
 }
 
 - (void)requestTaskUserInvolvement:(ASDKModelUser *)user
@@ -301,11 +240,13 @@
                    completionBlock:(AFATaskServicesUserInvolvementCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskInvolveUserCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskUserInvolveDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.taskInvolveUserDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.taskInvolveUserDataAccessor involveUser:user
-                                     inTaskWithID:taskID];
+    [dataAccessor involveUser:user
+                 inTaskWithID:taskID];
 }
 
 - (void)requestToRemoveTaskUserInvolvement:(ASDKModelUser *)user
@@ -313,11 +254,13 @@
                            completionBlock:(AFATaskServicesUserInvolvementCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskRemoveUserCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskRemoveUserDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.taskRemoveUserDataAccesor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.taskRemoveUserDataAccesor removeInvolvedUser:user
-                                        fromTaskWithID:taskID];
+    [dataAccessor removeInvolvedUser:user
+                      fromTaskWithID:taskID];
 }
 
 - (void)requestCreateComment:(NSString *)comment
@@ -325,11 +268,13 @@
              completionBlock:(AFATaskServicesCreateCommentCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.createTaskCommentCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskCreateCommentDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.createTaskCommentDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.createTaskCommentDataAccessor createComment:comment
-                                        forTaskWithID:taskID];
+    [dataAccessor createComment:comment
+                  forTaskWithID:taskID];
 }
 
 - (void)requestCreateTaskWithRepresentation:(AFATaskCreateModel *)taskRepresentation
@@ -343,30 +288,36 @@
     taskCreationRequestRepresentation.assigneeID = taskRepresentation.assigneeID;
     taskCreationRequestRepresentation.jsonAdapterType = ASDKModelJSONAdapterTypeExcludeNilValues;
     
-    self.createTaskCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskCreateDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.createTaskDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.createTaskDataAccessor createTaskWithRepresentation:taskCreationRequestRepresentation];
+    [dataAccessor createTaskWithRepresentation:taskCreationRequestRepresentation];
 }
 
 - (void)requestTaskClaimForTaskID:(NSString *)taskID
                   completionBlock:(AFATaskServicesClaimCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.claimTaskCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskClaimDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.claimTaskDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.claimTaskDataAccessor claimTaskWithID:taskID];
+    [dataAccessor claimTaskWithID:taskID];
 }
 
 - (void)requestTaskUnclaimForTaskID:(NSString *)taskID
                     completionBlock:(AFATaskServicesClaimCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.unclaimTaskCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskUnclaimDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.unclaimTaskDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.unclaimTaskDataAccessor unclaimTaskWithID:taskID];
+    [dataAccessor unclaimTaskWithID:taskID];
 }
 
 - (void)requestTaskAssignForTaskWithID:(NSString *)taskID
@@ -374,11 +325,13 @@
                        completionBlock:(AFATaskServicesTaskDetailsCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.assignTaskCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskAssignDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
     
-    self.assignTaskDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.assignTaskDataAccessor assignTaskWithID:taskID
-                                           toUser:user];
+    [dataAccessor assignTaskWithID:taskID
+                            toUser:user];
 }
 
 - (void)requestDownloadAuditLogForTaskWithID:(NSString *)taskID
@@ -387,12 +340,14 @@
                              completionBlock:(AFATaskServiceTaskContentDownloadCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.taskAuditLogDownloadProgressBlock = progressBlock;
-    self.taskAuditLogDownloadCompletionBlock = completionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    dataAccessor.cachePolicy = allowCachedResults ? ASDKServiceDataAccessorCachingPolicyHybrid : ASDKServiceDataAccessorCachingPolicyAPIOnly;
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleTaskAuditLogDownloadDataAccessorResponse:forRequest:)];
+    request.progressBlock = progressBlock;
+    request.completionBlock = completionBlock;
     
-    self.taskAuditLogDownloadDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    self.taskAuditLogDownloadDataAccessor.cachePolicy = allowCachedResults ? ASDKServiceDataAccessorCachingPolicyHybrid : ASDKServiceDataAccessorCachingPolicyAPIOnly;
-    [self.taskAuditLogDownloadDataAccessor downloadAuditLogForTaskWithID:taskID];
+    [dataAccessor downloadAuditLogForTaskWithID:taskID];
 }
 
 - (void)requestChecklistForTaskWithID:(NSString *)taskID
@@ -401,11 +356,13 @@
     NSParameterAssert(taskID);
     NSParameterAssert(completionBlock);
     
-    self.taskChecklistCompletionBlock = completionBlock;
-    self.taskChecklistCachedResultsBlock = cacheCompletionBlock;
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchTaskChecklistDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
     
-    self.fetchTaskChecklistDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.fetchTaskChecklistDataAccessor fetchTaskCheckListForTaskID:taskID];
+    [dataAccessor fetchTaskCheckListForTaskID:taskID];
 }
 
 - (void)requestChecklistCreateWithRepresentation:(AFATaskCreateModel *)taskRepresentation
@@ -413,8 +370,6 @@
                                  completionBlock:(AFATaskServicesTaskDetailsCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.createTaskChecklistCompletionBlock = completionBlock;
-    
     ASDKTaskCreationRequestRepresentation *checklistCreationRequestRepresentation = [ASDKTaskCreationRequestRepresentation new];
     checklistCreationRequestRepresentation.taskName = taskRepresentation.taskName;
     checklistCreationRequestRepresentation.taskDescription = taskRepresentation.taskDescription;
@@ -422,9 +377,13 @@
     checklistCreationRequestRepresentation.parentTaskID = taskID;
     checklistCreationRequestRepresentation.jsonAdapterType = ASDKModelJSONAdapterTypeExcludeNilValues;
     
-    self.createTaskChecklistDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.createTaskChecklistDataAccessor createChecklisEntryWithRepresentation:checklistCreationRequestRepresentation
-                                                                  forTaskWithID:taskID];
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleCreateChecklistDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    
+    [dataAccessor createChecklisEntryWithRepresentation:checklistCreationRequestRepresentation
+                                          forTaskWithID:taskID];
 }
 
 - (void)requestChecklistOrderUpdateWithOrderArrat:(NSArray *)orderArray
@@ -432,14 +391,16 @@
                                   completionBlock:(AFATaskServicesTaskUpdateCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
     
-    self.updateChecklistOrderCompletionBlock = completionBlock;
-    
     ASDKTaskChecklistOrderRequestRepresentation *checklistOrderRequestRepresentation = [ASDKTaskChecklistOrderRequestRepresentation new];
     checklistOrderRequestRepresentation.checklistOrder = orderArray;
     
-    self.updateChecklistOrderDataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
-    [self.updateChecklistOrderDataAccessor updateChecklistOrderWithRepresentation:checklistOrderRequestRepresentation
-                                                                    forTaskWithID:taskID];
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleUpdateChecklistOrderDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    
+    [dataAccessor updateChecklistOrderWithRepresentation:checklistOrderRequestRepresentation
+                                           forTaskWithID:taskID];
 }
 
 
@@ -448,117 +409,64 @@
 
 - (void)dataAccessor:(id<ASDKServiceDataAccessorProtocol>)dataAccessor
  didLoadDataResponse:(ASDKDataAccessorResponseBase *)response {
-    // Fetch lists
-    if (self.fetchTaskListDataAccessor == dataAccessor) {
-        [self handleFetchTaskListDataAccessorResponse:response];
-    }
-    
-    if (self.fetchTaskContentListDataAccessor == dataAccessor) {
-        [self handleFetchTaskContentListDataAccessorResponse:response];
-    }
-    
-    if (self.fetchTaskCommentListDataAccessor == dataAccessor) {
-        [self handleFetchTaskCommentListDataAccessorResponse:response];
-    }
-    
-    if (self.fetchTaskChecklistDataAccessor == dataAccessor) {
-        [self handleFetchTaskChecklistDataAccessorResponse:response];
-    }
-    
-    // Fetch details
-    if (self.fetchTaskDetailsDataAccessor == dataAccessor) {
-        [self handleFetchTaskDetailsDataAccessorResponse:response];
-    }
-    
-    // Create operations
-    if (self.createTaskDataAccessor == dataAccessor) {
-        [self handleTaskCreateDataAccessorResponse:response];
-    }
-    
-    if (self.createTaskCommentDataAccessor == dataAccessor) {
-        [self handleTaskCreateCommentDataAccessorResponse:response];
-    }
-    
-    if (self.createTaskChecklistDataAccessor == dataAccessor) {
-        [self handleCreateChecklistDataAccessorResponse:response];
-    }
-    
-    // Update operations
-    if (self.completeTaskDataAccessor == dataAccessor) {
-        [self handleCompleteTaskDataAccessorResponse:response];
-    }
-    
-    if (self.updateTaskDetailsDataAccessor == dataAccessor) {
-        [self handleUpdateTaskDetailsDataAccessorResponse:response];
-    }
-    
-    if (self.taskInvolveUserDataAccessor == dataAccessor ||
-        self.taskRemoveUserDataAccesor == dataAccessor) {
-        [self handleTaskUserInvolveDataAccessorResponse:response];
-    }
-    
-    if (self.claimTaskDataAccessor == dataAccessor) {
-        [self handleTaskClaimDataAccessorResponse:response];
-    }
-    
-    if (self.unclaimTaskDataAccessor == dataAccessor) {
-        [self handleTaskUnclaimDataAccessorResponse:response];
-    }
-    
-    if (self.assignTaskDataAccessor == dataAccessor) {
-        [self handleTaskAssignDataAccessorResponse:response];
-    }
-    
-    if (self.updateChecklistOrderDataAccessor == dataAccessor) {
-        [self handleUpdateChecklistOrderDataAccessorResponse:response];
-    }
-    
-    // Delete operations
-    if (self.taskContentDeleteDataAccessor == dataAccessor) {
-        [self handleTaskContentDeleteDataAccessorResponse:response];
-    }
-    if (self.taskRemoveUserDataAccesor == dataAccessor) {
-        [self handleTaskRemoveUserDataAccessorResponse:response];
-    }
-    
-    // Content upload and download
-    if (self.taskContentUploadDataAccessor == dataAccessor) {
-        [self handleTaskContentUploadDataAccessorResponse:response];
-    }
-    
-    if (self.taskContentDownloadDataAccessor == dataAccessor) {
-        [self handleTaskContentDownloadDataAccessorResponse:response];
-    }
-    
-    if (self.taskContentThumbnailDownloadDataAccessor == dataAccessor) {
-        [self handleTaskContentThumbnailDownloadDataAccessorResponse:response];
-    }
-    
-    if (self.taskAuditLogDownloadDataAccessor == dataAccessor) {
-        [self handleTaskAuditLogDownloadDataAccessorResponse:response];
-    }
+    [self.requestRegistry routeResponse:response
+                       fromDataAccessor:dataAccessor];
 }
 
 - (void)dataAccessorDidFinishedLoadingDataResponse:(id<ASDKServiceDataAccessorProtocol>)dataAccessor {
+    [self.requestRegistry finishRequestForDataAccessor:dataAccessor];
 }
 
 
 #pragma mark -
 #pragma mark Private interface
 
-- (void)handleFetchTaskListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (ASDKFilterRequestRepresentation *)filterRequestRepresentationForTaskFilter:(AFAGenericFilterModel *)taskFilter {
+    // Create request representation for the filter model
+    ASDKFilterRequestRepresentation *filterRequestRepresentation = [ASDKFilterRequestRepresentation new];
+    filterRequestRepresentation.jsonAdapterType = ASDKRequestRepresentationJSONAdapterTypeExcludeNilValues;
+    filterRequestRepresentation.filterID = taskFilter.filterID;
+    filterRequestRepresentation.appDefinitionID = taskFilter.appDefinitionID;
+    filterRequestRepresentation.appDeploymentID = taskFilter.appDeploymentID;
+    
+    ASDKModelFilter *modelFilter = [ASDKModelFilter new];
+    modelFilter.jsonAdapterType = ASDKModelJSONAdapterTypeExcludeNilValues;
+    modelFilter.sortType = (NSInteger)taskFilter.sortType;
+    modelFilter.state = (NSInteger)taskFilter.state;
+    modelFilter.assignmentType = (NSInteger)taskFilter.assignmentType;
+    modelFilter.name = taskFilter.text;
+    
+    filterRequestRepresentation.filterModel = modelFilter;
+    filterRequestRepresentation.page = taskFilter.page;
+    filterRequestRepresentation.size = taskFilter.size;
+    
+    return filterRequestRepresentation;
+}
+
+- (ASDKTaskDataAccessor *)taskListDataAccessorWithCompletionBlock:(AFATaskServicesTaskListCompletionBlock)completionBlock
+                                                    cachedResults:(AFATaskServicesTaskListCompletionBlock)cacheCompletionBlock {
+    ASDKTaskDataAccessor *dataAccessor = [[ASDKTaskDataAccessor alloc] initWithDelegate:self];
+    AFAServiceRequest *request = [self.requestRegistry registerDataAccessor:dataAccessor
+                                                            responseHandler:@selector(handleFetchTaskListDataAccessorResponse:forRequest:)];
+    request.completionBlock = completionBlock;
+    request.cachedResultsBlock = cacheCompletionBlock;
+    
+    return dataAccessor;
+}
+
+- (void)handleFetchTaskListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                     forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *taskListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *taskList = taskListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!taskListResponse.error) {
         if (taskListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFATaskServicesTaskListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.taskListCachedResultsBlock) {
-                    strongSelf.taskListCachedResultsBlock(taskList, nil, taskListResponse.paging);
-                    strongSelf.taskListCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(taskList, nil, taskListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -567,27 +475,37 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskListCompletionBlock) {
-            strongSelf.taskListCompletionBlock(taskList, taskListResponse.error, taskListResponse.paging);
-            strongSelf.taskListCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskList, taskListResponse.error, taskListResponse.paging);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleFetchTaskDetailsDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchTaskDetailsDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                        forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *taskResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
+    // Make the people related to the task available to local people searches
+    ASDKModelTask *task = (ASDKModelTask *)taskResponse.model;
+    if (!taskResponse.error && task) {
+        AFAUserDirectory *userDirectory = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeUserDirectory];
+        [userDirectory storeUsers:task.involvedPeople];
+        if (task.assigneeModel) {
+            [userDirectory storeUsers:@[task.assigneeModel]];
+        }
+    }
+    
     if (!taskResponse.error) {
         if (taskResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFATaskServicesTaskDetailsCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.taskDetailsCachedResultsBlock) {
-                    strongSelf.taskDetailsCachedResultsBlock(taskResponse.model, nil);
-                    strongSelf.taskDetailsCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(taskResponse.model, nil);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -596,28 +514,28 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskDetailsCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskDetailsCompletionBlock) {
-            strongSelf.taskDetailsCompletionBlock(taskResponse.model, taskResponse.error);
-            strongSelf.taskDetailsCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskResponse.model, taskResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleFetchTaskContentListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchTaskContentListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                            forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *taskContentListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *contentList = taskContentListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!taskContentListResponse.error) {
         if (taskContentListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFATaskServicesTaskContentCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.taskContentListCachedResultsBlock) {
-                    strongSelf.taskContentListCachedResultsBlock(contentList, nil);
-                    strongSelf.taskContentListCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(contentList, nil);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -626,28 +544,28 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskContentCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskContentListCompletionBlock) {
-            strongSelf.taskContentListCompletionBlock(contentList, taskContentListResponse.error);
-            strongSelf.taskContentListCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(contentList, taskContentListResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleFetchTaskCommentListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchTaskCommentListDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                            forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *taskCommentListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *commentList = taskCommentListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!taskCommentListResponse.error) {
         if (taskCommentListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFATaskServicesTaskCommentsCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.taskCommentListCachedResultsBlock) {
-                    strongSelf.taskCommentListCachedResultsBlock(commentList, nil, taskCommentListResponse.paging);
-                    strongSelf.taskCommentListCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(commentList, nil, taskCommentListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -656,27 +574,27 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskCommentsCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskCommentListCompletionBlock) {
-            strongSelf.taskCommentListCompletionBlock(commentList, taskCommentListResponse.error, taskCommentListResponse.paging);
+        if (completionBlock) {
+            completionBlock(commentList, taskCommentListResponse.error, taskCommentListResponse.paging);
         }
     });
 }
 
-- (void)handleFetchTaskChecklistDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleFetchTaskChecklistDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                          forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseCollection *taskCheckListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *checklist = taskCheckListResponse.collection;
     
-    __weak typeof(self) weakSelf = self;
     if (!taskCheckListResponse.error) {
         if (taskCheckListResponse.isCachedData) {
             dispatch_async(dispatch_get_main_queue(), ^{
-                __strong typeof(self) strongSelf = weakSelf;
+                AFATaskServicesTaskListCompletionBlock cachedResultsBlock = request.cachedResultsBlock;
                 
-                if (strongSelf.taskChecklistCachedResultsBlock) {
-                    strongSelf.taskChecklistCachedResultsBlock(checklist, nil, taskCheckListResponse.paging);
-                    strongSelf.taskChecklistCachedResultsBlock = nil;
+                if (cachedResultsBlock) {
+                    cachedResultsBlock(checklist, nil, taskCheckListResponse.paging);
+                    request.cachedResultsBlock = nil;
                 }
             });
             
@@ -685,287 +603,287 @@
     }
     
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskListCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskChecklistCompletionBlock) {
-            strongSelf.taskChecklistCompletionBlock(checklist, taskCheckListResponse.error, taskCheckListResponse.paging);
+        if (completionBlock) {
+            completionBlock(checklist, taskCheckListResponse.error, taskCheckListResponse.paging);
         }
     });
 }
 
-- (void)handleUpdateTaskDetailsDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleUpdateTaskDetailsDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                         forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *taskUpdateResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskUpdateCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.updateTaskDetailsCompletionBlock) {
-            strongSelf.updateTaskDetailsCompletionBlock(taskUpdateResponse.isConfirmation, taskUpdateResponse.error);
+        if (completionBlock) {
+            completionBlock(taskUpdateResponse.isConfirmation, taskUpdateResponse.error);
         }
     });
 }
 
-- (void)handleCompleteTaskDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleCompleteTaskDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                    forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *taskCompleteResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskCompleteCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.completeTaskCompletionBlock) {
-            strongSelf.completeTaskCompletionBlock(taskCompleteResponse.isConfirmation, taskCompleteResponse.error);
+        if (completionBlock) {
+            completionBlock(taskCompleteResponse.isConfirmation, taskCompleteResponse.error);
         }
     });
 }
 
-- (void)handleTaskContentUploadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
-    __weak typeof(self) weakSelf = self;
+- (void)handleTaskContentUploadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                         forRequest:(AFAServiceRequest *)request {
     if ([response isKindOfClass:[ASDKDataAccessorResponseProgress class]]) {
         ASDKDataAccessorResponseProgress *progressResponse = (ASDKDataAccessorResponseProgress *)response;
         NSUInteger progress = progressResponse.progress;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFATaskServiceTaskContentProgressBlock progressBlock = request.progressBlock;
             
-            if (strongSelf.taskContentUploadProgressBlock) {
-                strongSelf.taskContentUploadProgressBlock(progress, progressResponse.error);
+            if (progressBlock) {
+                progressBlock(progress, progressResponse.error);
             }
         });
     } else if ([response isKindOfClass:[ASDKDataAccessorResponseModel class]]) {
         ASDKDataAccessorResponseModel *contentResponse = (ASDKDataAccessorResponseModel *)response;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFATaskServicesTaskContentUploadCompletionBlock completionBlock = request.completionBlock;
             
-            if (strongSelf.taskContentUploadCompletionBlock) {
-                strongSelf.taskContentUploadCompletionBlock(contentResponse.model ? YES : NO, contentResponse.error);
-                strongSelf.taskContentUploadCompletionBlock = nil;
-                strongSelf.taskContentUploadProgressBlock = nil;
+            if (completionBlock) {
+                completionBlock(contentResponse.model ? YES : NO, contentResponse.error);
+                request.completionBlock = nil;
+                request.progressBlock = nil;
             }
         });
     }
 }
 
-- (void)handleTaskContentDeleteDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleTaskContentDeleteDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                         forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *contentDeleteResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServiceTaskContentDeleteCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskContentDeleteCompletionBlock) {
-            strongSelf.taskContentDeleteCompletionBlock(contentDeleteResponse.isConfirmation, contentDeleteResponse.error);
+        if (completionBlock) {
+            completionBlock(contentDeleteResponse.isConfirmation, contentDeleteResponse.error);
         }
     });
 }
 
-- (void)handleTaskContentDownloadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
-    __weak typeof(self) weakSelf = self;
+- (void)handleTaskContentDownloadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                           forRequest:(AFAServiceRequest *)request {
     if ([response isKindOfClass:[ASDKDataAccessorResponseProgress class]]) {
         ASDKDataAccessorResponseProgress *progressResponse = (ASDKDataAccessorResponseProgress *)response;
         NSString *formattedProgressString = progressResponse.formattedProgressString;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFATaskServiceTaskContentDownloadProgressBlock progressBlock = request.progressBlock;
             
-            if (strongSelf.taskContentDownloadProgressBlock) {
-                strongSelf.taskContentDownloadProgressBlock(formattedProgressString, progressResponse.error);
+            if (progressBlock) {
+                progressBlock(formattedProgressString, progressResponse.error);
             }
         });
     } else if ([response isKindOfClass:[ASDKDataAccessorResponseModel class]]) {
         ASDKDataAccessorResponseModel *contentResponse = (ASDKDataAccessorResponseModel *)response;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFATaskServiceTaskContentDownloadCompletionBlock completionBlock = request.completionBlock;
             
-            if (strongSelf.taskContentDownloadCompletionBlock) {
-                strongSelf.taskContentDownloadCompletionBlock(contentResponse.model, contentResponse.isCachedData, contentResponse.error);
-                strongSelf.taskContentDownloadCompletionBlock = nil;
-                strongSelf.taskContentDownloadProgressBlock = nil;
+            if (completionBlock) {
+                completionBlock(contentResponse.model, contentResponse.isCachedData, contentResponse.error);
+                request.completionBlock = nil;
+                request.progressBlock = nil;
             }
         });
     }
 }
 
-- (void)handleTaskContentThumbnailDownloadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
-    __weak typeof(self) weakSelf = self;
+- (void)handleTaskContentThumbnailDownloadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                                    forRequest:(AFAServiceRequest *)request {
     if ([response isKindOfClass:[ASDKDataAccessorResponseProgress class]]) {
         ASDKDataAccessorResponseProgress *progressResponse = (ASDKDataAccessorResponseProgress *)response;
         NSString *formattedProgressString = progressResponse.formattedProgressString;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFATaskServiceTaskContentDownloadProgressBlock progressBlock = request.progressBlock;
             
-            if (strongSelf.taskContentThumbnailDownloadProgressBlock) {
-                strongSelf.taskContentThumbnailDownloadProgressBlock(formattedProgressString, progressResponse.error);
+            if (progressBlock) {
+                progressBlock(formattedProgressString, progressResponse.error);
             }
         });
     } else if ([response isKindOfClass:[ASDKDataAccessorResponseModel class]]) {
         ASDKDataAccessorResponseModel *contentResponse = (ASDKDataAccessorResponseModel *)response;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFATaskServiceTaskContentDownloadCompletionBlock completionBlock = request.completionBlock;
             
-            if (strongSelf.taskContentThumbnailDownloadCompletionBlock) {
-                strongSelf.taskContentThumbnailDownloadCompletionBlock(contentResponse.model, contentResponse.isCachedData, contentResponse.error);
-                strongSelf.taskContentThumbnailDownloadCompletionBlock = nil;
-                strongSelf.taskContentThumbnailDownloadProgressBlock = nil;
+            if (completionBlock) {
+                completionBlock(contentResponse.model, contentResponse.isCachedData, contentResponse.error);
+                request.completionBlock = nil;
+                request.progressBlock = nil;
             }
         });
     }
 }
 
-- (void)handleTaskUserInvolveDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleTaskUserInvolveDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                       forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *taskInvolveResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesUserInvolvementCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskInvolveUserCompletionBlock) {
-            strongSelf.taskInvolveUserCompletionBlock(taskInvolveResponse.isConfirmation, taskInvolveResponse.error);
-            strongSelf.taskInvolveUserCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskInvolveResponse.isConfirmation, taskInvolveResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleTaskRemoveUserDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleTaskRemoveUserDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                      forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *taskInvolveResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesUserInvolvementCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.taskRemoveUserCompletionBlock) {
-            strongSelf.taskRemoveUserCompletionBlock(taskInvolveResponse.isConfirmation, taskInvolveResponse.error);
-            strongSelf.taskRemoveUserCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskInvolveResponse.isConfirmation, taskInvolveResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleTaskCreateCommentDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleTaskCreateCommentDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                         forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *commentResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesCreateCommentCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.createTaskCommentCompletionBlock) {
-            strongSelf.createTaskCommentCompletionBlock(commentResponse.model, commentResponse.error);
-            strongSelf.createTaskCommentCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(commentResponse.model, commentResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleTaskCreateDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleTaskCreateDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                  forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *taskResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskDetailsCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.createTaskCompletionBlock) {
-            strongSelf.createTaskCompletionBlock(taskResponse.model, taskResponse.error);
-            strongSelf.createTaskCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskResponse.model, taskResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleTaskClaimDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleTaskClaimDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                 forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *taskClaimResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesClaimCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.claimTaskCompletionBlock) {
-            strongSelf.claimTaskCompletionBlock(taskClaimResponse.isConfirmation, taskClaimResponse.error);
-            strongSelf.claimTaskCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskClaimResponse.isConfirmation, taskClaimResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleTaskUnclaimDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleTaskUnclaimDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                   forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *taskClaimResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesClaimCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.unclaimTaskCompletionBlock) {
-            strongSelf.unclaimTaskCompletionBlock(taskClaimResponse.isConfirmation, taskClaimResponse.error);
-            strongSelf.unclaimTaskCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskClaimResponse.isConfirmation, taskClaimResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleTaskAssignDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleTaskAssignDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                  forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *taskResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskDetailsCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.assignTaskCompletionBlock) {
-            strongSelf.assignTaskCompletionBlock(taskResponse.model, taskResponse.error);
-            strongSelf.assignTaskCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskResponse.model, taskResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleTaskAuditLogDownloadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
-    __weak typeof(self) weakSelf = self;
+- (void)handleTaskAuditLogDownloadDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                            forRequest:(AFAServiceRequest *)request {
     if ([response isKindOfClass:[ASDKDataAccessorResponseProgress class]]) {
         ASDKDataAccessorResponseProgress *progressResponse = (ASDKDataAccessorResponseProgress *)response;
         NSString *formattedProgressString = progressResponse.formattedProgressString;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFATaskServiceTaskContentDownloadProgressBlock progressBlock = request.progressBlock;
             
-            if (strongSelf.taskAuditLogDownloadProgressBlock) {
-                strongSelf.taskAuditLogDownloadProgressBlock(formattedProgressString, progressResponse.error);
+            if (progressBlock) {
+                progressBlock(formattedProgressString, progressResponse.error);
             }
         });
     } else if ([response isKindOfClass:[ASDKDataAccessorResponseModel class]]) {
         ASDKDataAccessorResponseModel *auditLogResponse = (ASDKDataAccessorResponseModel *)response;
         
         dispatch_async(dispatch_get_main_queue(), ^{
-            __strong typeof(self) strongSelf = weakSelf;
+            AFATaskServiceTaskContentDownloadCompletionBlock completionBlock = request.completionBlock;
             
-            if (strongSelf.taskAuditLogDownloadCompletionBlock) {
-                strongSelf.taskAuditLogDownloadCompletionBlock(auditLogResponse.model, auditLogResponse.isCachedData, auditLogResponse.error);
-                strongSelf.taskAuditLogDownloadCompletionBlock = nil;
-                strongSelf.taskAuditLogDownloadProgressBlock = nil;
+            if (completionBlock) {
+                completionBlock(auditLogResponse.model, auditLogResponse.isCachedData, auditLogResponse.error);
+                request.completionBlock = nil;
+                request.progressBlock = nil;
             }
         });
     }
 }
 
-- (void)handleCreateChecklistDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleCreateChecklistDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                       forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseModel *taskResponse = (ASDKDataAccessorResponseModel *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskDetailsCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.createTaskChecklistCompletionBlock) {
-            strongSelf.createTaskChecklistCompletionBlock(taskResponse.model, taskResponse.error);
-            strongSelf.createTaskChecklistCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskResponse.model, taskResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
 
-- (void)handleUpdateChecklistOrderDataAccessorResponse:(ASDKDataAccessorResponseBase *)response {
+- (void)handleUpdateChecklistOrderDataAccessorResponse:(ASDKDataAccessorResponseBase *)response
+                                            forRequest:(AFAServiceRequest *)request {
     ASDKDataAccessorResponseConfirmation *taskChecklistUpdateResponse = (ASDKDataAccessorResponseConfirmation *)response;
     
-    __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-        __strong typeof(self) strongSelf = weakSelf;
+        AFATaskServicesTaskUpdateCompletionBlock completionBlock = request.completionBlock;
         
-        if (strongSelf.updateChecklistOrderCompletionBlock) {
-            strongSelf.updateChecklistOrderCompletionBlock(taskChecklistUpdateResponse.isConfirmation, taskChecklistUpdateResponse.error);
-            strongSelf.updateChecklistOrderCompletionBlock = nil;
+        if (completionBlock) {
+            completionBlock(taskChecklistUpdateResponse.isConfirmation, taskChecklistUpdateResponse.error);
+            request.completionBlock = nil;
         }
     });
 }
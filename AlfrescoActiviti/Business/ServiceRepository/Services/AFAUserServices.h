@@ -38,6 +38,12 @@ typedef void  (^AFAUserPictureCompletionBlock) (UIImage *profileImage, NSError *
 - (void)requestUsersWithUserFilter:(AFAUserFilterModel *)filter
                    completionBlock:(AFAUserServicesFetchCompletionBlock)completionBlock;
 
+/**
+ *  Cancels the user list request in flight. Its completion block is discarded and
+ *  will not be called, which makes it safe to supersede a search with a newer one.
+ */
+- (void)cancelUserListRequest;
+
 /**
  *  Performs a request and returns via the completion block the profile picture of a user given it's
  *  user ID.
@@ -25,6 +25,10 @@
 // Models
 #import "AFAUserFilterModel.h"
 
+// Managers
+#import "AFAServiceRepository.h"
+#import "AFAUserDirectory.h"
+
 @interface AFAUserServices () <ASDKDataAccessorDelegate>
 
 // Fetch user list
@@ -61,6 +65,12 @@
     [self.fetchUserListDataAccessor fetchUsersWithUserFilter:userRequestRepresentation];
 }
 
+- (void)cancelUserListRequest {
+    self.fetchUserListDataAccessor.delegate = nil;
+    self.fetchUserListDataAccessor = nil;
+    self.userListCompletionBlock = nil;
+}
+
 - (void)requestPictureForUserID:(NSString *)userID
                 completionBlock:(AFAUserPictureCompletionBlock)completionBlock {
     NSParameterAssert(completionBlock);
@@ -101,11 +111,21 @@
     ASDKDataAccessorResponseCollection *userListResponse = (ASDKDataAccessorResponseCollection *)response;
     NSArray *userList = userListResponse.collection;
     
+    // Keep the found users around to answer later searches locally
+    if (!userListResponse.error) {
+        AFAUserDirectory *userDirectory = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeUserDirectory];
+        [userDirectory storeUsers:userList];
+    }
+    
+    // Results of a request that was superseded in the meantime are dropped
+    ASDKUserDataAccessor *respondingDataAccessor = self.fetchUserListDataAccessor;
+    
     __weak typeof(self) weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
         __strong typeof(self) strongSelf = weakSelf;
         
-        if (strongSelf.userListCompletionBlock) {
+        if (strongSelf.userListCompletionBlock &&
+            strongSelf.fetchUserListDataAccessor == respondingDataAccessor) {
             strongSelf.userListCompletionBlock(userList, userListResponse.error, userListResponse.paging);
             strongSelf.userListCompletionBlock = nil;
         }
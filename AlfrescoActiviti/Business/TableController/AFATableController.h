@@ -76,6 +76,23 @@ heightForHeaderInSection:(NSInteger)section
 - (UITableViewCellEditingStyle)tableView:(UITableView *)tableView
            editingStyleForRowAtIndexPath:(NSIndexPath *)indexPath;
 
+// Row heights are cached only for factories returning a layout identifier. The
+// identifier names the displayed content and the version changes along with it.
+- (NSString *)tableView:(UITableView *)tableView
+layoutIdentifierForRowAtIndexPath:(NSIndexPath *)indexPath
+               forModel:(id<AFATableViewModelDelegate>)model;
+
+- (NSUInteger)tableView:(UITableView *)tableView
+layoutVersionForRowAtIndexPath:(NSIndexPath *)indexPath
+               forModel:(id<AFATableViewModelDelegate>)model;
+
+// Estimates the height of a row for the passed item by measuring text only. It is
+// called off the main thread so it must not touch views or the model. Estimates are
+// used until the row is displayed, its height then comes from a self-sizing pass.
+// A value that is not positive means no estimate is available.
+- (CGFloat)heightForItem:(id)item
+               withWidth:(CGFloat)width;
+
 @end
 
 @interface AFATableController : NSObject <UITableViewDataSource, UITableViewDelegate>
@@ -17,9 +17,31 @@
  ******************************************************************************/
 
 #import "AFATableController.h"
+#import "AFATableControllerLayoutCache.h"
+
+@interface AFATableController ()
+
+@property (strong, nonatomic) AFATableControllerLayoutCache *layoutCache;
+@property (strong, nonatomic) dispatch_queue_t              layoutProcessingQueue;
+// Sections for which text based height computations are in flight
+@property (strong, nonatomic) NSMutableSet                  *pendingHeightComputations;
+
+@end
 
 @implementation AFATableController
 
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _layoutCache = [AFATableControllerLayoutCache new];
+        _layoutProcessingQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.tableControllerLayoutProcessingQueue", [NSBundle mainBundle].bundleIdentifier] UTF8String], DISPATCH_QUEUE_SERIAL);
+        _pendingHeightComputations = [NSMutableSet set];
+    }
+    
+    return self;
+}
+
 
 #pragma mark -
 #pragma mark Tableview Delegate & Datasource
@@ -71,6 +93,29 @@ heightForHeaderInSection:(NSInteger)section {
     return headerHeight;
 }
 
+- (CGFloat)tableView:(UITableView *)tableView
+heightForRowAtIndexPath:(NSIndexPath *)indexPath {
+    // Computed heights are only estimates, rows keep self-sizing until the
+    // height of their displayed cell is known
+    NSNumber *measuredHeight = [self cachedHeightForRowAtIndexPath:indexPath
+                                                       inTableView:tableView
+                                                    isMeasuredOnly:YES];
+    
+    return measuredHeight ? measuredHeight.floatValue : UITableViewAutomaticDimension;
+}
+
+- (CGFloat)tableView:(UITableView *)tableView
+estimatedHeightForRowAtIndexPath:(NSIndexPath *)indexPath {
+    NSNumber *cachedHeight = [self cachedHeightForRowAtIndexPath:indexPath
+                                                     inTableView:tableView
+                                                  isMeasuredOnly:NO];
+    if (cachedHeight) {
+        return cachedHeight.floatValue;
+    }
+    
+    return (tableView.estimatedRowHeight > 0) ? tableView.estimatedRowHeight : UITableViewAutomaticDimension;
+}
+
 - (void)tableView:(UITableView *)tableView
   willDisplayCell:(UITableViewCell *)cell
 forRowAtIndexPath:(NSIndexPath *)indexPath {
@@ -80,6 +125,29 @@ forRowAtIndexPath:(NSIndexPath *)indexPath {
                   forRowAtIndexPath:indexPath
                            forModel:self.model];
     }
+    
+    NSString *layoutIdentifier = [self layoutIdentifierForRowAtIndexPath:indexPath
+                                                             inTableView:tableView];
+    if (layoutIdentifier) {
+        NSUInteger layoutVersion = [self layoutVersionForRowAtIndexPath:indexPath
+                                                            inTableView:tableView];
+        CGFloat width = CGRectGetWidth(tableView.bounds);
+        BOOL isMeasuredHeight = [self.layoutCache measuredHeightForLayoutIdentifier:layoutIdentifier
+                                                                      layoutVersion:layoutVersion
+                                                                          withWidth:width] ? YES : NO;
+        
+        // Remember the height of self-sized rows so that they aren't measured again,
+        // replacing any computed estimate, and use the opportunity to estimate the
+        // rest of the section off screen
+        if (!isMeasuredHeight) {
+            [self.layoutCache storeHeight:CGRectGetHeight(cell.frame)
+                      forLayoutIdentifier:layoutIdentifier
+                            layoutVersion:layoutVersion
+                                withWidth:width];
+            [self computeRowHeightsForSection:indexPath.section
+                                  inTableView:tableView];
+        }
+    }
 }
 
 - (UITableViewCell *)tableView:(UITableView *)tableView
@@ -188,4 +256,134 @@ didSelectRowAtIndexPath:(NSIndexPath *)indexPath {
     }
 }
 
+
+#pragma mark -
+#pragma mark Layout cache
+
+- (NSString *)layoutIdentifierForRowAtIndexPath:(NSIndexPath *)indexPath
+                                    inTableView:(UITableView *)tableView {
+    if (![self.cellFactory respondsToSelector:@selector(tableView:layoutIdentifierForRowAtIndexPath:forModel:)]) {
+        return nil;
+    }
+    
+    NSString *layoutIdentifier = [self.cellFactory tableView:tableView
+                           layoutIdentifierForRowAtIndexPath:indexPath
+                                                    forModel:self.model];
+    
+    // The table controller is reused with different cell factories, so identifiers
+    // are scoped to the factory that lays out the row
+    return layoutIdentifier ? [NSString stringWithFormat:@"%@|%@", NSStringFromClass([self.cellFactory class]), layoutIdentifier] : nil;
+}
+
+- (NSUInteger)layoutVersionForRowAtIndexPath:(NSIndexPath *)indexPath
+                                 inTableView:(UITableView *)tableView {
+    NSUInteger layoutVersion = 0;
+    
+    if ([self.cellFactory respondsToSelector:@selector(tableView:layoutVersionForRowAtIndexPath:forModel:)]) {
+        layoutVersion = [self.cellFactory tableView:tableView
+                     layoutVersionForRowAtIndexPath:indexPath
+                                           forModel:self.model];
+    }
+    
+    return layoutVersion;
+}
+
+- (NSNumber *)cachedHeightForRowAtIndexPath:(NSIndexPath *)indexPath
+                                inTableView:(UITableView *)tableView
+                             isMeasuredOnly:(BOOL)isMeasuredOnly {
+    NSString *layoutIdentifier = [self layoutIdentifierForRowAtIndexPath:indexPath
+                                                             inTableView:tableView];
+    if (!layoutIdentifier) {
+        return nil;
+    }
+    
+    NSUInteger layoutVersion = [self layoutVersionForRowAtIndexPath:indexPath
+                                                        inTableView:tableView];
+    CGFloat width = CGRectGetWidth(tableView.bounds);
+    
+    if (isMeasuredOnly) {
+        return [self.layoutCache measuredHeightForLayoutIdentifier:layoutIdentifier
+                                                     layoutVersion:layoutVersion
+                                                         withWidth:width];
+    }
+    
+    return [self.layoutCache heightForLayoutIdentifier:layoutIdentifier
+                                         layoutVersion:layoutVersion
+                                             withWidth:width];
+}
+
+- (void)computeRowHeightsForSection:(NSInteger)section
+                        inTableView:(UITableView *)tableView {
+    id<AFATableViewCellFactory> cellFactory = self.cellFactory;
+    if (![cellFactory respondsToSelector:@selector(heightForItem:withWidth:)]) {
+        return;
+    }
+    
+    CGFloat width = CGRectGetWidth(tableView.bounds);
+    NSString *computationKey = [NSString stringWithFormat:@"%@|%ld|%.1f", NSStringFromClass([cellFactory class]), (long)section, width];
+    if ([self.pendingHeightComputations containsObject:computationKey]) {
+        return;
+    }
+    
+    // Snapshot the rows that weren't measured or estimated yet, the model
+    // is only accessed from the main thread
+    NSMutableArray *layoutIdentifiers = [NSMutableArray array];
+    NSMutableArray *layoutVersions = [NSMutableArray array];
+    NSMutableArray *items = [NSMutableArray array];
+    NSInteger rowCount = [self tableView:tableView
+                   numberOfRowsInSection:section];
+    
+    for (NSInteger row = 0; row < rowCount; row++) {
+        NSIndexPath *indexPath = [NSIndexPath indexPathForRow:row
+                                                    inSection:section];
+        NSString *layoutIdentifier = [self layoutIdentifierForRowAtIndexPath:indexPath
+                                                                 inTableView:tableView];
+        id item = [self.model itemAtIndexPath:indexPath];
+        if (!layoutIdentifier || !item) {
+            continue;
+        }
+        
+        NSUInteger layoutVersion = [self layoutVersionForRowAtIndexPath:indexPath
+                                                            inTableView:tableView];
+        if ([self.layoutCache heightForLayoutIdentifier:layoutIdentifier
+                                          layoutVersion:layoutVersion
+                                              withWidth:width]) {
+            continue;
+        }
+        
+        [layoutIdentifiers addObject:layoutIdentifier];
+        [layoutVersions addObject:@(layoutVersion)];
+        [items addObject:item];
+    }
+    
+    if (!items.count) {
+        return;
+    }
+    
+    [self.pendingHeightComputations addObject:computationKey];
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.layoutProcessingQueue, ^{
+        NSMutableArray *heights = [NSMutableArray arrayWithCapacity:items.count];
+        for (id item in items) {
+            [heights addObject:@([cellFactory heightForItem:item
+                                                  withWidth:width])];
+        }
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            __strong typeof(self) strongSelf = weakSelf;
+            
+            [strongSelf.pendingHeightComputations removeObject:computationKey];
+            
+            // Heights measured from displayed cells are kept apart and take precedence
+            for (NSUInteger idx = 0; idx < heights.count; idx++) {
+                [strongSelf.layoutCache storeEstimatedHeight:[heights[idx] floatValue]
+                                         forLayoutIdentifier:layoutIdentifiers[idx]
+                                               layoutVersion:[layoutVersions[idx] unsignedIntegerValue]
+                                                   withWidth:width];
+            }
+        });
+    });
+}
+
 @end
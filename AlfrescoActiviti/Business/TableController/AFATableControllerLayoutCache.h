@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <UIKit/UIKit.h>
+
+/**
+ *  Cache of row heights used by the table controller. Heights are stored per layout
+ *  identifier (typically the identity of the displayed model), content version and
+ *  table width. Heights measured from displayed cells are kept apart from computed
+ *  estimates and always take precedence over them. Storing a height for a new version of an identifier drops the heights
+ *  recorded for the previous version, so rows are invalidated individually as their
+ *  models change. Cached heights are discarded when the preferred content size
+ *  category changes. Meant to be used from the main thread.
+ */
+@interface AFATableControllerLayoutCache : NSObject
+
+/**
+ *  Returns the cached height for the passed layout identifier, version and width,
+ *  falling back to the estimated one if the row wasn't measured yet.
+ *
+ *  @param layoutIdentifier Identifier of the row content
+ *  @param layoutVersion    Version of the row content
+ *  @param width            Width of the table view
+ *
+ *  @return                 Measured or estimated height or nil if there is neither
+ */
+- (NSNumber *)heightForLayoutIdentifier:(NSString *)layoutIdentifier
+                          layoutVersion:(NSUInteger)layoutVersion
+                              withWidth:(CGFloat)width;
+
+/**
+ *  Returns the height measured from a displayed cell for the passed layout identifier,
+ *  version and width.
+ *
+ *  @param layoutIdentifier Identifier of the row content
+ *  @param layoutVersion    Version of the row content
+ *  @param width            Width of the table view
+ *
+ *  @return                 Measured height or nil if the row wasn't measured yet
+ */
+- (NSNumber *)measuredHeightForLayoutIdentifier:(NSString *)layoutIdentifier
+                                  layoutVersion:(NSUInteger)layoutVersion
+                                      withWidth:(CGFloat)width;
+
+/**
+ *  Stores the height of a displayed row for the passed layout identifier, version and width.
+ *
+ *  @param height           Measured height of the row
+ *  @param layoutIdentifier Identifier of the row content
+ *  @param layoutVersion    Version of the row content
+ *  @param width            Width of the table view
+ */
+- (void)storeHeight:(CGFloat)height
+forLayoutIdentifier:(NSString *)layoutIdentifier
+      layoutVersion:(NSUInteger)layoutVersion
+          withWidth:(CGFloat)width;
+
+/**
+ *  Stores a computed height estimate of a row for the passed layout identifier, version
+ *  and width. Estimates are only used until the row is measured.
+ *
+ *  @param height           Estimated height of the row
+ *  @param layoutIdentifier Identifier of the row content
+ *  @param layoutVersion    Version of the row content
+ *  @param width            Width of the table view
+ */
+- (void)storeEstimatedHeight:(CGFloat)height
+         forLayoutIdentifier:(NSString *)layoutIdentifier
+               layoutVersion:(NSUInteger)layoutVersion
+                   withWidth:(CGFloat)width;
+
+/**
+ *  Removes the cached heights of the passed layout identifier for all widths.
+ *
+ *  @param layoutIdentifier Identifier of the row content
+ */
+- (void)invalidateHeightsForLayoutIdentifier:(NSString *)layoutIdentifier;
+
+/**
+ *  Removes all the cached heights.
+ */
+- (void)removeAllHeights;
+
+@end
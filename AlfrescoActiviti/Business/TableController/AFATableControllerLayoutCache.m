@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "AFATableControllerLayoutCache.h"
+
+@interface AFATableControllerLayoutCacheEntry : NSObject
+
+@property (assign, nonatomic) NSUInteger            layoutVersion;
+@property (strong, nonatomic) NSMutableDictionary   *heights;
+@property (strong, nonatomic) NSMutableDictionary   *estimatedHeights;
+
+@end
+
+@implementation AFATableControllerLayoutCacheEntry
+@end
+
+@interface AFATableControllerLayoutCache ()
+
+@property (strong, nonatomic) NSCache *entriesCache;
+
+@end
+
+@implementation AFATableControllerLayoutCache
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _entriesCache = [NSCache new];
+        _entriesCache.name = [NSString stringWithFormat:@"%@.tableControllerLayoutCache", [NSBundle mainBundle].bundleIdentifier];
+        
+        // Text is measured differently once the user changes the text size
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(removeAllHeights)
+                                                     name:UIContentSizeCategoryDidChangeNotification
+                                                   object:nil];
+    }
+    
+    return self;
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (NSNumber *)heightForLayoutIdentifier:(NSString *)layoutIdentifier
+                          layoutVersion:(NSUInteger)layoutVersion
+                              withWidth:(CGFloat)width {
+    AFATableControllerLayoutCacheEntry *entry = [self entryForLayoutIdentifier:layoutIdentifier
+                                                                 layoutVersion:layoutVersion];
+    NSNumber *height = entry.heights[@(width)];
+    
+    return height ? height : entry.estimatedHeights[@(width)];
+}
+
+- (NSNumber *)measuredHeightForLayoutIdentifier:(NSString *)layoutIdentifier
+                                  layoutVersion:(NSUInteger)layoutVersion
+                                      withWidth:(CGFloat)width {
+    AFATableControllerLayoutCacheEntry *entry = [self entryForLayoutIdentifier:layoutIdentifier
+                                                                 layoutVersion:layoutVersion];
+    return entry.heights[@(width)];
+}
+
+- (void)storeHeight:(CGFloat)height
+forLayoutIdentifier:(NSString *)layoutIdentifier
+      layoutVersion:(NSUInteger)layoutVersion
+          withWidth:(CGFloat)width {
+    if (!layoutIdentifier || height <= 0) {
+        return;
+    }
+    
+    AFATableControllerLayoutCacheEntry *entry = [self currentEntryForLayoutIdentifier:layoutIdentifier
+                                                                        layoutVersion:layoutVersion];
+    entry.heights[@(width)] = @(height);
+}
+
+- (void)storeEstimatedHeight:(CGFloat)height
+         forLayoutIdentifier:(NSString *)layoutIdentifier
+               layoutVersion:(NSUInteger)layoutVersion
+                   withWidth:(CGFloat)width {
+    if (!layoutIdentifier || height <= 0) {
+        return;
+    }
+    
+    AFATableControllerLayoutCacheEntry *entry = [self currentEntryForLayoutIdentifier:layoutIdentifier
+                                                                        layoutVersion:layoutVersion];
+    entry.estimatedHeights[@(width)] = @(height);
+}
+
+- (void)invalidateHeightsForLayoutIdentifier:(NSString *)layoutIdentifier {
+    if (layoutIdentifier) {
+        [self.entriesCache removeObjectForKey:layoutIdentifier];
+    }
+}
+
+- (void)removeAllHeights {
+    [self.entriesCache removeAllObjects];
+}
+
+
+#pragma mark -
+#pragma mark Private interface
+
+- (AFATableControllerLayoutCacheEntry *)entryForLayoutIdentifier:(NSString *)layoutIdentifier
+                                                   layoutVersion:(NSUInteger)layoutVersion {
+    AFATableControllerLayoutCacheEntry *entry = [self.entriesCache objectForKey:layoutIdentifier];
+    
+    return (entry.layoutVersion == layoutVersion) ? entry : nil;
+}
+
+- (AFATableControllerLayoutCacheEntry *)currentEntryForLayoutIdentifier:(NSString *)layoutIdentifier
+                                                          layoutVersion:(NSUInteger)layoutVersion {
+    AFATableControllerLayoutCacheEntry *entry = [self entryForLayoutIdentifier:layoutIdentifier
+                                                                 layoutVersion:layoutVersion];
+    if (!entry) {
+        // Heights recorded for a previous version of the content are outdated
+        entry = [AFATableControllerLayoutCacheEntry new];
+        entry.layoutVersion = layoutVersion;
+        entry.heights = [NSMutableDictionary dictionary];
+        entry.estimatedHeights = [NSMutableDictionary dictionary];
+        [self.entriesCache setObject:entry
+                              forKey:layoutIdentifier];
+    }
+    
+    return entry;
+}
+
+@end
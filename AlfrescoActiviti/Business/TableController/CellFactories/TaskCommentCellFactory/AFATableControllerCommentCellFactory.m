@@ -26,29 +26,59 @@
 #import "AFACommentTableViewCell.h"
 
 // Managers
-#import "AFAUserServices.h"
 #import "AFAServiceRepository.h"
-#import "AFAThumbnailManager.h"
+#import "AFAAvatarCache.h"
 @import ActivitiSDK;
 
-@interface AFATableControllerCommentCellFactory ()
+static const NSUInteger kAFACommentCellLayoutSampleLineCount = 10;
+
+@interface AFACommentCellLayoutTemplate : NSObject
 
-@property (strong, nonatomic) AFAUserServices *fetchPictureForUserService;
+@property (strong, nonatomic) UIFont    *contributorNameFont;
+@property (strong, nonatomic) UIFont    *commentDescriptionFont;
+@property (assign, nonatomic) CGFloat   contributorNameHorizontalInset;
+@property (assign, nonatomic) CGFloat   commentDescriptionHorizontalInset;
+// Height of everything in the cell except for the multi-line name and description
+@property (assign, nonatomic) CGFloat   fixedHeight;
+// Height the cell doesn't shrink below, set by the avatar column or the prototype
+@property (assign, nonatomic) CGFloat   minimumHeight;
+@property (assign, nonatomic) CGFloat   screenScale;
+
+- (CGFloat)heightForText:(NSString *)text
+                withFont:(UIFont *)font
+      constrainedToWidth:(CGFloat)width;
 
 @end
 
-@implementation AFATableControllerCommentCellFactory
+@implementation AFACommentCellLayoutTemplate
 
-- (instancetype)init {
-    self = [super init];
-    
-    if (self) {
-        _fetchPictureForUserService = [AFAUserServices new];
+- (CGFloat)heightForText:(NSString *)text
+                withFont:(UIFont *)font
+      constrainedToWidth:(CGFloat)width {
+    if (!text.length || width <= 0) {
+        return .0f;
     }
     
-    return self;
+    CGRect textRect = [text boundingRectWithSize:CGSizeMake(width, CGFLOAT_MAX)
+                                         options:NSStringDrawingUsesLineFragmentOrigin
+                                      attributes:@{NSFontAttributeName : font}
+                                         context:nil];
+    
+    // Labels are laid out on pixel boundaries
+    return ceil(CGRectGetHeight(textRect) * self.screenScale) / self.screenScale;
 }
 
+@end
+
+@interface AFATableControllerCommentCellFactory ()
+
+// Read off the main thread when row heights are computed
+@property (strong, atomic) AFACommentCellLayoutTemplate *layoutTemplate;
+
+@end
+
+@implementation AFATableControllerCommentCellFactory
+
 
 #pragma mark -
 #pragma mark AFATableViewCellFactory Delegate
@@ -71,27 +101,31 @@
         ASDKModelComment *comment = (ASDKModelComment *)[model itemAtIndexPath:indexPath];
         [commentCell setUpCellWithComment:comment];
         
-        // Get a placeholder and make a request for the profile image
-        AFAThumbnailManager *thumbnailManager = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeThumbnailManager];
-        commentCell.avatarView.profileImage = [thumbnailManager thumbnailImageForIdentifier:comment.authorModel.modelID];
+        // Cached avatars are set right away, otherwise a placeholder is displayed
+        // until the avatar cache loads the author's picture
+        AFAAvatarCache *avatarCache = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeAvatarCache];
+        NSString *authorID = comment.authorModel.modelID;
+        CGFloat avatarSize = CGRectGetHeight(commentCell.avatarView.frame) * [UIScreen mainScreen].scale;
+        UIImage *cachedAvatar = [avatarCache cachedAvatarForUserID:authorID
+                                                          withSize:avatarSize];
+        commentCell.avatarView.profileImage = cachedAvatar ? cachedAvatar : [avatarCache placeholderAvatarImage];
         
-        [self.fetchPictureForUserService requestPictureForUserID:comment.authorModel.modelID
-                                                 completionBlock:^(UIImage *profileImage, NSError *error) {
-                                                    UIImage *cachedThumbnailImage = [thumbnailManager thumbnailForImage:profileImage
-                                                                          withIdentifier:comment.authorModel.modelID
-                                                                                withSize:CGRectGetHeight(commentCell.avatarView.frame) * [UIScreen mainScreen].scale
-                                                               processingCompletionBlock:^(UIImage *processedThumbnailImage) {
-                                                                   dispatch_async(dispatch_get_main_queue(), ^{
-                                                                       [tableView reloadData];
-                                                                   });
-                                                               }];
-                                                     if (cachedThumbnailImage) {
-                                                         dispatch_async(dispatch_get_main_queue(), ^{
-                                                             AFACommentTableViewCell *cellToUpdate = [tableView cellForRowAtIndexPath:indexPath];
-                                                             cellToUpdate.avatarView.profileImage = cachedThumbnailImage;
-                                                         });
-                                                     }
-                                                 }];
+        if (!cachedAvatar) {
+            [avatarCache avatarForUserID:authorID
+                                withSize:avatarSize
+                         completionBlock:^(UIImage *avatarImage, NSError *error) {
+                             // The row might display another comment by the time the avatar is available
+                             AFACommentTableViewCell *cellToUpdate = [tableView cellForRowAtIndexPath:indexPath];
+                             if (!avatarImage || !cellToUpdate) {
+                                 return;
+                             }
+                             
+                             ASDKModelComment *displayedComment = (ASDKModelComment *)[model itemAtIndexPath:indexPath];
+                             if ([displayedComment.authorModel.modelID isEqualToString:authorID]) {
+                                 cellToUpdate.avatarView.profileImage = avatarImage;
+                             }
+                         }];
+        }
         
         cell = commentCell;
     }
@@ -117,6 +151,120 @@ forRowAtIndexPath:(NSIndexPath *)indexPath
     if ([cell respondsToSelector:@selector(setLayoutMargins:)]) {
         [cell setLayoutMargins:UIEdgeInsetsZero];
     }
+    
+    if (!self.layoutTemplate &&
+        [cell isKindOfClass:[AFACommentTableViewCell class]]) {
+        self.layoutTemplate = [self layoutTemplateForCommentCell:(AFACommentTableViewCell *)cell
+                                                     inTableView:tableView];
+    }
+}
+
+- (NSString *)tableView:(UITableView *)tableView
+layoutIdentifierForRowAtIndexPath:(NSIndexPath *)indexPath
+               forModel:(id<AFATableViewModelDelegate>)model {
+    if (!indexPath.row) {
+        return @"header";
+    }
+    
+    ASDKModelComment *comment = (ASDKModelComment *)[model itemAtIndexPath:indexPath];
+    return comment.modelID;
+}
+
+- (NSUInteger)tableView:(UITableView *)tableView
+layoutVersionForRowAtIndexPath:(NSIndexPath *)indexPath
+               forModel:(id<AFATableViewModelDelegate>)model {
+    if (!indexPath.row) {
+        return 0;
+    }
+    
+    ASDKModelComment *comment = (ASDKModelComment *)[model itemAtIndexPath:indexPath];
+    return 31 * [AFACommentTableViewCell contributorNameForComment:comment].hash + comment.message.hash;
+}
+
+- (CGFloat)heightForItem:(id)item
+               withWidth:(CGFloat)width {
+    AFACommentCellLayoutTemplate *layoutTemplate = self.layoutTemplate;
+    if (!layoutTemplate ||
+        ![item isKindOfClass:[ASDKModelComment class]]) {
+        return .0f;
+    }
+    
+    ASDKModelComment *comment = (ASDKModelComment *)item;
+    CGFloat contributorNameHeight = [layoutTemplate heightForText:[AFACommentTableViewCell contributorNameForComment:comment]
+                                                         withFont:layoutTemplate.contributorNameFont
+                                               constrainedToWidth:width - layoutTemplate.contributorNameHorizontalInset];
+    CGFloat commentDescriptionHeight = [layoutTemplate heightForText:comment.message
+                                                            withFont:layoutTemplate.commentDescriptionFont
+                                                  constrainedToWidth:width - layoutTemplate.commentDescriptionHorizontalInset];
+    
+    return MAX(layoutTemplate.minimumHeight, layoutTemplate.fixedHeight + contributorNameHeight + commentDescriptionHeight);
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
+- (AFACommentCellLayoutTemplate *)layoutTemplateForCommentCell:(AFACommentTableViewCell *)commentCell
+                                                   inTableView:(UITableView *)tableView {
+    // The first displayed comment cell provides the fonts and how much room is left
+    // for the name and description labels so that other comments can be measured
+    // as plain text
+    [commentCell layoutIfNeeded];
+    
+    CGFloat cellWidth = CGRectGetWidth(commentCell.bounds);
+    CGFloat separatorHeight = CGRectGetHeight(commentCell.bounds) - CGRectGetHeight(commentCell.contentView.bounds);
+    
+    AFACommentCellLayoutTemplate *layoutTemplate = [AFACommentCellLayoutTemplate new];
+    layoutTemplate.screenScale = [UIScreen mainScreen].scale;
+    layoutTemplate.contributorNameFont = commentCell.contributorNameLabel.font;
+    layoutTemplate.commentDescriptionFont = commentCell.commentDescriptionLabel.font;
+    layoutTemplate.contributorNameHorizontalInset = cellWidth - CGRectGetWidth(commentCell.contributorNameLabel.frame);
+    layoutTemplate.commentDescriptionHorizontalInset = cellWidth - CGRectGetWidth(commentCell.commentDescriptionLabel.frame);
+    
+    // The vertical chrome is measured on a separate cell so that the displayed one
+    // isn't altered. Without text the avatar column or the prototype's height decide
+    // the height, with a long description the labels do and everything else is chrome.
+    AFACommentTableViewCell *templateCell = [tableView dequeueReusableCellWithIdentifier:kCellIDComment];
+    if (!templateCell) {
+        return nil;
+    }
+    
+    templateCell.preservesSuperviewLayoutMargins = NO;
+    templateCell.layoutMargins = commentCell.layoutMargins;
+    templateCell.bounds = CGRectMake(0, 0, cellWidth, CGRectGetHeight(templateCell.bounds));
+    templateCell.commentDateLabel.text = commentCell.commentDateLabel.text;
+    
+    templateCell.contributorNameLabel.text = nil;
+    templateCell.commentDescriptionLabel.text = nil;
+    layoutTemplate.minimumHeight = [self fittingHeightForCommentCell:templateCell] + separatorHeight;
+    
+    NSMutableArray *sampleLines = [NSMutableArray array];
+    for (NSUInteger lineIdx = 0; lineIdx < kAFACommentCellLayoutSampleLineCount; lineIdx++) {
+        [sampleLines addObject:@"W"];
+    }
+    NSString *sampleContributorName = sampleLines.firstObject;
+    NSString *sampleCommentDescription = [sampleLines componentsJoinedByString:@"\n"];
+    templateCell.contributorNameLabel.text = sampleContributorName;
+    templateCell.commentDescriptionLabel.text = sampleCommentDescription;
+    
+    CGFloat contributorNameHeight = [layoutTemplate heightForText:sampleContributorName
+                                                         withFont:layoutTemplate.contributorNameFont
+                                               constrainedToWidth:cellWidth - layoutTemplate.contributorNameHorizontalInset];
+    CGFloat commentDescriptionHeight = [layoutTemplate heightForText:sampleCommentDescription
+                                                            withFont:layoutTemplate.commentDescriptionFont
+                                                  constrainedToWidth:cellWidth - layoutTemplate.commentDescriptionHorizontalInset];
+    layoutTemplate.fixedHeight = [self fittingHeightForCommentCell:templateCell] + separatorHeight - contributorNameHeight - commentDescriptionHeight;
+    
+    return layoutTemplate;
+}
+
+- (CGFloat)fittingHeightForCommentCell:(AFACommentTableViewCell *)commentCell {
+    [commentCell setNeedsLayout];
+    [commentCell layoutIfNeeded];
+    
+    return [commentCell.contentView systemLayoutSizeFittingSize:CGSizeMake(CGRectGetWidth(commentCell.contentView.bounds), 0)
+                                  withHorizontalFittingPriority:UILayoutPriorityRequired
+                                        verticalFittingPriority:UILayoutPriorityFittingSizeLevel].height;
 }
 
 @end
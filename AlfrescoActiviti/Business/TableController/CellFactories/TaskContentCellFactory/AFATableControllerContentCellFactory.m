@@ -60,6 +60,50 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
 }
 
 
+#pragma mark -
+#pragma mark Thumbnail download
+
+- (void)downloadThumbnailForContent:(ASDKModelContent *)content
+                  withThumbnailSize:(CGFloat)thumbnailSize
+                        atIndexPath:(NSIndexPath *)indexPath
+                        ofTableView:(UITableView *)tableView {
+    // Only start a thumbnail download operation for those cells that don't have
+    // already an operation in progress and the thumbnail status permits it
+    if (self.thumbnailOperationsDict[indexPath] ||
+        content.thumbnailStatus != ASDKModelContentAvailabilityTypeCreated) {
+        return;
+    }
+    
+    self.thumbnailOperationsDict[indexPath] = content.modelID;
+    
+    __weak typeof(self) weakSelf = self;
+    [self.downloadContentThumbnailService
+     requestTaskContentThumbnailDownloadForContent:content
+     allowCachedResults:YES
+     withProgressBlock:nil
+     withCompletionBlock:^(NSURL *downloadedContentURL, BOOL isLocalContent, NSError *error) {
+         __strong typeof(self) strongSelf = weakSelf;
+         
+         // Remove operation reference for the current indexpath once it has completed
+         strongSelf.thumbnailOperationsDict[indexPath] = nil;
+         
+         if (!error) {
+             [strongSelf.thumbnailManager thumbnailForImageAtURL:downloadedContentURL
+                                                  withIdentifier:content.modelID
+                                                        withSize:thumbnailSize
+                                       processingCompletionBlock:^(UIImage *processedThumbnailImage) {
+                                           dispatch_async(dispatch_get_main_queue(), ^{
+                                               AFAContentFileTableViewCell *cellToUpdate = [tableView cellForRowAtIndexPath:indexPath];
+                                               cellToUpdate.fileThumbnailImageView.image = processedThumbnailImage;
+                                           });
+                                       }];
+         } else {
+             AFALogError(@"Unable to retrieve thumbnail image for content with ID:%@. Reason:%@", content.modelID, error.localizedDescription);
+         }
+     }];
+}
+
+
 #pragma mark -
 #pragma mark AFATableViewCellFactory Delegate
 
@@ -77,45 +121,28 @@ shouldHighlightRowAtIndexPath:(NSIndexPath *)indexPath {
     [contentFileCell setUpCellWithContent:content];
     
     // First, check the thumbnail manager for cached images
-    UIImage *thumbnailImage = nil;
-    thumbnailImage = [self.thumbnailManager thumbnailImageForIdentifier:content.modelID];
+    UIImage *thumbnailImage = [self.thumbnailManager thumbnailImageForIdentifier:content.modelID];
     if (thumbnailImage != [self.thumbnailManager placeholderThumbnailImage]) {
         contentFileCell.fileThumbnailImageView.image = thumbnailImage;
     } else {
-        // Only start a thumbnail download operation for those cells that don't have
-        // already an operation in progress and the thumbnail status permits it
-        if (!self.thumbnailOperationsDict[indexPath] &&
-            content.thumbnailStatus == ASDKModelContentAvailabilityTypeCreated) {
-            self.thumbnailOperationsDict[indexPath] = content.modelID;
-            
-            __weak typeof(self) weakSelf = self;
-            [self.downloadContentThumbnailService
-             requestTaskContentThumbnailDownloadForContent:content
-             allowCachedResults:YES
-             withProgressBlock:nil
-             withCompletionBlock:^(NSURL *downloadedContentURL, BOOL isLocalContent, NSError *error) {
-                 __strong typeof(self) strongSelf = weakSelf;
-                 
-                 // Remove operation reference for the current indexpath once it has completed
-                 strongSelf.thumbnailOperationsDict[indexPath] = nil;
-                 
-                 if (!error) {
-                     UIImage *downloadedThumbnailImage = [[UIImage alloc] initWithContentsOfFile:downloadedContentURL.path];
-                     
-                     [strongSelf.thumbnailManager thumbnailForImage:downloadedThumbnailImage
-                                                     withIdentifier:content.modelID
-                                                           withSize:CGRectGetHeight(contentFileCell.fileThumbnailImageView.frame) * [UIScreen mainScreen].scale
-                                          processingCompletionBlock:^(UIImage *processedThumbnailImage) {
-                                              dispatch_async(dispatch_get_main_queue(), ^{
-                                                  AFAContentFileTableViewCell *cellToUpdate = [tableView cellForRowAtIndexPath:indexPath];
-                                                  cellToUpdate.fileThumbnailImageView.image = processedThumbnailImage;
-                                              });
-                                          }];
-                 } else {
-                     AFALogError(@"Unable to retrieve thumbnail image for content with ID:%@. Reason:%@", content.modelID, error.localizedDescription);
-                 }
-             }];
-        }
+        CGFloat thumbnailSize = CGRectGetHeight(contentFileCell.fileThumbnailImageView.frame) * [UIScreen mainScreen].scale;
+        
+        // Fall back to the disk cache and only then to the network
+        __weak typeof(self) weakSelf = self;
+        [self.thumbnailManager thumbnailImageForIdentifier:content.modelID
+                                           completionBlock:^(UIImage *cachedThumbnailImage) {
+                                               __strong typeof(self) strongSelf = weakSelf;
+                                               
+                                               if (cachedThumbnailImage) {
+                                                   AFAContentFileTableViewCell *cellToUpdate = [tableView cellForRowAtIndexPath:indexPath];
+                                                   cellToUpdate.fileThumbnailImageView.image = cachedThumbnailImage;
+                                               } else {
+                                                   [strongSelf downloadThumbnailForContent:content
+                                                                         withThumbnailSize:thumbnailSize
+                                                                               atIndexPath:indexPath
+                                                                               ofTableView:tableView];
+                                               }
+                                           }];
     }
     
     return contentFileCell;
@@ -141,6 +168,19 @@ forRowAtIndexPath:(NSIndexPath *)indexPath
     }
 }
 
+- (NSString *)tableView:(UITableView *)tableView
+layoutIdentifierForRowAtIndexPath:(NSIndexPath *)indexPath
+               forModel:(id<AFATableViewModelDelegate>)model {
+    id item = [model itemAtIndexPath:indexPath];
+    return [item isKindOfClass:[ASDKModelContent class]] ? ((ASDKModelContent *)item).modelID : nil;
+}
+
+- (NSUInteger)tableView:(UITableView *)tableView
+layoutVersionForRowAtIndexPath:(NSIndexPath *)indexPath
+               forModel:(id<AFATableViewModelDelegate>)model {
+    return [[model itemAtIndexPath:indexPath] hash];
+}
+
 - (UIView *)tableView:(UITableView *)tableView
 viewForHeaderInSection:(NSInteger)section
              forModel:(id<AFATableViewModelDelegate>)model {
@@ -108,6 +108,30 @@ forRowAtIndexPath:(NSIndexPath *)indexPath
     }
 }
 
+- (NSString *)tableView:(UITableView *)tableView
+layoutIdentifierForRowAtIndexPath:(NSIndexPath *)indexPath
+               forModel:(id<AFATableViewModelDelegate>)model {
+    AFATableControllerTaskDetailsModel *currentModel = (AFATableControllerTaskDetailsModel *)model;
+    if (!currentModel.currentTask.modelID) {
+        return nil;
+    }
+    
+    return [NSString stringWithFormat:@"%@-%ld", currentModel.currentTask.modelID, (long)indexPath.row];
+}
+
+- (NSUInteger)tableView:(UITableView *)tableView
+layoutVersionForRowAtIndexPath:(NSIndexPath *)indexPath
+               forModel:(id<AFATableViewModelDelegate>)model {
+    // Besides the task itself, the displayed cell types depend on the parent
+    // task and on the current user
+    AFATableControllerTaskDetailsModel *currentModel = (AFATableControllerTaskDetailsModel *)model;
+    NSUInteger layoutVersion = currentModel.currentTask.hash;
+    layoutVersion = 31 * layoutVersion + currentModel.parentTask.hash;
+    layoutVersion = 31 * layoutVersion + currentModel.userProfile.modelID.hash;
+    
+    return layoutVersion;
+}
+
 
 #pragma mark -
 #pragma mark AFAAssigneeTableViewCellDelegate
@@ -22,6 +22,13 @@ typedef void (^AFAThumbnailProcessingCompletionBlock)(UIImage *processedThumbnai
 
 @interface AFAThumbnailManager : NSObject
 
+/**
+ *  Maximum number of bytes the disk cached thumbnails are allowed to take. When the
+ *  budget is exceeded the least recently accessed thumbnails are evicted first.
+ *  Defaults to 50MB.
+ */
+@property (assign, nonatomic) unsigned long long diskCacheBudget;
+
 /**
  *  Returns a local placeholder image
  *
@@ -30,8 +37,9 @@ typedef void (^AFAThumbnailProcessingCompletionBlock)(UIImage *processedThumbnai
 - (UIImage *)placeholderThumbnailImage;
 
 /**
- *  Returns a cached image object for the specified identifier and if that's not available
- *  it returns the default thumbnail image.
+ *  Returns the in-memory cached image object for the specified identifier and if that's
+ *  not available it returns the default thumbnail image. The disk cache is not consulted,
+ *  use the asynchronous variant for that.
  *
  *  @param imageIdentifier Image identifier for which the cache check is performed
  *
@@ -39,6 +47,17 @@ typedef void (^AFAThumbnailProcessingCompletionBlock)(UIImage *processedThumbnai
  */
 - (UIImage *)thumbnailImageForIdentifier:(NSString *)imageIdentifier;
 
+/**
+ *  Looks up the cached image object for the specified identifier. In-memory hits are
+ *  returned synchronously, otherwise the disk cache is read on a background queue and
+ *  the result is delivered on the main queue. A nil image is passed if nothing is cached.
+ *
+ *  @param imageIdentifier Image identifier for which the cache check is performed
+ *  @param completionBlock Cached image for identifier or nil
+ */
+- (void)thumbnailImageForIdentifier:(NSString *)imageIdentifier
+                    completionBlock:(AFAThumbnailProcessingCompletionBlock)completionBlock;
+
 /**
  *  Given a large sized image object and a desired size (square thumbnails) the method 
  *  creates and returns scaled UIImage object.
@@ -57,7 +76,8 @@ typedef void (^AFAThumbnailProcessingCompletionBlock)(UIImage *processedThumbnai
  *  Given a large sized image object and a desired size (square thumbnails) the method
  *  creates, caches or returns from cache a scaled UIImage object. The lazy created object
  *  is returned via a processing completion block. After the call, a placeholder is imediately 
- *  returned until the thumbnail is created
+ *  returned until the thumbnail is created. The completion block is called only when the
+ *  source image differs from the one the cached thumbnail was generated from.
  *
  *  @param largeImage      The large sized image object
  *  @param imageSize       Specifies the maximum width and height in pixels of a thumbnail.
@@ -73,6 +93,24 @@ typedef void (^AFAThumbnailProcessingCompletionBlock)(UIImage *processedThumbnai
                       withSize:(CGFloat)imageSize
      processingCompletionBlock:(AFAThumbnailProcessingCompletionBlock)completionBlock;
 
+/**
+ *  Same as the image based variant but the source is read from disk and decoded straight
+ *  to the thumbnail size without decoding the full sized image first. Changes are detected
+ *  using a digest of the source bytes, so the completion block is only called when the
+ *  source differs from the one the cached thumbnail was generated from.
+ *
+ *  @param imageURL        Local file URL of the large sized image
+ *  @param imageIdentifier String used to identify the passed image in the cache
+ *  @param imageSize       Specifies the maximum width and height in pixels of a thumbnail
+ *  @param completionBlock UIImage object returned after lazy creation
+ *
+ *  @return Cached thumbnail image or a placeholder until the thumbnail is created
+ */
+- (UIImage *)thumbnailForImageAtURL:(NSURL *)imageURL
+                     withIdentifier:(NSString *)imageIdentifier
+                           withSize:(CGFloat)imageSize
+          processingCompletionBlock:(AFAThumbnailProcessingCompletionBlock)completionBlock;
+
 /**
  *  Cleans the thumbnail images stored in the internal NSCache
  */
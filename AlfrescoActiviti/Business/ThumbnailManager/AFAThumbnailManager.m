@@ -24,13 +24,36 @@
 
 static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRACE;
 static NSString * const cachedThumbnailsPath = @"CachedThumbnails";
+static NSString * const kAFAThumbnailPNGPathExtension = @"png";
+static NSString * const kAFAThumbnailJPEGPathExtension = @"jpg";
+static const CGFloat kAFAThumbnailJPEGCompressionQuality = .8f;
+static const unsigned long long kAFAThumbnailDefaultDiskCacheBudget = 50 * 1024 * 1024;
+
+@interface AFAThumbnailDiskCacheEntry : NSObject
+
+@property (strong, nonatomic) NSString  *fileName;
+@property (assign, nonatomic) unsigned long long fileSize;
+@property (strong, nonatomic) NSDate    *accessDate;
+
+@end
+
+@implementation AFAThumbnailDiskCacheEntry
+@end
 
 @interface AFAThumbnailManager ()
 
-@property (strong, nonatomic) NSCache           *imageCache;
-@property (strong, nonatomic) dispatch_queue_t  imageProcessingQueue;
-@property (strong, nonatomic) dispatch_queue_t  ioProcessingQueue;
-@property (strong, nonatomic) UIImage           *placeholderThumbnailImage;
+@property (strong, nonatomic) NSCache               *imageCache;
+@property (strong, nonatomic) dispatch_queue_t      imageProcessingQueue;
+@property (strong, nonatomic) dispatch_queue_t      ioProcessingQueue;
+@property (strong, nonatomic) UIImage               *placeholderThumbnailImage;
+// Digests of the source images the cached thumbnails were generated from.
+// Only accessed from the image processing queue.
+@property (strong, nonatomic) NSMutableDictionary   *sourceDigests;
+// Index of the thumbnails on disk keyed by their hashed cache name. It is built
+// once at start-up so lookups don't have to touch the file system. Only accessed
+// from the IO processing queue.
+@property (strong, nonatomic) NSMutableDictionary   *diskCacheIndex;
+@property (assign, nonatomic) unsigned long long    diskCacheSize;
 
 @end
 
@@ -48,6 +71,15 @@ static NSString * const cachedThumbnailsPath = @"CachedThumbnails";
         self.imageProcessingQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.thumbnailsProcessingQueue", [NSBundle mainBundle].bundleIdentifier] UTF8String], DISPATCH_QUEUE_SERIAL);
         self.ioProcessingQueue = dispatch_queue_create([[NSString stringWithFormat:@"%@.thumbnailsIOProcessingQueue", [NSBundle mainBundle].bundleIdentifier] UTF8String], DISPATCH_QUEUE_SERIAL);
         self.placeholderThumbnailImage = [UIImage imageNamed:@"image-placeholder-icon"];
+        self.sourceDigests = [NSMutableDictionary dictionary];
+        self.diskCacheIndex = [NSMutableDictionary dictionary];
+        _diskCacheBudget = kAFAThumbnailDefaultDiskCacheBudget;
+        
+        __weak typeof(self) weakSelf = self;
+        dispatch_async(self.ioProcessingQueue, ^{
+            __strong typeof(self) strongSelf = weakSelf;
+            [strongSelf buildDiskCacheIndex];
+        });
         
         [[NSNotificationCenter defaultCenter] addObserver:self
                                                  selector:@selector(cleanupMemoryCache)
@@ -72,96 +104,73 @@ static NSString * const cachedThumbnailsPath = @"CachedThumbnails";
                 withIdentifier:(NSString *)imageIdentifier
                       withSize:(CGFloat)imageSize
      processingCompletionBlock:(AFAThumbnailProcessingCompletionBlock)completionBlock {
-    UIImage *cachedImage = nil;
-    if (largeImage) {
-        cachedImage = [self.imageCache objectForKey:imageIdentifier];
+    if (!largeImage) {
+        return nil;
+    }
+    
+    UIImage *cachedImage = [self cachedImageForForKey:imageIdentifier];
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.imageProcessingQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
         
-        // Check if the thumbnail for the large image has the same
-        // data as the cached image and if that's the case cache
-        // the new image data
-        if (cachedImage) {
-            // If the image has an alpha channel, we will consider it PNG to avoid losing the transparency
-            int cachedImageAlphaInfo = CGImageGetAlphaInfo(cachedImage.CGImage);
-            BOOL cachedImageHasAlpha = !(cachedImageAlphaInfo == kCGImageAlphaNone ||
-                                         cachedImageAlphaInfo == kCGImageAlphaNoneSkipFirst ||
-                                         cachedImageAlphaInfo == kCGImageAlphaNoneSkipLast);
-            
-            int largeImageAlphaInfo = CGImageGetAlphaInfo(largeImage.CGImage);
-            BOOL largeImageHasAlpha = !(largeImageAlphaInfo == kCGImageAlphaNone ||
-                                        largeImageAlphaInfo == kCGImageAlphaNoneSkipFirst ||
-                                        largeImageAlphaInfo == kCGImageAlphaNoneSkipLast);
-            
-            // If one image is a different type than the other re-cache the image
-            if ((cachedImageHasAlpha && largeImageHasAlpha) ||
-                (!cachedImageHasAlpha && !largeImageHasAlpha)) {
-                __weak typeof(self) weakSelf = self;
-                
-                dispatch_async(self.imageProcessingQueue, ^{
-                    __strong typeof(self) strongSelf = weakSelf;
-                    
-                    UIImage *thumbnailImageForLargeImage = [strongSelf thumbnailForImage:largeImage
-                                                                                withSize:imageSize];
-                    
-                    // If the images are PNGs then compara their specific PNG data
-                    if (cachedImageHasAlpha && largeImageHasAlpha) {
-                        NSData *cachedImageData = UIImagePNGRepresentation(cachedImage);
-                        NSData *largeImageData = UIImagePNGRepresentation(thumbnailImageForLargeImage);
-                        if (cachedImageData.length != largeImageData.length) {
-                            [self storeImage:thumbnailImageForLargeImage
-                                      forKey:imageIdentifier];
-                            [self cacheImageToDisk:thumbnailImageForLargeImage
-                                     forIdentifier:imageIdentifier];
-                            completionBlock(thumbnailImageForLargeImage);
-                        }
-                    }
-                    
-                    if (!cachedImageHasAlpha && !largeImageHasAlpha) {
-                        NSData *cachedImageData = UIImageJPEGRepresentation(cachedImage, 1.0f);
-                        NSData *largeImageData = UIImageJPEGRepresentation(thumbnailImageForLargeImage, 1.0f);
-                        
-                        if (cachedImageData.length != largeImageData.length) {
-                            [self storeImage:thumbnailImageForLargeImage
-                                      forKey:imageIdentifier];
-                            [self cacheImageToDisk:thumbnailImageForLargeImage
-                                     forIdentifier:imageIdentifier];
-                            completionBlock(thumbnailImageForLargeImage);
-                        }
-                    }
-                });
-            }
-        } else {
-            cachedImage = self.placeholderThumbnailImage;
-            
-            if (completionBlock) {
-                __weak typeof(self) weakSelf = self;
-                dispatch_async(self.imageProcessingQueue, ^{
-                    __strong typeof(self) strongSelf = weakSelf;
-                    
-                    if (strongSelf) {
-                        UIImage *processedImage = [strongSelf thumbnailForImage:largeImage
-                                                                       withSize:imageSize];
-                        [self storeImage:processedImage
-                                  forKey:imageIdentifier];
-                        [self cacheImageToDisk:processedImage
-                                 forIdentifier:imageIdentifier];
-                        
-                        completionBlock(processedImage);
-                    }
-                });
-            }
-        }
+        [strongSelf processThumbnailForIdentifier:imageIdentifier
+                                 withSourceDigest:[strongSelf digestForImage:largeImage]
+                                   thumbnailBlock:^UIImage *{
+                                       return [weakSelf thumbnailForImage:largeImage
+                                                                 withSize:imageSize];
+                                   } processingCompletionBlock:completionBlock];
+    });
+    
+    return cachedImage ? cachedImage : self.placeholderThumbnailImage;
+}
+
+- (UIImage *)thumbnailForImageAtURL:(NSURL *)imageURL
+                     withIdentifier:(NSString *)imageIdentifier
+                           withSize:(CGFloat)imageSize
+          processingCompletionBlock:(AFAThumbnailProcessingCompletionBlock)completionBlock {
+    if (!imageURL) {
+        return nil;
     }
     
-    return cachedImage;
+    UIImage *cachedImage = [self cachedImageForForKey:imageIdentifier];
+    
+    // Read the source bytes on the IO queue, then hash and downsample them
+    // on the image processing queue without decoding the full sized image
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.ioProcessingQueue, ^{
+        NSError *error = nil;
+        NSData *imageData = [NSData dataWithContentsOfURL:imageURL
+                                                  options:NSDataReadingMappedIfSafe
+                                                    error:&error];
+        if (!imageData) {
+            AFALogError(@"Cannot read source image for identifier: %@. Reason:%@", imageIdentifier, error.localizedDescription);
+            return;
+        }
+        
+        dispatch_queue_t imageProcessingQueue = weakSelf.imageProcessingQueue;
+        if (!imageProcessingQueue) {
+            return;
+        }
+        
+        dispatch_async(imageProcessingQueue, ^{
+            __strong typeof(self) strongSelf = weakSelf;
+            
+            [strongSelf processThumbnailForIdentifier:imageIdentifier
+                                     withSourceDigest:[strongSelf digestForData:imageData]
+                                       thumbnailBlock:^UIImage *{
+                                           return [UIImage createThumbnailForImageData:imageData
+                                                                              withSize:imageSize];
+                                       } processingCompletionBlock:completionBlock];
+        });
+    });
+    
+    return cachedImage ? cachedImage : self.placeholderThumbnailImage;
 }
 
 - (UIImage *)thumbnailImageForIdentifier:(NSString *)imageIdentifier {
     UIImage *thumbnailImage = [self cachedImageForForKey:imageIdentifier];
     
-    if (!thumbnailImage) {
-        thumbnailImage = [self cachedDiskImageForIdentifier:imageIdentifier];
-    }
-    
     if (!thumbnailImage) {
         thumbnailImage = self.placeholderThumbnailImage;
     }
@@ -169,14 +178,112 @@ static NSString * const cachedThumbnailsPath = @"CachedThumbnails";
     return thumbnailImage;
 }
 
+- (void)thumbnailImageForIdentifier:(NSString *)imageIdentifier
+                    completionBlock:(AFAThumbnailProcessingCompletionBlock)completionBlock {
+    NSParameterAssert(completionBlock);
+    
+    UIImage *thumbnailImage = [self cachedImageForForKey:imageIdentifier];
+    if (thumbnailImage) {
+        completionBlock(thumbnailImage);
+        return;
+    }
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.ioProcessingQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        UIImage *diskImage = [strongSelf cachedDiskImageForIdentifier:imageIdentifier];
+        if (diskImage) {
+            [strongSelf storeImage:diskImage
+                            forKey:imageIdentifier];
+        }
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completionBlock(diskImage);
+        });
+    });
+}
+
 - (void)cleanupMemoryCache {
     [self.imageCache removeAllObjects];
 }
 
+- (void)setDiskCacheBudget:(unsigned long long)diskCacheBudget {
+    _diskCacheBudget = diskCacheBudget;
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.ioProcessingQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        [strongSelf trimDiskCacheToBudget];
+    });
+}
+
 
 #pragma mark -
 #pragma mark Private interface
 
+- (void)processThumbnailForIdentifier:(NSString *)imageIdentifier
+                     withSourceDigest:(NSString *)sourceDigest
+                       thumbnailBlock:(UIImage * (^)(void))thumbnailBlock
+            processingCompletionBlock:(AFAThumbnailProcessingCompletionBlock)completionBlock {
+    // If the thumbnail in memory was generated from the same source there
+    // is nothing to update
+    if (sourceDigest &&
+        [self.sourceDigests[imageIdentifier] isEqualToString:sourceDigest] &&
+        [self cachedImageForForKey:imageIdentifier]) {
+        return;
+    }
+    
+    UIImage *thumbnailImage = thumbnailBlock();
+    if (!thumbnailImage) {
+        return;
+    }
+    
+    self.sourceDigests[imageIdentifier] = sourceDigest;
+    [self storeImage:thumbnailImage
+              forKey:imageIdentifier];
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.ioProcessingQueue, ^{
+        __strong typeof(self) strongSelf = weakSelf;
+        [strongSelf cacheImageToDisk:thumbnailImage
+                       forIdentifier:imageIdentifier];
+    });
+    
+    if (completionBlock) {
+        completionBlock(thumbnailImage);
+    }
+}
+
+- (NSString *)digestForData:(NSData *)data {
+    if (!data) {
+        return nil;
+    }
+    
+    unsigned char r[CC_MD5_DIGEST_LENGTH];
+    CC_MD5(data.bytes, (CC_LONG)data.length, r);
+    
+    return [self hexStringForDigest:r];
+}
+
+- (NSString *)digestForImage:(UIImage *)image {
+    CGImageRef imageRef = image.CGImage;
+    if (!imageRef) {
+        return nil;
+    }
+    
+    // Hash the already decoded pixel data instead of re-encoding the image
+    NSData *pixelData = CFBridgingRelease(CGDataProviderCopyData(CGImageGetDataProvider(imageRef)));
+    NSString *pixelDigest = [self digestForData:pixelData];
+    
+    return pixelDigest ? [NSString stringWithFormat:@"%@-%zux%zu", pixelDigest, CGImageGetWidth(imageRef), CGImageGetHeight(imageRef)] : nil;
+}
+
+- (NSString *)hexStringForDigest:(unsigned char *)r {
+    return [NSString stringWithFormat:@"%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x",
+            r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], r[8], r[9], r[10], r[11], r[12], r[13], r[14], r[15]];
+}
+
 - (void)storeImage:(UIImage *)image
             forKey:(NSString *)key {
     if (!image || !key) {
@@ -212,49 +319,170 @@ static NSString * const cachedThumbnailsPath = @"CachedThumbnails";
     }
     unsigned char r[CC_MD5_DIGEST_LENGTH];
     CC_MD5(str, (CC_LONG)strlen(str), r);
-    NSString *filename = [NSString stringWithFormat:@"%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x",
-                          r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], r[8], r[9], r[10], r[11], r[12], r[13], r[14], r[15]];
+    NSString *filename = [self hexStringForDigest:r];
     
     return filename;
 }
 
 - (void)cacheImageToDisk:(UIImage *)image
            forIdentifier:(NSString *)identifier {
-    NSString *thumbnailDownloadPath = [self thumbnailDownloadPathForIdentifier:identifier];
-    NSData *imageData = UIImagePNGRepresentation(image);
+    // Keep PNG for thumbnails that need transparency, everything else is
+    // stored as JPEG which is considerably smaller for photographic content
+    BOOL hasAlpha = [image hasAlphaChannel];
+    NSData *imageData = hasAlpha ? UIImagePNGRepresentation(image) : UIImageJPEGRepresentation(image, kAFAThumbnailJPEGCompressionQuality);
+    if (!imageData) {
+        AFALogError(@"Cannot encode image with identifier: %@", identifier);
+        return;
+    }
     
-    BOOL doesFileExist = [[NSFileManager defaultManager] fileExistsAtPath:thumbnailDownloadPath];
-    if (!doesFileExist) {
+    NSString *cacheName = [self cacheNameForKey:identifier];
+    NSString *fileName = [cacheName stringByAppendingPathExtension:hasAlpha ? kAFAThumbnailPNGPathExtension : kAFAThumbnailJPEGPathExtension];
+    NSString *thumbnailDownloadPath = [self thumbnailDownloadPathForFileName:fileName];
+    
+    AFAThumbnailDiskCacheEntry *previousEntry = self.diskCacheIndex[cacheName];
+    if (previousEntry) {
+        // The encoding might have changed along with the image
+        if (![previousEntry.fileName isEqualToString:fileName]) {
+            [self removeDiskCacheEntry:previousEntry
+                          forCacheName:cacheName];
+        } else {
+            self.diskCacheSize -= previousEntry.fileSize;
+            [self.diskCacheIndex removeObjectForKey:cacheName];
+        }
+    } else if (!self.diskCacheIndex.count) {
         [self createIntermediateDirectoryStructureForPath:thumbnailDownloadPath];
     }
     
     if (![imageData writeToFile:thumbnailDownloadPath
-                     atomically:NO]) {
+                     atomically:YES]) {
         AFALogError(@"Cannot cache to disk image with identifier: %@", identifier);
+        return;
     }
+    
+    AFAThumbnailDiskCacheEntry *entry = [AFAThumbnailDiskCacheEntry new];
+    entry.fileName = fileName;
+    entry.fileSize = imageData.length;
+    entry.accessDate = [NSDate date];
+    self.diskCacheIndex[cacheName] = entry;
+    self.diskCacheSize += entry.fileSize;
+    
+    [self trimDiskCacheToBudget];
 }
 
 - (UIImage *)cachedDiskImageForIdentifier:(NSString *)identifier {
-    NSString *thumbnailDownloadPath = [self thumbnailDownloadPathForIdentifier:identifier];
+    // Thumbnails that aren't indexed are not on disk either
+    NSString *cacheName = [self cacheNameForKey:identifier];
+    AFAThumbnailDiskCacheEntry *entry = self.diskCacheIndex[cacheName];
+    if (!entry) {
+        return nil;
+    }
+    
+    NSString *thumbnailDownloadPath = [self thumbnailDownloadPathForFileName:entry.fileName];
     NSError *error = nil;
     NSData *imageData = [NSData dataWithContentsOfFile:thumbnailDownloadPath
                                                options:NSDataReadingUncached
                                                  error:&error];
-    if (error.code != NSFileReadNoSuchFileError) {
+    if (!imageData) {
         AFALogError(@"Encountered an error while loading disk cached image with identifier: %@", identifier);
+        [self removeDiskCacheEntry:entry
+                      forCacheName:cacheName];
+        
+        return nil;
     }
     
-    if (imageData) {
-      return [UIImage imageWithData:imageData];
-    } else {
-        return nil;
+    // Record the access so that eviction can pick the least recently used
+    // thumbnails, also across launches
+    entry.accessDate = [NSDate date];
+    [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate : entry.accessDate}
+                                     ofItemAtPath:thumbnailDownloadPath
+                                            error:nil];
+    
+    // Decode off the main thread so the first render doesn't pay for it
+    return [UIImage createDecodedImageWithData:imageData];
+}
+
+- (void)buildDiskCacheIndex {
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSURL *thumbnailsDirectoryURL = [NSURL fileURLWithPath:[self thumbnailDownloadPathForFileName:@""]];
+    NSArray *resourceKeys = @[NSURLIsDirectoryKey, NSURLFileSizeKey, NSURLContentModificationDateKey];
+    NSArray *fileURLs = [fileManager contentsOfDirectoryAtURL:thumbnailsDirectoryURL
+                                   includingPropertiesForKeys:resourceKeys
+                                                      options:NSDirectoryEnumerationSkipsHiddenFiles
+                                                        error:nil];
+    
+    for (NSURL *fileURL in fileURLs) {
+        NSDictionary *resourceValues = [fileURL resourceValuesForKeys:resourceKeys
+                                                                error:nil];
+        if ([resourceValues[NSURLIsDirectoryKey] boolValue]) {
+            continue;
+        }
+        
+        NSString *fileName = fileURL.lastPathComponent;
+        NSString *cacheName = fileName.stringByDeletingPathExtension;
+        if (![self isValidCacheFileName:fileName]) {
+            // Thumbnails stored before hashed file names were introduced
+            // cannot be looked up anymore
+            [fileManager removeItemAtURL:fileURL
+                                   error:nil];
+            continue;
+        }
+        
+        AFAThumbnailDiskCacheEntry *entry = [AFAThumbnailDiskCacheEntry new];
+        entry.fileName = fileName;
+        entry.fileSize = [resourceValues[NSURLFileSizeKey] unsignedLongLongValue];
+        entry.accessDate = resourceValues[NSURLContentModificationDateKey] ?: [NSDate distantPast];
+        self.diskCacheIndex[cacheName] = entry;
+        self.diskCacheSize += entry.fileSize;
     }
+    
+    [self trimDiskCacheToBudget];
+}
+
+- (void)trimDiskCacheToBudget {
+    if (self.diskCacheSize <= self.diskCacheBudget) {
+        return;
+    }
+    
+    NSArray *cacheNames = [self.diskCacheIndex keysSortedByValueUsingComparator:^NSComparisonResult(AFAThumbnailDiskCacheEntry *firstEntry, AFAThumbnailDiskCacheEntry *secondEntry) {
+        return [firstEntry.accessDate compare:secondEntry.accessDate];
+    }];
+    
+    for (NSString *cacheName in cacheNames) {
+        if (self.diskCacheSize <= self.diskCacheBudget) {
+            break;
+        }
+        
+        [self removeDiskCacheEntry:self.diskCacheIndex[cacheName]
+                      forCacheName:cacheName];
+    }
+}
+
+- (void)removeDiskCacheEntry:(AFAThumbnailDiskCacheEntry *)entry
+                forCacheName:(NSString *)cacheName {
+    [[NSFileManager defaultManager] removeItemAtPath:[self thumbnailDownloadPathForFileName:entry.fileName]
+                                               error:nil];
+    self.diskCacheSize -= entry.fileSize;
+    [self.diskCacheIndex removeObjectForKey:cacheName];
+}
+
+- (BOOL)isValidCacheFileName:(NSString *)fileName {
+    NSString *pathExtension = fileName.pathExtension;
+    NSString *cacheName = fileName.stringByDeletingPathExtension;
+    
+    if (![pathExtension isEqualToString:kAFAThumbnailPNGPathExtension] &&
+        ![pathExtension isEqualToString:kAFAThumbnailJPEGPathExtension]) {
+        return NO;
+    }
+    
+    NSCharacterSet *nonHexCharacterSet = [[NSCharacterSet characterSetWithCharactersInString:@"0123456789abcdef"] invertedSet];
+    return (cacheName.length == CC_MD5_DIGEST_LENGTH * 2 &&
+            [cacheName rangeOfCharacterFromSet:nonHexCharacterSet].location == NSNotFound);
 }
 
-- (NSString *)thumbnailDownloadPathForIdentifier:(NSString *)identifier {
+- (NSString *)thumbnailDownloadPathForFileName:(NSString *)fileName {
     NSArray *documentsPaths = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES);
     NSString *documentsPath = documentsPaths.firstObject;
-    NSString *thumbnailPath = [[documentsPath stringByAppendingPathComponent:cachedThumbnailsPath] stringByAppendingPathComponent:identifier];
+    NSString *thumbnailPath = [[documentsPath stringByAppendingPathComponent:cachedThumbnailsPath] stringByAppendingPathComponent:fileName];
     
     return thumbnailPath;
 }
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+@class ASDKModelUser;
+
+/**
+ *  Local directory of the users seen by the app through searches, task involvements
+ *  and profile responses. It answers prefix queries without a round trip so that
+ *  people searches can display results while the remote query is still in flight.
+ *  Access is thread safe.
+ */
+@interface AFAUserDirectory : NSObject
+
+/**
+ *  Adds or refreshes the passed users in the directory. Both user and profile models
+ *  are accepted, profiles are converted to user models. Entries without a model ID
+ *  are ignored.
+ *
+ *  @param users Collection of ASDKModelUser or ASDKModelProfile objects
+ */
+- (void)storeUsers:(NSArray *)users;
+
+/**
+ *  Returns the stored users for which every word of the search text is a prefix of
+ *  their first name, last name or email. Matching is case and diacritic insensitive
+ *  and results are sorted by name.
+ *
+ *  @param searchText      Text typed by the user
+ *  @param excludedUserIDs IDs of users that should be left out of the results
+ *
+ *  @return                Array of matching ASDKModelUser objects
+ */
+- (NSArray *)usersMatchingSearchText:(NSString *)searchText
+                     excludedUserIDs:(NSSet *)excludedUserIDs;
+
+/**
+ *  Removes all the users stored in the directory.
+ */
+- (void)removeAllUsers;
+
+@end
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "AFAUserDirectory.h"
+@import ActivitiSDK;
+
+@interface AFAUserDirectory () {
+    NSLock *_lock;
+}
+
+// Stored users keyed by model ID
+@property (strong, nonatomic) NSMutableDictionary   *users;
+// Sorted search tokens and the IDs of the users they belong to. Both arrays are
+// rebuilt lazily on the first query following a change.
+@property (strong, nonatomic) NSArray               *sortedTokens;
+@property (strong, nonatomic) NSArray               *sortedTokenUserIDs;
+@property (assign, nonatomic) BOOL                  isTokenIndexStale;
+
+@end
+
+@implementation AFAUserDirectory
+
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _lock = [NSLock new];
+        _users = [NSMutableDictionary dictionary];
+    }
+    
+    return self;
+}
+
+
+#pragma mark -
+#pragma mark Public interface
+
+- (void)storeUsers:(NSArray *)users {
+    if (!users.count) {
+        return;
+    }
+    
+    [_lock lock];
+    
+    for (id user in users) {
+        ASDKModelUser *userModel = [self userModelForObject:user];
+        if (userModel.modelID.length) {
+            self.users[userModel.modelID] = userModel;
+            self.isTokenIndexStale = YES;
+        }
+    }
+    
+    [_lock unlock];
+}
+
+- (NSArray *)usersMatchingSearchText:(NSString *)searchText
+                     excludedUserIDs:(NSSet *)excludedUserIDs {
+    NSArray *searchWords = [self tokensForString:searchText];
+    if (!searchWords.count) {
+        return nil;
+    }
+    
+    [_lock lock];
+    
+    if (self.isTokenIndexStale) {
+        [self rebuildTokenIndex];
+    }
+    
+    // A user matches when each of the searched words prefixes one of its tokens
+    NSMutableSet *matchingUserIDs = nil;
+    for (NSString *searchWord in searchWords) {
+        NSSet *wordMatchingUserIDs = [self userIDsForTokenPrefix:searchWord];
+        
+        if (!matchingUserIDs) {
+            matchingUserIDs = [wordMatchingUserIDs mutableCopy];
+        } else {
+            [matchingUserIDs intersectSet:wordMatchingUserIDs];
+        }
+        
+        if (!matchingUserIDs.count) {
+            break;
+        }
+    }
+    
+    if (excludedUserIDs.count) {
+        [matchingUserIDs minusSet:excludedUserIDs];
+    }
+    
+    NSMutableArray *matchingUsers = [NSMutableArray array];
+    for (NSString *userID in matchingUserIDs) {
+        [matchingUsers addObject:self.users[userID]];
+    }
+    
+    [_lock unlock];
+    
+    return [matchingUsers sortedArrayUsingComparator:^NSComparisonResult(ASDKModelUser *firstUser, ASDKModelUser *secondUser) {
+        return [[firstUser normalisedName] localizedCaseInsensitiveCompare:[secondUser normalisedName]];
+    }];
+}
+
+- (void)removeAllUsers {
+    [_lock lock];
+    
+    [self.users removeAllObjects];
+    self.sortedTokens = nil;
+    self.sortedTokenUserIDs = nil;
+    self.isTokenIndexStale = NO;
+    
+    [_lock unlock];
+}
+
+
+#pragma mark -
+#pragma mark Token index
+
+- (void)rebuildTokenIndex {
+    NSMutableArray *tokenEntries = [NSMutableArray array];
+    
+    [self.users enumerateKeysAndObjectsUsingBlock:^(NSString *userID, ASDKModelUser *user, BOOL *stop) {
+        NSMutableSet *userTokens = [NSMutableSet set];
+        [userTokens addObjectsFromArray:[self tokensForString:user.userFirstName]];
+        [userTokens addObjectsFromArray:[self tokensForString:user.userLastName]];
+        [userTokens addObjectsFromArray:[self tokensForString:user.email]];
+        
+        for (NSString *token in userTokens) {
+            [tokenEntries addObject:@[token, userID]];
+        }
+    }];
+    
+    [tokenEntries sortUsingComparator:^NSComparisonResult(NSArray *firstEntry, NSArray *secondEntry) {
+        return [firstEntry.firstObject compare:secondEntry.firstObject
+                                       options:NSLiteralSearch];
+    }];
+    
+    NSMutableArray *sortedTokens = [NSMutableArray arrayWithCapacity:tokenEntries.count];
+    NSMutableArray *sortedTokenUserIDs = [NSMutableArray arrayWithCapacity:tokenEntries.count];
+    for (NSArray *tokenEntry in tokenEntries) {
+        [sortedTokens addObject:tokenEntry.firstObject];
+        [sortedTokenUserIDs addObject:tokenEntry.lastObject];
+    }
+    
+    self.sortedTokens = sortedTokens;
+    self.sortedTokenUserIDs = sortedTokenUserIDs;
+    self.isTokenIndexStale = NO;
+}
+
+- (NSSet *)userIDsForTokenPrefix:(NSString *)tokenPrefix {
+    // Binary search for the first token not ordered before the prefix, all the
+    // tokens sharing the prefix follow it contiguously
+    NSUInteger firstTokenIdx = [self.sortedTokens indexOfObject:tokenPrefix
+                                                  inSortedRange:NSMakeRange(0, self.sortedTokens.count)
+                                                        options:NSBinarySearchingInsertionIndex | NSBinarySearchingFirstEqual
+                                                usingComparator:^NSComparisonResult(NSString *firstToken, NSString *secondToken) {
+                                                    return [firstToken compare:secondToken
+                                                                       options:NSLiteralSearch];
+                                                }];
+    
+    NSMutableSet *userIDs = [NSMutableSet set];
+    for (NSUInteger tokenIdx = firstTokenIdx; tokenIdx < self.sortedTokens.count; tokenIdx++) {
+        if (![self.sortedTokens[tokenIdx] hasPrefix:tokenPrefix]) {
+            break;
+        }
+        
+        [userIDs addObject:self.sortedTokenUserIDs[tokenIdx]];
+    }
+    
+    return userIDs;
+}
+
+
+#pragma mark -
+#pragma mark Convenience methods
+
+- (NSArray *)tokensForString:(NSString *)string {
+    NSString *foldedString = [string stringByFoldingWithOptions:NSCaseInsensitiveSearch | NSDiacriticInsensitiveSearch
+                                                         locale:nil];
+    NSArray *components = [foldedString componentsSeparatedByCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    
+    return [components filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"length > 0"]];
+}
+
+- (ASDKModelUser *)userModelForObject:(id)object {
+    if ([object isKindOfClass:[ASDKModelUser class]]) {
+        return (ASDKModelUser *)object;
+    }
+    
+    if ([object isKindOfClass:[ASDKModelProfile class]]) {
+        ASDKModelProfile *profile = (ASDKModelProfile *)object;
+        
+        ASDKModelUser *userModel = [ASDKModelUser new];
+        userModel.modelID = profile.modelID;
+        userModel.email = profile.email;
+        userModel.userFirstName = profile.userFirstName;
+        userModel.userLastName = profile.userLastName;
+        userModel.externalID = profile.externalID;
+        userModel.pictureID = profile.pictureID;
+        userModel.companyName = profile.companyName;
+        
+        return userModel;
+    }
+    
+    return nil;
+}
+
+@end
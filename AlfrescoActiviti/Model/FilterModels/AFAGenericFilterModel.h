@@ -46,7 +46,7 @@ typedef NS_ENUM(NSInteger, AFAGenericFilterAdditionalFilterParameterType) {
 };
 
 
-@interface AFAGenericFilterModel : AFABaseModel
+@interface AFAGenericFilterModel : AFABaseModel <NSCopying>
 
 @property (strong, nonatomic) NSString                          *filterID;
 @property (strong, nonatomic) NSString                          *appDefinitionID;
@@ -47,6 +47,22 @@
     return self;
 }
 
+- (id)copyWithZone:(NSZone *)zone {
+    AFAGenericFilterModel *filterModel = [[[self class] allocWithZone:zone] init];
+    filterModel.filterID = self.filterID;
+    filterModel.appDefinitionID = self.appDefinitionID;
+    filterModel.appDeploymentID = self.appDeploymentID;
+    filterModel.processInstanceID = self.processInstanceID;
+    filterModel.text = self.text;
+    filterModel.sortType = self.sortType;
+    filterModel.state = self.state;
+    filterModel.assignmentType = self.assignmentType;
+    filterModel.page = self.page;
+    filterModel.size = self.size;
+    
+    return filterModel;
+}
+
 
 #pragma mark -
 #pragma mark Public interface
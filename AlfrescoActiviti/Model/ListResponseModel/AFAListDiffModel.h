@@ -0,0 +1,44 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  Describes how a list changed between two snapshots of model objects identified
+ *  by their modelID. Deleted and reloaded index paths refer to the old snapshot,
+ *  inserted ones to the new snapshot, which is what UITableView batch updates expect.
+ */
+@interface AFAListDiffModel : NSObject
+
+@property (strong, nonatomic, readonly) NSArray     *deletedIndexPaths;
+@property (strong, nonatomic, readonly) NSArray     *insertedIndexPaths;
+@property (strong, nonatomic, readonly) NSArray     *reloadedIndexPaths;
+// Array of @[fromIndexPath, toIndexPath] pairs
+@property (strong, nonatomic, readonly) NSArray     *movedIndexPaths;
+@property (assign, nonatomic, readonly) NSUInteger  oldEntriesCount;
+
+// Set when the snapshots cannot be diffed, for instance because an entry lacks
+// a modelID or appears more than once, and the list should be reloaded instead
+@property (assign, nonatomic, readonly) BOOL        requiresFullReload;
+@property (assign, nonatomic, readonly) BOOL        hasChanges;
+
++ (instancetype)diffFromEntries:(NSArray *)oldEntries
+                      toEntries:(NSArray *)newEntries
+                      inSection:(NSInteger)section;
+
+@end
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import "AFAListDiffModel.h"
+@import ActivitiSDK;
+@import UIKit;
+
+@interface AFAListDiffModel ()
+
+@property (strong, nonatomic, readwrite) NSArray        *deletedIndexPaths;
+@property (strong, nonatomic, readwrite) NSArray        *insertedIndexPaths;
+@property (strong, nonatomic, readwrite) NSArray        *reloadedIndexPaths;
+@property (strong, nonatomic, readwrite) NSArray        *movedIndexPaths;
+@property (assign, nonatomic, readwrite) NSUInteger     oldEntriesCount;
+@property (assign, nonatomic, readwrite) BOOL           requiresFullReload;
+
+@end
+
+@implementation AFAListDiffModel
+
+
+#pragma mark -
+#pragma mark Public interface
+
++ (instancetype)diffFromEntries:(NSArray *)oldEntries
+                      toEntries:(NSArray *)newEntries
+                      inSection:(NSInteger)section {
+    AFAListDiffModel *diff = [AFAListDiffModel new];
+    diff.oldEntriesCount = oldEntries.count;
+    
+    NSDictionary *oldIndexes = [self indexesByModelIDForEntries:oldEntries];
+    NSDictionary *newIndexes = [self indexesByModelIDForEntries:newEntries];
+    if (!oldIndexes || !newIndexes) {
+        diff.requiresFullReload = YES;
+        return diff;
+    }
+    
+    NSMutableArray *deletedIndexPaths = [NSMutableArray array];
+    NSMutableArray *insertedIndexPaths = [NSMutableArray array];
+    NSMutableArray *reloadedIndexPaths = [NSMutableArray array];
+    NSMutableArray *movedIndexPaths = [NSMutableArray array];
+    
+    for (NSUInteger oldIdx = 0; oldIdx < oldEntries.count; oldIdx++) {
+        if (!newIndexes[[oldEntries[oldIdx] modelID]]) {
+            [deletedIndexPaths addObject:[NSIndexPath indexPathForRow:oldIdx
+                                                            inSection:section]];
+        }
+    }
+    
+    // Walk the entries present in both snapshots in their new order. The ones
+    // forming the longest run of increasing old positions keep their place,
+    // everything else has moved.
+    NSMutableArray *commonNewIndexes = [NSMutableArray array];
+    NSMutableArray *commonOldIndexes = [NSMutableArray array];
+    for (NSUInteger newIdx = 0; newIdx < newEntries.count; newIdx++) {
+        NSNumber *oldIdx = oldIndexes[[newEntries[newIdx] modelID]];
+        if (oldIdx) {
+            [commonNewIndexes addObject:@(newIdx)];
+            [commonOldIndexes addObject:oldIdx];
+        } else {
+            [insertedIndexPaths addObject:[NSIndexPath indexPathForRow:newIdx
+                                                             inSection:section]];
+        }
+    }
+    
+    NSIndexSet *stableIndexes = [self longestIncreasingSubsequenceIndexesInArray:commonOldIndexes];
+    for (NSUInteger commonIdx = 0; commonIdx < commonOldIndexes.count; commonIdx++) {
+        NSUInteger oldIdx = [commonOldIndexes[commonIdx] unsignedIntegerValue];
+        NSUInteger newIdx = [commonNewIndexes[commonIdx] unsignedIntegerValue];
+        NSIndexPath *oldIndexPath = [NSIndexPath indexPathForRow:oldIdx
+                                                       inSection:section];
+        NSIndexPath *newIndexPath = [NSIndexPath indexPathForRow:newIdx
+                                                       inSection:section];
+        BOOL isChanged = ![oldEntries[oldIdx] isEqual:newEntries[newIdx]];
+        
+        if ([stableIndexes containsIndex:commonIdx]) {
+            if (isChanged) {
+                [reloadedIndexPaths addObject:oldIndexPath];
+            }
+        } else if (isChanged) {
+            // Moved rows are not reconfigured by the table view
+            [deletedIndexPaths addObject:oldIndexPath];
+            [insertedIndexPaths addObject:newIndexPath];
+        } else {
+            [movedIndexPaths addObject:@[oldIndexPath, newIndexPath]];
+        }
+    }
+    
+    diff.deletedIndexPaths = deletedIndexPaths;
+    diff.insertedIndexPaths = insertedIndexPaths;
+    diff.reloadedIndexPaths = reloadedIndexPaths;
+    diff.movedIndexPaths = movedIndexPaths;
+    
+    return diff;
+}
+
+- (BOOL)hasChanges {
+    return (self.requiresFullReload ||
+            self.deletedIndexPaths.count ||
+            self.insertedIndexPaths.count ||
+            self.reloadedIndexPaths.count ||
+            self.movedIndexPaths.count) ? YES : NO;
+}
+
+
+#pragma mark -
+#pragma mark Private interface
+
++ (NSDictionary *)indexesByModelIDForEntries:(NSArray *)entries {
+    NSMutableDictionary *indexes = [NSMutableDictionary dictionaryWithCapacity:entries.count];
+    
+    for (NSUInteger idx = 0; idx < entries.count; idx++) {
+        NSString *modelID = [entries[idx] modelID];
+        if (!modelID || indexes[modelID]) {
+            return nil;
+        }
+        
+        indexes[modelID] = @(idx);
+    }
+    
+    return indexes;
+}
+
++ (NSIndexSet *)longestIncreasingSubsequenceIndexesInArray:(NSArray *)values {
+    // Patience sorting: tails holds, for every subsequence length, the index of
+    // the smallest value ending a subsequence of that length
+    NSUInteger count = values.count;
+    NSMutableArray *tails = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray *predecessors = [NSMutableArray arrayWithCapacity:count];
+    
+    for (NSUInteger idx = 0; idx < count; idx++) {
+        NSUInteger value = [values[idx] unsignedIntegerValue];
+        NSUInteger low = 0;
+        NSUInteger high = tails.count;
+        
+        while (low < high) {
+            NSUInteger mid = (low + high) / 2;
+            if ([values[[tails[mid] unsignedIntegerValue]] unsignedIntegerValue] < value) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        
+        [predecessors addObject:low ? tails[low - 1] : @(NSNotFound)];
+        if (low == tails.count) {
+            [tails addObject:@(idx)];
+        } else {
+            tails[low] = @(idx);
+        }
+    }
+    
+    NSMutableIndexSet *subsequenceIndexes = [NSMutableIndexSet indexSet];
+    NSUInteger idx = tails.count ? [tails.lastObject unsignedIntegerValue] : NSNotFound;
+    while (idx != NSNotFound) {
+        [subsequenceIndexes addIndex:idx];
+        idx = [predecessors[idx] unsignedIntegerValue];
+    }
+    
+    return subsequenceIndexes;
+}
+
+@end
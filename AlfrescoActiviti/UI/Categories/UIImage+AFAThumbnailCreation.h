@@ -23,4 +23,11 @@
 + (UIImage *)createThumbnailForImage:(UIImage *)image
                             withSize:(CGFloat)imageSize;
 
++ (UIImage *)createThumbnailForImageData:(NSData *)imageData
+                                withSize:(CGFloat)imageSize;
+
++ (UIImage *)createDecodedImageWithData:(NSData *)imageData;
+
+- (BOOL)hasAlphaChannel;
+
 @end
@@ -26,37 +26,86 @@ static const int activitiLogLevel = AFA_LOG_LEVEL_VERBOSE; // | AFA_LOG_FLAG_TRA
 
 + (UIImage *)createThumbnailForImage:(UIImage *)image
                             withSize:(CGFloat)imageSize {
-    NSMutableData *imageData = [[NSMutableData alloc] initWithData:UIImageJPEGRepresentation(image, 1.0)];
+    if (!image.CGImage) {
+        AFALogError(@"Error creating thumbnail. Source image is nil");
+        return nil;
+    }
+    
+    // The source image is already decoded so instead of round tripping it
+    // through an encoder the thumbnail is drawn directly at the target size
+    CGSize pixelSize = CGSizeMake(image.size.width * image.scale, image.size.height * image.scale);
+    CGFloat scaleFactor = MIN(1.0f, imageSize / MAX(pixelSize.width, pixelSize.height));
+    CGSize thumbnailSize = CGSizeMake(floor(pixelSize.width * scaleFactor), floor(pixelSize.height * scaleFactor));
+    
+    UIGraphicsImageRendererFormat *rendererFormat = [UIGraphicsImageRendererFormat defaultFormat];
+    rendererFormat.scale = 1.0f;
+    rendererFormat.opaque = ![image hasAlphaChannel];
     
-    CFMutableDataRef dataRef = (__bridge CFMutableDataRef)imageData;
-    CGImageSourceRef imgSrc  = CGImageSourceCreateWithData(dataRef, NULL);
+    UIGraphicsImageRenderer *renderer = [[UIGraphicsImageRenderer alloc] initWithSize:thumbnailSize
+                                                                               format:rendererFormat];
+    return [renderer imageWithActions:^(UIGraphicsImageRendererContext * _Nonnull rendererContext) {
+        [image drawInRect:CGRectMake(0, 0, thumbnailSize.width, thumbnailSize.height)];
+    }];
+}
+
++ (UIImage *)createThumbnailForImageData:(NSData *)imageData
+                                withSize:(CGFloat)imageSize {
+    // Don't let ImageIO cache the full sized decoded image, only the thumbnail is needed
+    NSDictionary *sourceOptions = @{(__bridge NSString *)kCGImageSourceShouldCache : @NO};
+    CGImageSourceRef imgSrc = CGImageSourceCreateWithData((__bridge CFDataRef)imageData, (__bridge CFDictionaryRef)sourceOptions);
     
     UIImage *scaledImage = nil;
     
-    if (imgSrc == NULL){
+    if (imgSrc == NULL) {
         AFALogError(@"Error creating image source for thumbnail generation. Image source is nil");
     } else {
-        
+        // Decode straight to the thumbnail size and do it now rather than at render time
         NSDictionary *options = @{(__bridge NSString *)kCGImageSourceCreateThumbnailFromImageAlways : @YES,
-                                  (__bridge NSString *)kCGImageSourceCreateThumbnailWithTransform: @YES,
-                                  (__bridge NSString *)kCGImageSourceThumbnailMaxPixelSize : @(imageSize)};
+                                  (__bridge NSString *)kCGImageSourceCreateThumbnailWithTransform   : @YES,
+                                  (__bridge NSString *)kCGImageSourceShouldCacheImmediately         : @YES,
+                                  (__bridge NSString *)kCGImageSourceThumbnailMaxPixelSize          : @(imageSize)};
+        CGImageRef img = CGImageSourceCreateThumbnailAtIndex(imgSrc, 0, (__bridge CFDictionaryRef)options);
         
-        CFDictionaryRef cfOptions     = (__bridge CFDictionaryRef)options;
-        CGImageRef img                = CGImageSourceCreateThumbnailAtIndex(imgSrc, 0, cfOptions);
-        CFStringRef type              = CGImageSourceGetType(imgSrc);
-        CGImageDestinationRef imgDest = CGImageDestinationCreateWithData(dataRef, type, 1, NULL);
+        if (img == NULL) {
+            AFALogError(@"Error creating thumbnail from image source");
+        } else {
+            scaledImage = [UIImage imageWithCGImage:img];
+            CGImageRelease(img);
+        }
         
-        CGImageDestinationAddImage(imgDest, img, NULL);
-        CGImageDestinationFinalize(imgDest);
+        CFRelease(imgSrc);
+    }
+    
+    return scaledImage;
+}
+
++ (UIImage *)createDecodedImageWithData:(NSData *)imageData {
+    CGImageSourceRef imgSrc = CGImageSourceCreateWithData((__bridge CFDataRef)imageData, NULL);
+    
+    UIImage *decodedImage = nil;
+    
+    if (imgSrc == NULL) {
+        AFALogError(@"Error creating image source for image decoding. Image source is nil");
+    } else {
+        NSDictionary *options = @{(__bridge NSString *)kCGImageSourceShouldCacheImmediately : @YES};
+        CGImageRef img = CGImageSourceCreateImageAtIndex(imgSrc, 0, (__bridge CFDictionaryRef)options);
         
-        scaledImage = [UIImage imageWithCGImage:img];
+        if (img != NULL) {
+            decodedImage = [UIImage imageWithCGImage:img];
+            CGImageRelease(img);
+        }
         
         CFRelease(imgSrc);
-        CGImageRelease(img);
-        CFRelease(imgDest);
     }
     
-    return scaledImage;
+    return decodedImage;
+}
+
+- (BOOL)hasAlphaChannel {
+    CGImageAlphaInfo alphaInfo = CGImageGetAlphaInfo(self.CGImage);
+    return !(alphaInfo == kCGImageAlphaNone ||
+             alphaInfo == kCGImageAlphaNoneSkipFirst ||
+             alphaInfo == kCGImageAlphaNoneSkipLast);
 }
 
 @end
@@ -29,5 +29,6 @@
 @property (weak, nonatomic) IBOutlet UILabel *commentDateLabel;
 
 - (void)setUpCellWithComment:(ASDKModelComment *)comment;
++ (NSString *)contributorNameForComment:(ASDKModelComment *)comment;
 
 @end
@@ -40,9 +40,13 @@
 #pragma mark Public interface
 
 - (void)setUpCellWithComment:(ASDKModelComment *)comment {
-    self.contributorNameLabel.text = [NSString stringWithFormat:@"%@ %@", comment.authorModel.userFirstName, comment.authorModel.userLastName];
+    self.contributorNameLabel.text = [AFACommentTableViewCell contributorNameForComment:comment];
     self.commentDescriptionLabel.text = comment.message;
     self.commentDateLabel.text = [comment.creationDate commentFormattedString];
 }
 
++ (NSString *)contributorNameForComment:(ASDKModelComment *)comment {
+    return [NSString stringWithFormat:@"%@ %@", comment.authorModel.userFirstName, comment.authorModel.userLastName];
+}
+
 @end
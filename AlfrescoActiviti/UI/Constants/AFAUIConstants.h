@@ -126,6 +126,3 @@ extern NSString *kSegueIDProcessInstanceDetailsAddCommentsUnwind;
 extern NSString *kSegueIDProcessInstanceViewCompletedStartForm;
 extern NSString *kSegueIDProcessInstanceViewCompletedStartFormUnwind;
 extern NSString *kSegueIDProfileContentPickerComponentEmbedding;
-
-// Thumbnail manager
-extern NSString *kProfileImageThumbnailIdentifier;
@@ -134,9 +134,3 @@ NSString *kSegueIDProcessInstanceViewCompletedStartForm         = @"ProcessInsta
 NSString *kSegueIDProcessInstanceViewCompletedStartFormUnwind   = @"ProcessInstanceViewCompletedStartFormUnwindSegueID";
 NSString *kSegueIDProfileContentPickerComponentEmbedding        = @"ProfileContentPickerComponentEmbeddingSegueID";
 
-
-#pragma mark -
-#pragma mark Thumbnail manager
-
-NSString *kProfileImageThumbnailIdentifier                      = @"kProfileImageThumbnailIdentifier";
-
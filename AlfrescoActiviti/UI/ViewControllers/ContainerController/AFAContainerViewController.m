@@ -34,6 +34,8 @@
 // Managers
 #import "AFAServiceRepository.h"
 #import "AFAThumbnailManager.h"
+#import "AFAUserDirectory.h"
+#import "AFAAvatarCache.h"
 #import "AFAAppServices.h"
 #import "AFAProcessServices.h"
 #import "AFAFilterServices.h"
@@ -98,6 +100,16 @@ static CGFloat const kBackgroundThemeColorChangeAnimationDuration = .072f;
         [serviceRepository registerServiceObject:saveFormService
                                       forPurpose:AFAServiceObjectTypeNetworkDelayedSaveFormService];
         
+        // Register the user directory used to answer people searches locally
+        AFAUserDirectory *userDirectory = [AFAUserDirectory new];
+        [serviceRepository registerServiceObject:userDirectory
+                                      forPurpose:AFAServiceObjectTypeUserDirectory];
+        
+        // Register the avatar cache shared by the screens displaying user pictures
+        AFAAvatarCache *avatarCache = [AFAAvatarCache new];
+        [serviceRepository registerServiceObject:avatarCache
+                                      forPurpose:AFAServiceObjectTypeAvatarCache];
+        
         [[NSNotificationCenter defaultCenter] addObserver:self
                                                  selector:@selector(handleUnAuthorizedRequestNotification)
                                                      name:kADSKAPIUnauthorizedRequestNotification
@@ -33,8 +33,7 @@
 
 // Managers
 #import "AFAServiceRepository.h"
-#import "AFAThumbnailManager.h"
-#import "AFAProfileServices.h"
+#import "AFAAvatarCache.h"
 
 typedef NS_ENUM(NSInteger, AFADrawerMenuCellType) {
     AFADrawerMenuCellTypeAvatar = 0,
@@ -51,22 +50,10 @@ typedef NS_ENUM(NSInteger, AFADrawerMenuCellType) {
 @property (strong, nonatomic) UIImage               *profileImage;
 @property (assign, nonatomic) AFADrawerMenuCellType currentSelectedMenuCell;
 
-// Services
-@property (strong, nonatomic) AFAProfileServices    *fetchProfileImageService;
-
 @end
 
 @implementation AFADrawerMenuViewController
 
-- (instancetype)initWithCoder:(NSCoder *)aDecoder {
-    self = [super initWithCoder:aDecoder];
-    if (self) {
-        _fetchProfileImageService = [AFAProfileServices new];
-    }
-    
-    return self;
-}
-
 
 #pragma mark -
 #pragma mark Life cycle
@@ -156,24 +143,21 @@ typedef NS_ENUM(NSInteger, AFADrawerMenuCellType) {
 #pragma mark -
 #pragma mark Service integration
 
-- (void)updateProfileImageForIndexPath:(NSIndexPath *)indexPath  {
+- (void)updateProfileImageForIndexPath:(NSIndexPath *)indexPath
+                              withSize:(CGFloat)avatarSize {
+    AFAAvatarCache *avatarCache = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeAvatarCache];
+    
     __weak typeof(self) weakSelf = self;
-    [self.fetchProfileImageService requestProfileImageWithCompletionBlock:^(UIImage *profileImage, NSError *error) {
-        __strong typeof(self) strongSelf = weakSelf;
-        
-        if (!error) {
-            AFAThumbnailManager *thumbnailManager = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeThumbnailManager];
-            AFAAvatarMenuTableViewCell *refetchedAvatarCell = (AFAAvatarMenuTableViewCell *)[strongSelf.menuTableView cellForRowAtIndexPath:indexPath];
-            strongSelf.profileImage = [thumbnailManager thumbnailForImage:profileImage
-                                                     withIdentifier:kProfileImageThumbnailIdentifier
-                                                           withSize:CGRectGetHeight(refetchedAvatarCell.avatarView.frame) * [UIScreen mainScreen].scale
-                                          processingCompletionBlock:^(UIImage *processedThumbnailImage) {
-                                              dispatch_async(dispatch_get_main_queue(), ^{
-                                                  refetchedAvatarCell.avatarView.profileImage = processedThumbnailImage;
-                                              });
-                                          }];
-        }
-    }];
+    [avatarCache currentUserAvatarWithSize:avatarSize
+                           completionBlock:^(UIImage *avatarImage, NSError *error) {
+                               __strong typeof(self) strongSelf = weakSelf;
+                               
+                               if (avatarImage) {
+                                   strongSelf.profileImage = avatarImage;
+                                   AFAAvatarMenuTableViewCell *avatarCellToUpdate = (AFAAvatarMenuTableViewCell *)[strongSelf.menuTableView cellForRowAtIndexPath:indexPath];
+                                   avatarCellToUpdate.avatarView.profileImage = avatarImage;
+                               }
+                           }];
 }
 
 
@@ -204,16 +188,13 @@ forRowAtIndexPath:(NSIndexPath *)indexPath {
             AFAAvatarMenuTableViewCell *avatarCell = [tableView dequeueReusableCellWithIdentifier:kCellIDDrawerMenuAvatar
                                                                                      forIndexPath:indexPath];
             
-            // If we don't have loaded a thumbnail image use a placeholder instead
-            // otherwise look in the cache or compute the image and set it once
-            // available
-            AFAThumbnailManager *thumbnailManager = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeThumbnailManager];
-            self.profileImage = [thumbnailManager thumbnailImageForIdentifier:kProfileImageThumbnailIdentifier];
-            if (self.profileImage == [thumbnailManager placeholderThumbnailImage]) {
-                [self updateProfileImageForIndexPath:indexPath];
-            }
+            // Avatars already in memory are delivered synchronously, otherwise keep
+            // displaying the last known image or a placeholder until it's available
+            [self updateProfileImageForIndexPath:indexPath
+                                        withSize:CGRectGetHeight(avatarCell.avatarView.frame) * [UIScreen mainScreen].scale];
             
-            avatarCell.avatarView.profileImage = self.profileImage;
+            AFAAvatarCache *avatarCache = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeAvatarCache];
+            avatarCell.avatarView.profileImage = self.profileImage ? self.profileImage : [avatarCache placeholderAvatarImage];
             avatarCell.delegate = self;
             
             cell = avatarCell;
@@ -28,5 +28,7 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerType) {
 
 @property (assign, nonatomic) AFAPeoplePickerControllerType peoplePickerType;
 @property (strong, nonatomic) NSString *taskID;
+// IDs of the users already involved with the task, left out of local search results
+@property (strong, nonatomic) NSSet    *excludedUserIDs;
 
 @end
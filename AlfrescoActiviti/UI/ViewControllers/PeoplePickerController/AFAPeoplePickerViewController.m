@@ -31,11 +31,13 @@
 
 // Models
 #import "AFAUserFilterModel.h"
+#import "AFAListDiffModel.h"
 
 // Managers
 #import "AFAServiceRepository.h"
 #import "AFAUserServices.h"
 #import "AFATaskServices.h"
+#import "AFAUserDirectory.h"
 
 // Views
 #import "AFAActivityView.h"
@@ -44,6 +46,8 @@
 // Cells
 #import "AFAContributorTableViewCell.h"
 
+static const NSTimeInterval kAFAPeoplePickerRemoteSearchDelay = .3f;
+
 typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
     AFAPeoplePickerControllerStateIdle,
     AFAPeoplePickerControllerStateInProgress,
@@ -66,6 +70,8 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
 @property (strong, nonatomic) NSArray                           *contributorsArr;
 @property (strong, nonatomic) NSMutableDictionary               *selectedContributors;
 @property (assign, nonatomic) AFAPeoplePickerControllerState    controllerState;
+@property (strong, nonatomic) NSTimer                           *remoteSearchTimer;
+@property (strong, nonatomic) NSString                          *currentSearchText;
 
 // Task services
 @property (strong, nonatomic) AFATaskServices                   *involveUserService;
@@ -115,6 +121,10 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
                                           forState:UIControlStateNormal];
     self.backBarButtonItem.title = [NSString iconStringForIconType:ASDKGlyphIconTypeChevronLeft];
     self.navigationBarTitle = NSLocalizedString(kLocalizationPeoplePickerControllerTitleText, @"People picker screen title");
+    
+    [self.peopleSearchField addTarget:self
+                               action:@selector(onSearchTextChanged:)
+                     forControlEvents:UIControlEventEditingChanged];
 }
 
 - (void)viewDidAppear:(BOOL)animated {
@@ -123,6 +133,13 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
     [self.peopleSearchField becomeFirstResponder];
 }
 
+- (void)viewWillDisappear:(BOOL)animated {
+    [super viewWillDisappear:animated];
+    
+    [self.remoteSearchTimer invalidate];
+    [self.fetchUsersService cancelUserListRequest];
+}
+
 
 #pragma mark -
 #pragma mark Actions
@@ -136,6 +153,38 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
     [self toggleContentTransparentOverlay];
 }
 
+- (void)onSearchTextChanged:(UITextField *)textField {
+    NSString *searchText = [textField.text stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    
+    [self.remoteSearchTimer invalidate];
+    [self.fetchUsersService cancelUserListRequest];
+    self.currentSearchText = searchText;
+    
+    if (!searchText.length) {
+        self.controllerState = AFAPeoplePickerControllerStateIdle;
+        [self updateContributorsWithUsers:nil];
+        return;
+    }
+    
+    // Answer from the local user directory right away and refine the results
+    // with a remote query once the user pauses typing
+    NSArray *localUsers = [self localUsersMatchingSearchText:searchText];
+    if (localUsers.count) {
+        self.controllerState = AFAPeoplePickerControllerStateIdle;
+    }
+    [self updateContributorsWithUsers:localUsers];
+    
+    self.remoteSearchTimer = [NSTimer scheduledTimerWithTimeInterval:kAFAPeoplePickerRemoteSearchDelay
+                                                              target:self
+                                                            selector:@selector(onRemoteSearchTimer:)
+                                                            userInfo:searchText
+                                                             repeats:NO];
+}
+
+- (void)onRemoteSearchTimer:(NSTimer *)timer {
+    [self fetchUserListForSearchText:timer.userInfo];
+}
+
 #pragma mark -
 #pragma mark UITextField Delegate
 
@@ -146,6 +195,7 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
 }
 
 - (BOOL)textFieldShouldReturn:(UITextField *)textField {
+    [self.remoteSearchTimer invalidate];
     if (textField.text.length) {
         [self fetchUserListForSearchText:textField.text];
     }
@@ -177,10 +227,18 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
 #pragma mark Service integration
 
 - (void)fetchUserListForSearchText:(NSString *)searchText {
-    self.controllerState = AFAPeoplePickerControllerStateInProgress;
+    searchText = [searchText stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    self.currentSearchText = searchText;
+    
+    // Keep locally found results on screen while the remote query is in flight
+    if (!self.contributorsArr.count) {
+        self.controllerState = AFAPeoplePickerControllerStateInProgress;
+    }
+    
+    // Only the latest query is of interest
+    [self.fetchUsersService cancelUserListRequest];
     
     AFAUserFilterModel *userFilterModel = [AFAUserFilterModel new];
-    searchText = [searchText stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
     
     // First check if we're dealing with a search by email
     if ([searchText isValidEmailAddress]) {
@@ -200,15 +258,23 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
                                        completionBlock:^(NSArray *users, NSError *error, ASDKModelPaging *paging) {
                                            __strong typeof(self) strongSelf = weakSelf;
                                            
-                                           BOOL isContentAvailable = users.count ? YES : NO;
-                                           strongSelf.controllerState = isContentAvailable ? AFAPeoplePickerControllerStateIdle : AFAPeoplePickerControllerStateEmptyList;
+                                           // The search text changed while the request was in flight
+                                           if (![searchText isEqualToString:strongSelf.currentSearchText]) {
+                                               return;
+                                           }
                                            
                                            if (!error) {
-                                               strongSelf.contributorsArr = users;
+                                               NSArray *mergedUsers = [strongSelf mergeRemoteUsers:users
+                                                                                        withPaging:paging
+                                                                                     forSearchText:searchText];
+                                               BOOL isContentAvailable = mergedUsers.count ? YES : NO;
+                                               strongSelf.controllerState = isContentAvailable ? AFAPeoplePickerControllerStateIdle : AFAPeoplePickerControllerStateEmptyList;
                                                
-                                               // Reload table data
-                                               [strongSelf.contributorsTableView reloadData];
+                                               [strongSelf updateContributorsWithUsers:mergedUsers];
                                            } else {
+                                               BOOL isContentAvailable = strongSelf.contributorsArr.count ? YES : NO;
+                                               strongSelf.controllerState = isContentAvailable ? AFAPeoplePickerControllerStateIdle : AFAPeoplePickerControllerStateEmptyList;
+                                               
                                                [strongSelf showGenericNetworkErrorAlertControllerWithMessage:NSLocalizedString(kLocalizationAlertDialogGenericNetworkErrorText, @"Generic network error")];
                                            }
                                        }];
@@ -290,6 +356,72 @@ typedef NS_ENUM(NSInteger, AFAPeoplePickerControllerState) {
 }
 
 
+#pragma mark -
+#pragma mark Search results
+
+- (NSArray *)localUsersMatchingSearchText:(NSString *)searchText {
+    AFAUserDirectory *userDirectory = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeUserDirectory];
+    NSSet *excludedUserIDs = (AFAPeoplePickerControllerTypeInvolve == self.peoplePickerType) ? self.excludedUserIDs : nil;
+    
+    return [userDirectory usersMatchingSearchText:searchText
+                                  excludedUserIDs:excludedUserIDs];
+}
+
+- (NSArray *)mergeRemoteUsers:(NSArray *)remoteUsers
+                   withPaging:(ASDKModelPaging *)paging
+                forSearchText:(NSString *)searchText {
+    // The remote results are authoritative. Local matches are only kept next to
+    // them when the server returned a truncated page and might have left them out.
+    if (!paging || paging.total <= (NSInteger)remoteUsers.count) {
+        return remoteUsers;
+    }
+    
+    NSMutableArray *mergedUsers = [NSMutableArray arrayWithArray:remoteUsers];
+    NSSet *remoteUserIDs = [NSSet setWithArray:[remoteUsers valueForKey:NSStringFromSelector(@selector(modelID))]];
+    for (ASDKModelUser *localUser in [self localUsersMatchingSearchText:searchText]) {
+        if (![remoteUserIDs containsObject:localUser.modelID]) {
+            [mergedUsers addObject:localUser];
+        }
+    }
+    
+    return mergedUsers;
+}
+
+- (void)updateContributorsWithUsers:(NSArray *)users {
+    AFAListDiffModel *listDiff = [AFAListDiffModel diffFromEntries:self.contributorsArr
+                                                         toEntries:users
+                                                         inSection:0];
+    self.contributorsArr = users;
+    
+    // Rows that are already displayed are updated in place so that refined
+    // results don't make the list flicker
+    if (listDiff.requiresFullReload ||
+        !listDiff.oldEntriesCount ||
+        !self.contributorsTableView.window ||
+        [self.contributorsTableView numberOfRowsInSection:0] != (NSInteger)listDiff.oldEntriesCount) {
+        [self.contributorsTableView reloadData];
+        return;
+    }
+    
+    if (!listDiff.hasChanges) {
+        return;
+    }
+    
+    [self.contributorsTableView performBatchUpdates:^{
+        [self.contributorsTableView deleteRowsAtIndexPaths:listDiff.deletedIndexPaths
+                                          withRowAnimation:UITableViewRowAnimationFade];
+        [self.contributorsTableView insertRowsAtIndexPaths:listDiff.insertedIndexPaths
+                                          withRowAnimation:UITableViewRowAnimationFade];
+        [self.contributorsTableView reloadRowsAtIndexPaths:listDiff.reloadedIndexPaths
+                                          withRowAnimation:UITableViewRowAnimationNone];
+        for (NSArray *movedIndexPaths in listDiff.movedIndexPaths) {
+            [self.contributorsTableView moveRowAtIndexPath:movedIndexPaths.firstObject
+                                               toIndexPath:movedIndexPaths.lastObject];
+        }
+    } completion:nil];
+}
+
+
 #pragma mark -
 #pragma mark - Progress hud setup
 
@@ -45,7 +45,7 @@
 // Managers
 #import "AFAServiceRepository.h"
 #import "AFAProfileServices.h"
-#import "AFAThumbnailManager.h"
+#import "AFAAvatarCache.h"
 @import ActivitiSDK;
 
 typedef NS_ENUM(NSInteger, AFAProfileControllerState) {
@@ -86,7 +86,6 @@ UITableViewDelegate>
 
 // Services
 @property (strong, nonatomic) AFAProfileServices                *requestProfileService;
-@property (strong, nonatomic) AFAProfileServices                *profileImageService;
 @property (strong, nonatomic) AFAProfileServices                *profileUpdateService;
 @property (strong, nonatomic) AFAProfileServices                *profilePasswordUpdateService;
 @property (strong, nonatomic) ASDKKVOManager                    *kvoManager;
@@ -106,7 +105,6 @@ UITableViewDelegate>
         _controllerState = AFAProfileControllerStateIdle;
         _progressHUD = [self configureProgressHUD];
         _requestProfileService = [AFAProfileServices new];
-        _profileImageService = [AFAProfileServices new];
         _profileUpdateService = [AFAProfileServices new];
         _profilePasswordUpdateService = [AFAProfileServices new];
         
@@ -149,8 +147,8 @@ UITableViewDelegate>
     self.lastNameTextField.delegate = self;
     
     // Set a provisory profile image placeholder
-    AFAThumbnailManager *thumbnailManager = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeThumbnailManager];
-    self.avatarView.profileImage = [thumbnailManager placeholderThumbnailImage];
+    AFAAvatarCache *avatarCache = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeAvatarCache];
+    self.avatarView.profileImage = [avatarCache placeholderAvatarImage];
     
     self.initialContentPickerContainerHeight = self.contentPickerContainerHeightConstraint.constant;
 }
@@ -331,32 +329,20 @@ UITableViewDelegate>
 }
 
 - (void)fetchProfileImage {
+    // The avatar cache only goes to the server when the image isn't cached
+    // in memory or on disk, and it's invalidated when a new image is uploaded
+    AFAAvatarCache *avatarCache = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeAvatarCache];
+    
     __weak typeof(self) weakSelf = self;
-    [self.profileImageService requestProfileImageWithCompletionBlock:^(UIImage *profileImage, NSError *error) {
-        __strong typeof(self) strongSelf = weakSelf;
-        
-        AFAThumbnailManager *thumbnailManager = [[AFAServiceRepository sharedRepository] serviceObjectForPurpose:AFAServiceObjectTypeThumbnailManager];
-        
-        if (!error) {
-            strongSelf.profileImage = profileImage;
-            
-            // If we don't have loaded a thumbnail image use a placeholder instead
-            // otherwise look in the cache or compute the image and set it once
-            // available
-            strongSelf.profileImage = [thumbnailManager thumbnailForImage:self.profileImage
-                                                           withIdentifier:kProfileImageThumbnailIdentifier
-                                                                 withSize:CGRectGetHeight(strongSelf.avatarView.frame) * [UIScreen mainScreen].scale
-                                                processingCompletionBlock:^(UIImage *processedThumbnailImage) {
-                                                    dispatch_async(dispatch_get_main_queue(), ^{
-                                                        weakSelf.avatarView.profileImage = processedThumbnailImage;
-                                                    });
-                                                }];
-        } else {
-            strongSelf.profileImage = [thumbnailManager thumbnailImageForIdentifier:kProfileImageThumbnailIdentifier];
-        }
-        
-        strongSelf.avatarView.profileImage = self.profileImage;
-    }];
+    [avatarCache currentUserAvatarWithSize:CGRectGetHeight(self.avatarView.frame) * [UIScreen mainScreen].scale
+                           completionBlock:^(UIImage *avatarImage, NSError *error) {
+                               __strong typeof(self) strongSelf = weakSelf;
+                               
+                               if (avatarImage) {
+                                   strongSelf.profileImage = avatarImage;
+                                   strongSelf.avatarView.profileImage = avatarImage;
+                               }
+                           }];
 }
 
 
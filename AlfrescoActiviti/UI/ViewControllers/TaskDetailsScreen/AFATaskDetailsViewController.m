@@ -251,6 +251,9 @@ AFAModalPeoplePickerViewControllerDelegate>
             peoplePickerViewController.peoplePickerType = AFAPeoplePickerControllerTypeReAssign;
         } else {
             peoplePickerViewController.peoplePickerType = AFAPeoplePickerControllerTypeInvolve;
+            
+            AFATableControllerTaskContributorsModel *taskContributorsModel = [self.dataSource reusableTableControllerModelForSectionType:AFATaskDetailsSectionTypeContributors];
+            peoplePickerViewController.excludedUserIDs = [NSSet setWithArray:[taskContributorsModel.involvedPeople valueForKey:NSStringFromSelector(@selector(modelID))]];
         }
     } else if ([kSegueIDTaskDetailsViewProcess isEqualToString:segue.identifier]) {
         AFAProcessInstanceDetailsViewController *processInstanceDetailsController = (AFAProcessInstanceDetailsViewController *)segue.destinationViewController;
@@ -42,6 +42,68 @@
 #import "AFAProfileServices.h"
 #import "AFAIntegrationServices.h"
 
+static NSString * const kAFATaskDetailsTaskRequestKeyFormat  = @"task.%@";
+static NSString * const kAFATaskDetailsProfileRequestKey     = @"profile";
+static NSString * const kAFATaskDetailsContentRequestKey     = @"content";
+static NSString * const kAFATaskDetailsCommentsRequestKey    = @"comments";
+static NSString * const kAFATaskDetailsChecklistRequestKey   = @"checklist";
+static const NSTimeInterval kAFATaskDetailsPrefetchedResponseValidityInterval = 30.0f;
+
+@interface AFATaskDetailsLoaderResponse : NSObject
+
+@property (strong, nonatomic) id                model;
+@property (strong, nonatomic) ASDKModelPaging   *paging;
+@property (strong, nonatomic) NSDate            *responseDate;
+
++ (instancetype)responseWithModel:(id)model
+                           paging:(ASDKModelPaging *)paging;
+
+@end
+
+@implementation AFATaskDetailsLoaderResponse
+
++ (instancetype)responseWithModel:(id)model
+                           paging:(ASDKModelPaging *)paging {
+    AFATaskDetailsLoaderResponse *response = [AFATaskDetailsLoaderResponse new];
+    response.model = model;
+    response.paging = paging;
+    response.responseDate = [NSDate date];
+    
+    return response;
+}
+
+@end
+
+typedef void (^AFATaskDetailsLoaderCompletionBlock) (AFATaskDetailsLoaderResponse *response, NSError *error);
+typedef void (^AFATaskDetailsLoaderRequestBlock) (AFATaskDetailsLoaderCompletionBlock completionBlock, AFATaskDetailsLoaderCompletionBlock cachedResultsBlock);
+
+// Book-keeping for a request that is on the wire. Callers asking for the same
+// resource while it is loading are attached to it instead of issuing a new one.
+@interface AFATaskDetailsPendingRequest : NSObject
+
+@property (strong, nonatomic) NSMutableArray                *completionBlocks;
+@property (strong, nonatomic) NSMutableArray                *cachedResultsBlocks;
+@property (strong, nonatomic) AFATaskDetailsLoaderResponse  *cachedResponse;
+@property (strong, nonatomic) NSError                       *cachedError;
+@property (assign, nonatomic) BOOL                          isCachedResponseDelivered;
+
+@end
+
+@implementation AFATaskDetailsPendingRequest
+
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        _completionBlocks = [NSMutableArray array];
+        _cachedResultsBlocks = [NSMutableArray array];
+    }
+    
+    return self;
+}
+
+@end
+
 @interface AFATaskDetailsDataSource ()
 
 // Services
@@ -65,6 +127,12 @@
 @property (strong, nonatomic) AFATableControllerTaskDetailsModel *remoteTaskDetailsModel;
 @property (strong, nonatomic) NSError *cachedTaskDetailsError;
 @property (strong, nonatomic) NSError *remoteTaskDetailsError;
+@property (assign, nonatomic) BOOL    isParentTaskRequested;
+
+// Aggregate loader
+@property (strong, nonatomic) NSMutableDictionary   *pendingRequests;
+@property (strong, nonatomic) NSMutableDictionary   *prefetchedResponses;
+@property (assign, nonatomic) NSUInteger            prefetchGeneration;
 
 @end
 
@@ -82,6 +150,8 @@
         _sectionModels = [NSMutableDictionary dictionary];
         _cellFactories = [NSMutableDictionary dictionary];
         _tableController = [AFATableController new];
+        _pendingRequests = [NSMutableDictionary dictionary];
+        _prefetchedResponses = [NSMutableDictionary dictionary];
         
         _requestProfileService = [AFAProfileServices new];
         _fetchTaskDetailsService = [AFATaskServices new];
@@ -119,9 +189,15 @@
      3. If the current task is claimable and has an assignee then fetch the
      current user profile to also check if the task is already claimed and
      can be dequeued.
+     
+     Requests which are already in flight are joined instead of being issued
+     again and the fetched task is shared with the contributors section.
      */
     self.cachedTaskDetailsModel = [AFATableControllerTaskDetailsModel new];
     self.remoteTaskDetailsModel = [AFATableControllerTaskDetailsModel new];
+    self.cachedTaskDetailsError = nil;
+    self.remoteTaskDetailsError = nil;
+    self.isParentTaskRequested = NO;
     
     self.cachedTaskDetailsModel.isConnectivityAvailable = self.isConnectivityAvailable;
     self.remoteTaskDetailsModel.isConnectivityAvailable = self.isConnectivityAvailable;
@@ -138,6 +214,7 @@
     
     // 2
     if (self.parentTaskID) {
+        self.isParentTaskRequested = YES;
         dispatch_group_enter(remoteTaskDetailsGroup);
         dispatch_group_enter(cachedTaskDetailsGroup);
         [self fetchDetailsForParentTaskWithID:self.parentTaskID
@@ -168,11 +245,13 @@
         __strong typeof(self) strongSelf = weakSelf;
         
         BOOL registerCellActions = [strongSelf registerTaskDetailsCellActionsForModel:self.remoteTaskDetailsModel];
-        if (completionBlock) {
-            dispatch_async(dispatch_get_main_queue(), ^{
+        dispatch_async(dispatch_get_main_queue(), ^{
+            if (completionBlock) {
                 completionBlock(weakSelf.remoteTaskDetailsError, registerCellActions);
-            });
-        }
+            }
+            
+            [weakSelf prefetchSectionsAdjacentToSectionType:AFATaskDetailsSectionTypeTaskDetails];
+        });
     });
 }
 
@@ -186,6 +265,7 @@
     AFATableControllerContentModel *taskContentModel = [self reusableTableControllerModelForSectionType:AFATaskDetailsSectionTypeFilesContent];
     ASDKModelContent *selectedContentModel = taskContentModel.attachedContentArr[index];
     
+    [self invalidatePrefetchedResponses];
     [self.deleteTaskContentService requestTaskContentDeleteForContent:selectedContentModel
                                                   withCompletionBlock:^(BOOL isContentDeleted, NSError *error) {
                                                       if (completionBlock) {
@@ -196,31 +276,42 @@
 
 - (void)taskContributorsWithCompletionBlock:(AFATaskDataSourceErrorCompletionBlock)completionBlock
                          cachedResultsBlock:(AFATaskDataSourceErrorCompletionBlock)cachedResulstBlock {
+    // Involved people are part of the task details, reuse the task fetched for the
+    // details section if it's still fresh or join its request if it's in flight
+    if ([self replayPrefetchedResponseForSectionType:AFATaskDetailsSectionTypeContributors
+                                 withCompletionBlock:completionBlock]) {
+        return;
+    }
+    
     __weak typeof(self) weakSelf = self;
-    [self.fetchTaskDetailsService requestTaskDetailsForID:self.taskID
-                                          completionBlock:^(ASDKModelTask *task, NSError *error) {
-                                              __strong typeof(self) strongSelf = weakSelf;
-                                              
-                                              if (!error) {
-                                                  [strongSelf handleTaskContributorsResponseForTask:task];
-                                              }
-                                              if (completionBlock) {
-                                                  completionBlock(error);
-                                              }
-                                          } cachedResults:^(ASDKModelTask *task, NSError *error) {
-                                              __strong typeof(self) strongSelf = weakSelf;
-                                              
-                                              if (!error) {
-                                                  [strongSelf handleTaskContributorsResponseForTask:task];
-                                              }
-                                              if (cachedResulstBlock) {
-                                                  cachedResulstBlock(error);
-                                              }
-                                          }];
+    [self loadTaskWithID:self.taskID
+            usingService:self.fetchTaskDetailsService
+         completionBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+             __strong typeof(self) strongSelf = weakSelf;
+             
+             if (!error) {
+                 [strongSelf handleTaskContributorsResponseForTask:response.model];
+             }
+             if (completionBlock) {
+                 completionBlock(error);
+             }
+             
+             [strongSelf prefetchSectionsAdjacentToSectionType:AFATaskDetailsSectionTypeContributors];
+         } cachedResultsBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+             __strong typeof(self) strongSelf = weakSelf;
+             
+             if (!error) {
+                 [strongSelf handleTaskContributorsResponseForTask:response.model];
+             }
+             if (cachedResulstBlock) {
+                 cachedResulstBlock(error);
+             }
+         }];
 }
 
 - (void)removeInvolvementForUser:(ASDKModelUser *)user
              withCompletionBlock:(AFATaskUserInvolvementDataSourceCompletionBlock)completionBlock {
+    [self invalidatePrefetchedResponses];
     [self.removeUserService requestToRemoveTaskUserInvolvement:user
                                                      forTaskID:self.taskID
                                                completionBlock:^(BOOL isUserInvolved, NSError *error) {
@@ -232,79 +323,97 @@
 
 - (void)taskContentWithCompletionBlock:(AFATaskDataSourceErrorCompletionBlock)completionBlock
                     cachedResultsBlock:(AFATaskDataSourceErrorCompletionBlock)cachedResultsBlock {
+    if ([self replayPrefetchedResponseForSectionType:AFATaskDetailsSectionTypeFilesContent
+                                 withCompletionBlock:completionBlock]) {
+        return;
+    }
+    
     __weak typeof(self) weakSelf = self;
-    [self.fetchTaskContentService requestTaskContentForID:self.taskID
-                                          completionBlock:^(NSArray *contentList, NSError *error) {
-                                              __strong typeof(self) strongSelf = weakSelf;
-                                              
-                                              if (!error) {
-                                                  [strongSelf handleTaskContentListResponse:contentList];
-                                              }
-                                              if (completionBlock) {
-                                                  completionBlock(error);
-                                              }
-                                          } cachedResults:^(NSArray *contentList, NSError *error) {
-                                              __strong typeof(self) strongSelf = weakSelf;
-                                              
-                                              if (!error) {
-                                                  [strongSelf handleTaskContentListResponse:contentList];
-                                              }
-                                              if (cachedResultsBlock) {
-                                                  cachedResultsBlock(error);
-                                              }
-                                          }];
+    [self loadTaskContentWithCompletionBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (!error) {
+            [strongSelf handleTaskContentListResponse:response.model];
+        }
+        if (completionBlock) {
+            completionBlock(error);
+        }
+        
+        [strongSelf prefetchSectionsAdjacentToSectionType:AFATaskDetailsSectionTypeFilesContent];
+    } cachedResultsBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (!error) {
+            [strongSelf handleTaskContentListResponse:response.model];
+        }
+        if (cachedResultsBlock) {
+            cachedResultsBlock(error);
+        }
+    }];
 }
 
 - (void)taskCommentsWithCompletionBlock:(AFATaskDataSourceErrorCompletionBlock)completionBlock
                      cachedResultsBlock:(AFATaskDataSourceErrorCompletionBlock)cachedResultsBlock {
+    if ([self replayPrefetchedResponseForSectionType:AFATaskDetailsSectionTypeComments
+                                 withCompletionBlock:completionBlock]) {
+        return;
+    }
+    
     __weak typeof(self) weakSelf = self;
-    [self.fetchTaskCommentsService requestTaskCommentsForID:self.taskID
-                                            completionBlock:^(NSArray *commentList, NSError *error, ASDKModelPaging *paging) {
-                                                __strong typeof(self) strongSelf = weakSelf;
-                                                
-                                                if (!error) {
-                                                    [strongSelf handleTaskCommentListResponse:commentList
-                                                                                       paging:paging];
-                                                }
-                                                if (completionBlock) {
-                                                    completionBlock(error);
-                                                }
-                                            } cachedResults:^(NSArray *commentList, NSError *error, ASDKModelPaging *paging) {
-                                                __strong typeof(self) strongSelf = weakSelf;
-                                                
-                                                if (!error) {
-                                                    [strongSelf handleTaskCommentListResponse:commentList
-                                                                                       paging:paging];
-                                                }
-                                                if (cachedResultsBlock) {
-                                                    cachedResultsBlock(error);
-                                                }
-                                            }];
+    [self loadTaskCommentsWithCompletionBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (!error) {
+            [strongSelf handleTaskCommentListResponse:response.model
+                                               paging:response.paging];
+        }
+        if (completionBlock) {
+            completionBlock(error);
+        }
+        
+        [strongSelf prefetchSectionsAdjacentToSectionType:AFATaskDetailsSectionTypeComments];
+    } cachedResultsBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (!error) {
+            [strongSelf handleTaskCommentListResponse:response.model
+                                               paging:response.paging];
+        }
+        if (cachedResultsBlock) {
+            cachedResultsBlock(error);
+        }
+    }];
 }
 
 - (void)taskChecklistWithCompletionBlock:(AFATaskDataSourceErrorCompletionBlock)completionBlock
                       cachedResultsBlock:(AFATaskDataSourceErrorCompletionBlock)cachedResultsBlock {
+    if ([self replayPrefetchedResponseForSectionType:AFATaskDetailsSectionTypeChecklist
+                                 withCompletionBlock:completionBlock]) {
+        return;
+    }
+    
     __weak typeof(self) weakSelf = self;
-    [self.fetchTaskChecklistService requestChecklistForTaskWithID:self.taskID
-                                                  completionBlock:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
-                                                      __strong typeof(self) strongSelf = weakSelf;
-                                                      
-                                                      if (!error) {
-                                                          [strongSelf handleTaskChecklistResponse:taskList];
-                                                      }
-                                                      if (completionBlock) {
-                                                          completionBlock(error);
-                                                      }
-                                                  } cachedResults:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
-                                                      __strong typeof(self) strongSelf = weakSelf;
-                                                      
-                                                      if (!error) {
-                                                          [strongSelf handleTaskChecklistResponse:taskList];
-                                                      }
-                                                      if (cachedResultsBlock) {
-                                                          cachedResultsBlock(error);
-                                                      }
-                                                  }];
+    [self loadTaskChecklistWithCompletionBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (!error) {
+            [strongSelf handleTaskChecklistResponse:response.model];
+        }
+        if (completionBlock) {
+            completionBlock(error);
+        }
+        
+        [strongSelf prefetchSectionsAdjacentToSectionType:AFATaskDetailsSectionTypeChecklist];
+    } cachedResultsBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (!error) {
+            [strongSelf handleTaskChecklistResponse:response.model];
+        }
+        if (cachedResultsBlock) {
+            cachedResultsBlock(error);
+        }
+    }];
 }
 
 - (void)updateCurrentTaskDetailsWithCompletionBlock:(AFATaskUpdateDataSourceCompletionBlock)completionBlock {
@@ -312,6 +421,8 @@
     AFATableControllerTaskDetailsModel *taskDetailsModel = [self reusableTableControllerModelForSectionType:AFATaskDetailsSectionTypeTaskDetails];
     taskUpdate.taskDueDate = taskDetailsModel.currentTask.dueDate;
     
+    [self invalidatePrefetchedResponses];
+    
     __weak typeof(self) weakSelf = self;
     [self.updateTaskService requestTaskUpdateWithRepresentation:taskUpdate
                                                       forTaskID:self.taskID
@@ -331,6 +442,7 @@
 }
 
 - (void)completeTaskWithCompletionBlock:(AFATaskCompleteDataSourceCompletionBlock)completionBlock {
+    [self invalidatePrefetchedResponses];
     [self.completeTaskService requestTaskCompletionForID:self.taskID
                                      withCompletionBlock:^(BOOL isTaskCompleted, NSError *error) {
                                          if (completionBlock) {
@@ -340,6 +452,7 @@
 }
 
 - (void)claimTaskWithCompletionBlock:(AFATaskClaimingDataSourceCompletionBlock)completionBlock {
+    [self invalidatePrefetchedResponses];
     [self.claimTaskService requestTaskClaimForTaskID:self.taskID
                                      completionBlock:^(BOOL isTaskClaimed, NSError *error) {
                                          if (completionBlock) {
@@ -349,6 +462,7 @@
 }
 
 - (void)unclaimTaskWithCompletionBlock:(AFATaskClaimingDataSourceCompletionBlock)completionBlock {
+    [self invalidatePrefetchedResponses];
     [self.unclaimTaskService requestTaskUnclaimForTaskID:self.taskID
                                          completionBlock:^(BOOL isTaskClaimed, NSError *error) {
                                              if (completionBlock) {
@@ -360,6 +474,7 @@
 - (void)updateChecklistOrderWithCompletionBlock:(AFATaskDataSourceErrorCompletionBlock)completionBlock {
     AFATableControllerChecklistModel *taskChecklistModel = [self reusableTableControllerModelForSectionType:AFATaskDetailsSectionTypeChecklist];
     
+    [self invalidatePrefetchedResponses];
     [self.updateChecklistOrderService requestChecklistOrderUpdateWithOrderArrat:[taskChecklistModel checkListIDs]
                                                                          taskID:self.taskID
                                                                 completionBlock:^(BOOL isTaskUpdated, NSError *error) {
@@ -372,6 +487,7 @@
 
 - (void)uploadIntegrationContentForNode:(ASDKIntegrationNodeContentRequestRepresentation *)nodeContentRepresentation
                     withCompletionBlock:(AFATaskDataSourceErrorCompletionBlock)completionBlock {
+    [self invalidatePrefetchedResponses];
     [self.uploadIntegrationTaskContentService requestUploadIntegrationContentForTaskID:self.taskID
                                                                     withRepresentation:nodeContentRepresentation
                                                                         completionBloc:^(ASDKModelContent *contentModel, NSError *error) {
@@ -514,6 +630,289 @@
 }
 
 
+#pragma mark -
+#pragma mark Aggregate loader
+
+- (void)loadResponseForRequestKey:(NSString *)requestKey
+                 withRequestBlock:(AFATaskDetailsLoaderRequestBlock)requestBlock
+                  completionBlock:(AFATaskDetailsLoaderCompletionBlock)completionBlock
+               cachedResultsBlock:(AFATaskDetailsLoaderCompletionBlock)cachedResultsBlock {
+    AFATaskDetailsPendingRequest *pendingRequest = self.pendingRequests[requestKey];
+    BOOL isRequestInFlight = (pendingRequest != nil);
+    
+    if (!isRequestInFlight) {
+        pendingRequest = [AFATaskDetailsPendingRequest new];
+        self.pendingRequests[requestKey] = pendingRequest;
+    }
+    
+    if (completionBlock) {
+        [pendingRequest.completionBlocks addObject:[completionBlock copy]];
+    }
+    
+    if (cachedResultsBlock) {
+        if (pendingRequest.isCachedResponseDelivered) {
+            // Late joiners still get to display the cached results first
+            AFATaskDetailsLoaderResponse *cachedResponse = pendingRequest.cachedResponse;
+            NSError *cachedError = pendingRequest.cachedError;
+            dispatch_async(dispatch_get_main_queue(), ^{
+                cachedResultsBlock(cachedResponse, cachedError);
+            });
+        } else {
+            [pendingRequest.cachedResultsBlocks addObject:[cachedResultsBlock copy]];
+        }
+    }
+    
+    if (isRequestInFlight) {
+        return;
+    }
+    
+    __weak typeof(self) weakSelf = self;
+    requestBlock(^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        AFATaskDetailsPendingRequest *finishedRequest = strongSelf.pendingRequests[requestKey];
+        [strongSelf.pendingRequests removeObjectForKey:requestKey];
+        
+        // Callers waiting for cached results are never left hanging, if none
+        // were delivered pass them the remote ones instead
+        for (AFATaskDetailsLoaderCompletionBlock resultBlock in finishedRequest.cachedResultsBlocks) {
+            resultBlock(response, error);
+        }
+        for (AFATaskDetailsLoaderCompletionBlock resultBlock in finishedRequest.completionBlocks) {
+            resultBlock(response, error);
+        }
+    }, ^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        AFATaskDetailsPendingRequest *loadingRequest = strongSelf.pendingRequests[requestKey];
+        loadingRequest.cachedResponse = response;
+        loadingRequest.cachedError = error;
+        loadingRequest.isCachedResponseDelivered = YES;
+        
+        NSArray *cachedResultsBlocks = [loadingRequest.cachedResultsBlocks copy];
+        [loadingRequest.cachedResultsBlocks removeAllObjects];
+        for (AFATaskDetailsLoaderCompletionBlock resultBlock in cachedResultsBlocks) {
+            resultBlock(response, error);
+        }
+    });
+}
+
+- (void)loadTaskWithID:(NSString *)taskID
+          usingService:(AFATaskServices *)taskService
+       completionBlock:(AFATaskDetailsLoaderCompletionBlock)completionBlock
+    cachedResultsBlock:(AFATaskDetailsLoaderCompletionBlock)cachedResultsBlock {
+    AFATaskDetailsLoaderRequestBlock requestBlock = ^(AFATaskDetailsLoaderCompletionBlock remoteResponseBlock, AFATaskDetailsLoaderCompletionBlock cachedResponseBlock) {
+        [taskService requestTaskDetailsForID:taskID
+                             completionBlock:^(ASDKModelTask *task, NSError *error) {
+                                 remoteResponseBlock([AFATaskDetailsLoaderResponse responseWithModel:task
+                                                                                              paging:nil], error);
+                             } cachedResults:^(ASDKModelTask *task, NSError *error) {
+                                 cachedResponseBlock([AFATaskDetailsLoaderResponse responseWithModel:task
+                                                                                              paging:nil], error);
+                             }];
+    };
+    
+    [self loadResponseForRequestKey:[NSString stringWithFormat:kAFATaskDetailsTaskRequestKeyFormat, taskID]
+                   withRequestBlock:requestBlock
+                    completionBlock:completionBlock
+                 cachedResultsBlock:cachedResultsBlock];
+}
+
+- (void)loadTaskContentWithCompletionBlock:(AFATaskDetailsLoaderCompletionBlock)completionBlock
+                        cachedResultsBlock:(AFATaskDetailsLoaderCompletionBlock)cachedResultsBlock {
+    __weak typeof(self) weakSelf = self;
+    AFATaskDetailsLoaderRequestBlock requestBlock = ^(AFATaskDetailsLoaderCompletionBlock remoteResponseBlock, AFATaskDetailsLoaderCompletionBlock cachedResponseBlock) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        [strongSelf.fetchTaskContentService requestTaskContentForID:strongSelf.taskID
+                                                    completionBlock:^(NSArray *contentList, NSError *error) {
+                                                        remoteResponseBlock([AFATaskDetailsLoaderResponse responseWithModel:contentList
+                                                                                                                     paging:nil], error);
+                                                    } cachedResults:^(NSArray *contentList, NSError *error) {
+                                                        cachedResponseBlock([AFATaskDetailsLoaderResponse responseWithModel:contentList
+                                                                                                                     paging:nil], error);
+                                                    }];
+    };
+    
+    [self loadResponseForRequestKey:kAFATaskDetailsContentRequestKey
+                   withRequestBlock:requestBlock
+                    completionBlock:completionBlock
+                 cachedResultsBlock:cachedResultsBlock];
+}
+
+- (void)loadTaskCommentsWithCompletionBlock:(AFATaskDetailsLoaderCompletionBlock)completionBlock
+                         cachedResultsBlock:(AFATaskDetailsLoaderCompletionBlock)cachedResultsBlock {
+    __weak typeof(self) weakSelf = self;
+    AFATaskDetailsLoaderRequestBlock requestBlock = ^(AFATaskDetailsLoaderCompletionBlock remoteResponseBlock, AFATaskDetailsLoaderCompletionBlock cachedResponseBlock) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        [strongSelf.fetchTaskCommentsService requestTaskCommentsForID:strongSelf.taskID
+                                                      completionBlock:^(NSArray *commentList, NSError *error, ASDKModelPaging *paging) {
+                                                          remoteResponseBlock([AFATaskDetailsLoaderResponse responseWithModel:commentList
+                                                                                                                       paging:paging], error);
+                                                      } cachedResults:^(NSArray *commentList, NSError *error, ASDKModelPaging *paging) {
+                                                          cachedResponseBlock([AFATaskDetailsLoaderResponse responseWithModel:commentList
+                                                                                                                       paging:paging], error);
+                                                      }];
+    };
+    
+    [self loadResponseForRequestKey:kAFATaskDetailsCommentsRequestKey
+                   withRequestBlock:requestBlock
+                    completionBlock:completionBlock
+                 cachedResultsBlock:cachedResultsBlock];
+}
+
+- (void)loadTaskChecklistWithCompletionBlock:(AFATaskDetailsLoaderCompletionBlock)completionBlock
+                          cachedResultsBlock:(AFATaskDetailsLoaderCompletionBlock)cachedResultsBlock {
+    __weak typeof(self) weakSelf = self;
+    AFATaskDetailsLoaderRequestBlock requestBlock = ^(AFATaskDetailsLoaderCompletionBlock remoteResponseBlock, AFATaskDetailsLoaderCompletionBlock cachedResponseBlock) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        [strongSelf.fetchTaskChecklistService requestChecklistForTaskWithID:strongSelf.taskID
+                                                            completionBlock:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
+                                                                remoteResponseBlock([AFATaskDetailsLoaderResponse responseWithModel:taskList
+                                                                                                                             paging:paging], error);
+                                                            } cachedResults:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
+                                                                cachedResponseBlock([AFATaskDetailsLoaderResponse responseWithModel:taskList
+                                                                                                                             paging:paging], error);
+                                                            }];
+    };
+    
+    [self loadResponseForRequestKey:kAFATaskDetailsChecklistRequestKey
+                   withRequestBlock:requestBlock
+                    completionBlock:completionBlock
+                 cachedResultsBlock:cachedResultsBlock];
+}
+
+- (void)prefetchSectionsAdjacentToSectionType:(AFATaskDetailsSectionType)sectionType {
+    // Prefetching is low priority work and is deferred until all the requests
+    // issued for the displayed section have finished
+    if (!self.isConnectivityAvailable ||
+        self.pendingRequests.count) {
+        return;
+    }
+    
+    // Walk in both directions and stop at the first section that is backed by its
+    // own request. Sections derived from the task details are skipped over.
+    for (NSNumber *step in @[@(-1), @(1)]) {
+        for (NSInteger adjacentSectionType = sectionType + step.integerValue;
+             adjacentSectionType > AFATaskDetailsSectionTypeTaskDetails && adjacentSectionType < AFATaskDetailsSectionTypeEnumCount;
+             adjacentSectionType += step.integerValue) {
+            if ([self prefetchResponseForSectionType:adjacentSectionType]) {
+                break;
+            }
+        }
+    }
+}
+
+- (BOOL)prefetchResponseForSectionType:(AFATaskDetailsSectionType)sectionType {
+    if (AFATaskDetailsSectionTypeChecklist != sectionType &&
+        AFATaskDetailsSectionTypeFilesContent != sectionType &&
+        AFATaskDetailsSectionTypeComments != sectionType) {
+        return NO;
+    }
+    
+    if ([self isPrefetchedResponseValid:self.prefetchedResponses[@(sectionType)]]) {
+        return YES;
+    }
+    
+    // Responses of prefetches started before a mutation are discarded
+    NSUInteger prefetchGeneration = self.prefetchGeneration;
+    __weak typeof(self) weakSelf = self;
+    AFATaskDetailsLoaderCompletionBlock prefetchCompletionBlock = ^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        if (!error &&
+            prefetchGeneration == strongSelf.prefetchGeneration) {
+            strongSelf.prefetchedResponses[@(sectionType)] = response;
+        }
+    };
+    
+    switch (sectionType) {
+        case AFATaskDetailsSectionTypeChecklist: {
+            [self loadTaskChecklistWithCompletionBlock:prefetchCompletionBlock
+                                    cachedResultsBlock:nil];
+        }
+            break;
+        
+        case AFATaskDetailsSectionTypeFilesContent: {
+            [self loadTaskContentWithCompletionBlock:prefetchCompletionBlock
+                                  cachedResultsBlock:nil];
+        }
+            break;
+        
+        case AFATaskDetailsSectionTypeComments: {
+            [self loadTaskCommentsWithCompletionBlock:prefetchCompletionBlock
+                                   cachedResultsBlock:nil];
+        }
+            break;
+        
+        default:
+            break;
+    }
+    
+    return YES;
+}
+
+- (BOOL)replayPrefetchedResponseForSectionType:(AFATaskDetailsSectionType)sectionType
+                           withCompletionBlock:(AFATaskDataSourceErrorCompletionBlock)completionBlock {
+    // Prefetched responses are consumed once, further refreshes of the section
+    // go to the network
+    AFATaskDetailsLoaderResponse *response = self.prefetchedResponses[@(sectionType)];
+    [self.prefetchedResponses removeObjectForKey:@(sectionType)];
+    
+    if (![self isPrefetchedResponseValid:response]) {
+        return NO;
+    }
+    
+    switch (sectionType) {
+        case AFATaskDetailsSectionTypeContributors: {
+            [self handleTaskContributorsResponseForTask:response.model];
+        }
+            break;
+        
+        case AFATaskDetailsSectionTypeChecklist: {
+            [self handleTaskChecklistResponse:response.model];
+        }
+            break;
+        
+        case AFATaskDetailsSectionTypeFilesContent: {
+            [self handleTaskContentListResponse:response.model];
+        }
+            break;
+        
+        case AFATaskDetailsSectionTypeComments: {
+            [self handleTaskCommentListResponse:response.model
+                                         paging:response.paging];
+        }
+            break;
+        
+        default:
+            break;
+    }
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        if (completionBlock) {
+            completionBlock(nil);
+        }
+        
+        [weakSelf prefetchSectionsAdjacentToSectionType:sectionType];
+    });
+    
+    return YES;
+}
+
+- (BOOL)isPrefetchedResponseValid:(AFATaskDetailsLoaderResponse *)response {
+    return response && fabs([response.responseDate timeIntervalSinceNow]) < kAFATaskDetailsPrefetchedResponseValidityInterval;
+}
+
+- (void)invalidatePrefetchedResponses {
+    self.prefetchGeneration++;
+    [self.prefetchedResponses removeAllObjects];
+}
+
+
 #pragma mark -
 #pragma mark Helpers
 
@@ -547,37 +946,59 @@
               cachedDispatchGroup:(dispatch_group_t)cachedDispatchGroup {
     
     __weak typeof(self) weakSelf = self;
-    [self.fetchTaskDetailsService requestTaskDetailsForID:taskID
-                                          completionBlock:^(ASDKModelTask *task, NSError *error) {
-                                              __strong typeof(self) strongSelf = weakSelf;
-                                              
-                                              strongSelf.remoteTaskDetailsError = error;
-                                              
-                                              if (!error) {
-                                                  strongSelf.remoteTaskDetailsModel.currentTask = task;
-                                              }
-                                              
-                                              dispatch_group_leave(remoteDispatchGroup);
-                                          } cachedResults:^(ASDKModelTask *task, NSError *error) {
-                                              __strong typeof(self) strongSelf = weakSelf;
-                                              
-                                              strongSelf.cachedTaskDetailsError = error;
-                                              
-                                              if (!error) {
-                                                  strongSelf.cachedTaskDetailsModel.currentTask = task;
-                                                  
-                                                  // If the parent task information is not present when
-                                                  // fetching the task details perform an additional request
-                                                  if (!strongSelf.parentTaskID && task.parentTaskID) {
-                                                      dispatch_group_enter(remoteDispatchGroup);
-                                                      dispatch_group_enter(cachedDispatchGroup);
-                                                      [strongSelf fetchDetailsForParentTaskWithID:task.parentTaskID remoteDispatchGroup:remoteDispatchGroup
-                                                                              cachedDispatchGroup:cachedDispatchGroup];
-                                                  }
-                                              }
-                                              
-                                              dispatch_group_leave(cachedDispatchGroup);
-                                          }];
+    [self loadTaskWithID:taskID
+            usingService:self.fetchTaskDetailsService
+         completionBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+             __strong typeof(self) strongSelf = weakSelf;
+             
+             if (!error) {
+                 ASDKModelTask *task = response.model;
+                 strongSelf.remoteTaskDetailsModel.currentTask = task;
+                 
+                 // Share the task with the contributors section so that it doesn't
+                 // have to be requested again when that section is displayed
+                 strongSelf.prefetchedResponses[@(AFATaskDetailsSectionTypeContributors)] = response;
+                 
+                 // The parent task might only be revealed by the remote response
+                 if (!strongSelf.parentTaskID &&
+                     task.parentTaskID &&
+                     !strongSelf.isParentTaskRequested) {
+                     strongSelf.isParentTaskRequested = YES;
+                     dispatch_group_enter(remoteDispatchGroup);
+                     [strongSelf fetchDetailsForParentTaskWithID:task.parentTaskID
+                                             remoteDispatchGroup:remoteDispatchGroup
+                                             cachedDispatchGroup:nil];
+                 }
+             } else {
+                 strongSelf.remoteTaskDetailsError = error;
+             }
+             
+             dispatch_group_leave(remoteDispatchGroup);
+         } cachedResultsBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+             __strong typeof(self) strongSelf = weakSelf;
+             
+             if (!error) {
+                 ASDKModelTask *task = response.model;
+                 strongSelf.cachedTaskDetailsModel.currentTask = task;
+                 
+                 // If the parent task information is not present when
+                 // fetching the task details perform an additional request
+                 if (!strongSelf.parentTaskID &&
+                     task.parentTaskID &&
+                     !strongSelf.isParentTaskRequested) {
+                     strongSelf.isParentTaskRequested = YES;
+                     dispatch_group_enter(remoteDispatchGroup);
+                     dispatch_group_enter(cachedDispatchGroup);
+                     [strongSelf fetchDetailsForParentTaskWithID:task.parentTaskID
+                                             remoteDispatchGroup:remoteDispatchGroup
+                                             cachedDispatchGroup:cachedDispatchGroup];
+                 }
+             } else {
+                 strongSelf.cachedTaskDetailsError = error;
+             }
+             
+             dispatch_group_leave(cachedDispatchGroup);
+         }];
 }
 
 - (void)fetchDetailsForParentTaskWithID:(NSString *)parentTaskID
@@ -585,52 +1006,73 @@
                     cachedDispatchGroup:(dispatch_group_t)cachedDispatchGroup {
     __weak typeof(self) weakSelf = self;
     
-    [self.fetchParentTaskService requestTaskDetailsForID:parentTaskID
-                                         completionBlock:^(ASDKModelTask *task, NSError *error) {
-                                             __strong typeof(self) strongSelf = weakSelf;
-                                             
-                                             strongSelf.remoteTaskDetailsError = error;
-                                             
-                                             if (!error) {
-                                                 strongSelf.remoteTaskDetailsModel.parentTask = task;
-                                             }
-                                             
-                                             dispatch_group_leave(remoteDispatchGroup);
-                                         } cachedResults:^(ASDKModelTask *task, NSError *error) {
-                                             __strong typeof(self) strongSelf = weakSelf;
-                                             
-                                             strongSelf.cachedTaskDetailsError = error;
-                                             
-                                             if (!error) {
-                                                 strongSelf.cachedTaskDetailsModel.parentTask = task;
-                                             }
-                                             
-                                             dispatch_group_leave(cachedDispatchGroup);
-                                         }];
+    [self loadTaskWithID:parentTaskID
+            usingService:self.fetchParentTaskService
+         completionBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+             __strong typeof(self) strongSelf = weakSelf;
+             
+             if (!error) {
+                 strongSelf.remoteTaskDetailsModel.parentTask = response.model;
+             } else {
+                 strongSelf.remoteTaskDetailsError = error;
+             }
+             
+             dispatch_group_leave(remoteDispatchGroup);
+         } cachedResultsBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+             __strong typeof(self) strongSelf = weakSelf;
+             
+             // The parent task request can be issued once the remote task details
+             // are available in which case cached results are not awaited
+             if (!cachedDispatchGroup) {
+                 return;
+             }
+             
+             if (!error) {
+                 strongSelf.cachedTaskDetailsModel.parentTask = response.model;
+             } else {
+                 strongSelf.cachedTaskDetailsError = error;
+             }
+             
+             dispatch_group_leave(cachedDispatchGroup);
+         }];
 }
 
 - (void)fetchCurrentProfileInRemoteDispatchGroup:(dispatch_group_t)remoteDispatchGroup
                              cachedDispatchGroup:(dispatch_group_t)cachedDispatchGroup {
     __weak typeof(self) weakSelf = self;
-    [self.requestProfileService requestProfileWithCompletionBlock:^(ASDKModelProfile *profile, NSError *error) {
+    AFATaskDetailsLoaderRequestBlock requestBlock = ^(AFATaskDetailsLoaderCompletionBlock completionBlock, AFATaskDetailsLoaderCompletionBlock cachedResultsBlock) {
         __strong typeof(self) strongSelf = weakSelf;
         
-        strongSelf.remoteTaskDetailsError = error;
-        
-        if (!error) {
-            strongSelf.remoteTaskDetailsModel.userProfile = profile;
-        }
-        dispatch_group_leave(remoteDispatchGroup);
-    } cachedResults:^(ASDKModelProfile *profile, NSError *error) {
-        __strong typeof(self) strongSelf = weakSelf;
-        
-        strongSelf.cachedTaskDetailsError = error;
-        
-        if (!error) {
-            strongSelf.cachedTaskDetailsModel.userProfile = profile;
-        }
-        dispatch_group_leave(cachedDispatchGroup);
-    }];
+        [strongSelf.requestProfileService requestProfileWithCompletionBlock:^(ASDKModelProfile *profile, NSError *error) {
+            completionBlock([AFATaskDetailsLoaderResponse responseWithModel:profile
+                                                                     paging:nil], error);
+        } cachedResults:^(ASDKModelProfile *profile, NSError *error) {
+            cachedResultsBlock([AFATaskDetailsLoaderResponse responseWithModel:profile
+                                                                        paging:nil], error);
+        }];
+    };
+    
+    [self loadResponseForRequestKey:kAFATaskDetailsProfileRequestKey
+                   withRequestBlock:requestBlock
+                    completionBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+                        __strong typeof(self) strongSelf = weakSelf;
+                        
+                        if (!error) {
+                            strongSelf.remoteTaskDetailsModel.userProfile = response.model;
+                        } else {
+                            strongSelf.remoteTaskDetailsError = error;
+                        }
+                        dispatch_group_leave(remoteDispatchGroup);
+                    } cachedResultsBlock:^(AFATaskDetailsLoaderResponse *response, NSError *error) {
+                        __strong typeof(self) strongSelf = weakSelf;
+                        
+                        if (!error) {
+                            strongSelf.cachedTaskDetailsModel.userProfile = response.model;
+                        } else {
+                            strongSelf.cachedTaskDetailsError = error;
+                        }
+                        dispatch_group_leave(cachedDispatchGroup);
+                    }];
 }
 
 - (BOOL)registerTaskDetailsCellActionsForModel:(AFATableControllerTaskDetailsModel *)taskDetailsModel {
@@ -40,6 +40,7 @@
 #import "AFAGenericFilterModel.h"
 #import "ASDKModelTask.h"
 #import "AFAListResponseModel.h"
+#import "AFAListDiffModel.h"
 
 // View models
 #import "AFATaskListViewModel.h"
@@ -61,6 +62,8 @@
 #import "ASDKRoundedBorderView.h"
 #import "AFAActivityView.h"
 
+static const NSTimeInterval kAFAListScrollVelocitySampleInterval = .25;
+
 typedef NS_ENUM(NSInteger, AFAListControllerState) {
     AFAListControllerStateIdle = 0,
     AFAListControllerStateRefreshInProgress,
@@ -116,6 +119,11 @@ UITableViewDelegate>
 @property (strong, nonatomic) id<AFAListDataSourceProtocol>                 dataSource;
 @property (strong, nonatomic) AFAListBaseViewModel                          *currentListViewModel;
 @property (assign, nonatomic) NSUInteger                                    initialTabBarHeight;
+@property (assign, nonatomic) CGFloat                                       lastScrollContentOffsetY;
+@property (assign, nonatomic) NSTimeInterval                                lastScrollTimestamp;
+// Set when leaving for screens where tasks can be changed. Incremental updates only
+// pick up newly created tasks, so the list is fully refreshed once it reappears.
+@property (assign, nonatomic) BOOL                                          isFullRefreshRequired;
 
 // KVO
 @property (strong, nonatomic) ASDKKVOManager                                *kvoManager;
@@ -195,7 +203,9 @@ UITableViewDelegate>
 
 - (void)viewWillAppear:(BOOL)animated {
     [super viewWillAppear:animated];
-    [self searchWithTerm:self.searchTextField.text];
+    [self searchWithTerm:self.searchTextField.text
+           isFullRefresh:self.isFullRefreshRequired];
+    self.isFullRefreshRequired = NO;
     
     [self refreshUIForConnectivity:[self isNetworkReachable]];
 }
@@ -217,6 +227,12 @@ UITableViewDelegate>
 // In a storyboard-based application, you will often want to do a little preparation before navigation
 - (void)prepareForSegue:(UIStoryboardSegue *)segue
                  sender:(id)sender {
+    if ([kSegueIDTaskDetails isEqualToString:segue.identifier] ||
+        [kSegueIDStartProcessInstance isEqualToString:segue.identifier] ||
+        [kSegueIDProcessInstanceDetails isEqualToString:segue.identifier]) {
+        self.isFullRefreshRequired = YES;
+    }
+    
     if ([kSegueIDAdvancedSearchMenuEmbedding isEqualToString:segue.identifier]) {
         self.filterViewController = (AFAFilterViewController *)segue.destinationViewController;
         if (!self.currentListViewModel) {
@@ -298,7 +314,10 @@ UITableViewDelegate>
 - (IBAction)onRefresh:(id)sender {
     // Perform the refresh operation only when there is a filter available
     if (self.currentFilter) {
-        [self searchWithTerm:self.searchTextField.text];
+        self.controllerState = AFAListControllerStateRefreshInProgress;
+        
+        [self fetchListForSearchTerm:self.searchTextField.text
+                       isFullRefresh:YES];
     } else {
         [self showErrorMessage:NSLocalizedString(kLocalizationAlertDialogGenericNetworkErrorText, @"Generic network error")];
     }
@@ -314,7 +333,7 @@ UITableViewDelegate>
     self.searchTextField.text = nil;
     self.currentFilter.page = 0;
     
-    [self fetchContentList];
+    [self fetchContentListForFullRefresh:YES];
 }
 
 - (IBAction)onContentOverlayTap:(id)sender {
@@ -377,41 +396,118 @@ UITableViewDelegate>
 #pragma mark Content handling
 
 - (void)fetchContentList {
+    [self fetchContentListForFullRefresh:NO];
+}
+
+- (void)fetchContentListForFullRefresh:(BOOL)isFullRefresh {
     // Based on the chosen list content type fetch the list of tasks or the process
     // instance list with the default filter provided by the filter controller
     self.currentFilter.size = kDefaultTaskListFetchSize;
     self.currentFilter.appDeploymentID = self.currentListViewModel.application.deploymentID;
     
+    // Loading the first page means the filter or the search term changed or the list is
+    // refreshed, so pages fetched ahead of time for the previous content no longer apply
+    if (!self.currentFilter.page) {
+        [self.dataSource cancelPagePrefetch];
+    }
+    
     __weak typeof(self) weakSelf = self;
-    [self.dataSource loadContentListForFilter:self.currentFilter
-                          withCompletionBlock:^(id<AFAListDataSourceProtocol> dataSource, AFAListResponseModel *response) {
-                              __strong typeof(self) strongSelf = weakSelf;
-                              
-                              [strongSelf handleListRequestResponseFromDataSource:dataSource
-                                                                         response:response
-                                                                 isCachedResponse:NO];
-                          } cachedResults:^(id<AFAListDataSourceProtocol> dataSource, AFAListResponseModel *response) {
-                              __strong typeof(self) strongSelf = weakSelf;
-                              
-                              [strongSelf handleListRequestResponseFromDataSource:dataSource
-                                                                         response:response
-                                                                 isCachedResponse:YES];
-                          }];
+    AFAListHandleCompletionBlock completionBlock = ^(id<AFAListDataSourceProtocol> dataSource, AFAListResponseModel *response) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        [strongSelf handleListRequestResponseFromDataSource:dataSource
+                                                   response:response
+                                           isCachedResponse:NO];
+    };
+    AFAListHandleCompletionBlock cachedResultsBlock = ^(id<AFAListDataSourceProtocol> dataSource, AFAListResponseModel *response) {
+        __strong typeof(self) strongSelf = weakSelf;
+        
+        [strongSelf handleListRequestResponseFromDataSource:dataSource
+                                                   response:response
+                                           isCachedResponse:YES];
+    };
+    
+    // Refreshes requested by the user or following task changes bring every listed
+    // entry up to date instead of relying on incremental updates of the cached list
+    if (isFullRefresh) {
+        [self.dataSource refreshContentListForFilter:self.currentFilter
+                                 withCompletionBlock:completionBlock
+                                       cachedResults:cachedResultsBlock];
+    } else {
+        [self.dataSource loadContentListForFilter:self.currentFilter
+                              withCompletionBlock:completionBlock
+                                    cachedResults:cachedResultsBlock];
+    }
 }
 
 - (void)fetchListForSearchTerm:(NSString *)searchTerm {
+    [self fetchListForSearchTerm:searchTerm
+                   isFullRefresh:NO];
+}
+
+- (void)fetchListForSearchTerm:(NSString *)searchTerm
+                 isFullRefresh:(BOOL)isFullRefresh {
     // Pass the existing defined filter
     self.currentFilter.text = searchTerm;
     self.currentFilter.page = 0;
     self.currentFilter.appDefinitionID = self.currentListViewModel.application.modelID;
     
-    [self fetchContentList];
+    [self fetchContentListForFullRefresh:isFullRefresh];
 }
 
 - (void)fetchNextPageForCurrentList {
     self.currentFilter.page += 1;
     
-    [self fetchContentList];
+    // Display the activity view at the end of the table unless the page was
+    // already fetched ahead of time
+    if (![self.dataSource isPrefetchedPageAvailableForFilter:self.currentFilter]) {
+        self.listTableView.tableFooterView = self.loadingFooterView;
+        self.preloadingActivityView.animating = YES;
+    }
+    
+    __weak typeof(self) weakSelf = self;
+    BOOL isPagePrefetched =
+    [self.dataSource loadPrefetchedPageForFilter:self.currentFilter
+                             withCompletionBlock:^(id<AFAListDataSourceProtocol> dataSource, AFAListResponseModel *response) {
+                                 __strong typeof(self) strongSelf = weakSelf;
+                                 
+                                 [strongSelf handleListRequestResponseFromDataSource:dataSource
+                                                                            response:response
+                                                                    isCachedResponse:NO];
+                             }];
+    
+    if (!isPagePrefetched) {
+        [self fetchContentList];
+    }
+}
+
+- (void)prefetchPagesForScrollVelocity:(CGFloat)scrollVelocity
+                          inScrollView:(UIScrollView *)scrollView {
+    NSUInteger entriesCount = self.dataSource.dataEntries.count;
+    if (!self.currentFilter ||
+        !entriesCount ||
+        (NSInteger)self.currentFilter.page + 1 >= self.dataSource.totalPages) {
+        return;
+    }
+    
+    // Project the distance scrolled over the prefetch lead time and start loading
+    // once it reaches the end of the list. Every page worth of distance projected
+    // past the end asks for one more page ahead.
+    CGFloat remainingDistance = scrollView.contentSize.height - scrollView.contentOffset.y - CGRectGetHeight(scrollView.bounds);
+    CGFloat projectedDistance = scrollVelocity * kTaskPrefetchLeadTime;
+    if (projectedDistance < remainingDistance) {
+        return;
+    }
+    
+    CGFloat pageHeight = scrollView.contentSize.height * self.currentFilter.size / entriesCount;
+    NSUInteger pageCount = 1;
+    if (pageHeight > 0) {
+        pageCount += (NSUInteger)((projectedDistance - MAX(remainingDistance, 0)) / pageHeight);
+    }
+    
+    [self.dataSource prefetchPagesFollowingFilter:self.currentFilter
+                                        pageCount:pageCount
+                                       totalPages:self.dataSource.totalPages];
 }
 
 - (void)handleListRequestResponseFromDataSource:(id<AFAListDataSourceProtocol>)dataSource
@@ -427,15 +523,14 @@ UITableViewDelegate>
         if (self.refreshControl) {
             self.refreshControl.attributedTitle = [[NSDate date] lastUpdatedFormattedString];
         }
-        [self.dataSource processAdditionalEntries:response.objectList
-                                        forPaging:response.paging];
-        
-        [self.listTableView reloadData];
+        AFAListDiffModel *listDiff = [self.dataSource processAdditionalEntries:response.objectList
+                                                                     forPaging:response.paging];
+        [self applyListDiff:listDiff];
     } else {
         if (isCachedResponse) {
-            [self.dataSource processAdditionalEntries:nil
-                                            forPaging:nil];
-            [self.listTableView reloadData];
+            AFAListDiffModel *listDiff = [self.dataSource processAdditionalEntries:nil
+                                                                         forPaging:nil];
+            [self applyListDiff:listDiff];
         } else {
             if (response.error.code == NSURLErrorNotConnectedToInternet) {
                 [self showWarningMessage:NSLocalizedString(kLocalizationOfflineProvidingCachedResultsText, @"Cached results text")];
@@ -464,6 +559,36 @@ UITableViewDelegate>
 #pragma mark -
 #pragma mark Convenience methods
 
+- (void)applyListDiff:(AFAListDiffModel *)listDiff {
+    // Batch updates are only meaningful for rows the table view already displays,
+    // otherwise fall back to a plain reload
+    if (!listDiff ||
+        listDiff.requiresFullReload ||
+        !listDiff.oldEntriesCount ||
+        !self.listTableView.window ||
+        [self.listTableView numberOfRowsInSection:0] != (NSInteger)listDiff.oldEntriesCount) {
+        [self.listTableView reloadData];
+        return;
+    }
+    
+    if (!listDiff.hasChanges) {
+        return;
+    }
+    
+    [self.listTableView performBatchUpdates:^{
+        [self.listTableView deleteRowsAtIndexPaths:listDiff.deletedIndexPaths
+                                  withRowAnimation:UITableViewRowAnimationFade];
+        [self.listTableView insertRowsAtIndexPaths:listDiff.insertedIndexPaths
+                                  withRowAnimation:UITableViewRowAnimationFade];
+        [self.listTableView reloadRowsAtIndexPaths:listDiff.reloadedIndexPaths
+                                  withRowAnimation:UITableViewRowAnimationNone];
+        for (NSArray *movedIndexPaths in listDiff.movedIndexPaths) {
+            [self.listTableView moveRowAtIndexPath:movedIndexPaths.firstObject
+                                       toIndexPath:movedIndexPaths.lastObject];
+        }
+    } completion:nil];
+}
+
 - (void)endRefreshOnRefreshControl {
     __weak typeof(self) weakSelf = self;
     [[NSOperationQueue currentQueue] addOperationWithBlock:^{
@@ -551,10 +676,17 @@ UITableViewDelegate>
 }
 
 - (void)searchWithTerm:(NSString *)term {
+    [self searchWithTerm:term
+           isFullRefresh:NO];
+}
+
+- (void)searchWithTerm:(NSString *)term
+         isFullRefresh:(BOOL)isFullRefresh {
     if (self.currentFilter) {
         self.controllerState = AFAListControllerStateRefreshInProgress;
         
-        [self fetchListForSearchTerm:term];
+        [self fetchListForSearchTerm:term
+                       isFullRefresh:isFullRefresh];
     }
 }
 
@@ -569,7 +701,8 @@ UITableViewDelegate>
 - (void)didCreateTask:(ASDKModelTask *)task {
     [self.listTableView setContentOffset:CGPointZero
                                 animated:NO];
-    [self searchWithTerm:self.searchTextField.text];
+    [self searchWithTerm:self.searchTextField.text
+           isFullRefresh:YES];
 }
 
 
@@ -706,10 +839,6 @@ forRowAtIndexPath:(NSIndexPath *)indexPath {
     if (self.dataSource.preloadCellIdx &&
         self.dataSource.preloadCellIdx == indexPath.row &&
         self.currentFilter.page < self.dataSource.totalPages) {
-        // Display the activity view at the end of the table while content is fetched
-        tableView.tableFooterView = self.loadingFooterView;
-        self.preloadingActivityView.animating = YES;
-        
         [self fetchNextPageForCurrentList];
     }
 }
@@ -734,6 +863,30 @@ forRowAtIndexPath:(NSIndexPath *)indexPath {
 }
 
 
+#pragma mark -
+#pragma mark UIScrollViewDelegate
+
+- (void)scrollViewDidScroll:(UIScrollView *)scrollView {
+    NSTimeInterval timestamp = CACurrentMediaTime();
+    NSTimeInterval elapsedTime = timestamp - self.lastScrollTimestamp;
+    CGFloat scrolledDistance = scrollView.contentOffset.y - self.lastScrollContentOffsetY;
+    
+    self.lastScrollTimestamp = timestamp;
+    self.lastScrollContentOffsetY = scrollView.contentOffset.y;
+    
+    // Only samples taken while scrolling down towards the end of the list
+    // are relevant for the velocity
+    if (elapsedTime <= 0 ||
+        elapsedTime > kAFAListScrollVelocitySampleInterval ||
+        scrolledDistance <= 0) {
+        return;
+    }
+    
+    [self prefetchPagesForScrollVelocity:scrolledDistance / elapsedTime
+                            inScrollView:scrollView];
+}
+
+
 #pragma mark -
 #pragma mark View model related
 
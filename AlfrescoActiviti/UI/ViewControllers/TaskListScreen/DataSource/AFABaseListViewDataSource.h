@@ -17,8 +17,13 @@
  ******************************************************************************/
 
 #import <Foundation/Foundation.h>
+#import "AFAListDataSourceProtocol.h"
 
-@class ASDKModelPaging;
+@class ASDKModelPaging,
+AFAGenericFilterModel,
+AFAListResponseModel;
+
+typedef void  (^AFAListPageCompletionBlock) (AFAListResponseModel *response);
 
 @interface AFABaseListViewDataSource : NSObject
 
@@ -30,4 +35,55 @@
 - (NSInteger)preloadCellIndexForPaging:(ASDKModelPaging *)paging
                            dataEntries:(NSArray *)dataEntries;
 
+/**
+ *  Starts loading, ahead of need, the pages following the one described by the passed
+ *  filter. Pages that were prefetched and not yet handed over never hold more than
+ *  kTaskPrefetchEntryBudget entries, so fewer pages than requested might be loaded.
+ *
+ *  @param filter     Filter describing the last page requested for the list
+ *  @param pageCount  Number of pages expected to be needed soon
+ *  @param totalPages Total number of pages available for the list
+ */
+- (void)prefetchPagesFollowingFilter:(AFAGenericFilterModel *)filter
+                           pageCount:(NSUInteger)pageCount
+                          totalPages:(NSInteger)totalPages;
+
+/**
+ *  Returns whether the page described by the passed filter was prefetched and its
+ *  content is ready to be handed over.
+ *
+ *  @param filter Filter describing the page
+ */
+- (BOOL)isPrefetchedPageAvailableForFilter:(AFAGenericFilterModel *)filter;
+
+/**
+ *  Hands over the prefetched page described by the passed filter. The completion block
+ *  is called on the main queue, either right away or once the page finishes loading.
+ *
+ *  @param filter          Filter describing the page
+ *  @param completionBlock Completion block providing the page content
+ *
+ *  @return                YES if the page was or is being prefetched, NO if it has to
+ *                         be requested
+ */
+- (BOOL)loadPrefetchedPageForFilter:(AFAGenericFilterModel *)filter
+                withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock;
+
+/**
+ *  Drops the prefetched pages and detaches the requests for the ones still loading.
+ */
+- (void)cancelPagePrefetch;
+
+/**
+ *  Requests a single page of the list without reporting cached results. Subclasses
+ *  override this to perform the request and return a block cancelling it.
+ *
+ *  @param filter          Filter describing the page
+ *  @param completionBlock Completion block providing the page content
+ *
+ *  @return                Block cancelling the request or nil if not supported
+ */
+- (dispatch_block_t)requestPageForFilter:(AFAGenericFilterModel *)filter
+                     withCompletionBlock:(AFAListPageCompletionBlock)completionBlock;
+
 @end
@@ -22,10 +22,40 @@
 // Constants
 #import "AFABusinessConstants.h"
 
+// Models
+#import "AFAGenericFilterModel.h"
+#import "AFAListResponseModel.h"
+
+@interface AFAListPrefetchedPage : NSObject
+
+@property (assign, nonatomic) NSUInteger                    page;
+@property (strong, nonatomic) AFAListResponseModel          *response;
+@property (copy, nonatomic)   dispatch_block_t              cancelBlock;
+@property (copy, nonatomic)   AFAListHandleCompletionBlock  completionBlock;
+
+@end
+
+@implementation AFAListPrefetchedPage
+@end
+
+@interface AFABaseListViewDataSource ()
+
+// Pages loaded ahead of need, keyed by page number
+@property (strong, nonatomic) NSMutableDictionary *prefetchedPages;
+
+@end
 
 @implementation AFABaseListViewDataSource
 
 
+#pragma mark -
+#pragma mark Life cycle
+
+- (void)dealloc {
+    [self cancelPagePrefetch];
+}
+
+
 #pragma mark -
 #pragma mark Public interface
 
@@ -49,17 +79,31 @@
         }
     } else if (existingEntriesArr.count) {
         // Make sure that the incoming data is not a subset of the existing collection
-        NSArray *existingModelIDsArr = [existingEntriesArr valueForKeyPath:@"@distinctUnionOfObjects.modelID"];
-        NSPredicate *uniqueEntitiesPredicate = [NSPredicate predicateWithFormat:@"NOT (modelID IN %@)", existingModelIDsArr];
-        NSArray *serverEntriesArr = [additionalEntriesArr filteredArrayUsingPredicate:uniqueEntitiesPredicate];
+        NSMutableSet *existingModelIDs = [NSMutableSet setWithCapacity:existingEntriesArr.count + additionalEntriesArr.count];
+        for (ASDKModelAttributable *entry in existingEntriesArr) {
+            if (entry.modelID) {
+                [existingModelIDs addObject:entry.modelID];
+            }
+        }
         
-        if (serverEntriesArr.count) {
-            NSMutableArray *additionedEntries = [NSMutableArray arrayWithArray:existingEntriesArr];
-            [additionedEntries addObjectsFromArray:serverEntriesArr];
-            entriesArr = additionedEntries;
-        } else {
-            entriesArr = existingEntriesArr;
+        NSMutableArray *additionedEntries = nil;
+        for (ASDKModelAttributable *entry in additionalEntriesArr) {
+            if (entry.modelID &&
+                [existingModelIDs containsObject:entry.modelID]) {
+                continue;
+            }
+            
+            if (!additionedEntries) {
+                additionedEntries = [NSMutableArray arrayWithArray:existingEntriesArr];
+            }
+            [additionedEntries addObject:entry];
+            
+            if (entry.modelID) {
+                [existingModelIDs addObject:entry.modelID];
+            }
         }
+        
+        entriesArr = additionedEntries ? additionedEntries : existingEntriesArr;
     } else {
         entriesArr = additionalEntriesArr;
     }
@@ -82,4 +126,120 @@
     }
 }
 
+- (void)prefetchPagesFollowingFilter:(AFAGenericFilterModel *)filter
+                           pageCount:(NSUInteger)pageCount
+                          totalPages:(NSInteger)totalPages {
+    if (!self.prefetchedPages) {
+        self.prefetchedPages = [NSMutableDictionary dictionary];
+    }
+    
+    NSUInteger pageSize = filter.size ? filter.size : kDefaultTaskListFetchSize;
+    NSUInteger pageBudget = MAX(kTaskPrefetchEntryBudget / pageSize, 1);
+    
+    for (NSUInteger page = filter.page + 1; page <= filter.page + pageCount; page++) {
+        if ((NSInteger)page >= totalPages ||
+            self.prefetchedPages.count >= pageBudget) {
+            break;
+        }
+        
+        if (self.prefetchedPages[@(page)]) {
+            continue;
+        }
+        
+        AFAGenericFilterModel *pageFilter = [filter copy];
+        pageFilter.page = page;
+        
+        AFAListPrefetchedPage *prefetchedPage = [AFAListPrefetchedPage new];
+        prefetchedPage.page = page;
+        self.prefetchedPages[@(page)] = prefetchedPage;
+        
+        __weak typeof(self) weakSelf = self;
+        __weak AFAListPrefetchedPage *weakPrefetchedPage = prefetchedPage;
+        prefetchedPage.cancelBlock = [self requestPageForFilter:pageFilter
+                                            withCompletionBlock:^(AFAListResponseModel *response) {
+                                                __strong typeof(self) strongSelf = weakSelf;
+                                                
+                                                [strongSelf handlePrefetchedPage:weakPrefetchedPage
+                                                                    withResponse:response];
+                                            }];
+        
+        if (!prefetchedPage.cancelBlock) {
+            [self.prefetchedPages removeObjectForKey:@(page)];
+            break;
+        }
+    }
+}
+
+- (BOOL)isPrefetchedPageAvailableForFilter:(AFAGenericFilterModel *)filter {
+    AFAListPrefetchedPage *prefetchedPage = self.prefetchedPages[@(filter.page)];
+    return prefetchedPage.response ? YES : NO;
+}
+
+- (BOOL)loadPrefetchedPageForFilter:(AFAGenericFilterModel *)filter
+                withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock {
+    NSParameterAssert(completionBlock);
+    
+    AFAListPrefetchedPage *prefetchedPage = self.prefetchedPages[@(filter.page)];
+    if (!prefetchedPage) {
+        return NO;
+    }
+    
+    if (prefetchedPage.response) {
+        [self.prefetchedPages removeObjectForKey:@(filter.page)];
+        
+        __weak typeof(self) weakSelf = self;
+        dispatch_async(dispatch_get_main_queue(), ^{
+            __strong typeof(self) strongSelf = weakSelf;
+            
+            completionBlock((id<AFAListDataSourceProtocol>)strongSelf, prefetchedPage.response);
+        });
+    } else {
+        // The page is still loading, hand it over as soon as it lands
+        prefetchedPage.completionBlock = completionBlock;
+    }
+    
+    return YES;
+}
+
+- (void)cancelPagePrefetch {
+    for (AFAListPrefetchedPage *prefetchedPage in self.prefetchedPages.allValues) {
+        if (prefetchedPage.cancelBlock) {
+            prefetchedPage.cancelBlock();
+        }
+    }
+    
+    [self.prefetchedPages removeAllObjects];
+}
+
+- (dispatch_block_t)requestPageForFilter:(AFAGenericFilterModel *)filter
+                     withCompletionBlock:(AFAListPageCompletionBlock)completionBlock {
+    // Override behaviour in subclasses
+    return nil;
+}
+
+
+#pragma mark -
+#pragma mark Prefetch handling
+
+- (void)handlePrefetchedPage:(AFAListPrefetchedPage *)prefetchedPage
+                withResponse:(AFAListResponseModel *)response {
+    // Ignore responses for pages dropped in the meantime
+    if (!prefetchedPage ||
+        self.prefetchedPages[@(prefetchedPage.page)] != prefetchedPage) {
+        return;
+    }
+    
+    prefetchedPage.cancelBlock = nil;
+    
+    if (prefetchedPage.completionBlock) {
+        [self.prefetchedPages removeObjectForKey:@(prefetchedPage.page)];
+        prefetchedPage.completionBlock((id<AFAListDataSourceProtocol>)self, response);
+    } else if (response.error) {
+        // Failed pages are dropped so that they're requested again once needed
+        [self.prefetchedPages removeObjectForKey:@(prefetchedPage.page)];
+    } else {
+        prefetchedPage.response = response;
+    }
+}
+
 @end
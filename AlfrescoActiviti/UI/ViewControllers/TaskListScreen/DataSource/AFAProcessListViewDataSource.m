@@ -24,6 +24,7 @@
 // Models
 #import "AFAGenericFilterModel.h"
 #import "AFAListResponseModel.h"
+#import "AFAListDiffModel.h"
 
 // Cells
 #import "AFATaskListStyleCell.h"
@@ -69,6 +70,9 @@
 - (void)loadContentListForFilter:(AFAGenericFilterModel *)filter
              withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock
                    cachedResults:(AFAListHandleCompletionBlock)cacheCompletionBlock {
+    // Only the latest list request is relevant for the displayed content
+    [self.fetchProcessInstanceListService cancelProcessInstanceListRequest];
+    
     __weak typeof(self) weakSelf = self;
     [self.fetchProcessInstanceListService
      requestProcessInstanceListWithFilter:filter
@@ -87,8 +91,18 @@
      }];
 }
 
-- (void)processAdditionalEntries:(NSArray *)additionalEntriesArr
-                       forPaging:(ASDKModelPaging *)paging {
+- (void)refreshContentListForFilter:(AFAGenericFilterModel *)filter
+                withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock
+                      cachedResults:(AFAListHandleCompletionBlock)cacheCompletionBlock {
+    // Process instance lists are always fetched in full
+    [self loadContentListForFilter:filter
+               withCompletionBlock:completionBlock
+                     cachedResults:cacheCompletionBlock];
+}
+
+- (AFAListDiffModel *)processAdditionalEntries:(NSArray *)additionalEntriesArr
+                                     forPaging:(ASDKModelPaging *)paging {
+    NSArray *previousEntries = self.processInstances;
     _processInstances = [self processAdditionalEntries:additionalEntriesArr
                                     forExistingEntries:self.processInstances
                                                 paging:paging];
@@ -102,6 +116,32 @@
     
     _preloadCellIdx = [self preloadCellIndexForPaging:paging
                                           dataEntries:_processInstances];
+    
+    return [AFAListDiffModel diffFromEntries:previousEntries
+                                   toEntries:_processInstances
+                                   inSection:0];
+}
+
+- (dispatch_block_t)requestPageForFilter:(AFAGenericFilterModel *)filter
+                     withCompletionBlock:(AFAListPageCompletionBlock)completionBlock {
+    // Each page is requested through its own service instance so that it can be
+    // dropped without affecting the list request in flight
+    AFAProcessServices *pageProcessInstanceListService = [AFAProcessServices new];
+    
+    __weak typeof(self) weakSelf = self;
+    [pageProcessInstanceListService
+     requestProcessInstanceListWithFilter:filter
+     withCompletionBlock:^(NSArray *processInstanceList, NSError *error, ASDKModelPaging *paging) {
+         __strong typeof(self) strongSelf = weakSelf;
+         
+         completionBlock([strongSelf responseModelForProcessInstanceList:processInstanceList
+                                                                   error:error
+                                                                  paging:paging]);
+     } cachedResults:nil];
+    
+    return ^{
+        [pageProcessInstanceListService cancelProcessInstanceListRequest];
+    };
 }
 
 - (AFAListResponseModel *)responseModelForProcessInstanceList:(NSArray *)processInstanceList
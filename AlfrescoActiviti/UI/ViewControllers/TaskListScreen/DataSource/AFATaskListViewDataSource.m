@@ -23,6 +23,7 @@
 
 // Models
 #import "AFAListResponseModel.h"
+#import "AFAListDiffModel.h"
 
 // Cells
 #import "AFATaskListStyleCell.h"
@@ -68,6 +69,9 @@
 - (void)loadContentListForFilter:(AFAGenericFilterModel *)filter
              withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock
                    cachedResults:(AFAListHandleCompletionBlock)cacheCompletionBlock {
+    // Only the latest list request is relevant for the displayed content
+    [self.fetchTaskListService cancelTaskListRequest];
+    
     __weak typeof(self) weakSelf = self;
     [self.fetchTaskListService requestTaskListWithFilter:filter
                                          completionBlock:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
@@ -84,8 +88,33 @@
                                          }];
 }
 
-- (void)processAdditionalEntries:(NSArray *)additionalEntriesArr
-                       forPaging:(ASDKModelPaging *)paging {
+- (void)refreshContentListForFilter:(AFAGenericFilterModel *)filter
+                withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock
+                      cachedResults:(AFAListHandleCompletionBlock)cacheCompletionBlock {
+    [self.fetchTaskListService cancelTaskListRequest];
+    
+    // User initiated refreshes rebuild the cached list so that tasks which changed
+    // since the last synchronization are not served from the incremental update
+    __weak typeof(self) weakSelf = self;
+    [self.fetchTaskListService refreshTaskListWithFilter:filter
+                                         completionBlock:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
+                                             __strong typeof(self) strongSelf = weakSelf;
+                                             
+                                             completionBlock(strongSelf, [strongSelf responseModelForTaskList:taskList
+                                                                                                        error:error
+                                                                                                       paging:paging]);
+                                         } cachedResults:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
+                                             __strong typeof(self) strongSelf = weakSelf;
+                                             
+                                             cacheCompletionBlock(strongSelf, [strongSelf responseModelForTaskList:taskList
+                                                                                                             error:error
+                                                                                                            paging:paging]);
+                                         }];
+}
+
+- (AFAListDiffModel *)processAdditionalEntries:(NSArray *)additionalEntriesArr
+                                     forPaging:(ASDKModelPaging *)paging {
+    NSArray *previousEntries = self.tasks;
     _tasks = [self processAdditionalEntries:additionalEntriesArr
                          forExistingEntries:self.tasks
                                      paging:paging];
@@ -99,6 +128,31 @@
     
     _preloadCellIdx = [self preloadCellIndexForPaging:paging
                                           dataEntries:_tasks];
+    
+    return [AFAListDiffModel diffFromEntries:previousEntries
+                                   toEntries:_tasks
+                                   inSection:0];
+}
+
+- (dispatch_block_t)requestPageForFilter:(AFAGenericFilterModel *)filter
+                     withCompletionBlock:(AFAListPageCompletionBlock)completionBlock {
+    // Each page is requested through its own service instance so that it can be
+    // dropped without affecting the list request in flight
+    AFATaskServices *pageTaskListService = [AFATaskServices new];
+    
+    __weak typeof(self) weakSelf = self;
+    [pageTaskListService requestTaskListWithFilter:filter
+                                   completionBlock:^(NSArray *taskList, NSError *error, ASDKModelPaging *paging) {
+                                       __strong typeof(self) strongSelf = weakSelf;
+                                       
+                                       completionBlock([strongSelf responseModelForTaskList:taskList
+                                                                                      error:error
+                                                                                     paging:paging]);
+                                   } cachedResults:nil];
+    
+    return ^{
+        [pageTaskListService cancelTaskListRequest];
+    };
 }
 
 - (AFAListResponseModel *)responseModelForTaskList:(NSArray *)taskList
@@ -21,7 +21,8 @@
 
 @class AFAFilterViewController,
 AFAGenericFilterModel,
-AFAListResponseModel;
+AFAListResponseModel,
+AFAListDiffModel;
 
 @protocol AFAListDataSourceProtocol;
 
@@ -40,7 +41,17 @@ typedef void (^AFAListHandleCompletionBlock) (id<AFAListDataSourceProtocol>dataS
 - (void)loadContentListForFilter:(AFAGenericFilterModel *)filter
              withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock
                    cachedResults:(AFAListHandleCompletionBlock)cacheCompletionBlock;
-- (void)processAdditionalEntries:(NSArray *)additionalEntriesArr
-                       forPaging:(ASDKModelPaging *)paging;
+- (void)refreshContentListForFilter:(AFAGenericFilterModel *)filter
+                withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock
+                      cachedResults:(AFAListHandleCompletionBlock)cacheCompletionBlock;
+- (AFAListDiffModel *)processAdditionalEntries:(NSArray *)additionalEntriesArr
+                                     forPaging:(ASDKModelPaging *)paging;
+- (void)prefetchPagesFollowingFilter:(AFAGenericFilterModel *)filter
+                           pageCount:(NSUInteger)pageCount
+                          totalPages:(NSInteger)totalPages;
+- (BOOL)isPrefetchedPageAvailableForFilter:(AFAGenericFilterModel *)filter;
+- (BOOL)loadPrefetchedPageForFilter:(AFAGenericFilterModel *)filter
+                withCompletionBlock:(AFAListHandleCompletionBlock)completionBlock;
+- (void)cancelPagePrefetch;
 
 @end
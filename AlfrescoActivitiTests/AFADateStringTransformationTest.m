@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <XCTest/XCTest.h>
+#import "NSDate+AFAStringTransformation.h"
+
+static NSUInteger const kAFADateStringTransformationTestRowCount    = 200;
+static NSUInteger const kAFADateStringTransformationTestScrollCount = 10;
+
+@interface NSDate (AFAStringTransformationTest)
+
+- (NSString *)dueDateFormattedStringWithCalendar:(NSCalendar *)calendar;
+
+@end
+
+@interface AFADateStringTransformationTest : XCTestCase
+
+// Creation and due dates of the rows of a task list
+@property (strong, nonatomic) NSArray *creationDates;
+@property (strong, nonatomic) NSArray *dueDates;
+
+@end
+
+@implementation AFADateStringTransformationTest
+
+- (void)setUp {
+    [super setUp];
+    
+    // Due dates are spread from months in the past to years in the future so that
+    // most relative date representations are exercised
+    NSDate *currentDate = [NSDate date];
+    NSMutableArray *creationDates = [NSMutableArray array];
+    NSMutableArray *dueDates = [NSMutableArray array];
+    for (NSUInteger idx = 0; idx < kAFADateStringTransformationTestRowCount; idx++) {
+        NSInteger rowIdx = (NSInteger)idx;
+        NSTimeInterval dueDateOffset = (rowIdx - (NSInteger)kAFADateStringTransformationTestRowCount / 2) * rowIdx * 3600;
+        [creationDates addObject:[currentDate dateByAddingTimeInterval:-(NSTimeInterval)idx * 86400]];
+        [dueDates addObject:[currentDate dateByAddingTimeInterval:dueDateOffset]];
+    }
+    self.creationDates = creationDates;
+    self.dueDates = dueDates;
+}
+
+- (void)tearDown {
+    self.creationDates = nil;
+    self.dueDates = nil;
+    
+    [super tearDown];
+}
+
+- (void)testThatCachedDateStringsMatchTheUncachedOnes {
+    for (NSUInteger idx = 0; idx < kAFADateStringTransformationTestRowCount; idx++) {
+        // when
+        NSString *cachedCreationDateString = [self.creationDates[idx] listCreationDate];
+        NSString *cachedDueDateString = [self.dueDates[idx] dueDateFormattedString];
+        // Served from the relative date string cache the second time
+        NSString *repeatedDueDateString = [self.dueDates[idx] dueDateFormattedString];
+        
+        // then
+        XCTAssertEqualObjects(cachedCreationDateString, [self uncachedListCreationDateForDate:self.creationDates[idx]]);
+        XCTAssertEqualObjects(cachedDueDateString, [self uncachedDueDateForDate:self.dueDates[idx]]);
+        XCTAssertEqualObjects(repeatedDueDateString, cachedDueDateString);
+    }
+}
+
+- (void)testUncachedDateFormattingScrollPerformance {
+    [self measureScrollingUsingCache:NO];
+}
+
+- (void)testCachedDateFormattingScrollPerformance {
+    [self measureScrollingUsingCache:YES];
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (void)measureScrollingUsingCache:(BOOL)usingCache {
+    [self measureBlock:^{
+        // Every pass scrolls through the whole list a number of times, configuring
+        // the date labels of each row just like the task list cells do
+        for (NSUInteger scrollIdx = 0; scrollIdx < kAFADateStringTransformationTestScrollCount; scrollIdx++) {
+            @autoreleasepool {
+                for (NSUInteger idx = 0; idx < kAFADateStringTransformationTestRowCount; idx++) {
+                    NSDate *creationDate = self.creationDates[idx];
+                    NSDate *dueDate = self.dueDates[idx];
+                    
+                    if (usingCache) {
+                        [creationDate listCreationDate];
+                        [dueDate dueDateFormattedString];
+                    } else {
+                        [self uncachedListCreationDateForDate:creationDate];
+                        [self uncachedDueDateForDate:dueDate];
+                    }
+                }
+            }
+        }
+    }];
+}
+
+// Mirrors the implementation which created a formatter and a calendar for every row
+- (NSString *)uncachedListCreationDateForDate:(NSDate *)date {
+    NSDateFormatter *dateFormatter = [NSDateFormatter new];
+    [dateFormatter setDateFormat:@"MMM dd, YYYY"];
+    return [dateFormatter stringFromDate:date];
+}
+
+- (NSString *)uncachedDueDateForDate:(NSDate *)date {
+    return [date dueDateFormattedStringWithCalendar:[NSCalendar currentCalendar]];
+}
+
+@end
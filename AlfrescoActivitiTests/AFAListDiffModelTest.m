@@ -0,0 +1,359 @@
+/*******************************************************************************
+ * Copyright (C) 2005-2018 Alfresco Software Limited.
+ *
+ * This file is part of the Alfresco Activiti Mobile iOS App.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "AFAListDiffModel.h"
+
+static NSUInteger const kAFAListDiffModelTestShuffleCount = 100;
+
+// List entry stand-in compared on both its identity and its content
+@interface AFAListDiffModelTestEntry : NSObject
+
+@property (strong, nonatomic) NSString *modelID;
+@property (strong, nonatomic) NSString *name;
+
++ (instancetype)entryWithModelID:(NSString *)modelID
+                            name:(NSString *)name;
+
+@end
+
+@implementation AFAListDiffModelTestEntry
+
++ (instancetype)entryWithModelID:(NSString *)modelID
+                            name:(NSString *)name {
+    AFAListDiffModelTestEntry *entry = [AFAListDiffModelTestEntry new];
+    entry.modelID = modelID;
+    entry.name = name;
+    
+    return entry;
+}
+
+- (BOOL)isEqual:(id)object {
+    if (![object isKindOfClass:[AFAListDiffModelTestEntry class]]) {
+        return NO;
+    }
+    
+    AFAListDiffModelTestEntry *entry = (AFAListDiffModelTestEntry *)object;
+    return [self.modelID isEqualToString:entry.modelID] && [self.name isEqualToString:entry.name];
+}
+
+- (NSUInteger)hash {
+    return self.modelID.hash ^ self.name.hash;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"%@:%@", self.modelID, self.name];
+}
+
+@end
+
+@interface AFAListDiffModelTest : XCTestCase
+
+@end
+
+@implementation AFAListDiffModelTest
+
+- (void)testThatItReportsInsertedEntriesAtTheirNewPositions {
+    // given
+    NSArray *oldEntries = [self entriesWithModelIDs:@[@"a", @"b", @"c"]];
+    NSArray *newEntries = [self entriesWithModelIDs:@[@"a", @"x", @"b", @"c", @"y"]];
+    
+    // when
+    AFAListDiffModel *diff = [self diffFromEntries:oldEntries
+                                         toEntries:newEntries];
+    
+    // then
+    XCTAssertEqualObjects([self rowsForIndexPaths:diff.insertedIndexPaths], (@[@1, @4]));
+    XCTAssertEqual(diff.deletedIndexPaths.count, 0);
+    XCTAssertEqual(diff.reloadedIndexPaths.count, 0);
+    XCTAssertEqual(diff.movedIndexPaths.count, 0);
+}
+
+- (void)testThatItReportsDeletedEntriesAtTheirOldPositions {
+    // given
+    NSArray *oldEntries = [self entriesWithModelIDs:@[@"a", @"b", @"c", @"d"]];
+    NSArray *newEntries = [self entriesWithModelIDs:@[@"a", @"c"]];
+    
+    // when
+    AFAListDiffModel *diff = [self diffFromEntries:oldEntries
+                                         toEntries:newEntries];
+    
+    // then
+    XCTAssertEqualObjects([self rowsForIndexPaths:diff.deletedIndexPaths], (@[@1, @3]));
+    XCTAssertEqual(diff.insertedIndexPaths.count, 0);
+    XCTAssertEqual(diff.reloadedIndexPaths.count, 0);
+    XCTAssertEqual(diff.movedIndexPaths.count, 0);
+}
+
+- (void)testThatOnlyEntriesOutsideTheLongestIncreasingRunAreMoved {
+    // given
+    NSArray *oldEntries = [self entriesWithModelIDs:@[@"a", @"b", @"c", @"d"]];
+    NSArray *newEntries = [self entriesWithModelIDs:@[@"d", @"a", @"b", @"c"]];
+    
+    // when
+    AFAListDiffModel *diff = [self diffFromEntries:oldEntries
+                                         toEntries:newEntries];
+    
+    // then
+    XCTAssertEqual(diff.movedIndexPaths.count, 1);
+    XCTAssertEqual([diff.movedIndexPaths.firstObject[0] row], 3);
+    XCTAssertEqual([diff.movedIndexPaths.firstObject[1] row], 0);
+    XCTAssertEqual(diff.deletedIndexPaths.count, 0);
+    XCTAssertEqual(diff.insertedIndexPaths.count, 0);
+}
+
+- (void)testThatItReloadsChangedEntriesThatKeepTheirPlace {
+    // given
+    NSArray *oldEntries = [self entriesWithModelIDs:@[@"a", @"b", @"c"]];
+    NSArray *newEntries = @[oldEntries[0],
+                            [AFAListDiffModelTestEntry entryWithModelID:@"b"
+                                                                   name:@"renamed"],
+                            oldEntries[2]];
+    
+    // when
+    AFAListDiffModel *diff = [self diffFromEntries:oldEntries
+                                         toEntries:newEntries];
+    
+    // then
+    XCTAssertEqualObjects([self rowsForIndexPaths:diff.reloadedIndexPaths], (@[@1]));
+    XCTAssertEqual(diff.deletedIndexPaths.count, 0);
+    XCTAssertEqual(diff.insertedIndexPaths.count, 0);
+    XCTAssertEqual(diff.movedIndexPaths.count, 0);
+}
+
+- (void)testThatMovedAndChangedEntriesAreDeletedAndInserted {
+    // given
+    NSArray *oldEntries = [self entriesWithModelIDs:@[@"a", @"b", @"c", @"d"]];
+    NSArray *newEntries = @[[AFAListDiffModelTestEntry entryWithModelID:@"d"
+                                                                   name:@"renamed"],
+                            oldEntries[0],
+                            oldEntries[1],
+                            oldEntries[2]];
+    
+    // when
+    AFAListDiffModel *diff = [self diffFromEntries:oldEntries
+                                         toEntries:newEntries];
+    
+    // then
+    XCTAssertEqualObjects([self rowsForIndexPaths:diff.deletedIndexPaths], (@[@3]));
+    XCTAssertEqualObjects([self rowsForIndexPaths:diff.insertedIndexPaths], (@[@0]));
+    XCTAssertEqual(diff.reloadedIndexPaths.count, 0);
+    XCTAssertEqual(diff.movedIndexPaths.count, 0);
+}
+
+- (void)testThatApplyingAMixedDiffToTheOldListYieldsTheNewList {
+    // given
+    NSArray *oldEntries = [self entriesWithModelIDs:@[@"a", @"b", @"c", @"d", @"e", @"f", @"g"]];
+    NSArray *newEntries = @[oldEntries[4],
+                            [AFAListDiffModelTestEntry entryWithModelID:@"x"
+                                                                   name:@"x"],
+                            oldEntries[0],
+                            [AFAListDiffModelTestEntry entryWithModelID:@"c"
+                                                                   name:@"renamed"],
+                            [AFAListDiffModelTestEntry entryWithModelID:@"g"
+                                                                   name:@"renamed"],
+                            oldEntries[3],
+                            oldEntries[1]];
+    
+    // when
+    AFAListDiffModel *diff = [self diffFromEntries:oldEntries
+                                         toEntries:newEntries];
+    
+    // then
+    XCTAssertTrue(diff.hasChanges);
+    XCTAssertFalse(diff.requiresFullReload);
+    XCTAssertEqualObjects([self entriesByApplyingDiff:diff
+                                            toEntries:oldEntries
+                                         usingEntries:newEntries], newEntries);
+}
+
+- (void)testThatApplyingDiffsOfShuffledListsYieldsTheNewLists {
+    srand48(2018);
+    
+    for (NSUInteger iteration = 0; iteration < kAFAListDiffModelTestShuffleCount; iteration++) {
+        // given
+        NSArray *oldEntries = [self randomEntriesFromEntries:@[]];
+        NSArray *newEntries = [self randomEntriesFromEntries:oldEntries];
+        
+        // when
+        AFAListDiffModel *diff = [self diffFromEntries:oldEntries
+                                             toEntries:newEntries];
+        
+        // then
+        XCTAssertEqual(diff.oldEntriesCount, oldEntries.count);
+        XCTAssertEqualObjects([self entriesByApplyingDiff:diff
+                                                toEntries:oldEntries
+                                             usingEntries:newEntries], newEntries);
+    }
+}
+
+- (void)testThatIdenticalListsHaveNoChanges {
+    // given
+    NSArray *entries = [self entriesWithModelIDs:@[@"a", @"b", @"c"]];
+    
+    // when
+    AFAListDiffModel *diff = [self diffFromEntries:entries
+                                         toEntries:[entries copy]];
+    
+    // then
+    XCTAssertFalse(diff.hasChanges);
+}
+
+- (void)testThatListsWithDuplicateOrMissingModelIDsRequireAFullReload {
+    // given
+    NSArray *oldEntries = [self entriesWithModelIDs:@[@"a", @"b"]];
+    NSArray *duplicateEntries = [self entriesWithModelIDs:@[@"a", @"b", @"a"]];
+    NSArray *anonymousEntries = @[oldEntries[0],
+                                  [AFAListDiffModelTestEntry entryWithModelID:nil
+                                                                         name:@"anonymous"]];
+    
+    // then
+    XCTAssertTrue([self diffFromEntries:oldEntries
+                              toEntries:duplicateEntries].requiresFullReload);
+    XCTAssertTrue([self diffFromEntries:oldEntries
+                              toEntries:anonymousEntries].requiresFullReload);
+}
+
+
+#pragma mark -
+#pragma mark Utils
+
+- (AFAListDiffModel *)diffFromEntries:(NSArray *)oldEntries
+                            toEntries:(NSArray *)newEntries {
+    return [AFAListDiffModel diffFromEntries:oldEntries
+                                   toEntries:newEntries
+                                   inSection:0];
+}
+
+- (NSArray *)entriesWithModelIDs:(NSArray *)modelIDs {
+    NSMutableArray *entries = [NSMutableArray array];
+    for (NSString *modelID in modelIDs) {
+        [entries addObject:[AFAListDiffModelTestEntry entryWithModelID:modelID
+                                                                  name:modelID]];
+    }
+    
+    return entries;
+}
+
+- (NSArray *)rowsForIndexPaths:(NSArray *)indexPaths {
+    NSMutableArray *rows = [NSMutableArray array];
+    for (NSIndexPath *indexPath in indexPaths) {
+        [rows addObject:@(indexPath.row)];
+    }
+    
+    return [rows sortedArrayUsingSelector:@selector(compare:)];
+}
+
+- (NSArray *)randomEntriesFromEntries:(NSArray *)entries {
+    // Drops, renames and shuffles some of the passed entries and adds new ones
+    NSMutableArray *randomEntries = [NSMutableArray array];
+    for (AFAListDiffModelTestEntry *entry in entries) {
+        double dice = drand48();
+        if (dice < .2f) {
+            continue;
+        } else if (dice < .35f) {
+            [randomEntries addObject:[AFAListDiffModelTestEntry entryWithModelID:entry.modelID
+                                                                            name:[entry.name stringByAppendingString:@"'"]]];
+        } else {
+            [randomEntries addObject:entry];
+        }
+    }
+    
+    NSUInteger insertionCount = 1 + (NSUInteger)(drand48() * 20);
+    for (NSUInteger idx = 0; idx < insertionCount; idx++) {
+        NSString *modelID = [[NSUUID UUID] UUIDString];
+        [randomEntries insertObject:[AFAListDiffModelTestEntry entryWithModelID:modelID
+                                                                           name:modelID]
+                            atIndex:(NSUInteger)(drand48() * (randomEntries.count + 1))];
+    }
+    
+    NSUInteger swapCount = (NSUInteger)(drand48() * 5);
+    for (NSUInteger idx = 0; idx < swapCount; idx++) {
+        [randomEntries exchangeObjectAtIndex:(NSUInteger)(drand48() * randomEntries.count)
+                           withObjectAtIndex:(NSUInteger)(drand48() * randomEntries.count)];
+    }
+    
+    return randomEntries;
+}
+
+// Replays the diff the way UITableView batch updates do: deleted, reloaded and
+// moved from index paths refer to the old list, inserted and moved to index paths
+// to the new one and the remaining rows keep their relative order
+- (NSArray *)entriesByApplyingDiff:(AFAListDiffModel *)diff
+                         toEntries:(NSArray *)oldEntries
+                      usingEntries:(NSArray *)newEntries {
+    NSMutableIndexSet *removedOldIndexes = [NSMutableIndexSet indexSet];
+    NSMutableIndexSet *reloadedOldIndexes = [NSMutableIndexSet indexSet];
+    for (NSIndexPath *indexPath in diff.deletedIndexPaths) {
+        XCTAssertFalse([removedOldIndexes containsIndex:indexPath.row]);
+        [removedOldIndexes addIndex:indexPath.row];
+    }
+    for (NSIndexPath *indexPath in diff.reloadedIndexPaths) {
+        [reloadedOldIndexes addIndex:indexPath.row];
+    }
+    
+    NSUInteger newEntriesCount = oldEntries.count - diff.deletedIndexPaths.count + diff.insertedIndexPaths.count;
+    XCTAssertEqual(newEntriesCount, newEntries.count);
+    
+    NSMutableArray *entries = [NSMutableArray array];
+    for (NSUInteger idx = 0; idx < newEntriesCount; idx++) {
+        [entries addObject:[NSNull null]];
+    }
+    
+    for (NSIndexPath *indexPath in diff.insertedIndexPaths) {
+        XCTAssertEqual(entries[indexPath.row], [NSNull null]);
+        entries[indexPath.row] = newEntries[indexPath.row];
+    }
+    
+    for (NSArray *movedIndexPaths in diff.movedIndexPaths) {
+        NSIndexPath *fromIndexPath = movedIndexPaths[0];
+        NSIndexPath *toIndexPath = movedIndexPaths[1];
+        XCTAssertFalse([removedOldIndexes containsIndex:fromIndexPath.row]);
+        XCTAssertEqual(entries[toIndexPath.row], [NSNull null]);
+        
+        [removedOldIndexes addIndex:fromIndexPath.row];
+        entries[toIndexPath.row] = oldEntries[fromIndexPath.row];
+    }
+    
+    NSUInteger newIdx = 0;
+    for (NSUInteger oldIdx = 0; oldIdx < oldEntries.count; oldIdx++) {
+        if ([removedOldIndexes containsIndex:oldIdx]) {
+            continue;
+        }
+        
+        while (newIdx < entries.count && entries[newIdx] != [NSNull null]) {
+            newIdx++;
+        }
+        XCTAssertLessThan(newIdx, entries.count);
+        
+        // Reloaded rows are configured again with the entry now at their position,
+        // which must still be the same model
+        if ([reloadedOldIndexes containsIndex:oldIdx]) {
+            XCTAssertEqualObjects([newEntries[newIdx] modelID], [oldEntries[oldIdx] modelID]);
+            entries[newIdx] = newEntries[newIdx];
+        } else {
+            entries[newIdx] = oldEntries[oldIdx];
+        }
+        newIdx++;
+    }
+    
+    return entries;
+}
+
+@end